@@ -0,0 +1,1319 @@
+
+_allocbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  int i, n, t0, t1;
+
+  n = argc > 1 ? atoi(argv[1]) : 2;
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  n = argc > 1 ? atoi(argv[1]) : 2;
+  1a:	7e 39                	jle    55 <main+0x55>
+  1c:	83 ec 0c             	sub    $0xc,%esp
+  1f:	ff 70 04             	push   0x4(%eax)
+  22:	e8 d9 02 00 00       	call   300 <atoi>
+  if(n < 1){
+  27:	83 c4 10             	add    $0x10,%esp
+  n = argc > 1 ? atoi(argv[1]) : 2;
+  2a:	89 c6                	mov    %eax,%esi
+  if(n < 1){
+  2c:	85 c0                	test   %eax,%eax
+  2e:	7e 79                	jle    a9 <main+0xa9>
+    printf(2, "usage: allocbench [nworkers]\n");
+    exit();
+  }
+
+  t0 = uptime();
+  30:	e8 22 04 00 00       	call   457 <uptime>
+  35:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++){
+  37:	31 db                	xor    %ebx,%ebx
+  39:	eb 0c                	jmp    47 <main+0x47>
+  3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  3f:	90                   	nop
+  40:	83 c3 01             	add    $0x1,%ebx
+  43:	39 f3                	cmp    %esi,%ebx
+  45:	74 1c                	je     63 <main+0x63>
+    if(fork() == 0)
+  47:	e8 6b 03 00 00       	call   3b7 <fork>
+  4c:	85 c0                	test   %eax,%eax
+  4e:	75 f0                	jne    40 <main+0x40>
+      worker();
+  50:	e8 6b 00 00 00       	call   c0 <worker>
+  t0 = uptime();
+  55:	e8 fd 03 00 00       	call   457 <uptime>
+  n = argc > 1 ? atoi(argv[1]) : 2;
+  5a:	be 02 00 00 00       	mov    $0x2,%esi
+  t0 = uptime();
+  5f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++){
+  61:	eb d4                	jmp    37 <main+0x37>
+  }
+  for(i = 0; i < n; i++)
+  63:	31 db                	xor    %ebx,%ebx
+  65:	8d 76 00             	lea    0x0(%esi),%esi
+    wait();
+  68:	e8 5a 03 00 00       	call   3c7 <wait>
+  for(i = 0; i < n; i++)
+  6d:	83 c3 01             	add    $0x1,%ebx
+  70:	39 f3                	cmp    %esi,%ebx
+  72:	75 f4                	jne    68 <main+0x68>
+  t1 = uptime();
+  74:	e8 de 03 00 00       	call   457 <uptime>
+  79:	89 c1                	mov    %eax,%ecx
+
+  if(t1 == t0)
+  7b:	39 f8                	cmp    %edi,%eax
+  7d:	75 03                	jne    82 <main+0x82>
+    t1 = t0 + 1;
+  7f:	8d 4f 01             	lea    0x1(%edi),%ecx
+  printf(1, "allocbench: %d workers, %d pages in %d ticks, %d pages/tick\n",
+         n, n*NPAGES*NROUNDS, t1 - t0, n*NPAGES*NROUNDS / (t1 - t0));
+  82:	69 de 00 32 00 00    	imul   $0x3200,%esi,%ebx
+  printf(1, "allocbench: %d workers, %d pages in %d ticks, %d pages/tick\n",
+  88:	50                   	push   %eax
+         n, n*NPAGES*NROUNDS, t1 - t0, n*NPAGES*NROUNDS / (t1 - t0));
+  89:	29 f9                	sub    %edi,%ecx
+  printf(1, "allocbench: %d workers, %d pages in %d ticks, %d pages/tick\n",
+  8b:	50                   	push   %eax
+  8c:	89 d8                	mov    %ebx,%eax
+  8e:	99                   	cltd
+  8f:	f7 f9                	idiv   %ecx
+  91:	50                   	push   %eax
+  92:	51                   	push   %ecx
+  93:	53                   	push   %ebx
+  94:	56                   	push   %esi
+  95:	68 90 08 00 00       	push   $0x890
+  9a:	6a 01                	push   $0x1
+  9c:	e8 8f 04 00 00       	call   530 <printf>
+  exit();
+  a1:	83 c4 20             	add    $0x20,%esp
+  a4:	e8 16 03 00 00       	call   3bf <exit>
+    printf(2, "usage: allocbench [nworkers]\n");
+  a9:	52                   	push   %edx
+  aa:	52                   	push   %edx
+  ab:	68 71 08 00 00       	push   $0x871
+  b0:	6a 02                	push   $0x2
+  b2:	e8 79 04 00 00       	call   530 <printf>
+    exit();
+  b7:	e8 03 03 00 00       	call   3bf <exit>
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <worker>:
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	53                   	push   %ebx
+  for(r = 0; r < NROUNDS; r++){
+  c4:	31 db                	xor    %ebx,%ebx
+{
+  c6:	83 ec 04             	sub    $0x4,%esp
+  c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((p = sbrk(NPAGES*4096)) == (char*)-1){
+  d0:	83 ec 0c             	sub    $0xc,%esp
+  d3:	68 00 00 04 00       	push   $0x40000
+  d8:	e8 6a 03 00 00       	call   447 <sbrk>
+  dd:	83 c4 10             	add    $0x10,%esp
+  e0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  e3:	74 36                	je     11b <worker+0x5b>
+      p[i*4096] = r;
+  e5:	89 d9                	mov    %ebx,%ecx
+  e7:	8d 90 00 00 04 00    	lea    0x40000(%eax),%edx
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  f0:	88 08                	mov    %cl,(%eax)
+    for(i = 0; i < NPAGES; i++)
+  f2:	05 00 10 00 00       	add    $0x1000,%eax
+  f7:	39 d0                	cmp    %edx,%eax
+  f9:	75 f5                	jne    f0 <worker+0x30>
+    sbrk(-NPAGES*4096);
+  fb:	83 ec 0c             	sub    $0xc,%esp
+  for(r = 0; r < NROUNDS; r++){
+  fe:	83 c3 01             	add    $0x1,%ebx
+    sbrk(-NPAGES*4096);
+ 101:	68 00 00 fc ff       	push   $0xfffc0000
+ 106:	e8 3c 03 00 00       	call   447 <sbrk>
+  for(r = 0; r < NROUNDS; r++){
+ 10b:	83 c4 10             	add    $0x10,%esp
+ 10e:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+ 114:	75 ba                	jne    d0 <worker+0x10>
+  exit();
+ 116:	e8 a4 02 00 00       	call   3bf <exit>
+      printf(1, "allocbench: sbrk failed\n");
+ 11b:	83 ec 08             	sub    $0x8,%esp
+ 11e:	68 58 08 00 00       	push   $0x858
+ 123:	6a 01                	push   $0x1
+ 125:	e8 06 04 00 00       	call   530 <printf>
+      exit();
+ 12a:	e8 90 02 00 00       	call   3bf <exit>
+ 12f:	90                   	nop
+
+00000130 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 130:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 131:	31 c0                	xor    %eax,%eax
+{
+ 133:	89 e5                	mov    %esp,%ebp
+ 135:	53                   	push   %ebx
+ 136:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 139:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 140:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 144:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 147:	83 c0 01             	add    $0x1,%eax
+ 14a:	84 d2                	test   %dl,%dl
+ 14c:	75 f2                	jne    140 <strcpy+0x10>
+    ;
+  return os;
+}
+ 14e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 151:	89 c8                	mov    %ecx,%eax
+ 153:	c9                   	leave
+ 154:	c3                   	ret
+ 155:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	53                   	push   %ebx
+ 164:	8b 55 08             	mov    0x8(%ebp),%edx
+ 167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 16a:	0f b6 02             	movzbl (%edx),%eax
+ 16d:	84 c0                	test   %al,%al
+ 16f:	75 17                	jne    188 <strcmp+0x28>
+ 171:	eb 3a                	jmp    1ad <strcmp+0x4d>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 17c:	83 c2 01             	add    $0x1,%edx
+ 17f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 182:	84 c0                	test   %al,%al
+ 184:	74 1a                	je     1a0 <strcmp+0x40>
+    p++, q++;
+ 186:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 188:	0f b6 19             	movzbl (%ecx),%ebx
+ 18b:	38 c3                	cmp    %al,%bl
+ 18d:	74 e9                	je     178 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 18f:	29 d8                	sub    %ebx,%eax
+}
+ 191:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 194:	c9                   	leave
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1a4:	31 c0                	xor    %eax,%eax
+ 1a6:	29 d8                	sub    %ebx,%eax
+}
+ 1a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1ab:	c9                   	leave
+ 1ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 1b0:	31 c0                	xor    %eax,%eax
+ 1b2:	eb db                	jmp    18f <strcmp+0x2f>
+ 1b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+
+000001c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1c9:	74 15                	je     1e0 <strlen+0x20>
+ 1cb:	31 c0                	xor    %eax,%eax
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1d0:	83 c0 01             	add    $0x1,%eax
+ 1d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1d7:	89 c1                	mov    %eax,%ecx
+ 1d9:	75 f5                	jne    1d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1db:	89 c8                	mov    %ecx,%eax
+ 1dd:	5d                   	pop    %ebp
+ 1de:	c3                   	ret
+ 1df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1e0:	31 c9                	xor    %ecx,%ecx
+}
+ 1e2:	5d                   	pop    %ebp
+ 1e3:	89 c8                	mov    %ecx,%eax
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fd:	89 d7                	mov    %edx,%edi
+ 1ff:	fc                   	cld
+ 200:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 202:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 205:	89 d0                	mov    %edx,%eax
+ 207:	c9                   	leave
+ 208:	c3                   	ret
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 21a:	0f b6 10             	movzbl (%eax),%edx
+ 21d:	84 d2                	test   %dl,%dl
+ 21f:	75 12                	jne    233 <strchr+0x23>
+ 221:	eb 1d                	jmp    240 <strchr+0x30>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 22c:	83 c0 01             	add    $0x1,%eax
+ 22f:	84 d2                	test   %dl,%dl
+ 231:	74 0d                	je     240 <strchr+0x30>
+    if(*s == c)
+ 233:	38 d1                	cmp    %dl,%cl
+ 235:	75 f1                	jne    228 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 237:	5d                   	pop    %ebp
+ 238:	c3                   	ret
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 240:	31 c0                	xor    %eax,%eax
+}
+ 242:	5d                   	pop    %ebp
+ 243:	c3                   	ret
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 255:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 258:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 259:	31 db                	xor    %ebx,%ebx
+{
+ 25b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 25e:	eb 2b                	jmp    28b <gets+0x3b>
+    cc = read(0, &c, 1);
+ 260:	83 ec 04             	sub    $0x4,%esp
+ 263:	6a 01                	push   $0x1
+ 265:	56                   	push   %esi
+ 266:	6a 00                	push   $0x0
+ 268:	e8 6a 01 00 00       	call   3d7 <read>
+    if(cc < 1)
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	85 c0                	test   %eax,%eax
+ 272:	7e 21                	jle    295 <gets+0x45>
+      break;
+    buf[i++] = c;
+ 274:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(c == '\n' || c == '\r' || c == '\t')
+ 27b:	8d 48 f7             	lea    -0x9(%eax),%ecx
+    buf[i++] = c;
+ 27e:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r' || c == '\t')
+ 282:	80 f9 01             	cmp    $0x1,%cl
+ 285:	76 10                	jbe    297 <gets+0x47>
+ 287:	3c 0d                	cmp    $0xd,%al
+ 289:	74 0c                	je     297 <gets+0x47>
+  for(i=0; i+1 < max; ){
+ 28b:	89 df                	mov    %ebx,%edi
+ 28d:	83 c3 01             	add    $0x1,%ebx
+ 290:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 293:	7c cb                	jl     260 <gets+0x10>
+ 295:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 297:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29a:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 29e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2a1:	5b                   	pop    %ebx
+ 2a2:	5e                   	pop    %esi
+ 2a3:	5f                   	pop    %edi
+ 2a4:	5d                   	pop    %ebp
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	56                   	push   %esi
+ 2b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2b5:	83 ec 08             	sub    $0x8,%esp
+ 2b8:	6a 00                	push   $0x0
+ 2ba:	ff 75 08             	push   0x8(%ebp)
+ 2bd:	e8 3d 01 00 00       	call   3ff <open>
+  if(fd < 0)
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	85 c0                	test   %eax,%eax
+ 2c7:	78 27                	js     2f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2c9:	83 ec 08             	sub    $0x8,%esp
+ 2cc:	ff 75 0c             	push   0xc(%ebp)
+ 2cf:	89 c3                	mov    %eax,%ebx
+ 2d1:	50                   	push   %eax
+ 2d2:	e8 40 01 00 00       	call   417 <fstat>
+  close(fd);
+ 2d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2dc:	e8 06 01 00 00       	call   3e7 <close>
+  return r;
+ 2e1:	83 c4 10             	add    $0x10,%esp
+}
+ 2e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2e7:	89 f0                	mov    %esi,%eax
+ 2e9:	5b                   	pop    %ebx
+ 2ea:	5e                   	pop    %esi
+ 2eb:	5d                   	pop    %ebp
+ 2ec:	c3                   	ret
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2f5:	eb ed                	jmp    2e4 <stat+0x34>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 307:	0f be 02             	movsbl (%edx),%eax
+ 30a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 30d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 310:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 315:	77 1e                	ja     335 <atoi+0x35>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 320:	83 c2 01             	add    $0x1,%edx
+ 323:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 326:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 32a:	0f be 02             	movsbl (%edx),%eax
+ 32d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 330:	80 fb 09             	cmp    $0x9,%bl
+ 333:	76 eb                	jbe    320 <atoi+0x20>
+  return n;
+}
+ 335:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 338:	89 c8                	mov    %ecx,%eax
+ 33a:	c9                   	leave
+ 33b:	c3                   	ret
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	8b 45 10             	mov    0x10(%ebp),%eax
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 34e:	85 c0                	test   %eax,%eax
+ 350:	7e 13                	jle    365 <memmove+0x25>
+ 352:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 354:	89 d7                	mov    %edx,%edi
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 360:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 361:	39 f8                	cmp    %edi,%eax
+ 363:	75 fb                	jne    360 <memmove+0x20>
+  return vdst;
+}
+ 365:	5e                   	pop    %esi
+ 366:	89 d0                	mov    %edx,%eax
+ 368:	5f                   	pop    %edi
+ 369:	5d                   	pop    %ebp
+ 36a:	c3                   	ret
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <strncmp>:
+
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 10             	mov    0x10(%ebp),%edx
+ 377:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+ 37d:	85 d2                	test   %edx,%edx
+ 37f:	75 16                	jne    397 <strncmp+0x27>
+ 381:	eb 2d                	jmp    3b0 <strncmp+0x40>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	3a 19                	cmp    (%ecx),%bl
+ 38a:	75 12                	jne    39e <strncmp+0x2e>
+    n--, p++, q++;
+ 38c:	83 c0 01             	add    $0x1,%eax
+ 38f:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+ 392:	83 ea 01             	sub    $0x1,%edx
+ 395:	74 19                	je     3b0 <strncmp+0x40>
+ 397:	0f b6 18             	movzbl (%eax),%ebx
+ 39a:	84 db                	test   %bl,%bl
+ 39c:	75 ea                	jne    388 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+ 39e:	0f b6 00             	movzbl (%eax),%eax
+ 3a1:	0f b6 11             	movzbl (%ecx),%edx
+ 3a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a7:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+ 3a8:	29 d0                	sub    %edx,%eax
+ 3aa:	c3                   	ret
+ 3ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+ 3b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+ 3b3:	31 c0                	xor    %eax,%eax
+ 3b5:	c9                   	leave
+ 3b6:	c3                   	ret
+
+000003b7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3b7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <exit>:
+SYSCALL(exit)
+ 3bf:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c4:	cd 40                	int    $0x40
+ 3c6:	c3                   	ret
+
+000003c7 <wait>:
+SYSCALL(wait)
+ 3c7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3cc:	cd 40                	int    $0x40
+ 3ce:	c3                   	ret
+
+000003cf <pipe>:
+SYSCALL(pipe)
+ 3cf:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d4:	cd 40                	int    $0x40
+ 3d6:	c3                   	ret
+
+000003d7 <read>:
+SYSCALL(read)
+ 3d7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3dc:	cd 40                	int    $0x40
+ 3de:	c3                   	ret
+
+000003df <write>:
+SYSCALL(write)
+ 3df:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e4:	cd 40                	int    $0x40
+ 3e6:	c3                   	ret
+
+000003e7 <close>:
+SYSCALL(close)
+ 3e7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ec:	cd 40                	int    $0x40
+ 3ee:	c3                   	ret
+
+000003ef <kill>:
+SYSCALL(kill)
+ 3ef:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3f4:	cd 40                	int    $0x40
+ 3f6:	c3                   	ret
+
+000003f7 <exec>:
+SYSCALL(exec)
+ 3f7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3fc:	cd 40                	int    $0x40
+ 3fe:	c3                   	ret
+
+000003ff <open>:
+SYSCALL(open)
+ 3ff:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 404:	cd 40                	int    $0x40
+ 406:	c3                   	ret
+
+00000407 <mknod>:
+SYSCALL(mknod)
+ 407:	b8 11 00 00 00       	mov    $0x11,%eax
+ 40c:	cd 40                	int    $0x40
+ 40e:	c3                   	ret
+
+0000040f <unlink>:
+SYSCALL(unlink)
+ 40f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 414:	cd 40                	int    $0x40
+ 416:	c3                   	ret
+
+00000417 <fstat>:
+SYSCALL(fstat)
+ 417:	b8 08 00 00 00       	mov    $0x8,%eax
+ 41c:	cd 40                	int    $0x40
+ 41e:	c3                   	ret
+
+0000041f <link>:
+SYSCALL(link)
+ 41f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 424:	cd 40                	int    $0x40
+ 426:	c3                   	ret
+
+00000427 <mkdir>:
+SYSCALL(mkdir)
+ 427:	b8 14 00 00 00       	mov    $0x14,%eax
+ 42c:	cd 40                	int    $0x40
+ 42e:	c3                   	ret
+
+0000042f <chdir>:
+SYSCALL(chdir)
+ 42f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 434:	cd 40                	int    $0x40
+ 436:	c3                   	ret
+
+00000437 <dup>:
+SYSCALL(dup)
+ 437:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 43c:	cd 40                	int    $0x40
+ 43e:	c3                   	ret
+
+0000043f <getpid>:
+SYSCALL(getpid)
+ 43f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 444:	cd 40                	int    $0x40
+ 446:	c3                   	ret
+
+00000447 <sbrk>:
+SYSCALL(sbrk)
+ 447:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 44c:	cd 40                	int    $0x40
+ 44e:	c3                   	ret
+
+0000044f <sleep>:
+SYSCALL(sleep)
+ 44f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 454:	cd 40                	int    $0x40
+ 456:	c3                   	ret
+
+00000457 <uptime>:
+SYSCALL(uptime)
+ 457:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 45c:	cd 40                	int    $0x40
+ 45e:	c3                   	ret
+
+0000045f <setsched>:
+SYSCALL(setsched)
+ 45f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 464:	cd 40                	int    $0x40
+ 466:	c3                   	ret
+
+00000467 <memstat>:
+SYSCALL(memstat)
+ 467:	b8 17 00 00 00       	mov    $0x17,%eax
+ 46c:	cd 40                	int    $0x40
+ 46e:	c3                   	ret
+
+0000046f <lseek>:
+SYSCALL(lseek)
+ 46f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 474:	cd 40                	int    $0x40
+ 476:	c3                   	ret
+
+00000477 <setiosched>:
+SYSCALL(setiosched)
+ 477:	b8 19 00 00 00       	mov    $0x19,%eax
+ 47c:	cd 40                	int    $0x40
+ 47e:	c3                   	ret
+
+0000047f <iostat>:
+SYSCALL(iostat)
+ 47f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 484:	cd 40                	int    $0x40
+ 486:	c3                   	ret
+ 487:	66 90                	xchg   %ax,%ax
+ 489:	66 90                	xchg   %ax,%ax
+ 48b:	66 90                	xchg   %ax,%ax
+ 48d:	66 90                	xchg   %ax,%ax
+ 48f:	90                   	nop
+
+00000490 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 498:	89 d1                	mov    %edx,%ecx
+{
+ 49a:	83 ec 3c             	sub    $0x3c,%esp
+ 49d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4a0:	85 d2                	test   %edx,%edx
+ 4a2:	0f 89 80 00 00 00    	jns    528 <printint+0x98>
+ 4a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4ac:	74 7a                	je     528 <printint+0x98>
+    x = -xx;
+ 4ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4b8:	31 f6                	xor    %esi,%esi
+ 4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4c0:	89 c8                	mov    %ecx,%eax
+ 4c2:	31 d2                	xor    %edx,%edx
+ 4c4:	89 f7                	mov    %esi,%edi
+ 4c6:	f7 f3                	div    %ebx
+ 4c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4cb:	0f b6 92 2c 09 00 00 	movzbl 0x92c(%edx),%edx
+ 4d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4d6:	89 ca                	mov    %ecx,%edx
+ 4d8:	89 c1                	mov    %eax,%ecx
+ 4da:	39 da                	cmp    %ebx,%edx
+ 4dc:	73 e2                	jae    4c0 <printint+0x30>
+  if(neg)
+ 4de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4e1:	85 c0                	test   %eax,%eax
+ 4e3:	74 07                	je     4ec <printint+0x5c>
+    buf[i++] = '-';
+ 4e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4ea:	89 f7                	mov    %esi,%edi
+ 4ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4f2:	01 df                	add    %ebx,%edi
+ 4f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4fb:	83 ec 04             	sub    $0x4,%esp
+ 4fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 501:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 504:	6a 01                	push   $0x1
+ 506:	50                   	push   %eax
+ 507:	56                   	push   %esi
+ 508:	e8 d2 fe ff ff       	call   3df <write>
+  while(--i >= 0)
+ 50d:	89 f8                	mov    %edi,%eax
+ 50f:	83 c4 10             	add    $0x10,%esp
+ 512:	83 ef 01             	sub    $0x1,%edi
+ 515:	39 d8                	cmp    %ebx,%eax
+ 517:	75 df                	jne    4f8 <printint+0x68>
+}
+ 519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51c:	5b                   	pop    %ebx
+ 51d:	5e                   	pop    %esi
+ 51e:	5f                   	pop    %edi
+ 51f:	5d                   	pop    %ebp
+ 520:	c3                   	ret
+ 521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 528:	31 c0                	xor    %eax,%eax
+ 52a:	eb 89                	jmp    4b5 <printint+0x25>
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 539:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 53c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 53f:	0f b6 1e             	movzbl (%esi),%ebx
+ 542:	83 c6 01             	add    $0x1,%esi
+ 545:	84 db                	test   %bl,%bl
+ 547:	74 67                	je     5b0 <printf+0x80>
+ 549:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 54c:	31 d2                	xor    %edx,%edx
+ 54e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 551:	eb 34                	jmp    587 <printf+0x57>
+ 553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 557:	90                   	nop
+ 558:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 55b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 560:	83 f8 25             	cmp    $0x25,%eax
+ 563:	74 18                	je     57d <printf+0x4d>
+  write(fd, &c, 1);
+ 565:	83 ec 04             	sub    $0x4,%esp
+ 568:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 56b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 56e:	6a 01                	push   $0x1
+ 570:	50                   	push   %eax
+ 571:	57                   	push   %edi
+ 572:	e8 68 fe ff ff       	call   3df <write>
+ 577:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 57a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 57d:	0f b6 1e             	movzbl (%esi),%ebx
+ 580:	83 c6 01             	add    $0x1,%esi
+ 583:	84 db                	test   %bl,%bl
+ 585:	74 29                	je     5b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 587:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 58a:	85 d2                	test   %edx,%edx
+ 58c:	74 ca                	je     558 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 58e:	83 fa 25             	cmp    $0x25,%edx
+ 591:	75 ea                	jne    57d <printf+0x4d>
+      if(c == 'd'){
+ 593:	83 f8 25             	cmp    $0x25,%eax
+ 596:	0f 84 24 01 00 00    	je     6c0 <printf+0x190>
+ 59c:	83 e8 63             	sub    $0x63,%eax
+ 59f:	83 f8 15             	cmp    $0x15,%eax
+ 5a2:	77 1c                	ja     5c0 <printf+0x90>
+ 5a4:	ff 24 85 d4 08 00 00 	jmp    *0x8d4(,%eax,4)
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5b3:	5b                   	pop    %ebx
+ 5b4:	5e                   	pop    %esi
+ 5b5:	5f                   	pop    %edi
+ 5b6:	5d                   	pop    %ebp
+ 5b7:	c3                   	ret
+ 5b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+  write(fd, &c, 1);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5ca:	6a 01                	push   $0x1
+ 5cc:	52                   	push   %edx
+ 5cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5d0:	57                   	push   %edi
+ 5d1:	e8 09 fe ff ff       	call   3df <write>
+ 5d6:	83 c4 0c             	add    $0xc,%esp
+ 5d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5dc:	6a 01                	push   $0x1
+ 5de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5e1:	52                   	push   %edx
+ 5e2:	57                   	push   %edi
+ 5e3:	e8 f7 fd ff ff       	call   3df <write>
+        putc(fd, c);
+ 5e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5eb:	31 d2                	xor    %edx,%edx
+ 5ed:	eb 8e                	jmp    57d <printf+0x4d>
+ 5ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5f3:	83 ec 0c             	sub    $0xc,%esp
+ 5f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5fb:	8b 13                	mov    (%ebx),%edx
+ 5fd:	6a 00                	push   $0x0
+ 5ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 601:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 604:	e8 87 fe ff ff       	call   490 <printint>
+        ap++;
+ 609:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 60c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 60f:	31 d2                	xor    %edx,%edx
+ 611:	e9 67 ff ff ff       	jmp    57d <printf+0x4d>
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 620:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 623:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 625:	83 c0 04             	add    $0x4,%eax
+ 628:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 62b:	85 db                	test   %ebx,%ebx
+ 62d:	0f 84 9d 00 00 00    	je     6d0 <printf+0x1a0>
+        while(*s != 0){
+ 633:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 636:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 638:	84 c0                	test   %al,%al
+ 63a:	0f 84 3d ff ff ff    	je     57d <printf+0x4d>
+ 640:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 643:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 646:	89 de                	mov    %ebx,%esi
+ 648:	89 d3                	mov    %edx,%ebx
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 656:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 659:	6a 01                	push   $0x1
+ 65b:	53                   	push   %ebx
+ 65c:	57                   	push   %edi
+ 65d:	e8 7d fd ff ff       	call   3df <write>
+        while(*s != 0){
+ 662:	0f b6 06             	movzbl (%esi),%eax
+ 665:	83 c4 10             	add    $0x10,%esp
+ 668:	84 c0                	test   %al,%al
+ 66a:	75 e4                	jne    650 <printf+0x120>
+      state = 0;
+ 66c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 66f:	31 d2                	xor    %edx,%edx
+ 671:	e9 07 ff ff ff       	jmp    57d <printf+0x4d>
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 68b:	8b 13                	mov    (%ebx),%edx
+ 68d:	6a 01                	push   $0x1
+ 68f:	e9 6b ff ff ff       	jmp    5ff <printf+0xcf>
+ 694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 698:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 69b:	83 ec 04             	sub    $0x4,%esp
+ 69e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	52                   	push   %edx
+ 6ac:	57                   	push   %edi
+ 6ad:	e8 2d fd ff ff       	call   3df <write>
+        ap++;
+ 6b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6b8:	31 d2                	xor    %edx,%edx
+ 6ba:	e9 be fe ff ff       	jmp    57d <printf+0x4d>
+ 6bf:	90                   	nop
+  write(fd, &c, 1);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c9:	6a 01                	push   $0x1
+ 6cb:	e9 11 ff ff ff       	jmp    5e1 <printf+0xb1>
+ 6d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6d5:	bb cd 08 00 00       	mov    $0x8cd,%ebx
+ 6da:	e9 61 ff ff ff       	jmp    640 <printf+0x110>
+ 6df:	90                   	nop
+
+000006e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6e1:	a1 1c 0c 00 00       	mov    0xc1c,%eax
+{
+ 6e6:	89 e5                	mov    %esp,%ebp
+ 6e8:	57                   	push   %edi
+ 6e9:	56                   	push   %esi
+ 6ea:	53                   	push   %ebx
+ 6eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 6ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6fc:	39 ca                	cmp    %ecx,%edx
+ 6fe:	73 30                	jae    730 <free+0x50>
+ 700:	39 c1                	cmp    %eax,%ecx
+ 702:	72 04                	jb     708 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 704:	39 c2                	cmp    %eax,%edx
+ 706:	72 f0                	jb     6f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 708:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 70b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 70e:	39 f8                	cmp    %edi,%eax
+ 710:	74 2e                	je     740 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 712:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 715:	8b 42 04             	mov    0x4(%edx),%eax
+ 718:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 71b:	39 f1                	cmp    %esi,%ecx
+ 71d:	74 38                	je     757 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 71f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 721:	5b                   	pop    %ebx
+  freep = p;
+ 722:	89 15 1c 0c 00 00    	mov    %edx,0xc1c
+}
+ 728:	5e                   	pop    %esi
+ 729:	5f                   	pop    %edi
+ 72a:	5d                   	pop    %ebp
+ 72b:	c3                   	ret
+ 72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 730:	39 c1                	cmp    %eax,%ecx
+ 732:	72 d0                	jb     704 <free+0x24>
+ 734:	eb c2                	jmp    6f8 <free+0x18>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 740:	03 70 04             	add    0x4(%eax),%esi
+ 743:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 746:	8b 02                	mov    (%edx),%eax
+ 748:	8b 00                	mov    (%eax),%eax
+ 74a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 74d:	8b 42 04             	mov    0x4(%edx),%eax
+ 750:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 753:	39 f1                	cmp    %esi,%ecx
+ 755:	75 c8                	jne    71f <free+0x3f>
+    p->s.size += bp->s.size;
+ 757:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 75a:	89 15 1c 0c 00 00    	mov    %edx,0xc1c
+    p->s.size += bp->s.size;
+ 760:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 763:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 766:	89 0a                	mov    %ecx,(%edx)
+}
+ 768:	5b                   	pop    %ebx
+ 769:	5e                   	pop    %esi
+ 76a:	5f                   	pop    %edi
+ 76b:	5d                   	pop    %ebp
+ 76c:	c3                   	ret
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000770 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 779:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 77c:	8b 15 1c 0c 00 00    	mov    0xc1c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 782:	8d 78 07             	lea    0x7(%eax),%edi
+ 785:	c1 ef 03             	shr    $0x3,%edi
+ 788:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 78b:	85 d2                	test   %edx,%edx
+ 78d:	0f 84 8d 00 00 00    	je     820 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 793:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 795:	8b 48 04             	mov    0x4(%eax),%ecx
+ 798:	39 f9                	cmp    %edi,%ecx
+ 79a:	73 64                	jae    800 <malloc+0x90>
+  if(nu < 4096)
+ 79c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7a1:	39 df                	cmp    %ebx,%edi
+ 7a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7ad:	eb 0a                	jmp    7b9 <malloc+0x49>
+ 7af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7b2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7b5:	39 f9                	cmp    %edi,%ecx
+ 7b7:	73 47                	jae    800 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 7b9:	89 c2                	mov    %eax,%edx
+ 7bb:	39 05 1c 0c 00 00    	cmp    %eax,0xc1c
+ 7c1:	75 ed                	jne    7b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	56                   	push   %esi
+ 7c7:	e8 7b fc ff ff       	call   447 <sbrk>
+  if(p == (char*)-1)
+ 7cc:	83 c4 10             	add    $0x10,%esp
+ 7cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7d2:	74 1c                	je     7f0 <malloc+0x80>
+  hp->s.size = nu;
+ 7d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7d7:	83 ec 0c             	sub    $0xc,%esp
+ 7da:	83 c0 08             	add    $0x8,%eax
+ 7dd:	50                   	push   %eax
+ 7de:	e8 fd fe ff ff       	call   6e0 <free>
+  return freep;
+ 7e3:	8b 15 1c 0c 00 00    	mov    0xc1c,%edx
+      if((p = morecore(nunits)) == 0)
+ 7e9:	83 c4 10             	add    $0x10,%esp
+ 7ec:	85 d2                	test   %edx,%edx
+ 7ee:	75 c0                	jne    7b0 <malloc+0x40>
+        return 0;
+  }
+}
+ 7f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7f3:	31 c0                	xor    %eax,%eax
+}
+ 7f5:	5b                   	pop    %ebx
+ 7f6:	5e                   	pop    %esi
+ 7f7:	5f                   	pop    %edi
+ 7f8:	5d                   	pop    %ebp
+ 7f9:	c3                   	ret
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 800:	39 cf                	cmp    %ecx,%edi
+ 802:	74 4c                	je     850 <malloc+0xe0>
+        p->s.size -= nunits;
+ 804:	29 f9                	sub    %edi,%ecx
+ 806:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 809:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 80c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 80f:	89 15 1c 0c 00 00    	mov    %edx,0xc1c
+}
+ 815:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 818:	83 c0 08             	add    $0x8,%eax
+}
+ 81b:	5b                   	pop    %ebx
+ 81c:	5e                   	pop    %esi
+ 81d:	5f                   	pop    %edi
+ 81e:	5d                   	pop    %ebp
+ 81f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 820:	c7 05 1c 0c 00 00 20 	movl   $0xc20,0xc1c
+ 827:	0c 00 00 
+    base.s.size = 0;
+ 82a:	b8 20 0c 00 00       	mov    $0xc20,%eax
+    base.s.ptr = freep = prevp = &base;
+ 82f:	c7 05 20 0c 00 00 20 	movl   $0xc20,0xc20
+ 836:	0c 00 00 
+    base.s.size = 0;
+ 839:	c7 05 24 0c 00 00 00 	movl   $0x0,0xc24
+ 840:	00 00 00 
+    if(p->s.size >= nunits){
+ 843:	e9 54 ff ff ff       	jmp    79c <malloc+0x2c>
+ 848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 850:	8b 08                	mov    (%eax),%ecx
+ 852:	89 0a                	mov    %ecx,(%edx)
+ 854:	eb b9                	jmp    80f <malloc+0x9f>
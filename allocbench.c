@@ -0,0 +1,57 @@
+// Page allocator stress benchmark.
+// Forks nworkers processes that each repeatedly grow their heap,
+// touch every new page (so the kernel kalloc()s it) and shrink
+// it again (so the kernel kfree()s it).  Run it with different
+// CPUS= settings to see how pages/sec scales with CPU count.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NPAGES  64   // pages allocated per round
+#define NROUNDS 200  // rounds per worker
+
+void
+worker(void)
+{
+  char *p;
+  int i, r;
+
+  for(r = 0; r < NROUNDS; r++){
+    if((p = sbrk(NPAGES*4096)) == (char*)-1){
+      printf(1, "allocbench: sbrk failed\n");
+      exit();
+    }
+    for(i = 0; i < NPAGES; i++)
+      p[i*4096] = r;
+    sbrk(-NPAGES*4096);
+  }
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, t0, t1;
+
+  n = argc > 1 ? atoi(argv[1]) : 2;
+  if(n < 1){
+    printf(2, "usage: allocbench [nworkers]\n");
+    exit();
+  }
+
+  t0 = uptime();
+  for(i = 0; i < n; i++){
+    if(fork() == 0)
+      worker();
+  }
+  for(i = 0; i < n; i++)
+    wait();
+  t1 = uptime();
+
+  if(t1 == t0)
+    t1 = t0 + 1;
+  printf(1, "allocbench: %d workers, %d pages in %d ticks, %d pages/tick\n",
+         n, n*NPAGES*NROUNDS, t1 - t0, n*NPAGES*NROUNDS / (t1 - t0));
+  exit();
+}
@@ -0,0 +1,2097 @@
+
+_bigbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	b8 01 00 00 00       	mov    $0x1,%eax
+       c:	ff 71 fc             	push   -0x4(%ecx)
+       f:	55                   	push   %ebp
+      10:	89 e5                	mov    %esp,%ebp
+      12:	51                   	push   %ecx
+      13:	83 ec 04             	sub    $0x4,%esp
+  int mb;
+
+  mb = argc > 1 ? atoi(argv[1]) : 1;
+      16:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      19:	8b 51 04             	mov    0x4(%ecx),%edx
+  mb = argc > 1 ? atoi(argv[1]) : 1;
+      1c:	7f 16                	jg     34 <main+0x34>
+  if(mb < 1 || mb > MAXFILE/2048){
+    printf(2, "usage: bigbench [megabytes]\n");
+    exit();
+  }
+  bigfile(mb*2048);
+      1e:	83 ec 0c             	sub    $0xc,%esp
+      21:	c1 e0 0b             	shl    $0xb,%eax
+      24:	50                   	push   %eax
+      25:	e8 76 01 00 00       	call   1a0 <bigfile>
+  smallfiles();
+      2a:	e8 21 05 00 00       	call   550 <smallfiles>
+  exit();
+      2f:	e8 4b 0b 00 00       	call   b7f <exit>
+  mb = argc > 1 ? atoi(argv[1]) : 1;
+      34:	83 ec 0c             	sub    $0xc,%esp
+      37:	ff 72 04             	push   0x4(%edx)
+      3a:	e8 81 0a 00 00       	call   ac0 <atoi>
+  if(mb < 1 || mb > MAXFILE/2048){
+      3f:	83 c4 10             	add    $0x10,%esp
+      42:	8d 50 ff             	lea    -0x1(%eax),%edx
+      45:	81 fa 07 04 00 00    	cmp    $0x407,%edx
+      4b:	76 d1                	jbe    1e <main+0x1e>
+    printf(2, "usage: bigbench [megabytes]\n");
+      4d:	50                   	push   %eax
+      4e:	50                   	push   %eax
+      4f:	68 eb 10 00 00       	push   $0x10eb
+      54:	6a 02                	push   $0x2
+      56:	e8 95 0c 00 00       	call   cf0 <printf>
+    exit();
+      5b:	e8 1f 0b 00 00       	call   b7f <exit>
+
+00000060 <openorfail.part.0>:
+openorfail(char *name, int mode)
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	83 ec 0c             	sub    $0xc,%esp
+    printf(2, "bigbench: cannot open %s\n", name);
+      66:	50                   	push   %eax
+      67:	68 18 10 00 00       	push   $0x1018
+      6c:	6a 02                	push   $0x2
+      6e:	e8 7d 0c 00 00       	call   cf0 <printf>
+    exit();
+      73:	e8 07 0b 00 00       	call   b7f <exit>
+      78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      7f:	90                   	nop
+
+00000080 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+      80:	69 05 a8 15 00 00 0d 	imul   $0x19660d,0x15a8,%eax
+      87:	66 19 00 
+      8a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+      8f:	a3 a8 15 00 00       	mov    %eax,0x15a8
+}
+      94:	c3                   	ret
+      95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <report>:
+{
+      a0:	55                   	push   %ebp
+      a1:	89 e5                	mov    %esp,%ebp
+      a3:	53                   	push   %ebx
+      a4:	83 ec 04             	sub    $0x4,%esp
+      a7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+      aa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+      ad:	89 d8                	mov    %ebx,%eax
+  if(t == 0)
+      af:	85 c9                	test   %ecx,%ecx
+      b1:	74 25                	je     d8 <report+0x38>
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+      b3:	99                   	cltd
+      b4:	f7 f9                	idiv   %ecx
+      b6:	83 ec 08             	sub    $0x8,%esp
+      b9:	50                   	push   %eax
+      ba:	51                   	push   %ecx
+      bb:	53                   	push   %ebx
+      bc:	ff 75 08             	push   0x8(%ebp)
+      bf:	68 08 11 00 00       	push   $0x1108
+      c4:	6a 01                	push   $0x1
+      c6:	e8 25 0c 00 00       	call   cf0 <printf>
+}
+      cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      ce:	83 c4 20             	add    $0x20,%esp
+      d1:	c9                   	leave
+      d2:	c3                   	ret
+      d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      d7:	90                   	nop
+    t = 1;
+      d8:	b9 01 00 00 00       	mov    $0x1,%ecx
+      dd:	eb d7                	jmp    b6 <report+0x16>
+      df:	90                   	nop
+
+000000e0 <openorfail>:
+{
+      e0:	55                   	push   %ebp
+      e1:	89 e5                	mov    %esp,%ebp
+      e3:	53                   	push   %ebx
+      e4:	83 ec 0c             	sub    $0xc,%esp
+      e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((fd = open(name, mode)) < 0){
+      ea:	ff 75 0c             	push   0xc(%ebp)
+      ed:	53                   	push   %ebx
+      ee:	e8 cc 0a 00 00       	call   bbf <open>
+      f3:	83 c4 10             	add    $0x10,%esp
+      f6:	85 c0                	test   %eax,%eax
+      f8:	78 05                	js     ff <openorfail+0x1f>
+}
+      fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      fd:	c9                   	leave
+      fe:	c3                   	ret
+      ff:	89 d8                	mov    %ebx,%eax
+     101:	e8 5a ff ff ff       	call   60 <openorfail.part.0>
+     106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     10d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000110 <xread>:
+{
+     110:	55                   	push   %ebp
+     111:	89 e5                	mov    %esp,%ebp
+     113:	83 ec 0c             	sub    $0xc,%esp
+  if(read(fd, buf, BSIZE) != BSIZE || ((int*)buf)[0] != i){
+     116:	68 00 02 00 00       	push   $0x200
+     11b:	68 c0 15 00 00       	push   $0x15c0
+     120:	ff 75 08             	push   0x8(%ebp)
+     123:	e8 6f 0a 00 00       	call   b97 <read>
+     128:	83 c4 10             	add    $0x10,%esp
+     12b:	3d 00 02 00 00       	cmp    $0x200,%eax
+     130:	75 0d                	jne    13f <xread+0x2f>
+     132:	8b 45 0c             	mov    0xc(%ebp),%eax
+     135:	39 05 c0 15 00 00    	cmp    %eax,0x15c0
+     13b:	75 02                	jne    13f <xread+0x2f>
+}
+     13d:	c9                   	leave
+     13e:	c3                   	ret
+    printf(2, "bigbench: bad block %d\n", i);
+     13f:	50                   	push   %eax
+     140:	ff 75 0c             	push   0xc(%ebp)
+     143:	68 32 10 00 00       	push   $0x1032
+     148:	6a 02                	push   $0x2
+     14a:	e8 a1 0b 00 00       	call   cf0 <printf>
+    exit();
+     14f:	e8 2b 0a 00 00       	call   b7f <exit>
+     154:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     15f:	90                   	nop
+
+00000160 <xwrite>:
+{
+     160:	55                   	push   %ebp
+     161:	89 e5                	mov    %esp,%ebp
+     163:	83 ec 0c             	sub    $0xc,%esp
+  ((int*)buf)[0] = i;
+     166:	8b 45 0c             	mov    0xc(%ebp),%eax
+     169:	a3 c0 15 00 00       	mov    %eax,0x15c0
+  if(write(fd, buf, BSIZE) != BSIZE){
+     16e:	68 00 02 00 00       	push   $0x200
+     173:	68 c0 15 00 00       	push   $0x15c0
+     178:	ff 75 08             	push   0x8(%ebp)
+     17b:	e8 1f 0a 00 00       	call   b9f <write>
+     180:	83 c4 10             	add    $0x10,%esp
+     183:	3d 00 02 00 00       	cmp    $0x200,%eax
+     188:	75 02                	jne    18c <xwrite+0x2c>
+}
+     18a:	c9                   	leave
+     18b:	c3                   	ret
+    printf(2, "bigbench: write failed, disk full?\n");
+     18c:	50                   	push   %eax
+     18d:	50                   	push   %eax
+     18e:	68 34 11 00 00       	push   $0x1134
+     193:	6a 02                	push   $0x2
+     195:	e8 56 0b 00 00       	call   cf0 <printf>
+    exit();
+     19a:	e8 e0 09 00 00       	call   b7f <exit>
+     19f:	90                   	nop
+
+000001a0 <bigfile>:
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	57                   	push   %edi
+     1a4:	56                   	push   %esi
+     1a5:	53                   	push   %ebx
+     1a6:	83 ec 1c             	sub    $0x1c,%esp
+     1a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  t = uptime();
+     1ac:	e8 66 0a 00 00       	call   c17 <uptime>
+  if((fd = open(name, mode)) < 0){
+     1b1:	83 ec 08             	sub    $0x8,%esp
+  t = uptime();
+     1b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((fd = open(name, mode)) < 0){
+     1b7:	68 02 02 00 00       	push   $0x202
+     1bc:	68 4a 10 00 00       	push   $0x104a
+     1c1:	e8 f9 09 00 00       	call   bbf <open>
+     1c6:	83 c4 10             	add    $0x10,%esp
+     1c9:	85 c0                	test   %eax,%eax
+     1cb:	0f 88 69 03 00 00    	js     53a <bigfile+0x39a>
+     1d1:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < nblocks; i++)
+     1d3:	31 ff                	xor    %edi,%edi
+     1d5:	85 db                	test   %ebx,%ebx
+     1d7:	7e 35                	jle    20e <bigfile+0x6e>
+     1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(write(fd, buf, BSIZE) != BSIZE){
+     1e0:	83 ec 04             	sub    $0x4,%esp
+  ((int*)buf)[0] = i;
+     1e3:	89 3d c0 15 00 00    	mov    %edi,0x15c0
+  if(write(fd, buf, BSIZE) != BSIZE){
+     1e9:	68 00 02 00 00       	push   $0x200
+     1ee:	68 c0 15 00 00       	push   $0x15c0
+     1f3:	56                   	push   %esi
+     1f4:	e8 a6 09 00 00       	call   b9f <write>
+     1f9:	83 c4 10             	add    $0x10,%esp
+     1fc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     201:	0f 85 0a 03 00 00    	jne    511 <bigfile+0x371>
+  for(i = 0; i < nblocks; i++)
+     207:	83 c7 01             	add    $0x1,%edi
+     20a:	39 fb                	cmp    %edi,%ebx
+     20c:	75 d2                	jne    1e0 <bigfile+0x40>
+  close(fd);
+     20e:	83 ec 0c             	sub    $0xc,%esp
+     211:	56                   	push   %esi
+     212:	e8 90 09 00 00       	call   ba7 <close>
+  report("big sequential write", nblocks/2, uptime() - t);
+     217:	e8 fb 09 00 00       	call   c17 <uptime>
+  if(t == 0)
+     21c:	83 c4 10             	add    $0x10,%esp
+  report("big sequential write", nblocks/2, uptime() - t);
+     21f:	89 c1                	mov    %eax,%ecx
+     221:	89 d8                	mov    %ebx,%eax
+     223:	c1 e8 1f             	shr    $0x1f,%eax
+     226:	01 d8                	add    %ebx,%eax
+     228:	d1 f8                	sar    %eax
+     22a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(t == 0)
+     22d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     230:	29 c1                	sub    %eax,%ecx
+     232:	0f 84 91 02 00 00    	je     4c9 <bigfile+0x329>
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     238:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     23b:	99                   	cltd
+     23c:	f7 f9                	idiv   %ecx
+     23e:	83 ec 08             	sub    $0x8,%esp
+     241:	50                   	push   %eax
+     242:	51                   	push   %ecx
+     243:	ff 75 e4             	push   -0x1c(%ebp)
+     246:	68 57 10 00 00       	push   $0x1057
+     24b:	68 08 11 00 00       	push   $0x1108
+     250:	6a 01                	push   $0x1
+     252:	e8 99 0a 00 00       	call   cf0 <printf>
+  t = uptime();
+     257:	83 c4 20             	add    $0x20,%esp
+     25a:	e8 b8 09 00 00       	call   c17 <uptime>
+  if((fd = open(name, mode)) < 0){
+     25f:	83 ec 08             	sub    $0x8,%esp
+  t = uptime();
+     262:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((fd = open(name, mode)) < 0){
+     265:	6a 00                	push   $0x0
+     267:	68 4a 10 00 00       	push   $0x104a
+     26c:	e8 4e 09 00 00       	call   bbf <open>
+     271:	83 c4 10             	add    $0x10,%esp
+     274:	89 c6                	mov    %eax,%esi
+     276:	85 c0                	test   %eax,%eax
+     278:	0f 88 bc 02 00 00    	js     53a <bigfile+0x39a>
+  for(i = 0; i < nblocks; i++)
+     27e:	31 ff                	xor    %edi,%edi
+     280:	85 db                	test   %ebx,%ebx
+     282:	7e 38                	jle    2bc <bigfile+0x11c>
+     284:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(read(fd, buf, BSIZE) != BSIZE || ((int*)buf)[0] != i){
+     288:	83 ec 04             	sub    $0x4,%esp
+     28b:	68 00 02 00 00       	push   $0x200
+     290:	68 c0 15 00 00       	push   $0x15c0
+     295:	56                   	push   %esi
+     296:	e8 fc 08 00 00       	call   b97 <read>
+     29b:	83 c4 10             	add    $0x10,%esp
+     29e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     2a3:	0f 85 7c 02 00 00    	jne    525 <bigfile+0x385>
+     2a9:	39 3d c0 15 00 00    	cmp    %edi,0x15c0
+     2af:	0f 85 70 02 00 00    	jne    525 <bigfile+0x385>
+  for(i = 0; i < nblocks; i++)
+     2b5:	83 c7 01             	add    $0x1,%edi
+     2b8:	39 fb                	cmp    %edi,%ebx
+     2ba:	75 cc                	jne    288 <bigfile+0xe8>
+  close(fd);
+     2bc:	83 ec 0c             	sub    $0xc,%esp
+     2bf:	56                   	push   %esi
+     2c0:	e8 e2 08 00 00       	call   ba7 <close>
+  report("big sequential read", nblocks/2, uptime() - t);
+     2c5:	e8 4d 09 00 00       	call   c17 <uptime>
+  if(t == 0)
+     2ca:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     2cd:	83 c4 10             	add    $0x10,%esp
+     2d0:	29 c8                	sub    %ecx,%eax
+     2d2:	89 c1                	mov    %eax,%ecx
+     2d4:	0f 85 fc 01 00 00    	jne    4d6 <bigfile+0x336>
+     2da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    t = 1;
+     2dd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     2e2:	83 ec 08             	sub    $0x8,%esp
+     2e5:	50                   	push   %eax
+     2e6:	51                   	push   %ecx
+     2e7:	ff 75 e4             	push   -0x1c(%ebp)
+     2ea:	68 6c 10 00 00       	push   $0x106c
+     2ef:	68 08 11 00 00       	push   $0x1108
+     2f4:	6a 01                	push   $0x1
+     2f6:	e8 f5 09 00 00       	call   cf0 <printf>
+  t = uptime();
+     2fb:	83 c4 20             	add    $0x20,%esp
+     2fe:	e8 14 09 00 00       	call   c17 <uptime>
+  if((fd = open(name, mode)) < 0){
+     303:	83 ec 08             	sub    $0x8,%esp
+  t = uptime();
+     306:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if((fd = open(name, mode)) < 0){
+     309:	6a 02                	push   $0x2
+     30b:	68 4a 10 00 00       	push   $0x104a
+     310:	e8 aa 08 00 00       	call   bbf <open>
+     315:	83 c4 10             	add    $0x10,%esp
+     318:	89 c6                	mov    %eax,%esi
+     31a:	85 c0                	test   %eax,%eax
+     31c:	0f 88 18 02 00 00    	js     53a <bigfile+0x39a>
+    b = rand() % nblocks;
+     322:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     325:	bf e8 03 00 00       	mov    $0x3e8,%edi
+     32a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  randstate = randstate * 1664525 + 1013904223;
+     330:	69 05 a8 15 00 00 0d 	imul   $0x19660d,0x15a8,%eax
+     337:	66 19 00 
+    b = rand() % nblocks;
+     33a:	31 d2                	xor    %edx,%edx
+    lseek(fd, b*BSIZE, SEEK_SET);
+     33c:	83 ec 04             	sub    $0x4,%esp
+  randstate = randstate * 1664525 + 1013904223;
+     33f:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+     344:	a3 a8 15 00 00       	mov    %eax,0x15a8
+    b = rand() % nblocks;
+     349:	f7 75 08             	divl   0x8(%ebp)
+    lseek(fd, b*BSIZE, SEEK_SET);
+     34c:	6a 00                	push   $0x0
+     34e:	89 d0                	mov    %edx,%eax
+    b = rand() % nblocks;
+     350:	89 d3                	mov    %edx,%ebx
+    lseek(fd, b*BSIZE, SEEK_SET);
+     352:	c1 e0 09             	shl    $0x9,%eax
+     355:	50                   	push   %eax
+     356:	56                   	push   %esi
+     357:	e8 d3 08 00 00       	call   c2f <lseek>
+  if(read(fd, buf, BSIZE) != BSIZE || ((int*)buf)[0] != i){
+     35c:	83 c4 0c             	add    $0xc,%esp
+     35f:	68 00 02 00 00       	push   $0x200
+     364:	68 c0 15 00 00       	push   $0x15c0
+     369:	56                   	push   %esi
+     36a:	e8 28 08 00 00       	call   b97 <read>
+     36f:	83 c4 10             	add    $0x10,%esp
+     372:	3d 00 02 00 00       	cmp    $0x200,%eax
+     377:	0f 85 7f 01 00 00    	jne    4fc <bigfile+0x35c>
+     37d:	3b 1d c0 15 00 00    	cmp    0x15c0,%ebx
+     383:	0f 85 73 01 00 00    	jne    4fc <bigfile+0x35c>
+  for(i = 0; i < NRANDOM; i++){
+     389:	83 ef 01             	sub    $0x1,%edi
+     38c:	75 a2                	jne    330 <bigfile+0x190>
+  report("big random read", NRANDOM/2, uptime() - t);
+     38e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     391:	e8 81 08 00 00       	call   c17 <uptime>
+  if(t == 0)
+     396:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     399:	29 c8                	sub    %ecx,%eax
+     39b:	89 c1                	mov    %eax,%ecx
+     39d:	b8 f4 01 00 00       	mov    $0x1f4,%eax
+     3a2:	0f 84 39 01 00 00    	je     4e1 <bigfile+0x341>
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     3a8:	31 d2                	xor    %edx,%edx
+     3aa:	f7 f9                	idiv   %ecx
+     3ac:	83 ec 08             	sub    $0x8,%esp
+  t = uptime();
+     3af:	bf e8 03 00 00       	mov    $0x3e8,%edi
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     3b4:	50                   	push   %eax
+     3b5:	51                   	push   %ecx
+     3b6:	68 f4 01 00 00       	push   $0x1f4
+     3bb:	68 80 10 00 00       	push   $0x1080
+     3c0:	68 08 11 00 00       	push   $0x1108
+     3c5:	6a 01                	push   $0x1
+     3c7:	e8 24 09 00 00       	call   cf0 <printf>
+  t = uptime();
+     3cc:	83 c4 20             	add    $0x20,%esp
+     3cf:	e8 43 08 00 00       	call   c17 <uptime>
+     3d4:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     3d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < NRANDOM; i++){
+     3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  randstate = randstate * 1664525 + 1013904223;
+     3e0:	69 05 a8 15 00 00 0d 	imul   $0x19660d,0x15a8,%eax
+     3e7:	66 19 00 
+    b = rand() % nblocks;
+     3ea:	31 d2                	xor    %edx,%edx
+    lseek(fd, b*BSIZE, SEEK_SET);
+     3ec:	83 ec 04             	sub    $0x4,%esp
+  randstate = randstate * 1664525 + 1013904223;
+     3ef:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+     3f4:	a3 a8 15 00 00       	mov    %eax,0x15a8
+    b = rand() % nblocks;
+     3f9:	f7 75 08             	divl   0x8(%ebp)
+    lseek(fd, b*BSIZE, SEEK_SET);
+     3fc:	6a 00                	push   $0x0
+     3fe:	89 d0                	mov    %edx,%eax
+    b = rand() % nblocks;
+     400:	89 d3                	mov    %edx,%ebx
+    lseek(fd, b*BSIZE, SEEK_SET);
+     402:	c1 e0 09             	shl    $0x9,%eax
+     405:	50                   	push   %eax
+     406:	56                   	push   %esi
+     407:	e8 23 08 00 00       	call   c2f <lseek>
+  if(write(fd, buf, BSIZE) != BSIZE){
+     40c:	83 c4 0c             	add    $0xc,%esp
+  ((int*)buf)[0] = i;
+     40f:	89 1d c0 15 00 00    	mov    %ebx,0x15c0
+  if(write(fd, buf, BSIZE) != BSIZE){
+     415:	68 00 02 00 00       	push   $0x200
+     41a:	68 c0 15 00 00       	push   $0x15c0
+     41f:	56                   	push   %esi
+     420:	e8 7a 07 00 00       	call   b9f <write>
+     425:	83 c4 10             	add    $0x10,%esp
+     428:	3d 00 02 00 00       	cmp    $0x200,%eax
+     42d:	0f 85 de 00 00 00    	jne    511 <bigfile+0x371>
+  for(i = 0; i < NRANDOM; i++){
+     433:	83 ef 01             	sub    $0x1,%edi
+     436:	75 a8                	jne    3e0 <bigfile+0x240>
+  close(fd);
+     438:	83 ec 0c             	sub    $0xc,%esp
+     43b:	56                   	push   %esi
+     43c:	e8 66 07 00 00       	call   ba7 <close>
+  report("big random write", NRANDOM/2, uptime() - t);
+     441:	e8 d1 07 00 00       	call   c17 <uptime>
+  if(t == 0)
+     446:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     449:	83 c4 10             	add    $0x10,%esp
+     44c:	29 c8                	sub    %ecx,%eax
+     44e:	89 c1                	mov    %eax,%ecx
+     450:	b8 f4 01 00 00       	mov    $0x1f4,%eax
+     455:	0f 84 97 00 00 00    	je     4f2 <bigfile+0x352>
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     45b:	31 d2                	xor    %edx,%edx
+     45d:	f7 f9                	idiv   %ecx
+     45f:	83 ec 08             	sub    $0x8,%esp
+     462:	50                   	push   %eax
+     463:	51                   	push   %ecx
+     464:	68 f4 01 00 00       	push   $0x1f4
+     469:	68 90 10 00 00       	push   $0x1090
+     46e:	68 08 11 00 00       	push   $0x1108
+     473:	6a 01                	push   $0x1
+     475:	e8 76 08 00 00       	call   cf0 <printf>
+  t = uptime();
+     47a:	83 c4 20             	add    $0x20,%esp
+     47d:	e8 95 07 00 00       	call   c17 <uptime>
+  unlink("bigbench.big");
+     482:	83 ec 0c             	sub    $0xc,%esp
+     485:	68 4a 10 00 00       	push   $0x104a
+  t = uptime();
+     48a:	89 c3                	mov    %eax,%ebx
+  unlink("bigbench.big");
+     48c:	e8 3e 07 00 00       	call   bcf <unlink>
+  report("big unlink", nblocks/2, uptime() - t);
+     491:	e8 81 07 00 00       	call   c17 <uptime>
+  if(t == 0)
+     496:	83 c4 10             	add    $0x10,%esp
+     499:	29 d8                	sub    %ebx,%eax
+     49b:	89 c1                	mov    %eax,%ecx
+     49d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     4a0:	74 49                	je     4eb <bigfile+0x34b>
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     4a2:	99                   	cltd
+     4a3:	f7 f9                	idiv   %ecx
+     4a5:	83 ec 08             	sub    $0x8,%esp
+     4a8:	50                   	push   %eax
+     4a9:	51                   	push   %ecx
+     4aa:	ff 75 e4             	push   -0x1c(%ebp)
+     4ad:	68 a1 10 00 00       	push   $0x10a1
+     4b2:	68 08 11 00 00       	push   $0x1108
+     4b7:	6a 01                	push   $0x1
+     4b9:	e8 32 08 00 00       	call   cf0 <printf>
+}
+     4be:	83 c4 20             	add    $0x20,%esp
+     4c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4c4:	5b                   	pop    %ebx
+     4c5:	5e                   	pop    %esi
+     4c6:	5f                   	pop    %edi
+     4c7:	5d                   	pop    %ebp
+     4c8:	c3                   	ret
+     4c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    t = 1;
+     4cc:	b9 01 00 00 00       	mov    $0x1,%ecx
+     4d1:	e9 68 fd ff ff       	jmp    23e <bigfile+0x9e>
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     4d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     4d9:	99                   	cltd
+     4da:	f7 f9                	idiv   %ecx
+     4dc:	e9 01 fe ff ff       	jmp    2e2 <bigfile+0x142>
+    t = 1;
+     4e1:	b9 01 00 00 00       	mov    $0x1,%ecx
+     4e6:	e9 c1 fe ff ff       	jmp    3ac <bigfile+0x20c>
+     4eb:	b9 01 00 00 00       	mov    $0x1,%ecx
+     4f0:	eb b3                	jmp    4a5 <bigfile+0x305>
+     4f2:	b9 01 00 00 00       	mov    $0x1,%ecx
+     4f7:	e9 63 ff ff ff       	jmp    45f <bigfile+0x2bf>
+    printf(2, "bigbench: bad block %d\n", i);
+     4fc:	83 ec 04             	sub    $0x4,%esp
+     4ff:	53                   	push   %ebx
+     500:	68 32 10 00 00       	push   $0x1032
+     505:	6a 02                	push   $0x2
+     507:	e8 e4 07 00 00       	call   cf0 <printf>
+    exit();
+     50c:	e8 6e 06 00 00       	call   b7f <exit>
+    printf(2, "bigbench: write failed, disk full?\n");
+     511:	83 ec 08             	sub    $0x8,%esp
+     514:	68 34 11 00 00       	push   $0x1134
+     519:	6a 02                	push   $0x2
+     51b:	e8 d0 07 00 00       	call   cf0 <printf>
+    exit();
+     520:	e8 5a 06 00 00       	call   b7f <exit>
+    printf(2, "bigbench: bad block %d\n", i);
+     525:	83 ec 04             	sub    $0x4,%esp
+     528:	57                   	push   %edi
+     529:	68 32 10 00 00       	push   $0x1032
+     52e:	6a 02                	push   $0x2
+     530:	e8 bb 07 00 00       	call   cf0 <printf>
+    exit();
+     535:	e8 45 06 00 00       	call   b7f <exit>
+     53a:	b8 4a 10 00 00       	mov    $0x104a,%eax
+     53f:	e8 1c fb ff ff       	call   60 <openorfail.part.0>
+     544:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     54f:	90                   	nop
+
+00000550 <smallfiles>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	57                   	push   %edi
+     554:	56                   	push   %esi
+     555:	53                   	push   %ebx
+  for(i = 0; i < NSMALL; i++){
+     556:	31 db                	xor    %ebx,%ebx
+{
+     558:	83 ec 2c             	sub    $0x2c,%esp
+  char name[] = "bigbench.s00";
+     55b:	c7 45 db 62 69 67 62 	movl   $0x62676962,-0x25(%ebp)
+     562:	c7 45 df 65 6e 63 68 	movl   $0x68636e65,-0x21(%ebp)
+     569:	c7 45 e3 2e 73 30 30 	movl   $0x3030732e,-0x1d(%ebp)
+     570:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  t = uptime();
+     574:	e8 9e 06 00 00       	call   c17 <uptime>
+     579:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < NSMALL; i++){
+     57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    name[10] = '0' + i/10;
+     580:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  if((fd = open(name, mode)) < 0){
+     585:	83 ec 08             	sub    $0x8,%esp
+    name[10] = '0' + i/10;
+     588:	f7 e3                	mul    %ebx
+     58a:	c1 ea 03             	shr    $0x3,%edx
+     58d:	8d 42 30             	lea    0x30(%edx),%eax
+    name[11] = '0' + i%10;
+     590:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[10] = '0' + i/10;
+     593:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[11] = '0' + i%10;
+     596:	01 d2                	add    %edx,%edx
+     598:	89 d8                	mov    %ebx,%eax
+     59a:	29 d0                	sub    %edx,%eax
+     59c:	83 c0 30             	add    $0x30,%eax
+     59f:	88 45 e6             	mov    %al,-0x1a(%ebp)
+  if((fd = open(name, mode)) < 0){
+     5a2:	8d 45 db             	lea    -0x25(%ebp),%eax
+     5a5:	68 02 02 00 00       	push   $0x202
+     5aa:	50                   	push   %eax
+     5ab:	e8 0f 06 00 00       	call   bbf <open>
+     5b0:	83 c4 10             	add    $0x10,%esp
+     5b3:	89 c7                	mov    %eax,%edi
+     5b5:	85 c0                	test   %eax,%eax
+     5b7:	0f 88 15 03 00 00    	js     8d2 <smallfiles+0x382>
+    for(j = 0; j < NDIRECT; j++)
+     5bd:	31 f6                	xor    %esi,%esi
+     5bf:	90                   	nop
+  if(write(fd, buf, BSIZE) != BSIZE){
+     5c0:	83 ec 04             	sub    $0x4,%esp
+  ((int*)buf)[0] = i;
+     5c3:	89 35 c0 15 00 00    	mov    %esi,0x15c0
+  if(write(fd, buf, BSIZE) != BSIZE){
+     5c9:	68 00 02 00 00       	push   $0x200
+     5ce:	68 c0 15 00 00       	push   $0x15c0
+     5d3:	57                   	push   %edi
+     5d4:	e8 c6 05 00 00       	call   b9f <write>
+     5d9:	83 c4 10             	add    $0x10,%esp
+     5dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     5e1:	0f 85 c3 02 00 00    	jne    8aa <smallfiles+0x35a>
+    for(j = 0; j < NDIRECT; j++)
+     5e7:	83 c6 01             	add    $0x1,%esi
+     5ea:	83 fe 0a             	cmp    $0xa,%esi
+     5ed:	75 d1                	jne    5c0 <smallfiles+0x70>
+    close(fd);
+     5ef:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NSMALL; i++){
+     5f2:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+     5f5:	57                   	push   %edi
+     5f6:	e8 ac 05 00 00       	call   ba7 <close>
+  for(i = 0; i < NSMALL; i++){
+     5fb:	83 c4 10             	add    $0x10,%esp
+     5fe:	83 fb 64             	cmp    $0x64,%ebx
+     601:	0f 85 79 ff ff ff    	jne    580 <smallfiles+0x30>
+  report("small sequential write", NSMALL*NDIRECT/2, uptime() - t);
+     607:	e8 0b 06 00 00       	call   c17 <uptime>
+  if(t == 0)
+     60c:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     60f:	29 c8                	sub    %ecx,%eax
+     611:	89 c1                	mov    %eax,%ecx
+     613:	b8 f4 01 00 00       	mov    $0x1f4,%eax
+     618:	0f 84 6d 02 00 00    	je     88b <smallfiles+0x33b>
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     61e:	31 d2                	xor    %edx,%edx
+     620:	f7 f9                	idiv   %ecx
+     622:	83 ec 08             	sub    $0x8,%esp
+    name[10] = '0' + i/10;
+     625:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     62a:	50                   	push   %eax
+     62b:	51                   	push   %ecx
+     62c:	68 f4 01 00 00       	push   $0x1f4
+     631:	68 ac 10 00 00       	push   $0x10ac
+     636:	68 08 11 00 00       	push   $0x1108
+     63b:	6a 01                	push   $0x1
+     63d:	e8 ae 06 00 00       	call   cf0 <printf>
+  t = uptime();
+     642:	83 c4 20             	add    $0x20,%esp
+     645:	e8 cd 05 00 00       	call   c17 <uptime>
+  for(i = 0; i < NSMALL; i++){
+     64a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  t = uptime();
+     651:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 0; i < NSMALL; i++){
+     654:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    name[10] = '0' + i/10;
+     658:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  if((fd = open(name, mode)) < 0){
+     65b:	83 ec 08             	sub    $0x8,%esp
+    name[10] = '0' + i/10;
+     65e:	f7 e6                	mul    %esi
+     660:	c1 ea 03             	shr    $0x3,%edx
+     663:	8d 42 30             	lea    0x30(%edx),%eax
+    name[11] = '0' + i%10;
+     666:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[10] = '0' + i/10;
+     669:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[11] = '0' + i%10;
+     66c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     66f:	01 d2                	add    %edx,%edx
+     671:	29 d0                	sub    %edx,%eax
+     673:	83 c0 30             	add    $0x30,%eax
+     676:	88 45 e6             	mov    %al,-0x1a(%ebp)
+  if((fd = open(name, mode)) < 0){
+     679:	8d 45 db             	lea    -0x25(%ebp),%eax
+     67c:	6a 00                	push   $0x0
+     67e:	50                   	push   %eax
+     67f:	e8 3b 05 00 00       	call   bbf <open>
+     684:	83 c4 10             	add    $0x10,%esp
+     687:	89 c3                	mov    %eax,%ebx
+     689:	85 c0                	test   %eax,%eax
+     68b:	0f 88 41 02 00 00    	js     8d2 <smallfiles+0x382>
+    for(j = 0; j < NDIRECT; j++)
+     691:	31 ff                	xor    %edi,%edi
+     693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     697:	90                   	nop
+  if(read(fd, buf, BSIZE) != BSIZE || ((int*)buf)[0] != i){
+     698:	83 ec 04             	sub    $0x4,%esp
+     69b:	68 00 02 00 00       	push   $0x200
+     6a0:	68 c0 15 00 00       	push   $0x15c0
+     6a5:	53                   	push   %ebx
+     6a6:	e8 ec 04 00 00       	call   b97 <read>
+     6ab:	83 c4 10             	add    $0x10,%esp
+     6ae:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6b3:	0f 85 dc 01 00 00    	jne    895 <smallfiles+0x345>
+     6b9:	3b 3d c0 15 00 00    	cmp    0x15c0,%edi
+     6bf:	0f 85 d0 01 00 00    	jne    895 <smallfiles+0x345>
+    for(j = 0; j < NDIRECT; j++)
+     6c5:	83 c7 01             	add    $0x1,%edi
+     6c8:	83 ff 0a             	cmp    $0xa,%edi
+     6cb:	75 cb                	jne    698 <smallfiles+0x148>
+    close(fd);
+     6cd:	83 ec 0c             	sub    $0xc,%esp
+     6d0:	53                   	push   %ebx
+     6d1:	e8 d1 04 00 00       	call   ba7 <close>
+  for(i = 0; i < NSMALL; i++){
+     6d6:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+     6da:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     6dd:	83 c4 10             	add    $0x10,%esp
+     6e0:	83 f8 64             	cmp    $0x64,%eax
+     6e3:	0f 85 6f ff ff ff    	jne    658 <smallfiles+0x108>
+  report("small sequential read", NSMALL*NDIRECT/2, uptime() - t);
+     6e9:	e8 29 05 00 00       	call   c17 <uptime>
+  if(t == 0)
+     6ee:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     6f1:	29 c8                	sub    %ecx,%eax
+     6f3:	89 c1                	mov    %eax,%ecx
+     6f5:	b8 f4 01 00 00       	mov    $0x1f4,%eax
+     6fa:	0f 84 be 01 00 00    	je     8be <smallfiles+0x36e>
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     700:	31 d2                	xor    %edx,%edx
+     702:	f7 f9                	idiv   %ecx
+     704:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < NRANDOM; i++){
+     707:	31 db                	xor    %ebx,%ebx
+    name[10] = '0' + i%NSMALL/10;
+     709:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     70e:	50                   	push   %eax
+     70f:	51                   	push   %ecx
+     710:	68 f4 01 00 00       	push   $0x1f4
+     715:	68 c3 10 00 00       	push   $0x10c3
+     71a:	68 08 11 00 00       	push   $0x1108
+     71f:	6a 01                	push   $0x1
+     721:	e8 ca 05 00 00       	call   cf0 <printf>
+  t = uptime();
+     726:	83 c4 20             	add    $0x20,%esp
+     729:	e8 e9 04 00 00       	call   c17 <uptime>
+     72e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 0; i < NRANDOM; i++){
+     731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    name[10] = '0' + i%NSMALL/10;
+     738:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  if((fd = open(name, mode)) < 0){
+     73d:	83 ec 08             	sub    $0x8,%esp
+    name[10] = '0' + i%NSMALL/10;
+     740:	f7 e3                	mul    %ebx
+  randstate = randstate * 1664525 + 1013904223;
+     742:	69 0d a8 15 00 00 0d 	imul   $0x19660d,0x15a8,%ecx
+     749:	66 19 00 
+    name[10] = '0' + i%NSMALL/10;
+     74c:	c1 ea 05             	shr    $0x5,%edx
+     74f:	6b c2 64             	imul   $0x64,%edx,%eax
+     752:	89 da                	mov    %ebx,%edx
+  randstate = randstate * 1664525 + 1013904223;
+     754:	81 c1 5f f3 6e 3c    	add    $0x3c6ef35f,%ecx
+     75a:	89 0d a8 15 00 00    	mov    %ecx,0x15a8
+    name[10] = '0' + i%NSMALL/10;
+     760:	29 c2                	sub    %eax,%edx
+     762:	89 d0                	mov    %edx,%eax
+     764:	f7 e6                	mul    %esi
+    name[11] = '0' + i%10;
+     766:	89 d8                	mov    %ebx,%eax
+    name[10] = '0' + i%NSMALL/10;
+     768:	c1 ea 03             	shr    $0x3,%edx
+     76b:	83 c2 30             	add    $0x30,%edx
+     76e:	88 55 e5             	mov    %dl,-0x1b(%ebp)
+    name[11] = '0' + i%10;
+     771:	f7 e6                	mul    %esi
+     773:	89 d8                	mov    %ebx,%eax
+     775:	c1 ea 03             	shr    $0x3,%edx
+     778:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     77b:	01 d2                	add    %edx,%edx
+     77d:	29 d0                	sub    %edx,%eax
+     77f:	83 c0 30             	add    $0x30,%eax
+     782:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    j = rand() % NDIRECT;
+     785:	89 c8                	mov    %ecx,%eax
+     787:	f7 e6                	mul    %esi
+  if((fd = open(name, mode)) < 0){
+     789:	6a 00                	push   $0x0
+    j = rand() % NDIRECT;
+     78b:	c1 ea 03             	shr    $0x3,%edx
+     78e:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     791:	01 c0                	add    %eax,%eax
+     793:	29 c1                	sub    %eax,%ecx
+  if((fd = open(name, mode)) < 0){
+     795:	8d 45 db             	lea    -0x25(%ebp),%eax
+     798:	50                   	push   %eax
+    j = rand() % NDIRECT;
+     799:	89 cf                	mov    %ecx,%edi
+  if((fd = open(name, mode)) < 0){
+     79b:	e8 1f 04 00 00       	call   bbf <open>
+     7a0:	83 c4 10             	add    $0x10,%esp
+     7a3:	89 c2                	mov    %eax,%edx
+     7a5:	85 c0                	test   %eax,%eax
+     7a7:	0f 88 25 01 00 00    	js     8d2 <smallfiles+0x382>
+    lseek(fd, j*BSIZE, SEEK_SET);
+     7ad:	89 f8                	mov    %edi,%eax
+     7af:	83 ec 04             	sub    $0x4,%esp
+     7b2:	c1 e0 09             	shl    $0x9,%eax
+     7b5:	6a 00                	push   $0x0
+     7b7:	50                   	push   %eax
+     7b8:	52                   	push   %edx
+     7b9:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     7bc:	e8 6e 04 00 00       	call   c2f <lseek>
+  if(read(fd, buf, BSIZE) != BSIZE || ((int*)buf)[0] != i){
+     7c1:	83 c4 0c             	add    $0xc,%esp
+     7c4:	68 00 02 00 00       	push   $0x200
+     7c9:	68 c0 15 00 00       	push   $0x15c0
+     7ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     7d1:	52                   	push   %edx
+     7d2:	e8 c0 03 00 00       	call   b97 <read>
+     7d7:	83 c4 10             	add    $0x10,%esp
+     7da:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7df:	0f 85 b0 00 00 00    	jne    895 <smallfiles+0x345>
+     7e5:	3b 3d c0 15 00 00    	cmp    0x15c0,%edi
+     7eb:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     7ee:	0f 85 a1 00 00 00    	jne    895 <smallfiles+0x345>
+    close(fd);
+     7f4:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NRANDOM; i++){
+     7f7:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+     7fa:	52                   	push   %edx
+     7fb:	e8 a7 03 00 00       	call   ba7 <close>
+  for(i = 0; i < NRANDOM; i++){
+     800:	83 c4 10             	add    $0x10,%esp
+     803:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+     809:	0f 85 29 ff ff ff    	jne    738 <smallfiles+0x1e8>
+  report("small random read", NRANDOM/2, uptime() - t);
+     80f:	e8 03 04 00 00       	call   c17 <uptime>
+  if(t == 0)
+     814:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     817:	29 c8                	sub    %ecx,%eax
+     819:	89 c1                	mov    %eax,%ecx
+     81b:	b8 f4 01 00 00       	mov    $0x1f4,%eax
+     820:	0f 84 a2 00 00 00    	je     8c8 <smallfiles+0x378>
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     826:	31 d2                	xor    %edx,%edx
+     828:	f7 f9                	idiv   %ecx
+     82a:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < NSMALL; i++){
+     82d:	31 ff                	xor    %edi,%edi
+    name[10] = '0' + i/10;
+     82f:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+     834:	50                   	push   %eax
+     835:	51                   	push   %ecx
+     836:	68 f4 01 00 00       	push   $0x1f4
+     83b:	68 d9 10 00 00       	push   $0x10d9
+     840:	68 08 11 00 00       	push   $0x1108
+     845:	6a 01                	push   $0x1
+     847:	e8 a4 04 00 00       	call   cf0 <printf>
+     84c:	83 c4 20             	add    $0x20,%esp
+     84f:	90                   	nop
+    name[10] = '0' + i/10;
+     850:	89 f8                	mov    %edi,%eax
+    unlink(name);
+     852:	83 ec 0c             	sub    $0xc,%esp
+    name[10] = '0' + i/10;
+     855:	f7 e3                	mul    %ebx
+     857:	c1 ea 03             	shr    $0x3,%edx
+     85a:	8d 42 30             	lea    0x30(%edx),%eax
+    name[11] = '0' + i%10;
+     85d:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[10] = '0' + i/10;
+     860:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[11] = '0' + i%10;
+     863:	01 d2                	add    %edx,%edx
+     865:	89 f8                	mov    %edi,%eax
+  for(i = 0; i < NSMALL; i++){
+     867:	83 c7 01             	add    $0x1,%edi
+    name[11] = '0' + i%10;
+     86a:	29 d0                	sub    %edx,%eax
+     86c:	83 c0 30             	add    $0x30,%eax
+     86f:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(name);
+     872:	8d 45 db             	lea    -0x25(%ebp),%eax
+     875:	50                   	push   %eax
+     876:	e8 54 03 00 00       	call   bcf <unlink>
+  for(i = 0; i < NSMALL; i++){
+     87b:	83 c4 10             	add    $0x10,%esp
+     87e:	83 ff 64             	cmp    $0x64,%edi
+     881:	75 cd                	jne    850 <smallfiles+0x300>
+}
+     883:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     886:	5b                   	pop    %ebx
+     887:	5e                   	pop    %esi
+     888:	5f                   	pop    %edi
+     889:	5d                   	pop    %ebp
+     88a:	c3                   	ret
+    t = 1;
+     88b:	b9 01 00 00 00       	mov    $0x1,%ecx
+     890:	e9 8d fd ff ff       	jmp    622 <smallfiles+0xd2>
+    printf(2, "bigbench: bad block %d\n", i);
+     895:	83 ec 04             	sub    $0x4,%esp
+     898:	57                   	push   %edi
+     899:	68 32 10 00 00       	push   $0x1032
+     89e:	6a 02                	push   $0x2
+     8a0:	e8 4b 04 00 00       	call   cf0 <printf>
+    exit();
+     8a5:	e8 d5 02 00 00       	call   b7f <exit>
+    printf(2, "bigbench: write failed, disk full?\n");
+     8aa:	83 ec 08             	sub    $0x8,%esp
+     8ad:	68 34 11 00 00       	push   $0x1134
+     8b2:	6a 02                	push   $0x2
+     8b4:	e8 37 04 00 00       	call   cf0 <printf>
+    exit();
+     8b9:	e8 c1 02 00 00       	call   b7f <exit>
+    t = 1;
+     8be:	b9 01 00 00 00       	mov    $0x1,%ecx
+     8c3:	e9 3c fe ff ff       	jmp    704 <smallfiles+0x1b4>
+     8c8:	b9 01 00 00 00       	mov    $0x1,%ecx
+     8cd:	e9 58 ff ff ff       	jmp    82a <smallfiles+0x2da>
+    printf(2, "bigbench: cannot open %s\n", name);
+     8d2:	83 ec 04             	sub    $0x4,%esp
+     8d5:	8d 45 db             	lea    -0x25(%ebp),%eax
+     8d8:	50                   	push   %eax
+     8d9:	68 18 10 00 00       	push   $0x1018
+     8de:	6a 02                	push   $0x2
+     8e0:	e8 0b 04 00 00       	call   cf0 <printf>
+    exit();
+     8e5:	e8 95 02 00 00       	call   b7f <exit>
+     8ea:	66 90                	xchg   %ax,%ax
+     8ec:	66 90                	xchg   %ax,%ax
+     8ee:	66 90                	xchg   %ax,%ax
+
+000008f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     8f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     8f1:	31 c0                	xor    %eax,%eax
+{
+     8f3:	89 e5                	mov    %esp,%ebp
+     8f5:	53                   	push   %ebx
+     8f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     8f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     900:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     904:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     907:	83 c0 01             	add    $0x1,%eax
+     90a:	84 d2                	test   %dl,%dl
+     90c:	75 f2                	jne    900 <strcpy+0x10>
+    ;
+  return os;
+}
+     90e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     911:	89 c8                	mov    %ecx,%eax
+     913:	c9                   	leave
+     914:	c3                   	ret
+     915:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     920:	55                   	push   %ebp
+     921:	89 e5                	mov    %esp,%ebp
+     923:	53                   	push   %ebx
+     924:	8b 55 08             	mov    0x8(%ebp),%edx
+     927:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     92a:	0f b6 02             	movzbl (%edx),%eax
+     92d:	84 c0                	test   %al,%al
+     92f:	75 17                	jne    948 <strcmp+0x28>
+     931:	eb 3a                	jmp    96d <strcmp+0x4d>
+     933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     937:	90                   	nop
+     938:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     93c:	83 c2 01             	add    $0x1,%edx
+     93f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     942:	84 c0                	test   %al,%al
+     944:	74 1a                	je     960 <strcmp+0x40>
+    p++, q++;
+     946:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     948:	0f b6 19             	movzbl (%ecx),%ebx
+     94b:	38 c3                	cmp    %al,%bl
+     94d:	74 e9                	je     938 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     94f:	29 d8                	sub    %ebx,%eax
+}
+     951:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     954:	c9                   	leave
+     955:	c3                   	ret
+     956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     960:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     964:	31 c0                	xor    %eax,%eax
+     966:	29 d8                	sub    %ebx,%eax
+}
+     968:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     96b:	c9                   	leave
+     96c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     96d:	0f b6 19             	movzbl (%ecx),%ebx
+     970:	31 c0                	xor    %eax,%eax
+     972:	eb db                	jmp    94f <strcmp+0x2f>
+     974:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     97f:	90                   	nop
+
+00000980 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     986:	80 3a 00             	cmpb   $0x0,(%edx)
+     989:	74 15                	je     9a0 <strlen+0x20>
+     98b:	31 c0                	xor    %eax,%eax
+     98d:	8d 76 00             	lea    0x0(%esi),%esi
+     990:	83 c0 01             	add    $0x1,%eax
+     993:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     997:	89 c1                	mov    %eax,%ecx
+     999:	75 f5                	jne    990 <strlen+0x10>
+    ;
+  return n;
+}
+     99b:	89 c8                	mov    %ecx,%eax
+     99d:	5d                   	pop    %ebp
+     99e:	c3                   	ret
+     99f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     9a0:	31 c9                	xor    %ecx,%ecx
+}
+     9a2:	5d                   	pop    %ebp
+     9a3:	89 c8                	mov    %ecx,%eax
+     9a5:	c3                   	ret
+     9a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	57                   	push   %edi
+     9b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     9b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9bd:	89 d7                	mov    %edx,%edi
+     9bf:	fc                   	cld
+     9c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     9c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     9c5:	89 d0                	mov    %edx,%eax
+     9c7:	c9                   	leave
+     9c8:	c3                   	ret
+     9c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     9d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     9da:	0f b6 10             	movzbl (%eax),%edx
+     9dd:	84 d2                	test   %dl,%dl
+     9df:	75 12                	jne    9f3 <strchr+0x23>
+     9e1:	eb 1d                	jmp    a00 <strchr+0x30>
+     9e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9e7:	90                   	nop
+     9e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     9ec:	83 c0 01             	add    $0x1,%eax
+     9ef:	84 d2                	test   %dl,%dl
+     9f1:	74 0d                	je     a00 <strchr+0x30>
+    if(*s == c)
+     9f3:	38 d1                	cmp    %dl,%cl
+     9f5:	75 f1                	jne    9e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     9f7:	5d                   	pop    %ebp
+     9f8:	c3                   	ret
+     9f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     a00:	31 c0                	xor    %eax,%eax
+}
+     a02:	5d                   	pop    %ebp
+     a03:	c3                   	ret
+     a04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a0f:	90                   	nop
+
+00000a10 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	57                   	push   %edi
+     a14:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     a15:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     a18:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     a19:	31 db                	xor    %ebx,%ebx
+{
+     a1b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     a1e:	eb 2b                	jmp    a4b <gets+0x3b>
+    cc = read(0, &c, 1);
+     a20:	83 ec 04             	sub    $0x4,%esp
+     a23:	6a 01                	push   $0x1
+     a25:	56                   	push   %esi
+     a26:	6a 00                	push   $0x0
+     a28:	e8 6a 01 00 00       	call   b97 <read>
+    if(cc < 1)
+     a2d:	83 c4 10             	add    $0x10,%esp
+     a30:	85 c0                	test   %eax,%eax
+     a32:	7e 21                	jle    a55 <gets+0x45>
+      break;
+    buf[i++] = c;
+     a34:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     a38:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(c == '\n' || c == '\r' || c == '\t')
+     a3b:	8d 48 f7             	lea    -0x9(%eax),%ecx
+    buf[i++] = c;
+     a3e:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r' || c == '\t')
+     a42:	80 f9 01             	cmp    $0x1,%cl
+     a45:	76 10                	jbe    a57 <gets+0x47>
+     a47:	3c 0d                	cmp    $0xd,%al
+     a49:	74 0c                	je     a57 <gets+0x47>
+  for(i=0; i+1 < max; ){
+     a4b:	89 df                	mov    %ebx,%edi
+     a4d:	83 c3 01             	add    $0x1,%ebx
+     a50:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     a53:	7c cb                	jl     a20 <gets+0x10>
+     a55:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     a57:	8b 45 08             	mov    0x8(%ebp),%eax
+     a5a:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     a5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a61:	5b                   	pop    %ebx
+     a62:	5e                   	pop    %esi
+     a63:	5f                   	pop    %edi
+     a64:	5d                   	pop    %ebp
+     a65:	c3                   	ret
+     a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a70 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     a70:	55                   	push   %ebp
+     a71:	89 e5                	mov    %esp,%ebp
+     a73:	56                   	push   %esi
+     a74:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     a75:	83 ec 08             	sub    $0x8,%esp
+     a78:	6a 00                	push   $0x0
+     a7a:	ff 75 08             	push   0x8(%ebp)
+     a7d:	e8 3d 01 00 00       	call   bbf <open>
+  if(fd < 0)
+     a82:	83 c4 10             	add    $0x10,%esp
+     a85:	85 c0                	test   %eax,%eax
+     a87:	78 27                	js     ab0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     a89:	83 ec 08             	sub    $0x8,%esp
+     a8c:	ff 75 0c             	push   0xc(%ebp)
+     a8f:	89 c3                	mov    %eax,%ebx
+     a91:	50                   	push   %eax
+     a92:	e8 40 01 00 00       	call   bd7 <fstat>
+  close(fd);
+     a97:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     a9a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     a9c:	e8 06 01 00 00       	call   ba7 <close>
+  return r;
+     aa1:	83 c4 10             	add    $0x10,%esp
+}
+     aa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     aa7:	89 f0                	mov    %esi,%eax
+     aa9:	5b                   	pop    %ebx
+     aaa:	5e                   	pop    %esi
+     aab:	5d                   	pop    %ebp
+     aac:	c3                   	ret
+     aad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     ab0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     ab5:	eb ed                	jmp    aa4 <stat+0x34>
+     ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abe:	66 90                	xchg   %ax,%ax
+
+00000ac0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	53                   	push   %ebx
+     ac4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     ac7:	0f be 02             	movsbl (%edx),%eax
+     aca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     acd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     ad0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     ad5:	77 1e                	ja     af5 <atoi+0x35>
+     ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ade:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     ae0:	83 c2 01             	add    $0x1,%edx
+     ae3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     ae6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     aea:	0f be 02             	movsbl (%edx),%eax
+     aed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     af0:	80 fb 09             	cmp    $0x9,%bl
+     af3:	76 eb                	jbe    ae0 <atoi+0x20>
+  return n;
+}
+     af5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     af8:	89 c8                	mov    %ecx,%eax
+     afa:	c9                   	leave
+     afb:	c3                   	ret
+     afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b00 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	57                   	push   %edi
+     b04:	56                   	push   %esi
+     b05:	8b 45 10             	mov    0x10(%ebp),%eax
+     b08:	8b 55 08             	mov    0x8(%ebp),%edx
+     b0b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     b0e:	85 c0                	test   %eax,%eax
+     b10:	7e 13                	jle    b25 <memmove+0x25>
+     b12:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     b14:	89 d7                	mov    %edx,%edi
+     b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     b20:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     b21:	39 f8                	cmp    %edi,%eax
+     b23:	75 fb                	jne    b20 <memmove+0x20>
+  return vdst;
+}
+     b25:	5e                   	pop    %esi
+     b26:	89 d0                	mov    %edx,%eax
+     b28:	5f                   	pop    %edi
+     b29:	5d                   	pop    %ebp
+     b2a:	c3                   	ret
+     b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b2f:	90                   	nop
+
+00000b30 <strncmp>:
+
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	53                   	push   %ebx
+     b34:	8b 55 10             	mov    0x10(%ebp),%edx
+     b37:	8b 45 08             	mov    0x8(%ebp),%eax
+     b3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+     b3d:	85 d2                	test   %edx,%edx
+     b3f:	75 16                	jne    b57 <strncmp+0x27>
+     b41:	eb 2d                	jmp    b70 <strncmp+0x40>
+     b43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b47:	90                   	nop
+     b48:	3a 19                	cmp    (%ecx),%bl
+     b4a:	75 12                	jne    b5e <strncmp+0x2e>
+    n--, p++, q++;
+     b4c:	83 c0 01             	add    $0x1,%eax
+     b4f:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+     b52:	83 ea 01             	sub    $0x1,%edx
+     b55:	74 19                	je     b70 <strncmp+0x40>
+     b57:	0f b6 18             	movzbl (%eax),%ebx
+     b5a:	84 db                	test   %bl,%bl
+     b5c:	75 ea                	jne    b48 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+     b5e:	0f b6 00             	movzbl (%eax),%eax
+     b61:	0f b6 11             	movzbl (%ecx),%edx
+     b64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b67:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+     b68:	29 d0                	sub    %edx,%eax
+     b6a:	c3                   	ret
+     b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b6f:	90                   	nop
+     b70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+     b73:	31 c0                	xor    %eax,%eax
+     b75:	c9                   	leave
+     b76:	c3                   	ret
+
+00000b77 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     b77:	b8 01 00 00 00       	mov    $0x1,%eax
+     b7c:	cd 40                	int    $0x40
+     b7e:	c3                   	ret
+
+00000b7f <exit>:
+SYSCALL(exit)
+     b7f:	b8 02 00 00 00       	mov    $0x2,%eax
+     b84:	cd 40                	int    $0x40
+     b86:	c3                   	ret
+
+00000b87 <wait>:
+SYSCALL(wait)
+     b87:	b8 03 00 00 00       	mov    $0x3,%eax
+     b8c:	cd 40                	int    $0x40
+     b8e:	c3                   	ret
+
+00000b8f <pipe>:
+SYSCALL(pipe)
+     b8f:	b8 04 00 00 00       	mov    $0x4,%eax
+     b94:	cd 40                	int    $0x40
+     b96:	c3                   	ret
+
+00000b97 <read>:
+SYSCALL(read)
+     b97:	b8 05 00 00 00       	mov    $0x5,%eax
+     b9c:	cd 40                	int    $0x40
+     b9e:	c3                   	ret
+
+00000b9f <write>:
+SYSCALL(write)
+     b9f:	b8 10 00 00 00       	mov    $0x10,%eax
+     ba4:	cd 40                	int    $0x40
+     ba6:	c3                   	ret
+
+00000ba7 <close>:
+SYSCALL(close)
+     ba7:	b8 15 00 00 00       	mov    $0x15,%eax
+     bac:	cd 40                	int    $0x40
+     bae:	c3                   	ret
+
+00000baf <kill>:
+SYSCALL(kill)
+     baf:	b8 06 00 00 00       	mov    $0x6,%eax
+     bb4:	cd 40                	int    $0x40
+     bb6:	c3                   	ret
+
+00000bb7 <exec>:
+SYSCALL(exec)
+     bb7:	b8 07 00 00 00       	mov    $0x7,%eax
+     bbc:	cd 40                	int    $0x40
+     bbe:	c3                   	ret
+
+00000bbf <open>:
+SYSCALL(open)
+     bbf:	b8 0f 00 00 00       	mov    $0xf,%eax
+     bc4:	cd 40                	int    $0x40
+     bc6:	c3                   	ret
+
+00000bc7 <mknod>:
+SYSCALL(mknod)
+     bc7:	b8 11 00 00 00       	mov    $0x11,%eax
+     bcc:	cd 40                	int    $0x40
+     bce:	c3                   	ret
+
+00000bcf <unlink>:
+SYSCALL(unlink)
+     bcf:	b8 12 00 00 00       	mov    $0x12,%eax
+     bd4:	cd 40                	int    $0x40
+     bd6:	c3                   	ret
+
+00000bd7 <fstat>:
+SYSCALL(fstat)
+     bd7:	b8 08 00 00 00       	mov    $0x8,%eax
+     bdc:	cd 40                	int    $0x40
+     bde:	c3                   	ret
+
+00000bdf <link>:
+SYSCALL(link)
+     bdf:	b8 13 00 00 00       	mov    $0x13,%eax
+     be4:	cd 40                	int    $0x40
+     be6:	c3                   	ret
+
+00000be7 <mkdir>:
+SYSCALL(mkdir)
+     be7:	b8 14 00 00 00       	mov    $0x14,%eax
+     bec:	cd 40                	int    $0x40
+     bee:	c3                   	ret
+
+00000bef <chdir>:
+SYSCALL(chdir)
+     bef:	b8 09 00 00 00       	mov    $0x9,%eax
+     bf4:	cd 40                	int    $0x40
+     bf6:	c3                   	ret
+
+00000bf7 <dup>:
+SYSCALL(dup)
+     bf7:	b8 0a 00 00 00       	mov    $0xa,%eax
+     bfc:	cd 40                	int    $0x40
+     bfe:	c3                   	ret
+
+00000bff <getpid>:
+SYSCALL(getpid)
+     bff:	b8 0b 00 00 00       	mov    $0xb,%eax
+     c04:	cd 40                	int    $0x40
+     c06:	c3                   	ret
+
+00000c07 <sbrk>:
+SYSCALL(sbrk)
+     c07:	b8 0c 00 00 00       	mov    $0xc,%eax
+     c0c:	cd 40                	int    $0x40
+     c0e:	c3                   	ret
+
+00000c0f <sleep>:
+SYSCALL(sleep)
+     c0f:	b8 0d 00 00 00       	mov    $0xd,%eax
+     c14:	cd 40                	int    $0x40
+     c16:	c3                   	ret
+
+00000c17 <uptime>:
+SYSCALL(uptime)
+     c17:	b8 0e 00 00 00       	mov    $0xe,%eax
+     c1c:	cd 40                	int    $0x40
+     c1e:	c3                   	ret
+
+00000c1f <setsched>:
+SYSCALL(setsched)
+     c1f:	b8 16 00 00 00       	mov    $0x16,%eax
+     c24:	cd 40                	int    $0x40
+     c26:	c3                   	ret
+
+00000c27 <memstat>:
+SYSCALL(memstat)
+     c27:	b8 17 00 00 00       	mov    $0x17,%eax
+     c2c:	cd 40                	int    $0x40
+     c2e:	c3                   	ret
+
+00000c2f <lseek>:
+SYSCALL(lseek)
+     c2f:	b8 18 00 00 00       	mov    $0x18,%eax
+     c34:	cd 40                	int    $0x40
+     c36:	c3                   	ret
+
+00000c37 <setiosched>:
+SYSCALL(setiosched)
+     c37:	b8 19 00 00 00       	mov    $0x19,%eax
+     c3c:	cd 40                	int    $0x40
+     c3e:	c3                   	ret
+
+00000c3f <iostat>:
+SYSCALL(iostat)
+     c3f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     c44:	cd 40                	int    $0x40
+     c46:	c3                   	ret
+     c47:	66 90                	xchg   %ax,%ax
+     c49:	66 90                	xchg   %ax,%ax
+     c4b:	66 90                	xchg   %ax,%ax
+     c4d:	66 90                	xchg   %ax,%ax
+     c4f:	90                   	nop
+
+00000c50 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	56                   	push   %esi
+     c55:	53                   	push   %ebx
+     c56:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     c58:	89 d1                	mov    %edx,%ecx
+{
+     c5a:	83 ec 3c             	sub    $0x3c,%esp
+     c5d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     c60:	85 d2                	test   %edx,%edx
+     c62:	0f 89 80 00 00 00    	jns    ce8 <printint+0x98>
+     c68:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c6c:	74 7a                	je     ce8 <printint+0x98>
+    x = -xx;
+     c6e:	f7 d9                	neg    %ecx
+    neg = 1;
+     c70:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c75:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c78:	31 f6                	xor    %esi,%esi
+     c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c80:	89 c8                	mov    %ecx,%eax
+     c82:	31 d2                	xor    %edx,%edx
+     c84:	89 f7                	mov    %esi,%edi
+     c86:	f7 f3                	div    %ebx
+     c88:	8d 76 01             	lea    0x1(%esi),%esi
+     c8b:	0f b6 92 b8 11 00 00 	movzbl 0x11b8(%edx),%edx
+     c92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c96:	89 ca                	mov    %ecx,%edx
+     c98:	89 c1                	mov    %eax,%ecx
+     c9a:	39 da                	cmp    %ebx,%edx
+     c9c:	73 e2                	jae    c80 <printint+0x30>
+  if(neg)
+     c9e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ca1:	85 c0                	test   %eax,%eax
+     ca3:	74 07                	je     cac <printint+0x5c>
+    buf[i++] = '-';
+     ca5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     caa:	89 f7                	mov    %esi,%edi
+     cac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     caf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     cb2:	01 df                	add    %ebx,%edi
+     cb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     cb8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     cbb:	83 ec 04             	sub    $0x4,%esp
+     cbe:	88 45 d7             	mov    %al,-0x29(%ebp)
+     cc1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     cc4:	6a 01                	push   $0x1
+     cc6:	50                   	push   %eax
+     cc7:	56                   	push   %esi
+     cc8:	e8 d2 fe ff ff       	call   b9f <write>
+  while(--i >= 0)
+     ccd:	89 f8                	mov    %edi,%eax
+     ccf:	83 c4 10             	add    $0x10,%esp
+     cd2:	83 ef 01             	sub    $0x1,%edi
+     cd5:	39 d8                	cmp    %ebx,%eax
+     cd7:	75 df                	jne    cb8 <printint+0x68>
+}
+     cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cdc:	5b                   	pop    %ebx
+     cdd:	5e                   	pop    %esi
+     cde:	5f                   	pop    %edi
+     cdf:	5d                   	pop    %ebp
+     ce0:	c3                   	ret
+     ce1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     ce8:	31 c0                	xor    %eax,%eax
+     cea:	eb 89                	jmp    c75 <printint+0x25>
+     cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cf0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	57                   	push   %edi
+     cf4:	56                   	push   %esi
+     cf5:	53                   	push   %ebx
+     cf6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     cf9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     cfc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     cff:	0f b6 1e             	movzbl (%esi),%ebx
+     d02:	83 c6 01             	add    $0x1,%esi
+     d05:	84 db                	test   %bl,%bl
+     d07:	74 67                	je     d70 <printf+0x80>
+     d09:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d0c:	31 d2                	xor    %edx,%edx
+     d0e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     d11:	eb 34                	jmp    d47 <printf+0x57>
+     d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d17:	90                   	nop
+     d18:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     d1b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     d20:	83 f8 25             	cmp    $0x25,%eax
+     d23:	74 18                	je     d3d <printf+0x4d>
+  write(fd, &c, 1);
+     d25:	83 ec 04             	sub    $0x4,%esp
+     d28:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     d2b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d2e:	6a 01                	push   $0x1
+     d30:	50                   	push   %eax
+     d31:	57                   	push   %edi
+     d32:	e8 68 fe ff ff       	call   b9f <write>
+     d37:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     d3a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     d3d:	0f b6 1e             	movzbl (%esi),%ebx
+     d40:	83 c6 01             	add    $0x1,%esi
+     d43:	84 db                	test   %bl,%bl
+     d45:	74 29                	je     d70 <printf+0x80>
+    c = fmt[i] & 0xff;
+     d47:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     d4a:	85 d2                	test   %edx,%edx
+     d4c:	74 ca                	je     d18 <printf+0x28>
+      }
+    } else if(state == '%'){
+     d4e:	83 fa 25             	cmp    $0x25,%edx
+     d51:	75 ea                	jne    d3d <printf+0x4d>
+      if(c == 'd'){
+     d53:	83 f8 25             	cmp    $0x25,%eax
+     d56:	0f 84 24 01 00 00    	je     e80 <printf+0x190>
+     d5c:	83 e8 63             	sub    $0x63,%eax
+     d5f:	83 f8 15             	cmp    $0x15,%eax
+     d62:	77 1c                	ja     d80 <printf+0x90>
+     d64:	ff 24 85 60 11 00 00 	jmp    *0x1160(,%eax,4)
+     d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     d70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d73:	5b                   	pop    %ebx
+     d74:	5e                   	pop    %esi
+     d75:	5f                   	pop    %edi
+     d76:	5d                   	pop    %ebp
+     d77:	c3                   	ret
+     d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7f:	90                   	nop
+  write(fd, &c, 1);
+     d80:	83 ec 04             	sub    $0x4,%esp
+     d83:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     d86:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     d8a:	6a 01                	push   $0x1
+     d8c:	52                   	push   %edx
+     d8d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     d90:	57                   	push   %edi
+     d91:	e8 09 fe ff ff       	call   b9f <write>
+     d96:	83 c4 0c             	add    $0xc,%esp
+     d99:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d9c:	6a 01                	push   $0x1
+     d9e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     da1:	52                   	push   %edx
+     da2:	57                   	push   %edi
+     da3:	e8 f7 fd ff ff       	call   b9f <write>
+        putc(fd, c);
+     da8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     dab:	31 d2                	xor    %edx,%edx
+     dad:	eb 8e                	jmp    d3d <printf+0x4d>
+     daf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     db0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     db3:	83 ec 0c             	sub    $0xc,%esp
+     db6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     dbb:	8b 13                	mov    (%ebx),%edx
+     dbd:	6a 00                	push   $0x0
+     dbf:	89 f8                	mov    %edi,%eax
+        ap++;
+     dc1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     dc4:	e8 87 fe ff ff       	call   c50 <printint>
+        ap++;
+     dc9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     dcc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     dcf:	31 d2                	xor    %edx,%edx
+     dd1:	e9 67 ff ff ff       	jmp    d3d <printf+0x4d>
+     dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     de0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     de3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     de5:	83 c0 04             	add    $0x4,%eax
+     de8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     deb:	85 db                	test   %ebx,%ebx
+     ded:	0f 84 9d 00 00 00    	je     e90 <printf+0x1a0>
+        while(*s != 0){
+     df3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     df6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     df8:	84 c0                	test   %al,%al
+     dfa:	0f 84 3d ff ff ff    	je     d3d <printf+0x4d>
+     e00:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e03:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     e06:	89 de                	mov    %ebx,%esi
+     e08:	89 d3                	mov    %edx,%ebx
+     e0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     e10:	83 ec 04             	sub    $0x4,%esp
+     e13:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     e16:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     e19:	6a 01                	push   $0x1
+     e1b:	53                   	push   %ebx
+     e1c:	57                   	push   %edi
+     e1d:	e8 7d fd ff ff       	call   b9f <write>
+        while(*s != 0){
+     e22:	0f b6 06             	movzbl (%esi),%eax
+     e25:	83 c4 10             	add    $0x10,%esp
+     e28:	84 c0                	test   %al,%al
+     e2a:	75 e4                	jne    e10 <printf+0x120>
+      state = 0;
+     e2c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     e2f:	31 d2                	xor    %edx,%edx
+     e31:	e9 07 ff ff ff       	jmp    d3d <printf+0x4d>
+     e36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     e40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     e43:	83 ec 0c             	sub    $0xc,%esp
+     e46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e4b:	8b 13                	mov    (%ebx),%edx
+     e4d:	6a 01                	push   $0x1
+     e4f:	e9 6b ff ff ff       	jmp    dbf <printf+0xcf>
+     e54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     e58:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     e5b:	83 ec 04             	sub    $0x4,%esp
+     e5e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     e61:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     e63:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     e66:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     e69:	6a 01                	push   $0x1
+     e6b:	52                   	push   %edx
+     e6c:	57                   	push   %edi
+     e6d:	e8 2d fd ff ff       	call   b9f <write>
+        ap++;
+     e72:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     e75:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e78:	31 d2                	xor    %edx,%edx
+     e7a:	e9 be fe ff ff       	jmp    d3d <printf+0x4d>
+     e7f:	90                   	nop
+  write(fd, &c, 1);
+     e80:	83 ec 04             	sub    $0x4,%esp
+     e83:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     e86:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e89:	6a 01                	push   $0x1
+     e8b:	e9 11 ff ff ff       	jmp    da1 <printf+0xb1>
+     e90:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     e95:	bb 58 11 00 00       	mov    $0x1158,%ebx
+     e9a:	e9 61 ff ff ff       	jmp    e00 <printf+0x110>
+     e9f:	90                   	nop
+
+00000ea0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     ea0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ea1:	a1 c0 17 00 00       	mov    0x17c0,%eax
+{
+     ea6:	89 e5                	mov    %esp,%ebp
+     ea8:	57                   	push   %edi
+     ea9:	56                   	push   %esi
+     eaa:	53                   	push   %ebx
+     eab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     eae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     eb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eb8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     eba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ebc:	39 ca                	cmp    %ecx,%edx
+     ebe:	73 30                	jae    ef0 <free+0x50>
+     ec0:	39 c1                	cmp    %eax,%ecx
+     ec2:	72 04                	jb     ec8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ec4:	39 c2                	cmp    %eax,%edx
+     ec6:	72 f0                	jb     eb8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     ec8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     ecb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     ece:	39 f8                	cmp    %edi,%eax
+     ed0:	74 2e                	je     f00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ed2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     ed5:	8b 42 04             	mov    0x4(%edx),%eax
+     ed8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     edb:	39 f1                	cmp    %esi,%ecx
+     edd:	74 38                	je     f17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     edf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     ee1:	5b                   	pop    %ebx
+  freep = p;
+     ee2:	89 15 c0 17 00 00    	mov    %edx,0x17c0
+}
+     ee8:	5e                   	pop    %esi
+     ee9:	5f                   	pop    %edi
+     eea:	5d                   	pop    %ebp
+     eeb:	c3                   	ret
+     eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ef0:	39 c1                	cmp    %eax,%ecx
+     ef2:	72 d0                	jb     ec4 <free+0x24>
+     ef4:	eb c2                	jmp    eb8 <free+0x18>
+     ef6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     f00:	03 70 04             	add    0x4(%eax),%esi
+     f03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f06:	8b 02                	mov    (%edx),%eax
+     f08:	8b 00                	mov    (%eax),%eax
+     f0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f0d:	8b 42 04             	mov    0x4(%edx),%eax
+     f10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f13:	39 f1                	cmp    %esi,%ecx
+     f15:	75 c8                	jne    edf <free+0x3f>
+    p->s.size += bp->s.size;
+     f17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f1a:	89 15 c0 17 00 00    	mov    %edx,0x17c0
+    p->s.size += bp->s.size;
+     f20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f26:	89 0a                	mov    %ecx,(%edx)
+}
+     f28:	5b                   	pop    %ebx
+     f29:	5e                   	pop    %esi
+     f2a:	5f                   	pop    %edi
+     f2b:	5d                   	pop    %ebp
+     f2c:	c3                   	ret
+     f2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	57                   	push   %edi
+     f34:	56                   	push   %esi
+     f35:	53                   	push   %ebx
+     f36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     f3c:	8b 15 c0 17 00 00    	mov    0x17c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f42:	8d 78 07             	lea    0x7(%eax),%edi
+     f45:	c1 ef 03             	shr    $0x3,%edi
+     f48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     f4b:	85 d2                	test   %edx,%edx
+     f4d:	0f 84 8d 00 00 00    	je     fe0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f55:	8b 48 04             	mov    0x4(%eax),%ecx
+     f58:	39 f9                	cmp    %edi,%ecx
+     f5a:	73 64                	jae    fc0 <malloc+0x90>
+  if(nu < 4096)
+     f5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f61:	39 df                	cmp    %ebx,%edi
+     f63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     f6d:	eb 0a                	jmp    f79 <malloc+0x49>
+     f6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f72:	8b 48 04             	mov    0x4(%eax),%ecx
+     f75:	39 f9                	cmp    %edi,%ecx
+     f77:	73 47                	jae    fc0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f79:	89 c2                	mov    %eax,%edx
+     f7b:	39 05 c0 17 00 00    	cmp    %eax,0x17c0
+     f81:	75 ed                	jne    f70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     f83:	83 ec 0c             	sub    $0xc,%esp
+     f86:	56                   	push   %esi
+     f87:	e8 7b fc ff ff       	call   c07 <sbrk>
+  if(p == (char*)-1)
+     f8c:	83 c4 10             	add    $0x10,%esp
+     f8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f92:	74 1c                	je     fb0 <malloc+0x80>
+  hp->s.size = nu;
+     f94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     f97:	83 ec 0c             	sub    $0xc,%esp
+     f9a:	83 c0 08             	add    $0x8,%eax
+     f9d:	50                   	push   %eax
+     f9e:	e8 fd fe ff ff       	call   ea0 <free>
+  return freep;
+     fa3:	8b 15 c0 17 00 00    	mov    0x17c0,%edx
+      if((p = morecore(nunits)) == 0)
+     fa9:	83 c4 10             	add    $0x10,%esp
+     fac:	85 d2                	test   %edx,%edx
+     fae:	75 c0                	jne    f70 <malloc+0x40>
+        return 0;
+  }
+}
+     fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     fb3:	31 c0                	xor    %eax,%eax
+}
+     fb5:	5b                   	pop    %ebx
+     fb6:	5e                   	pop    %esi
+     fb7:	5f                   	pop    %edi
+     fb8:	5d                   	pop    %ebp
+     fb9:	c3                   	ret
+     fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     fc0:	39 cf                	cmp    %ecx,%edi
+     fc2:	74 4c                	je     1010 <malloc+0xe0>
+        p->s.size -= nunits;
+     fc4:	29 f9                	sub    %edi,%ecx
+     fc6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     fc9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     fcc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     fcf:	89 15 c0 17 00 00    	mov    %edx,0x17c0
+}
+     fd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     fd8:	83 c0 08             	add    $0x8,%eax
+}
+     fdb:	5b                   	pop    %ebx
+     fdc:	5e                   	pop    %esi
+     fdd:	5f                   	pop    %edi
+     fde:	5d                   	pop    %ebp
+     fdf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     fe0:	c7 05 c0 17 00 00 c4 	movl   $0x17c4,0x17c0
+     fe7:	17 00 00 
+    base.s.size = 0;
+     fea:	b8 c4 17 00 00       	mov    $0x17c4,%eax
+    base.s.ptr = freep = prevp = &base;
+     fef:	c7 05 c4 17 00 00 c4 	movl   $0x17c4,0x17c4
+     ff6:	17 00 00 
+    base.s.size = 0;
+     ff9:	c7 05 c8 17 00 00 00 	movl   $0x0,0x17c8
+    1000:	00 00 00 
+    if(p->s.size >= nunits){
+    1003:	e9 54 ff ff ff       	jmp    f5c <malloc+0x2c>
+    1008:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1010:	8b 08                	mov    (%eax),%ecx
+    1012:	89 0a                	mov    %ecx,(%edx)
+    1014:	eb b9                	jmp    fcf <malloc+0x9f>
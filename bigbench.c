@@ -0,0 +1,173 @@
+// Large file benchmark.
+// Writes a file of the given size sequentially, reads it back
+// sequentially, then reads and rewrites blocks of it at random,
+// which exercises the doubly and triply indirect blocks.  Then
+// does the same to small files that fit in their direct blocks,
+// to check that the deeper block maps cost them nothing.
+// The default fs.img has room for about a megabyte; build with
+// make FSSIZE=524288 to try files of hundreds of megabytes.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+
+#define NRANDOM 1000  // random block reads, and as many writes
+#define NSMALL   100  // small files
+
+char buf[BSIZE];
+uint randstate = 1;
+
+uint
+rand(void)
+{
+  randstate = randstate * 1664525 + 1013904223;
+  return randstate;
+}
+
+void
+report(char *what, int kb, int t)
+{
+  if(t == 0)
+    t = 1;
+  printf(1, "bigbench: %s %d KB in %d ticks, %d KB/tick\n",
+         what, kb, t, kb / t);
+}
+
+int
+openorfail(char *name, int mode)
+{
+  int fd;
+
+  if((fd = open(name, mode)) < 0){
+    printf(2, "bigbench: cannot open %s\n", name);
+    exit();
+  }
+  return fd;
+}
+
+void
+xread(int fd, int i)
+{
+  if(read(fd, buf, BSIZE) != BSIZE || ((int*)buf)[0] != i){
+    printf(2, "bigbench: bad block %d\n", i);
+    exit();
+  }
+}
+
+void
+xwrite(int fd, int i)
+{
+  ((int*)buf)[0] = i;
+  if(write(fd, buf, BSIZE) != BSIZE){
+    printf(2, "bigbench: write failed, disk full?\n");
+    exit();
+  }
+}
+
+// Sequential and random I/O on one file of nblocks blocks.
+void
+bigfile(int nblocks)
+{
+  int fd, i, b, t;
+
+  t = uptime();
+  fd = openorfail("bigbench.big", O_CREATE|O_RDWR);
+  for(i = 0; i < nblocks; i++)
+    xwrite(fd, i);
+  close(fd);
+  report("big sequential write", nblocks/2, uptime() - t);
+
+  t = uptime();
+  fd = openorfail("bigbench.big", O_RDONLY);
+  for(i = 0; i < nblocks; i++)
+    xread(fd, i);
+  close(fd);
+  report("big sequential read", nblocks/2, uptime() - t);
+
+  t = uptime();
+  fd = openorfail("bigbench.big", O_RDWR);
+  for(i = 0; i < NRANDOM; i++){
+    b = rand() % nblocks;
+    lseek(fd, b*BSIZE, SEEK_SET);
+    xread(fd, b);
+  }
+  report("big random read", NRANDOM/2, uptime() - t);
+
+  t = uptime();
+  for(i = 0; i < NRANDOM; i++){
+    b = rand() % nblocks;
+    lseek(fd, b*BSIZE, SEEK_SET);
+    xwrite(fd, b);
+  }
+  close(fd);
+  report("big random write", NRANDOM/2, uptime() - t);
+
+  t = uptime();
+  unlink("bigbench.big");
+  report("big unlink", nblocks/2, uptime() - t);
+}
+
+// The same on NSMALL files of NDIRECT blocks each.
+void
+smallfiles(void)
+{
+  char name[] = "bigbench.s00";
+  int fd, i, j, t;
+
+  t = uptime();
+  for(i = 0; i < NSMALL; i++){
+    name[10] = '0' + i/10;
+    name[11] = '0' + i%10;
+    fd = openorfail(name, O_CREATE|O_RDWR);
+    for(j = 0; j < NDIRECT; j++)
+      xwrite(fd, j);
+    close(fd);
+  }
+  report("small sequential write", NSMALL*NDIRECT/2, uptime() - t);
+
+  t = uptime();
+  for(i = 0; i < NSMALL; i++){
+    name[10] = '0' + i/10;
+    name[11] = '0' + i%10;
+    fd = openorfail(name, O_RDONLY);
+    for(j = 0; j < NDIRECT; j++)
+      xread(fd, j);
+    close(fd);
+  }
+  report("small sequential read", NSMALL*NDIRECT/2, uptime() - t);
+
+  t = uptime();
+  for(i = 0; i < NRANDOM; i++){
+    name[10] = '0' + i%NSMALL/10;
+    name[11] = '0' + i%10;
+    j = rand() % NDIRECT;
+    fd = openorfail(name, O_RDONLY);
+    lseek(fd, j*BSIZE, SEEK_SET);
+    xread(fd, j);
+    close(fd);
+  }
+  report("small random read", NRANDOM/2, uptime() - t);
+
+  for(i = 0; i < NSMALL; i++){
+    name[10] = '0' + i/10;
+    name[11] = '0' + i%10;
+    unlink(name);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int mb;
+
+  mb = argc > 1 ? atoi(argv[1]) : 1;
+  if(mb < 1 || mb > MAXFILE/2048){
+    printf(2, "usage: bigbench [megabytes]\n");
+    exit();
+  }
+  bigfile(mb*2048);
+  smallfiles();
+  exit();
+}
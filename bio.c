@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,79 +17,257 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_ASYNC: a read-ahead is in flight; the disk interrupt
+//     releases the buffer when it completes.
+// * B_READAHEAD: the buffer was filled by read-ahead and
+//     has not been read since.
+//
+// Buffers hash on (dev, blockno) into buckets, each with its own
+// lock and its own list in most-recently-used order, so lookups
+// of different blocks rarely contend.  binit() makes one bucket
+// per BUFPERBUCKET buffers, to keep the lists short however large
+// the cache is.  A miss recycles the
+// least recently used free buffer of its own bucket, or else of the
+// next bucket that has one; there is no global LRU list and no
+// global lock.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "memstat.h"
+#include "iostat.h"
 
-struct {
+#define BUFPERBUCKET 4  // buffers per hash bucket, on average
+#define BHASH(dev, blockno) (((dev)*31 + (blockno)) % bcache.nbucket)
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  // List of buffers in this bucket, through prev/next,
+  // from the most (head) to the least (tail) recently used.
+  struct buf *head;
+  struct buf *tail;
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+struct {
+  struct bucket *bucket;
+  int nbucket;
+  int nbuf;
+  uint hit;       // bread() found the block cached
+  uint miss;      // ... or had to read it
+  uint raissued;  // read-ahead blocks sent to the disk
+  uint rahit;     // ... later read by bread()
+  uint rawaste;   // ... recycled without being read
 } bcache;
 
+// Unlink b from bk's list.  Caller must hold bk->lock.
+static void
+bunlink(struct bucket *bk, struct buf *b)
+{
+  if(b->prev)
+    b->prev->next = b->next;
+  else
+    bk->head = b->next;
+  if(b->next)
+    b->next->prev = b->prev;
+  else
+    bk->tail = b->prev;
+}
+
+// Insert b at the MRU end of bk.  Caller must hold bk->lock.
+static void
+blink(struct bucket *bk, struct buf *b)
+{
+  b->prev = 0;
+  b->next = bk->head;
+  if(bk->head)
+    bk->head->prev = b;
+  else
+    bk->tail = b;
+  bk->head = b;
+}
+
+// Carve the cache out of whole pages, taking 1/BUFMEMFRAC of free
+// memory but at least NBUF buffers.  Must come after kinit2().
 void
 binit(void)
 {
+  struct memstat st;
+  struct bucket *bk;
   struct buf *b;
+  char *p;
+  int i, k, npage, perpage;
+
+  kmemstat(&st);
+  npage = st.ncached;
+  for(k = 0; k <= MAXORDER; k++)
+    npage += st.nfree[k] << k;
+  perpage = PGSIZE / sizeof(struct buf);
+  npage /= BUFMEMFRAC;
+  if(npage*perpage < NBUF)
+    npage = (NBUF + perpage - 1) / perpage;
 
-  initlock(&bcache.lock, "bcache");
+  // The buckets, BUFPERBUCKET buffers' worth or more,
+  // in the smallest block of pages that holds them.
+  for(k = 0; k < MAXORDER &&
+      (PGSIZE<<k) < npage*perpage/BUFPERBUCKET*sizeof(struct bucket); k++)
+    ;
+  if((p = buddyalloc(k)) == 0)
+    panic("binit: no memory");
+  memset(p, 0, PGSIZE<<k);
+  bcache.bucket = (struct bucket*)p;
+  bcache.nbucket = (PGSIZE<<k) / sizeof(struct bucket);
+  for(bk = bcache.bucket; bk < bcache.bucket+bcache.nbucket; bk++)
+    initlock(&bk->lock, "bcache");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  // Spread the buffers over the buckets.
+  for(; npage > 0; npage--){
+    if((p = kalloc()) == 0)
+      break;
+    memset(p, 0, PGSIZE);
+    for(i = 0; i < perpage; i++){
+      b = (struct buf*)p + i;
+      initsleeplock(&b->lock, "buffer");
+      b->dev = -1;
+      blink(&bcache.bucket[bcache.nbuf % bcache.nbucket], b);
+      bcache.nbuf++;
+    }
   }
+  if(bcache.nbuf < NBUF)
+    panic("binit: no memory");
 }
 
-// Look through buffer cache for block on device dev.
+// Return the least recently used buffer in bk that may be
+// recycled, or 0.  Caller must hold bk->lock.
+// Even if refcnt==0, B_DIRTY indicates a buffer is in use
+// because log.c has modified it but not yet committed it.
+static struct buf*
+bvictim(struct bucket *bk)
+{
+  struct buf *b;
+
+  for(b = bk->tail; b; b = b->prev){
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      if(b->flags & B_READAHEAD)
+        __sync_fetch_and_add(&bcache.rawaste, 1);
+      return b;
+    }
+  }
+  return 0;
+}
+
+// Take a recyclable buffer out of some bucket other than self,
+// holding only one bucket lock at a time.
+// Returns it unlinked with refcnt 1, or 0 if there is none.
+static struct buf*
+bsteal(struct bucket *self)
+{
+  struct bucket *bk;
+  struct buf *b;
+  int i;
+
+  bk = self;
+  for(i = 1; i < bcache.nbucket; i++){
+    if(++bk == bcache.bucket+bcache.nbucket)
+      bk = bcache.bucket;
+    acquire(&bk->lock);
+    if((b = bvictim(bk)) != 0){
+      bunlink(bk, b);
+      b->refcnt = 1;
+    }
+    release(&bk->lock);
+    if(b)
+      return b;
+  }
+  return 0;
+}
+
+// Look through the bucket for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
+// If ahead is set, return 0 instead of a cached block or
+// if no buffer is free; a newly allocated buffer is then
+// locked without sleeping.
 static struct buf*
-bget(uint dev, uint blockno)
+bget(uint dev, uint blockno, int ahead)
 {
-  struct buf *b;
+  struct bucket *bk;
+  struct buf *b, *nb;
 
-  acquire(&bcache.lock);
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+  acquire(&bk->lock);
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  for(b = bk->head; b; b = b->next){
     if(b->dev == dev && b->blockno == blockno){
+      if(ahead){
+        release(&bk->lock);
+        return 0;
+      }
       b->refcnt++;
-      release(&bcache.lock);
+      release(&bk->lock);
       acquiresleep(&b->lock);
       return b;
     }
   }
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
+  // Not cached; recycle an unused buffer of this bucket.
+  if((b = bvictim(bk)) != 0){
+    b->dev = dev;
+    b->blockno = blockno;
+    b->flags = 0;
+    b->refcnt = 1;
+    release(&bk->lock);
+    acquiresleep(&b->lock);
+    return b;
+  }
+
+  // Borrow one from another bucket.  bk->lock must be
+  // dropped meanwhile, so another process may have added
+  // the block by the time it is taken again.
+  release(&bk->lock);
+  nb = bsteal(bk);
+  acquire(&bk->lock);
+  for(b = bk->head; b; b = b->next){
+    if(b->dev == dev && b->blockno == blockno){
+      if(nb){
+        // Keep the borrowed buffer here, marked invalid.
+        // Its old block hashes elsewhere, so no lookup in
+        // this bucket can match it.
+        nb->flags = 0;
+        nb->refcnt = 0;
+        blink(bk, nb);
+      }
+      if(ahead){
+        release(&bk->lock);
+        return 0;
+      }
+      b->refcnt++;
+      release(&bk->lock);
       acquiresleep(&b->lock);
       return b;
     }
   }
-  panic("bget: no buffers");
+  if(nb == 0){
+    // Read-ahead is optional; let it skip the block.
+    if(ahead){
+      release(&bk->lock);
+      return 0;
+    }
+    panic("bget: no buffers");
+  }
+  nb->dev = dev;
+  nb->blockno = blockno;
+  nb->flags = 0;
+  blink(bk, nb);
+  release(&bk->lock);
+  acquiresleep(&nb->lock);
+  return nb;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -98,13 +276,45 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if((b->flags & B_VALID) == 0) {
+    __sync_fetch_and_add(&bcache.miss, 1);
     iderw(b);
+  } else {
+    __sync_fetch_and_add(&bcache.hit, 1);
+  }
+  if(b->flags & B_READAHEAD){
+    b->flags &= ~B_READAHEAD;
+    __sync_fetch_and_add(&bcache.rahit, 1);
   }
   return b;
 }
 
+// Start reading a block into the cache without waiting
+// for it.  Does nothing if the block is already cached.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = bget(dev, blockno, 1)) == 0)
+    return;
+  b->flags |= B_ASYNC | B_READAHEAD;
+  __sync_fetch_and_add(&bcache.raissued, 1);
+  iderw(b);
+}
+
+// Called by the disk interrupt handler when the read
+// started by breadahead() has completed.  Releases the
+// buffer on behalf of the process that started it.
+void
+bdone(struct buf *b)
+{
+  b->flags &= ~B_ASYNC;
+  releasesleep(&b->lock);
+  bunpin(b);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,30 +325,68 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Keep b in the cache after it is released, until bunpin().
+// Caller must hold a reference to b.
+void
+bpin(struct buf *b)
+{
+  struct bucket *bk;
+
+  bk = &bcache.bucket[BHASH(b->dev, b->blockno)];
+  acquire(&bk->lock);
+  b->refcnt++;
+  release(&bk->lock);
+}
+
+void
+bunpin(struct buf *b)
+{
+  struct bucket *bk;
+
+  bk = &bcache.bucket[BHASH(b->dev, b->blockno)];
+  acquire(&bk->lock);
+  if(--b->refcnt == 0){
+    bunlink(bk, b);
+    blink(bk, b);
+  }
+  release(&bk->lock);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// Move to the head of its bucket's MRU list.
 void
 brelse(struct buf *b)
 {
+  struct bucket *bk;
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  // b cannot be recycled, and so cannot change
+  // bucket, while this reference is held.
+  bk = &bcache.bucket[BHASH(b->dev, b->blockno)];
+  acquire(&bk->lock);
   b->refcnt--;
   if (b->refcnt == 0) {
     // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    bunlink(bk, b);
+    blink(bk, b);
   }
   
-  release(&bcache.lock);
+  release(&bk->lock);
+}
+
+// Report block cache statistics.
+void
+biostat(struct iostat *st)
+{
+  st->bhit = bcache.hit;
+  st->bmiss = bcache.miss;
+  st->raissued = bcache.raissued;
+  st->rahit = bcache.rahit;
+  st->rawaste = bcache.rawaste;
 }
 //PAGEBREAK!
 // Blank page.
-
@@ -7,8 +7,20 @@ struct buf {
   struct buf *prev; // LRU cache list
   struct buf *next;
   struct buf *qnext; // disk queue
+  uint qtime;        // ticks when queued
+  uint qtsc;         // TSC when queued, for iostat
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // disk interrupt releases buffer when done
+#define B_READAHEAD 0x10  // filled by read-ahead, not read yet
 
+
+// Requests waiting for a disk; see iosched.c.
+struct ioqueue {
+  struct buf *head;  // oldest
+  struct buf *tail;
+  int n;
+  uint pos;          // block after the last one started
+};
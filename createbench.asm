@@ -0,0 +1,1393 @@
+
+_createbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#define NBATCH 10  // files per batch
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  char name[] = "cb000";
+  10:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+  15:	51                   	push   %ecx
+  16:	83 ec 28             	sub    $0x28,%esp
+  int n, i, fd, t;
+
+  n = argc > 1 ? atoi(argv[1]) : 150;
+  19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  char name[] = "cb000";
+  1f:	c7 45 e2 63 62 30 30 	movl   $0x30306263,-0x1e(%ebp)
+  26:	66 89 5d e6          	mov    %bx,-0x1a(%ebp)
+  n = argc > 1 ? atoi(argv[1]) : 150;
+  2a:	0f 8f d9 00 00 00    	jg     109 <main+0x109>
+  if(n < 1 || n > 999){
+    printf(2, "usage: createbench [files]\n");
+    exit();
+  }
+  t = uptime();
+  30:	e8 c2 04 00 00       	call   4f7 <uptime>
+  n = argc > 1 ? atoi(argv[1]) : 150;
+  35:	be 96 00 00 00       	mov    $0x96,%esi
+  t = uptime();
+  3a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < n; i++){
+    name[2] = '0' + i/100;
+    name[3] = '0' + i/10%10;
+  3d:	31 c0                	xor    %eax,%eax
+  3f:	89 f3                	mov    %esi,%ebx
+  41:	89 c6                	mov    %eax,%esi
+  43:	eb 0e                	jmp    53 <main+0x53>
+  45:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < n; i++){
+  48:	83 c6 01             	add    $0x1,%esi
+  4b:	39 de                	cmp    %ebx,%esi
+  4d:	0f 84 b2 00 00 00    	je     105 <main+0x105>
+    name[2] = '0' + i/100;
+  53:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[4] = '0' + i%10;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+  58:	83 ec 08             	sub    $0x8,%esp
+    name[2] = '0' + i/100;
+  5b:	f7 e6                	mul    %esi
+    name[3] = '0' + i/10%10;
+  5d:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    name[2] = '0' + i/100;
+  62:	c1 ea 05             	shr    $0x5,%edx
+  65:	83 c2 30             	add    $0x30,%edx
+  68:	88 55 e4             	mov    %dl,-0x1c(%ebp)
+    name[3] = '0' + i/10%10;
+  6b:	f7 e6                	mul    %esi
+  6d:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  72:	89 d7                	mov    %edx,%edi
+  74:	c1 ef 03             	shr    $0x3,%edi
+  77:	f7 e7                	mul    %edi
+  79:	89 f8                	mov    %edi,%eax
+  7b:	c1 ea 03             	shr    $0x3,%edx
+  7e:	8d 14 92             	lea    (%edx,%edx,4),%edx
+  81:	01 d2                	add    %edx,%edx
+  83:	29 d0                	sub    %edx,%eax
+  85:	83 c0 30             	add    $0x30,%eax
+  88:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[4] = '0' + i%10;
+  8b:	8d 04 bf             	lea    (%edi,%edi,4),%eax
+  8e:	89 f7                	mov    %esi,%edi
+  90:	01 c0                	add    %eax,%eax
+  92:	29 c7                	sub    %eax,%edi
+  94:	8d 47 30             	lea    0x30(%edi),%eax
+  97:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+  9a:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+  9d:	68 02 02 00 00       	push   $0x202
+  a2:	50                   	push   %eax
+  a3:	e8 f7 03 00 00       	call   49f <open>
+  a8:	83 c4 10             	add    $0x10,%esp
+  ab:	85 c0                	test   %eax,%eax
+  ad:	0f 88 87 00 00 00    	js     13a <main+0x13a>
+      printf(2, "createbench: cannot create %s\n", name);
+      n = i;
+      break;
+    }
+    close(fd);
+  b3:	83 ec 0c             	sub    $0xc,%esp
+  b6:	50                   	push   %eax
+  b7:	e8 cb 03 00 00       	call   487 <close>
+    if(i % NBATCH == NBATCH-1 || i == n-1){
+  bc:	83 c4 10             	add    $0x10,%esp
+  bf:	83 ff 09             	cmp    $0x9,%edi
+  c2:	74 0b                	je     cf <main+0xcf>
+  c4:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  c7:	39 f0                	cmp    %esi,%eax
+  c9:	0f 85 79 ff ff ff    	jne    48 <main+0x48>
+      printf(1, "createbench: files %d-%d in %d ticks\n",
+             i - i%NBATCH, i, uptime() - t);
+  cf:	e8 23 04 00 00       	call   4f7 <uptime>
+      printf(1, "createbench: files %d-%d in %d ticks\n",
+  d4:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  d7:	83 ec 0c             	sub    $0xc,%esp
+  da:	29 c8                	sub    %ecx,%eax
+  dc:	50                   	push   %eax
+  dd:	89 f0                	mov    %esi,%eax
+  df:	29 f8                	sub    %edi,%eax
+  e1:	56                   	push   %esi
+  for(i = 0; i < n; i++){
+  e2:	83 c6 01             	add    $0x1,%esi
+      printf(1, "createbench: files %d-%d in %d ticks\n",
+  e5:	50                   	push   %eax
+  e6:	68 34 09 00 00       	push   $0x934
+  eb:	6a 01                	push   $0x1
+  ed:	e8 de 04 00 00       	call   5d0 <printf>
+      t = uptime();
+  f2:	83 c4 20             	add    $0x20,%esp
+  f5:	e8 fd 03 00 00       	call   4f7 <uptime>
+  fa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < n; i++){
+  fd:	39 de                	cmp    %ebx,%esi
+  ff:	0f 85 4e ff ff ff    	jne    53 <main+0x53>
+ 105:	89 f3                	mov    %esi,%ebx
+ 107:	eb 4b                	jmp    154 <main+0x154>
+  n = argc > 1 ? atoi(argv[1]) : 150;
+ 109:	83 ec 0c             	sub    $0xc,%esp
+ 10c:	ff 70 04             	push   0x4(%eax)
+ 10f:	e8 8c 02 00 00       	call   3a0 <atoi>
+  if(n < 1 || n > 999){
+ 114:	83 c4 10             	add    $0x10,%esp
+  n = argc > 1 ? atoi(argv[1]) : 150;
+ 117:	89 c6                	mov    %eax,%esi
+  if(n < 1 || n > 999){
+ 119:	8d 40 ff             	lea    -0x1(%eax),%eax
+ 11c:	3d e6 03 00 00       	cmp    $0x3e6,%eax
+ 121:	0f 86 92 00 00 00    	jbe    1b9 <main+0x1b9>
+    printf(2, "usage: createbench [files]\n");
+ 127:	52                   	push   %edx
+ 128:	52                   	push   %edx
+ 129:	68 f8 08 00 00       	push   $0x8f8
+ 12e:	6a 02                	push   $0x2
+ 130:	e8 9b 04 00 00       	call   5d0 <printf>
+    exit();
+ 135:	e8 25 03 00 00       	call   45f <exit>
+      printf(2, "createbench: cannot create %s\n", name);
+ 13a:	50                   	push   %eax
+ 13b:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+ 13e:	89 f3                	mov    %esi,%ebx
+ 140:	50                   	push   %eax
+ 141:	68 14 09 00 00       	push   $0x914
+ 146:	6a 02                	push   $0x2
+ 148:	e8 83 04 00 00       	call   5d0 <printf>
+    }
+  }
+  for(i = 0; i < n; i++){
+ 14d:	83 c4 10             	add    $0x10,%esp
+ 150:	85 f6                	test   %esi,%esi
+ 152:	74 60                	je     1b4 <main+0x1b4>
+ 154:	31 ff                	xor    %edi,%edi
+    name[2] = '0' + i/100;
+    name[3] = '0' + i/10%10;
+ 156:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+    name[2] = '0' + i/100;
+ 160:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[4] = '0' + i%10;
+    unlink(name);
+ 165:	83 ec 0c             	sub    $0xc,%esp
+    name[2] = '0' + i/100;
+ 168:	f7 e7                	mul    %edi
+    name[3] = '0' + i/10%10;
+ 16a:	89 f8                	mov    %edi,%eax
+    name[2] = '0' + i/100;
+ 16c:	c1 ea 05             	shr    $0x5,%edx
+ 16f:	83 c2 30             	add    $0x30,%edx
+ 172:	88 55 e4             	mov    %dl,-0x1c(%ebp)
+    name[3] = '0' + i/10%10;
+ 175:	f7 e6                	mul    %esi
+ 177:	89 d1                	mov    %edx,%ecx
+ 179:	c1 e9 03             	shr    $0x3,%ecx
+ 17c:	89 c8                	mov    %ecx,%eax
+ 17e:	f7 e6                	mul    %esi
+ 180:	89 c8                	mov    %ecx,%eax
+ 182:	c1 ea 03             	shr    $0x3,%edx
+ 185:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ 188:	01 d2                	add    %edx,%edx
+ 18a:	29 d0                	sub    %edx,%eax
+    name[4] = '0' + i%10;
+ 18c:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+    name[3] = '0' + i/10%10;
+ 18f:	83 c0 30             	add    $0x30,%eax
+    name[4] = '0' + i%10;
+ 192:	01 d2                	add    %edx,%edx
+    name[3] = '0' + i/10%10;
+ 194:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[4] = '0' + i%10;
+ 197:	89 f8                	mov    %edi,%eax
+  for(i = 0; i < n; i++){
+ 199:	83 c7 01             	add    $0x1,%edi
+    name[4] = '0' + i%10;
+ 19c:	29 d0                	sub    %edx,%eax
+ 19e:	83 c0 30             	add    $0x30,%eax
+ 1a1:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(name);
+ 1a4:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+ 1a7:	50                   	push   %eax
+ 1a8:	e8 02 03 00 00       	call   4af <unlink>
+  for(i = 0; i < n; i++){
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	39 df                	cmp    %ebx,%edi
+ 1b2:	75 ac                	jne    160 <main+0x160>
+  }
+  exit();
+ 1b4:	e8 a6 02 00 00       	call   45f <exit>
+  t = uptime();
+ 1b9:	e8 39 03 00 00       	call   4f7 <uptime>
+ 1be:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < n; i++){
+ 1c1:	e9 77 fe ff ff       	jmp    3d <main+0x3d>
+ 1c6:	66 90                	xchg   %ax,%ax
+ 1c8:	66 90                	xchg   %ax,%ax
+ 1ca:	66 90                	xchg   %ax,%ax
+ 1cc:	66 90                	xchg   %ax,%ax
+ 1ce:	66 90                	xchg   %ax,%ax
+
+000001d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1d1:	31 c0                	xor    %eax,%eax
+{
+ 1d3:	89 e5                	mov    %esp,%ebp
+ 1d5:	53                   	push   %ebx
+ 1d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1e7:	83 c0 01             	add    $0x1,%eax
+ 1ea:	84 d2                	test   %dl,%dl
+ 1ec:	75 f2                	jne    1e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f1:	89 c8                	mov    %ecx,%eax
+ 1f3:	c9                   	leave
+ 1f4:	c3                   	ret
+ 1f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+ 207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 20a:	0f b6 02             	movzbl (%edx),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 17                	jne    228 <strcmp+0x28>
+ 211:	eb 3a                	jmp    24d <strcmp+0x4d>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 21c:	83 c2 01             	add    $0x1,%edx
+ 21f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 222:	84 c0                	test   %al,%al
+ 224:	74 1a                	je     240 <strcmp+0x40>
+    p++, q++;
+ 226:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 228:	0f b6 19             	movzbl (%ecx),%ebx
+ 22b:	38 c3                	cmp    %al,%bl
+ 22d:	74 e9                	je     218 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 22f:	29 d8                	sub    %ebx,%eax
+}
+ 231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 234:	c9                   	leave
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 240:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 244:	31 c0                	xor    %eax,%eax
+ 246:	29 d8                	sub    %ebx,%eax
+}
+ 248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24b:	c9                   	leave
+ 24c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 24d:	0f b6 19             	movzbl (%ecx),%ebx
+ 250:	31 c0                	xor    %eax,%eax
+ 252:	eb db                	jmp    22f <strcmp+0x2f>
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 266:	80 3a 00             	cmpb   $0x0,(%edx)
+ 269:	74 15                	je     280 <strlen+0x20>
+ 26b:	31 c0                	xor    %eax,%eax
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+ 270:	83 c0 01             	add    $0x1,%eax
+ 273:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 277:	89 c1                	mov    %eax,%ecx
+ 279:	75 f5                	jne    270 <strlen+0x10>
+    ;
+  return n;
+}
+ 27b:	89 c8                	mov    %ecx,%eax
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+ 27f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 280:	31 c9                	xor    %ecx,%ecx
+}
+ 282:	5d                   	pop    %ebp
+ 283:	89 c8                	mov    %ecx,%eax
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000290 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 297:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 29a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29d:	89 d7                	mov    %edx,%edi
+ 29f:	fc                   	cld
+ 2a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2a5:	89 d0                	mov    %edx,%eax
+ 2a7:	c9                   	leave
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ba:	0f b6 10             	movzbl (%eax),%edx
+ 2bd:	84 d2                	test   %dl,%dl
+ 2bf:	75 12                	jne    2d3 <strchr+0x23>
+ 2c1:	eb 1d                	jmp    2e0 <strchr+0x30>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2cc:	83 c0 01             	add    $0x1,%eax
+ 2cf:	84 d2                	test   %dl,%dl
+ 2d1:	74 0d                	je     2e0 <strchr+0x30>
+    if(*s == c)
+ 2d3:	38 d1                	cmp    %dl,%cl
+ 2d5:	75 f1                	jne    2c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2d7:	5d                   	pop    %ebp
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2e0:	31 c0                	xor    %eax,%eax
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	c3                   	ret
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2f9:	31 db                	xor    %ebx,%ebx
+{
+ 2fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2fe:	eb 2b                	jmp    32b <gets+0x3b>
+    cc = read(0, &c, 1);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	6a 01                	push   $0x1
+ 305:	56                   	push   %esi
+ 306:	6a 00                	push   $0x0
+ 308:	e8 6a 01 00 00       	call   477 <read>
+    if(cc < 1)
+ 30d:	83 c4 10             	add    $0x10,%esp
+ 310:	85 c0                	test   %eax,%eax
+ 312:	7e 21                	jle    335 <gets+0x45>
+      break;
+    buf[i++] = c;
+ 314:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(c == '\n' || c == '\r' || c == '\t')
+ 31b:	8d 48 f7             	lea    -0x9(%eax),%ecx
+    buf[i++] = c;
+ 31e:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r' || c == '\t')
+ 322:	80 f9 01             	cmp    $0x1,%cl
+ 325:	76 10                	jbe    337 <gets+0x47>
+ 327:	3c 0d                	cmp    $0xd,%al
+ 329:	74 0c                	je     337 <gets+0x47>
+  for(i=0; i+1 < max; ){
+ 32b:	89 df                	mov    %ebx,%edi
+ 32d:	83 c3 01             	add    $0x1,%ebx
+ 330:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 333:	7c cb                	jl     300 <gets+0x10>
+ 335:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 337:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33a:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 33e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 341:	5b                   	pop    %ebx
+ 342:	5e                   	pop    %esi
+ 343:	5f                   	pop    %edi
+ 344:	5d                   	pop    %ebp
+ 345:	c3                   	ret
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	6a 00                	push   $0x0
+ 35a:	ff 75 08             	push   0x8(%ebp)
+ 35d:	e8 3d 01 00 00       	call   49f <open>
+  if(fd < 0)
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	78 27                	js     390 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	ff 75 0c             	push   0xc(%ebp)
+ 36f:	89 c3                	mov    %eax,%ebx
+ 371:	50                   	push   %eax
+ 372:	e8 40 01 00 00       	call   4b7 <fstat>
+  close(fd);
+ 377:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 37a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 37c:	e8 06 01 00 00       	call   487 <close>
+  return r;
+ 381:	83 c4 10             	add    $0x10,%esp
+}
+ 384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 387:	89 f0                	mov    %esi,%eax
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5d                   	pop    %ebp
+ 38c:	c3                   	ret
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 395:	eb ed                	jmp    384 <stat+0x34>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3a7:	0f be 02             	movsbl (%edx),%eax
+ 3aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3b5:	77 1e                	ja     3d5 <atoi+0x35>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3c0:	83 c2 01             	add    $0x1,%edx
+ 3c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ca:	0f be 02             	movsbl (%edx),%eax
+ 3cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3d0:	80 fb 09             	cmp    $0x9,%bl
+ 3d3:	76 eb                	jbe    3c0 <atoi+0x20>
+  return n;
+}
+ 3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d8:	89 c8                	mov    %ecx,%eax
+ 3da:	c9                   	leave
+ 3db:	c3                   	ret
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ee:	85 c0                	test   %eax,%eax
+ 3f0:	7e 13                	jle    405 <memmove+0x25>
+ 3f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3f4:	89 d7                	mov    %edx,%edi
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 400:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 401:	39 f8                	cmp    %edi,%eax
+ 403:	75 fb                	jne    400 <memmove+0x20>
+  return vdst;
+}
+ 405:	5e                   	pop    %esi
+ 406:	89 d0                	mov    %edx,%eax
+ 408:	5f                   	pop    %edi
+ 409:	5d                   	pop    %ebp
+ 40a:	c3                   	ret
+ 40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+
+00000410 <strncmp>:
+
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	53                   	push   %ebx
+ 414:	8b 55 10             	mov    0x10(%ebp),%edx
+ 417:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+ 41d:	85 d2                	test   %edx,%edx
+ 41f:	75 16                	jne    437 <strncmp+0x27>
+ 421:	eb 2d                	jmp    450 <strncmp+0x40>
+ 423:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 427:	90                   	nop
+ 428:	3a 19                	cmp    (%ecx),%bl
+ 42a:	75 12                	jne    43e <strncmp+0x2e>
+    n--, p++, q++;
+ 42c:	83 c0 01             	add    $0x1,%eax
+ 42f:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+ 432:	83 ea 01             	sub    $0x1,%edx
+ 435:	74 19                	je     450 <strncmp+0x40>
+ 437:	0f b6 18             	movzbl (%eax),%ebx
+ 43a:	84 db                	test   %bl,%bl
+ 43c:	75 ea                	jne    428 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+ 43e:	0f b6 00             	movzbl (%eax),%eax
+ 441:	0f b6 11             	movzbl (%ecx),%edx
+ 444:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 447:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+ 448:	29 d0                	sub    %edx,%eax
+ 44a:	c3                   	ret
+ 44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+ 450:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+ 453:	31 c0                	xor    %eax,%eax
+ 455:	c9                   	leave
+ 456:	c3                   	ret
+
+00000457 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 457:	b8 01 00 00 00       	mov    $0x1,%eax
+ 45c:	cd 40                	int    $0x40
+ 45e:	c3                   	ret
+
+0000045f <exit>:
+SYSCALL(exit)
+ 45f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 464:	cd 40                	int    $0x40
+ 466:	c3                   	ret
+
+00000467 <wait>:
+SYSCALL(wait)
+ 467:	b8 03 00 00 00       	mov    $0x3,%eax
+ 46c:	cd 40                	int    $0x40
+ 46e:	c3                   	ret
+
+0000046f <pipe>:
+SYSCALL(pipe)
+ 46f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 474:	cd 40                	int    $0x40
+ 476:	c3                   	ret
+
+00000477 <read>:
+SYSCALL(read)
+ 477:	b8 05 00 00 00       	mov    $0x5,%eax
+ 47c:	cd 40                	int    $0x40
+ 47e:	c3                   	ret
+
+0000047f <write>:
+SYSCALL(write)
+ 47f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 484:	cd 40                	int    $0x40
+ 486:	c3                   	ret
+
+00000487 <close>:
+SYSCALL(close)
+ 487:	b8 15 00 00 00       	mov    $0x15,%eax
+ 48c:	cd 40                	int    $0x40
+ 48e:	c3                   	ret
+
+0000048f <kill>:
+SYSCALL(kill)
+ 48f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 494:	cd 40                	int    $0x40
+ 496:	c3                   	ret
+
+00000497 <exec>:
+SYSCALL(exec)
+ 497:	b8 07 00 00 00       	mov    $0x7,%eax
+ 49c:	cd 40                	int    $0x40
+ 49e:	c3                   	ret
+
+0000049f <open>:
+SYSCALL(open)
+ 49f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4a4:	cd 40                	int    $0x40
+ 4a6:	c3                   	ret
+
+000004a7 <mknod>:
+SYSCALL(mknod)
+ 4a7:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4ac:	cd 40                	int    $0x40
+ 4ae:	c3                   	ret
+
+000004af <unlink>:
+SYSCALL(unlink)
+ 4af:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4b4:	cd 40                	int    $0x40
+ 4b6:	c3                   	ret
+
+000004b7 <fstat>:
+SYSCALL(fstat)
+ 4b7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4bc:	cd 40                	int    $0x40
+ 4be:	c3                   	ret
+
+000004bf <link>:
+SYSCALL(link)
+ 4bf:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4c4:	cd 40                	int    $0x40
+ 4c6:	c3                   	ret
+
+000004c7 <mkdir>:
+SYSCALL(mkdir)
+ 4c7:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4cc:	cd 40                	int    $0x40
+ 4ce:	c3                   	ret
+
+000004cf <chdir>:
+SYSCALL(chdir)
+ 4cf:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4d4:	cd 40                	int    $0x40
+ 4d6:	c3                   	ret
+
+000004d7 <dup>:
+SYSCALL(dup)
+ 4d7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4dc:	cd 40                	int    $0x40
+ 4de:	c3                   	ret
+
+000004df <getpid>:
+SYSCALL(getpid)
+ 4df:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4e4:	cd 40                	int    $0x40
+ 4e6:	c3                   	ret
+
+000004e7 <sbrk>:
+SYSCALL(sbrk)
+ 4e7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4ec:	cd 40                	int    $0x40
+ 4ee:	c3                   	ret
+
+000004ef <sleep>:
+SYSCALL(sleep)
+ 4ef:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4f4:	cd 40                	int    $0x40
+ 4f6:	c3                   	ret
+
+000004f7 <uptime>:
+SYSCALL(uptime)
+ 4f7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4fc:	cd 40                	int    $0x40
+ 4fe:	c3                   	ret
+
+000004ff <setsched>:
+SYSCALL(setsched)
+ 4ff:	b8 16 00 00 00       	mov    $0x16,%eax
+ 504:	cd 40                	int    $0x40
+ 506:	c3                   	ret
+
+00000507 <memstat>:
+SYSCALL(memstat)
+ 507:	b8 17 00 00 00       	mov    $0x17,%eax
+ 50c:	cd 40                	int    $0x40
+ 50e:	c3                   	ret
+
+0000050f <lseek>:
+SYSCALL(lseek)
+ 50f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 514:	cd 40                	int    $0x40
+ 516:	c3                   	ret
+
+00000517 <setiosched>:
+SYSCALL(setiosched)
+ 517:	b8 19 00 00 00       	mov    $0x19,%eax
+ 51c:	cd 40                	int    $0x40
+ 51e:	c3                   	ret
+
+0000051f <iostat>:
+SYSCALL(iostat)
+ 51f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 524:	cd 40                	int    $0x40
+ 526:	c3                   	ret
+ 527:	66 90                	xchg   %ax,%ax
+ 529:	66 90                	xchg   %ax,%ax
+ 52b:	66 90                	xchg   %ax,%ax
+ 52d:	66 90                	xchg   %ax,%ax
+ 52f:	90                   	nop
+
+00000530 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 538:	89 d1                	mov    %edx,%ecx
+{
+ 53a:	83 ec 3c             	sub    $0x3c,%esp
+ 53d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 540:	85 d2                	test   %edx,%edx
+ 542:	0f 89 80 00 00 00    	jns    5c8 <printint+0x98>
+ 548:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 54c:	74 7a                	je     5c8 <printint+0x98>
+    x = -xx;
+ 54e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 550:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 555:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 558:	31 f6                	xor    %esi,%esi
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 560:	89 c8                	mov    %ecx,%eax
+ 562:	31 d2                	xor    %edx,%edx
+ 564:	89 f7                	mov    %esi,%edi
+ 566:	f7 f3                	div    %ebx
+ 568:	8d 76 01             	lea    0x1(%esi),%esi
+ 56b:	0f b6 92 bc 09 00 00 	movzbl 0x9bc(%edx),%edx
+ 572:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 576:	89 ca                	mov    %ecx,%edx
+ 578:	89 c1                	mov    %eax,%ecx
+ 57a:	39 da                	cmp    %ebx,%edx
+ 57c:	73 e2                	jae    560 <printint+0x30>
+  if(neg)
+ 57e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 581:	85 c0                	test   %eax,%eax
+ 583:	74 07                	je     58c <printint+0x5c>
+    buf[i++] = '-';
+ 585:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 58a:	89 f7                	mov    %esi,%edi
+ 58c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 58f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 592:	01 df                	add    %ebx,%edi
+ 594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 598:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 59b:	83 ec 04             	sub    $0x4,%esp
+ 59e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5a4:	6a 01                	push   $0x1
+ 5a6:	50                   	push   %eax
+ 5a7:	56                   	push   %esi
+ 5a8:	e8 d2 fe ff ff       	call   47f <write>
+  while(--i >= 0)
+ 5ad:	89 f8                	mov    %edi,%eax
+ 5af:	83 c4 10             	add    $0x10,%esp
+ 5b2:	83 ef 01             	sub    $0x1,%edi
+ 5b5:	39 d8                	cmp    %ebx,%eax
+ 5b7:	75 df                	jne    598 <printint+0x68>
+}
+ 5b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5bc:	5b                   	pop    %ebx
+ 5bd:	5e                   	pop    %esi
+ 5be:	5f                   	pop    %edi
+ 5bf:	5d                   	pop    %ebp
+ 5c0:	c3                   	ret
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5c8:	31 c0                	xor    %eax,%eax
+ 5ca:	eb 89                	jmp    555 <printint+0x25>
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5df:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e2:	83 c6 01             	add    $0x1,%esi
+ 5e5:	84 db                	test   %bl,%bl
+ 5e7:	74 67                	je     650 <printf+0x80>
+ 5e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ec:	31 d2                	xor    %edx,%edx
+ 5ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5f1:	eb 34                	jmp    627 <printf+0x57>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+ 5f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 600:	83 f8 25             	cmp    $0x25,%eax
+ 603:	74 18                	je     61d <printf+0x4d>
+  write(fd, &c, 1);
+ 605:	83 ec 04             	sub    $0x4,%esp
+ 608:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 60b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60e:	6a 01                	push   $0x1
+ 610:	50                   	push   %eax
+ 611:	57                   	push   %edi
+ 612:	e8 68 fe ff ff       	call   47f <write>
+ 617:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 61a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 61d:	0f b6 1e             	movzbl (%esi),%ebx
+ 620:	83 c6 01             	add    $0x1,%esi
+ 623:	84 db                	test   %bl,%bl
+ 625:	74 29                	je     650 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 627:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 62a:	85 d2                	test   %edx,%edx
+ 62c:	74 ca                	je     5f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 62e:	83 fa 25             	cmp    $0x25,%edx
+ 631:	75 ea                	jne    61d <printf+0x4d>
+      if(c == 'd'){
+ 633:	83 f8 25             	cmp    $0x25,%eax
+ 636:	0f 84 24 01 00 00    	je     760 <printf+0x190>
+ 63c:	83 e8 63             	sub    $0x63,%eax
+ 63f:	83 f8 15             	cmp    $0x15,%eax
+ 642:	77 1c                	ja     660 <printf+0x90>
+ 644:	ff 24 85 64 09 00 00 	jmp    *0x964(,%eax,4)
+ 64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 653:	5b                   	pop    %ebx
+ 654:	5e                   	pop    %esi
+ 655:	5f                   	pop    %edi
+ 656:	5d                   	pop    %ebp
+ 657:	c3                   	ret
+ 658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 666:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 66a:	6a 01                	push   $0x1
+ 66c:	52                   	push   %edx
+ 66d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 670:	57                   	push   %edi
+ 671:	e8 09 fe ff ff       	call   47f <write>
+ 676:	83 c4 0c             	add    $0xc,%esp
+ 679:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 67c:	6a 01                	push   $0x1
+ 67e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 681:	52                   	push   %edx
+ 682:	57                   	push   %edi
+ 683:	e8 f7 fd ff ff       	call   47f <write>
+        putc(fd, c);
+ 688:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68b:	31 d2                	xor    %edx,%edx
+ 68d:	eb 8e                	jmp    61d <printf+0x4d>
+ 68f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 00                	push   $0x0
+ 69f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6a4:	e8 87 fe ff ff       	call   530 <printint>
+        ap++;
+ 6a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6af:	31 d2                	xor    %edx,%edx
+ 6b1:	e9 67 ff ff ff       	jmp    61d <printf+0x4d>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6c5:	83 c0 04             	add    $0x4,%eax
+ 6c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6cb:	85 db                	test   %ebx,%ebx
+ 6cd:	0f 84 9d 00 00 00    	je     770 <printf+0x1a0>
+        while(*s != 0){
+ 6d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6d8:	84 c0                	test   %al,%al
+ 6da:	0f 84 3d ff ff ff    	je     61d <printf+0x4d>
+ 6e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6e6:	89 de                	mov    %ebx,%esi
+ 6e8:	89 d3                	mov    %edx,%ebx
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	53                   	push   %ebx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 7d fd ff ff       	call   47f <write>
+        while(*s != 0){
+ 702:	0f b6 06             	movzbl (%esi),%eax
+ 705:	83 c4 10             	add    $0x10,%esp
+ 708:	84 c0                	test   %al,%al
+ 70a:	75 e4                	jne    6f0 <printf+0x120>
+      state = 0;
+ 70c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 07 ff ff ff       	jmp    61d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 01                	push   $0x1
+ 72f:	e9 6b ff ff ff       	jmp    69f <printf+0xcf>
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 738:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 741:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 743:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 746:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	52                   	push   %edx
+ 74c:	57                   	push   %edi
+ 74d:	e8 2d fd ff ff       	call   47f <write>
+        ap++;
+ 752:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 755:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 758:	31 d2                	xor    %edx,%edx
+ 75a:	e9 be fe ff ff       	jmp    61d <printf+0x4d>
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 766:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 769:	6a 01                	push   $0x1
+ 76b:	e9 11 ff ff ff       	jmp    681 <printf+0xb1>
+ 770:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 775:	bb 5a 09 00 00       	mov    $0x95a,%ebx
+ 77a:	e9 61 ff ff ff       	jmp    6e0 <printf+0x110>
+ 77f:	90                   	nop
+
+00000780 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 780:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 781:	a1 94 0c 00 00       	mov    0xc94,%eax
+{
+ 786:	89 e5                	mov    %esp,%ebp
+ 788:	57                   	push   %edi
+ 789:	56                   	push   %esi
+ 78a:	53                   	push   %ebx
+ 78b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 78e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 798:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 79a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 79c:	39 ca                	cmp    %ecx,%edx
+ 79e:	73 30                	jae    7d0 <free+0x50>
+ 7a0:	39 c1                	cmp    %eax,%ecx
+ 7a2:	72 04                	jb     7a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7a4:	39 c2                	cmp    %eax,%edx
+ 7a6:	72 f0                	jb     798 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ae:	39 f8                	cmp    %edi,%eax
+ 7b0:	74 2e                	je     7e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7bb:	39 f1                	cmp    %esi,%ecx
+ 7bd:	74 38                	je     7f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7c1:	5b                   	pop    %ebx
+  freep = p;
+ 7c2:	89 15 94 0c 00 00    	mov    %edx,0xc94
+}
+ 7c8:	5e                   	pop    %esi
+ 7c9:	5f                   	pop    %edi
+ 7ca:	5d                   	pop    %ebp
+ 7cb:	c3                   	ret
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d0:	39 c1                	cmp    %eax,%ecx
+ 7d2:	72 d0                	jb     7a4 <free+0x24>
+ 7d4:	eb c2                	jmp    798 <free+0x18>
+ 7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7e0:	03 70 04             	add    0x4(%eax),%esi
+ 7e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7e6:	8b 02                	mov    (%edx),%eax
+ 7e8:	8b 00                	mov    (%eax),%eax
+ 7ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 7f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7f3:	39 f1                	cmp    %esi,%ecx
+ 7f5:	75 c8                	jne    7bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 7f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7fa:	89 15 94 0c 00 00    	mov    %edx,0xc94
+    p->s.size += bp->s.size;
+ 800:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 803:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 806:	89 0a                	mov    %ecx,(%edx)
+}
+ 808:	5b                   	pop    %ebx
+ 809:	5e                   	pop    %esi
+ 80a:	5f                   	pop    %edi
+ 80b:	5d                   	pop    %ebp
+ 80c:	c3                   	ret
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000810 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 819:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 81c:	8b 15 94 0c 00 00    	mov    0xc94,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 822:	8d 78 07             	lea    0x7(%eax),%edi
+ 825:	c1 ef 03             	shr    $0x3,%edi
+ 828:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 82b:	85 d2                	test   %edx,%edx
+ 82d:	0f 84 8d 00 00 00    	je     8c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 833:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 835:	8b 48 04             	mov    0x4(%eax),%ecx
+ 838:	39 f9                	cmp    %edi,%ecx
+ 83a:	73 64                	jae    8a0 <malloc+0x90>
+  if(nu < 4096)
+ 83c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 841:	39 df                	cmp    %ebx,%edi
+ 843:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 846:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 84d:	eb 0a                	jmp    859 <malloc+0x49>
+ 84f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 850:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 852:	8b 48 04             	mov    0x4(%eax),%ecx
+ 855:	39 f9                	cmp    %edi,%ecx
+ 857:	73 47                	jae    8a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 859:	89 c2                	mov    %eax,%edx
+ 85b:	39 05 94 0c 00 00    	cmp    %eax,0xc94
+ 861:	75 ed                	jne    850 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	56                   	push   %esi
+ 867:	e8 7b fc ff ff       	call   4e7 <sbrk>
+  if(p == (char*)-1)
+ 86c:	83 c4 10             	add    $0x10,%esp
+ 86f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 872:	74 1c                	je     890 <malloc+0x80>
+  hp->s.size = nu;
+ 874:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 877:	83 ec 0c             	sub    $0xc,%esp
+ 87a:	83 c0 08             	add    $0x8,%eax
+ 87d:	50                   	push   %eax
+ 87e:	e8 fd fe ff ff       	call   780 <free>
+  return freep;
+ 883:	8b 15 94 0c 00 00    	mov    0xc94,%edx
+      if((p = morecore(nunits)) == 0)
+ 889:	83 c4 10             	add    $0x10,%esp
+ 88c:	85 d2                	test   %edx,%edx
+ 88e:	75 c0                	jne    850 <malloc+0x40>
+        return 0;
+  }
+}
+ 890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 893:	31 c0                	xor    %eax,%eax
+}
+ 895:	5b                   	pop    %ebx
+ 896:	5e                   	pop    %esi
+ 897:	5f                   	pop    %edi
+ 898:	5d                   	pop    %ebp
+ 899:	c3                   	ret
+ 89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8a0:	39 cf                	cmp    %ecx,%edi
+ 8a2:	74 4c                	je     8f0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8a4:	29 f9                	sub    %edi,%ecx
+ 8a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8af:	89 15 94 0c 00 00    	mov    %edx,0xc94
+}
+ 8b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8b8:	83 c0 08             	add    $0x8,%eax
+}
+ 8bb:	5b                   	pop    %ebx
+ 8bc:	5e                   	pop    %esi
+ 8bd:	5f                   	pop    %edi
+ 8be:	5d                   	pop    %ebp
+ 8bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8c0:	c7 05 94 0c 00 00 98 	movl   $0xc98,0xc94
+ 8c7:	0c 00 00 
+    base.s.size = 0;
+ 8ca:	b8 98 0c 00 00       	mov    $0xc98,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8cf:	c7 05 98 0c 00 00 98 	movl   $0xc98,0xc98
+ 8d6:	0c 00 00 
+    base.s.size = 0;
+ 8d9:	c7 05 9c 0c 00 00 00 	movl   $0x0,0xc9c
+ 8e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8e3:	e9 54 ff ff ff       	jmp    83c <malloc+0x2c>
+ 8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8f0:	8b 08                	mov    (%eax),%ecx
+ 8f2:	89 0a                	mov    %ecx,(%edx)
+ 8f4:	eb b9                	jmp    8af <malloc+0x9f>
@@ -0,0 +1,48 @@
+// File creation benchmark.
+// Creates empty files in batches, reporting the time each batch
+// takes, so that a slowdown as the inode table fills shows up as
+// a rising curve.  Then removes them.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define NBATCH 10  // files per batch
+
+int
+main(int argc, char *argv[])
+{
+  char name[] = "cb000";
+  int n, i, fd, t;
+
+  n = argc > 1 ? atoi(argv[1]) : 150;
+  if(n < 1 || n > 999){
+    printf(2, "usage: createbench [files]\n");
+    exit();
+  }
+  t = uptime();
+  for(i = 0; i < n; i++){
+    name[2] = '0' + i/100;
+    name[3] = '0' + i/10%10;
+    name[4] = '0' + i%10;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(2, "createbench: cannot create %s\n", name);
+      n = i;
+      break;
+    }
+    close(fd);
+    if(i % NBATCH == NBATCH-1 || i == n-1){
+      printf(1, "createbench: files %d-%d in %d ticks\n",
+             i - i%NBATCH, i, uptime() - t);
+      t = uptime();
+    }
+  }
+  for(i = 0; i < n; i++){
+    name[2] = '0' + i/100;
+    name[3] = '0' + i/10%10;
+    name[4] = '0' + i%10;
+    unlink(name);
+  }
+  exit();
+}
@@ -0,0 +1,160 @@
+// Directory name cache.
+//
+// Remembers what dirlookup() found for (device, directory inode,
+// name): the inode number and offset of the entry, or that there
+// is no such entry (inum 0), so that repeated path lookups need
+// not read and search the directory again.
+//
+// Entries hash on (dev, dir, name) into NDBUCKET buckets of
+// NDWAY entries each, kept in most-recently-used order; a new
+// entry replaces the least recently used one of its bucket.
+//
+// The cache holds no references.  Callers must hold the
+// directory's inode lock, which is what keeps a directory's
+// entries and its cached names consistent: dirlink() and
+// dirunlink() update the cache as they change the directory,
+// and iput() purges a directory's names when it frees it.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "iostat.h"
+
+#define NDBUCKET 64
+#define NDWAY 4
+
+struct dentry {
+  uint dev;
+  uint dir;             // inode number of the directory, 0 if unused
+  uint inum;            // inode number of the entry, 0 if none
+  uint off;             // offset of the entry in dir
+  char name[DIRSIZ];
+};
+
+struct dbucket {
+  struct spinlock lock;
+  struct dentry e[NDWAY];  // e[0] is most recently used
+};
+
+struct {
+  struct dbucket bucket[NDBUCKET];
+  uint hit;
+  uint miss;
+} dcache;
+
+void
+dcacheinit(void)
+{
+  struct dbucket *db;
+
+  for(db = dcache.bucket; db < dcache.bucket+NDBUCKET; db++)
+    initlock(&db->lock, "dcache");
+}
+
+static struct dbucket*
+dhash(uint dev, uint dir, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dir;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return &dcache.bucket[h % NDBUCKET];
+}
+
+// Return the index of the entry for (dev, dir, name) in db,
+// or -1.  Caller must hold db->lock.
+static int
+dfind(struct dbucket *db, uint dev, uint dir, char *name)
+{
+  int i;
+
+  for(i = 0; i < NDWAY; i++)
+    if(db->e[i].dir == dir && db->e[i].dev == dev &&
+       namecmp(db->e[i].name, name) == 0)
+      return i;
+  return -1;
+}
+
+// Move db->e[i] to the front.  Caller must hold db->lock.
+static void
+dtouch(struct dbucket *db, int i)
+{
+  struct dentry d;
+
+  d = db->e[i];
+  for(; i > 0; i--)
+    db->e[i] = db->e[i-1];
+  db->e[0] = d;
+}
+
+// Look up name in directory dir.  Return 1 and set *inum
+// (0 if the name is known not to exist) and *off if cached.
+int
+dcachelookup(uint dev, uint dir, char *name, uint *inum, uint *off)
+{
+  struct dbucket *db;
+  int i;
+
+  db = dhash(dev, dir, name);
+  acquire(&db->lock);
+  if((i = dfind(db, dev, dir, name)) < 0){
+    release(&db->lock);
+    __sync_fetch_and_add(&dcache.miss, 1);
+    return 0;
+  }
+  dtouch(db, i);
+  *inum = db->e[0].inum;
+  *off = db->e[0].off;
+  release(&db->lock);
+  __sync_fetch_and_add(&dcache.hit, 1);
+  return 1;
+}
+
+// Report name cache statistics.
+void
+dcachestat(struct iostat *st)
+{
+  st->dhit = dcache.hit;
+  st->dmiss = dcache.miss;
+}
+
+// Record that name in dir is inum at offset off,
+// or does not exist if inum is 0.
+void
+dcacheadd(uint dev, uint dir, char *name, uint inum, uint off)
+{
+  struct dbucket *db;
+  int i;
+
+  db = dhash(dev, dir, name);
+  acquire(&db->lock);
+  if((i = dfind(db, dev, dir, name)) < 0)
+    i = NDWAY-1;
+  dtouch(db, i);
+  db->e[0].dev = dev;
+  db->e[0].dir = dir;
+  db->e[0].inum = inum;
+  db->e[0].off = off;
+  strncpy(db->e[0].name, name, DIRSIZ);
+  release(&db->lock);
+}
+
+// Forget all names in directory dir, which is being freed.
+void
+dcachepurge(uint dev, uint dir)
+{
+  struct dbucket *db;
+  int i;
+
+  for(db = dcache.bucket; db < dcache.bucket+NDBUCKET; db++){
+    acquire(&db->lock);
+    for(i = 0; i < NDWAY; i++)
+      if(db->e[i].dir == dir && db->e[i].dev == dev)
+        db->e[i].dir = 0;
+    release(&db->lock);
+  }
+}
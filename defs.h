@@ -2,18 +2,28 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct ioqueue;
+struct iostat;
+struct memstat;
+struct pcidev;
 struct pipe;
 struct proc;
 struct rtcdate;
+struct slabcache;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
 
 // bio.c
+void            bdone(struct buf*);
 void            binit(void);
+void            biostat(struct iostat*);
+void            bpin(struct buf*);
 struct buf*     bread(uint, uint);
+void            breadahead(uint, uint);
 void            brelse(struct buf*);
+void            bunpin(struct buf*);
 void            bwrite(struct buf*);
 
 // console.c
@@ -22,6 +32,13 @@ void            cprintf(char*, ...);
 void            consoleintr(int(*)(void));
 void            panic(char*) __attribute__((noreturn));
 
+// dcache.c
+void            dcacheinit(void);
+void            dcacheadd(uint, uint, char*, uint, uint);
+int             dcachelookup(uint, uint, char*, uint*, uint*);
+void            dcachepurge(uint, uint);
+void            dcachestat(struct iostat*);
+
 // exec.c
 int             exec(char*, char**);
 
@@ -31,15 +48,20 @@ void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+int             fileseek(struct file*, int, int);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
+void            ballocinit(int dev);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
+void            dirunlink(struct inode*, char*, uint);
 struct inode*   ialloc(uint, short);
+void            iallocinit(int dev);
 struct inode*   idup(struct inode*);
+void            icacheinit(void);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -57,17 +79,37 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderwv(struct buf**, int);
+
+// ioacct.c
+int             iobucket(uint, uint);
+void            iocmd(uint);
+void            iodone(struct buf*);
+void            iostart(struct buf*);
+void            iostat(struct iostat*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
 extern uchar    ioapicid;
 void            ioapicinit(void);
 
+// iosched.c
+extern int      iosched;
+void            ioqadd(struct ioqueue*, struct buf*);
+struct buf*     ioqmerge(struct ioqueue*, struct buf*);
+struct buf*     ioqnext(struct ioqueue*);
+int             setiosched(int);
+
 // kalloc.c
+char*           buddyalloc(int);
+void            buddyfree(char*, int);
 char*           kalloc(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kmemstat(struct memstat*);
+void            kref(char*);
+int             krefcount(char*);
 
 // kbd.c
 void            kbdintr(void);
@@ -84,13 +126,23 @@ void            microdelay(int);
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
+void            logtimer(void);
 void            begin_op();
+void            begin_opn(int);
 void            end_op();
+void            end_opn(int);
+int             logopblocks(void);
+void            logstat(struct iostat*);
 
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// pci.c
+int             pcifind(ushort, ushort, uchar, uchar, struct pcidev*);
+uint            pciread(struct pcidev*, uint);
+void            pciwrite(struct pcidev*, uint, uint);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -98,6 +150,7 @@ void            picinit(void);
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
+void            pipeinit(void);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
 
@@ -108,14 +161,19 @@ void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int);
+void            kthread(char*, void (*)(void));
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
+void            priboost(void);
 void            procdump(void);
+void            rebalance(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setsched(int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
+int             timeslice(void);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
@@ -124,6 +182,11 @@ void            yield(void);
 // swtch.S
 void            swtch(struct context**, struct context*);
 
+// slab.c
+void*           slaballoc(struct slabcache*);
+void            slabfree(struct slabcache*, void*);
+void            slabinit(struct slabcache*, char*, uint, void (*)(void*));
+
 // spinlock.c
 void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
@@ -170,6 +233,12 @@ void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
 
+// virtio.c
+extern int      virtioirq;
+void            virtioinit(void);
+void            virtiointr(void);
+void            virtiorw(struct buf**, int);
+
 // vm.c
 void            seginit(void);
 void            kvmalloc(void);
@@ -185,6 +254,8 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             pagefault(struct proc*, uint, uint);
+int             uvmprefault(struct proc*, uint, uint, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -14,6 +14,8 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *prev; // icache bucket list
+  struct inode *next;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -22,7 +24,16 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+3];
+
+  uint ranext;        // block a sequential reader reads next
+  uint raend;         // first block not yet read ahead
+
+  uint ebn;           // extent bmap() found last: file block,
+  uint estart;        // disk block
+  uint elen;          // and length, 0 if none
+
+  uint bgoal;         // where bmap() should allocate next, or 0
 };
 
 // table mapping major device number to
@@ -14,15 +14,18 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
+#include "slab.h"
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
+#include "memstat.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
+static void dirifree(struct inode*, uint*, int*);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb; 
@@ -52,29 +55,161 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+// Blocks are allocated in groups of BPB, one group per bitmap
+// block.  bgroup counts the free blocks of each group, so
+// balloc() goes straight to a group with room, and remembers
+// where the first free block of each group may be, so it rarely
+// has to scan.  A count is taken (under bgroup.lock) before the
+// bitmap block is searched, so a group never runs out of blocks
+// under an allocator that has reserved one.
+//
+// balloc() takes a goal, normally the block after the one the
+// file allocated last, and uses it if it is free, so that a
+// file's blocks end up next to each other.  A file with no
+// blocks yet starts in the group its inode number maps to (see
+// inogoal), so that files created together sit together.  Only
+// callers without a goal start a new run at a cursor that moves
+// RUNGAP blocks along each time.
+#define NBGROUP ((FSSIZE + BPB - 1) / BPB)
+#define RUNGAP 64
+
+struct {
+  struct spinlock lock;
+  uint ngroup;
+  uint nfree[NBGROUP];  // free blocks in each group
+  uint hint[NBGROUP];   // no free block in the group below this
+  uint cursor;          // where the next new run starts
+} bgroup;
+
+// Count the free blocks of each group.  Called once the log
+// has been recovered, since recovery may rewrite the bitmap.
+// The group table is sized for the FSSIZE the kernel was built
+// with, which the disk drivers also check block numbers against,
+// so the kernel cannot mount a larger fs.img: build both with
+// the same make FSSIZE=...
+void
+ballocinit(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
-
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
-    bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
+  uint g, b;
+
+  initlock(&bgroup.lock, "bgroup");
+  bgroup.ngroup = (sb.size + BPB - 1) / BPB;
+  if(bgroup.ngroup > NBGROUP)
+    panic("ballocinit: disk larger than FSSIZE");
+  for(g = 0; g < bgroup.ngroup; g++){
+    bp = bread(dev, BBLOCK(g*BPB, sb));
+    bgroup.hint[g] = BPB;
+    for(b = g*BPB; b < sb.size && b < (g+1)*BPB; b++){
+      if((bp->data[(b%BPB)/8] & (1 << (b%8))) == 0){
+        if(bgroup.nfree[g]++ == 0)
+          bgroup.hint[g] = b%BPB;
       }
     }
     brelse(bp);
   }
-  panic("balloc: out of blocks");
+  bgroup.cursor = sb.bmapstart + sb.size/BPB + 1;
+}
+
+// Take the first free block of group g at or after block from
+// of the group, wrapping around to its start, and zero it.
+// The caller has reserved a block of the group.  The last
+// group may end before its bitmap block does; the bits past
+// the end of the disk are never taken.
+static uint
+bgrab(uint dev, uint g, uint from)
+{
+  struct buf *bp;
+  uint bi, n, nb;
+  int m;
+
+  nb = sb.size - g*BPB < BPB ? sb.size - g*BPB : BPB;
+  bp = bread(dev, BBLOCK(g*BPB, sb));
+  for(n = 0, bi = from % nb; n < nb; n++, bi = (bi+1) % nb){
+    if(bi%8 == 0 && bp->data[bi/8] == 0xff && bi+8 <= nb && n+8 <= nb){
+      n += 7;
+      bi += 7;
+      continue;
+    }
+    m = 1 << (bi % 8);
+    if((bp->data[bi/8] & m) == 0){  // Is block free?
+      bp->data[bi/8] |= m;  // Mark block in use.
+      log_write(bp);
+      brelse(bp);
+      bzero(dev, g*BPB + bi);
+      return g*BPB + bi;
+    }
+  }
+  panic("bgrab: group full");
+}
+
+// Allocate a zeroed disk block, as close after goal as
+// possible, or at the start of a new run if goal is 0.
+static uint
+balloc(uint dev, uint goal)
+{
+  uint g, i, from, b;
+
+  acquire(&bgroup.lock);
+  if(goal == 0 || goal >= sb.size){
+    goal = bgroup.cursor;
+    bgroup.cursor = goal + RUNGAP < sb.size ? goal + RUNGAP : 0;
+  }
+  g = goal / BPB;
+  for(i = 0; i < bgroup.ngroup && bgroup.nfree[g] == 0; i++)
+    g = (g + 1) % bgroup.ngroup;
+  if(i == bgroup.ngroup)
+    panic("balloc: out of blocks");
+  bgroup.nfree[g]--;
+  if(g == goal / BPB && goal % BPB >= bgroup.hint[g])
+    from = goal % BPB;
+  else
+    from = bgroup.hint[g];
+  release(&bgroup.lock);
+
+  b = bgrab(dev, g, from % BPB);
+
+  acquire(&bgroup.lock);
+  if(from == bgroup.hint[g] && b % BPB >= from)
+    bgroup.hint[g] = b % BPB + 1;
+  release(&bgroup.lock);
+  return b;
+}
+
+// Allocate block b if it is free.  Return 1 if so.
+static int
+balloctry(uint dev, uint b)
+{
+  struct buf *bp;
+  uint g, bi;
+  int m;
+
+  if(b >= sb.size)
+    return 0;
+  g = b / BPB;
+  acquire(&bgroup.lock);
+  if(bgroup.nfree[g] == 0){
+    release(&bgroup.lock);
+    return 0;
+  }
+  bgroup.nfree[g]--;
+  release(&bgroup.lock);
+
+  bp = bread(dev, BBLOCK(b, sb));
+  bi = b % BPB;
+  m = 1 << (bi % 8);
+  if((bp->data[bi/8] & m) == 0){
+    bp->data[bi/8] |= m;
+    log_write(bp);
+    brelse(bp);
+    bzero(dev, b);
+    return 1;
+  }
+  brelse(bp);
+  acquire(&bgroup.lock);
+  bgroup.nfree[g]++;
+  release(&bgroup.lock);
+  return 0;
 }
 
 // Free a disk block.
@@ -92,6 +227,12 @@ bfree(int dev, uint b)
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+
+  acquire(&bgroup.lock);
+  bgroup.nfree[b/BPB]++;
+  if(bi < bgroup.hint[b/BPB])
+    bgroup.hint[b/BPB] = bi;
+  release(&bgroup.lock);
 }
 
 // Inodes.
@@ -130,7 +271,7 @@ bfree(int dev, uint b)
 //   cache entry is only correct when ip->valid is 1.
 //   ilock() reads the inode from
 //   the disk and sets ip->valid, while iput() clears
-//   ip->valid if ip->ref has fallen to zero.
+//   ip->valid when it frees the inode on disk.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
@@ -154,30 +295,80 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// In-memory inodes come from a slab cache and hash on (dev, inum)
+// into buckets, each with its own lock and its own list in
+// most-recently-used order.  An inode whose last reference is
+// dropped stays cached, still valid, so that the next iget() of it
+// need not read the disk; each bucket keeps at most NIIDLE such
+// idle inodes, and returns the least recently used one to the slab
+// cache when it would have more.  icacheinit() makes enough buckets
+// for the idle inodes to fill 1/INODEMEMFRAC of free memory, which
+// also keeps the lists of referenced inodes short.
+//
+// A bucket's lock protects its list and the ref of each inode on
+// it. Since ip->ref indicates whether an entry is in use, and
+// ip->dev and ip->inum indicate which i-node an entry holds, one
+// must hold the bucket lock while using any of those fields.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
-struct {
+#define NIIDLE 8  // unreferenced inodes cached per bucket
+#define IHASH(dev, inum) (((dev)*31 + (inum)) % icache.nbucket)
+
+struct ibucket {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode *list;   // head is most recently used
+  int nidle;            // inodes on list with ref == 0
+};
+
+struct {
+  struct ibucket *bucket;
+  int nbucket;
+  struct slabcache cache;
 } icache;
 
+// Slab constructor: inodes keep their sleep-lock across reuse.
+static void
+inodector(void *v)
+{
+  initsleeplock(&((struct inode*)v)->lock, "inode");
+}
+
+// Must come after kinit2(), since the table is sized
+// from free memory.
 void
-iinit(int dev)
+icacheinit(void)
 {
-  int i = 0;
-  
-  initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  struct memstat st;
+  struct ibucket *ib;
+  char *p;
+  int k, npage, nidle;
+
+  kmemstat(&st);
+  npage = st.ncached;
+  for(k = 0; k <= MAXORDER; k++)
+    npage += st.nfree[k] << k;
+  nidle = npage / INODEMEMFRAC * (PGSIZE / sizeof(struct inode));
+
+  // The buckets, in the smallest block of pages that holds them.
+  for(k = 0; k < MAXORDER &&
+      (PGSIZE<<k) < nidle/NIIDLE*sizeof(struct ibucket); k++)
+    ;
+  if((p = buddyalloc(k)) == 0)
+    panic("icacheinit: no memory");
+  memset(p, 0, PGSIZE<<k);
+  icache.bucket = (struct ibucket*)p;
+  icache.nbucket = (PGSIZE<<k) / sizeof(struct ibucket);
+  for(ib = icache.bucket; ib < icache.bucket+icache.nbucket; ib++)
+    initlock(&ib->lock, "icache");
+  slabinit(&icache.cache, "inode", sizeof(struct inode), inodector);
+}
 
+void
+iinit(int dev)
+{
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
@@ -187,6 +378,47 @@ iinit(int dev)
 
 static struct inode* iget(uint dev, uint inum);
 
+// Free inodes.  imap has a bit set for each inode whose type on
+// disk is not 0, built by iallocinit() once the log has been
+// recovered, so ialloc() goes straight to a free inode instead of
+// reading the inode blocks in turn.  iput() clears the bit when
+// it frees an inode.
+struct {
+  struct spinlock lock;
+  uchar *map;
+  uint hint;            // no free inode below this
+} imap;
+
+void
+iallocinit(int dev)
+{
+  struct buf *bp;
+  struct dinode *dip;
+  uint inum;
+
+  initlock(&imap.lock, "imap");
+  if(sb.ninodes > PGSIZE*8 || (imap.map = (uchar*)kalloc()) == 0)
+    panic("iallocinit");
+  memset(imap.map, 0, PGSIZE);
+  imap.map[0] = 1;  // there is no inode 0
+  imap.hint = sb.ninodes;
+  bp = 0;
+  for(inum = 1; inum < sb.ninodes; inum++){
+    if(bp == 0 || inum%IPB == 0){
+      if(bp)
+        brelse(bp);
+      bp = bread(dev, IBLOCK(inum, sb));
+    }
+    dip = (struct dinode*)bp->data + inum%IPB;
+    if(dip->type != 0)
+      imap.map[inum/8] |= 1 << (inum%8);
+    else if(imap.hint == sb.ninodes)
+      imap.hint = inum;
+  }
+  if(bp)
+    brelse(bp);
+}
+
 //PAGEBREAK!
 // Allocate an inode on device dev.
 // Mark it as allocated by  giving it type type.
@@ -194,23 +426,45 @@ static struct inode* iget(uint dev, uint inum);
 struct inode*
 ialloc(uint dev, short type)
 {
-  int inum;
+  uint inum;
   struct buf *bp;
   struct dinode *dip;
 
-  for(inum = 1; inum < sb.ninodes; inum++){
-    bp = bread(dev, IBLOCK(inum, sb));
-    dip = (struct dinode*)bp->data + inum%IPB;
-    if(dip->type == 0){  // a free inode
-      memset(dip, 0, sizeof(*dip));
-      dip->type = type;
-      log_write(bp);   // mark it allocated on the disk
-      brelse(bp);
-      return iget(dev, inum);
+  acquire(&imap.lock);
+  for(inum = imap.hint; inum < sb.ninodes; inum++){
+    if(inum%8 == 0 && imap.map[inum/8] == 0xff){
+      inum += 7;
+      continue;
     }
-    brelse(bp);
+    if((imap.map[inum/8] & (1 << (inum%8))) == 0)
+      break;
   }
-  panic("ialloc: no inodes");
+  if(inum >= sb.ninodes)
+    panic("ialloc: no inodes");
+  imap.map[inum/8] |= 1 << (inum%8);
+  imap.hint = inum + 1;
+  release(&imap.lock);
+
+  bp = bread(dev, IBLOCK(inum, sb));
+  dip = (struct dinode*)bp->data + inum%IPB;
+  if(dip->type != 0)
+    panic("ialloc: inode in use");
+  memset(dip, 0, sizeof(*dip));
+  dip->type = type;
+  log_write(bp);   // mark it allocated on the disk
+  brelse(bp);
+  return iget(dev, inum);
+}
+
+// Mark inode inum free in imap.
+static void
+ifree(uint inum)
+{
+  acquire(&imap.lock);
+  imap.map[inum/8] &= ~(1 << (inum%8));
+  if(inum < imap.hint)
+    imap.hint = inum;
+  release(&imap.lock);
 }
 
 // Copy a modified in-memory inode to disk.
@@ -235,38 +489,66 @@ iupdate(struct inode *ip)
   brelse(bp);
 }
 
+// Unlink ip from ib's list.  Caller must hold ib->lock.
+static void
+iunlink(struct ibucket *ib, struct inode *ip)
+{
+  if(ip->prev)
+    ip->prev->next = ip->next;
+  else
+    ib->list = ip->next;
+  if(ip->next)
+    ip->next->prev = ip->prev;
+}
+
+// Insert ip at the head of ib's list.  Caller must hold ib->lock.
+static void
+ilink(struct ibucket *ib, struct inode *ip)
+{
+  ip->prev = 0;
+  ip->next = ib->list;
+  if(ib->list)
+    ib->list->prev = ip;
+  ib->list = ip;
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct ibucket *ib;
+  struct inode *ip;
 
-  acquire(&icache.lock);
+  ib = &icache.bucket[IHASH(dev, inum)];
+  acquire(&ib->lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
-      release(&icache.lock);
+  for(ip = ib->list; ip; ip = ip->next){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        ib->nidle--;
+      if(ip != ib->list){
+        iunlink(ib, ip);
+        ilink(ib, ip);
+      }
+      release(&ib->lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
-
-  ip = empty;
+  // Allocate an inode cache entry.
+  if((ip = slaballoc(&icache.cache)) == 0)
+    panic("iget: out of memory");
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
-  release(&icache.lock);
+  ip->ranext = 0;
+  ip->raend = 0;
+  ilink(ib, ip);
+  release(&ib->lock);
 
   return ip;
 }
@@ -276,9 +558,12 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
+  struct ibucket *ib;
+
+  ib = &icache.bucket[IHASH(ip->dev, ip->inum)];
+  acquire(&ib->lock);
   ip->ref++;
-  release(&icache.lock);
+  release(&ib->lock);
   return ip;
 }
 
@@ -305,6 +590,8 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->elen = 0;
+    ip->bgoal = 0;
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -322,8 +609,8 @@ iunlock(struct inode *ip)
 }
 
 // Drop a reference to an in-memory inode.
-// If that was the last reference, the inode cache entry can
-// be recycled.
+// If that was the last reference, the inode cache entry
+// stays cached until the bucket has too many idle entries.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 // All calls to iput() must be inside a transaction in
@@ -331,24 +618,48 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  struct ibucket *ib;
+  struct inode *victim;
+
+  ib = &icache.bucket[IHASH(ip->dev, ip->inum)];
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
+    acquire(&ib->lock);
     int r = ip->ref;
-    release(&icache.lock);
+    release(&ib->lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
+      if(ip->type == T_DIR)
+        dcachepurge(ip->dev, ip->inum);
       itrunc(ip);
       ip->type = 0;
       iupdate(ip);
+      ifree(ip->inum);
       ip->valid = 0;
     }
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  release(&icache.lock);
+  victim = 0;
+  acquire(&ib->lock);
+  if(--ip->ref == 0){
+    if(!ip->valid){
+      // Nothing worth keeping, e.g. a freed inode.
+      iunlink(ib, ip);
+      victim = ip;
+    } else if(++ib->nidle > NIIDLE){
+      // Reclaim the least recently used idle inode.
+      for(victim = ib->list; victim->next; victim = victim->next)
+        ;
+      while(victim->ref > 0)
+        victim = victim->prev;
+      iunlink(ib, victim);
+      ib->nidle--;
+    }
+  }
+  release(&ib->lock);
+  if(victim)
+    slabfree(&icache.cache, victim);
 }
 
 // Common idiom: unlock, then put.
@@ -365,38 +676,242 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT].  ip->addrs[NDIRECT+1]
+// is a doubly indirect block, listing NINDIRECT indirect
+// blocks, and ip->addrs[NDIRECT+2] a triply indirect one.
+
+// Where the first block of the file with inode ip should go.
+// The inodes are spread evenly over the groups in order, and
+// each starts at its group's first free block, so small files
+// are packed together near others created at the same time.
+static uint
+inogoal(struct inode *ip)
+{
+  uint g;
+
+  g = ip->inum * bgroup.ngroup / sb.ninodes;
+  if(g >= bgroup.ngroup)
+    g = bgroup.ngroup - 1;
+  if(g == 0)
+    return sb.bmapstart + sb.size/BPB + 1;  // first data block
+  return g*BPB;
+}
+
+// Allocate a block for ip, next to the one it got last.
+static uint
+iballoc(struct inode *ip)
+{
+  uint b;
+
+  if(ip->bgoal == 0)
+    ip->bgoal = inogoal(ip);
+  b = balloc(ip->dev, ip->bgoal);
+  ip->bgoal = b + 1;
+  return b;
+}
+
+// On a file system with FS_EXTENTS, ip->addrs[] holds extents
+// instead (see fs.h), and emap() takes the place of bmap().
+// The extent that satisfied the last lookup is remembered in
+// the inode, so a sequential reader looks at the extent list
+// once per extent, not once per block.
+static uint
+emap(struct inode *ip, uint bn)
+{
+  struct extent *e;
+  struct buf *bp;
+  uint fbn, addr;
+  int i, n;
+
+  if(bn - ip->ebn < ip->elen)
+    return ip->estart + (bn - ip->ebn);
+
+  // Walk the extents in the inode, then the chain,
+  // keeping fbn the file block at the start of e[i].
+  fbn = 0;
+  bp = 0;
+  e = (struct extent*)ip->addrs;
+  n = NEXTENT;
+  for(;;){
+    for(i = 0; i < n && e[i].len > 0; i++){
+      if(bn < fbn + e[i].len){
+        ip->ebn = fbn;
+        ip->estart = e[i].start;
+        ip->elen = e[i].len;
+        if(bp)
+          brelse(bp);
+        return ip->estart + (bn - fbn);
+      }
+      fbn += e[i].len;
+    }
+    if(i < n)
+      break;
+    addr = bp ? ((struct extblock*)bp->data)->next : ip->addrs[EXTCHAIN];
+    if(addr == 0)
+      break;
+    if(bp)
+      brelse(bp);
+    bp = bread(ip->dev, addr);
+    e = ((struct extblock*)bp->data)->e;
+    n = NEXTBLOCK;
+  }
+
+  // bn is not mapped, so it must be the next block of the file.
+  if(bn != fbn)
+    panic("emap: hole");
+  if(i > 0 && balloctry(ip->dev, e[i-1].start + e[i-1].len)){
+    // Grow the last extent.
+    e[i-1].len++;
+    i--;
+  } else {
+    if(i == n){
+      // No free slot: start a new extent block.
+      addr = balloc(ip->dev, e[n-1].start + e[n-1].len);
+      if(bp){
+        ((struct extblock*)bp->data)->next = addr;
+        log_write(bp);
+        brelse(bp);
+      } else
+        ip->addrs[EXTCHAIN] = addr;
+      bp = bread(ip->dev, addr);
+      e = ((struct extblock*)bp->data)->e;
+      i = 0;
+    }
+    e[i].start = iballoc(ip);
+    e[i].len = 1;
+  }
+  if(bp){
+    log_write(bp);
+    brelse(bp);
+  }
+  ip->ebn = bn + 1 - e[i].len;
+  ip->estart = e[i].start;
+  ip->elen = e[i].len;
+  return ip->estart + (bn - ip->ebn);
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  uint addr, *a, n;
+  int level;
   struct buf *bp;
 
+  if(sb.flags & FS_EXTENTS)
+    return emap(ip, bn);
+
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = iballoc(ip);
     return addr;
   }
   bn -= NDIRECT;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+  // Find how many levels of indirect blocks lead to bn;
+  // the tree below ip->addrs[NDIRECT+level] maps n blocks.
+  n = NINDIRECT;
+  for(level = 0; bn >= n; level++){
+    if(level == 2)
+      panic("bmap: out of range");
+    bn -= n;
+    n *= NINDIRECT;
+  }
+
+  // Walk down the tree, allocating blocks as necessary.
+  if((addr = ip->addrs[NDIRECT+level]) == 0)
+    ip->addrs[NDIRECT+level] = addr = iballoc(ip);
+  for(; level >= 0; level--){
+    n /= NINDIRECT;
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+    if((addr = a[bn/n]) == 0){
+      a[bn/n] = addr = iballoc(ip);
       log_write(bp);
     }
     brelse(bp);
-    return addr;
+    bn %= n;
+  }
+  return addr;
+}
+
+#define TRUNCBLOCKS 4  // bitmap blocks itrunc() logs per transaction
+
+// Free block b on behalf of itrunc().  A large file's blocks
+// span more bitmap blocks than one transaction can log, so
+// move on to a new transaction whenever this one has touched
+// TRUNCBLOCKS of them, which leaves room for what the caller's
+// operation logs.  (If the system crashes part way, the
+// unlinked inode and its remaining blocks are leaked.)
+static void
+tfree(uint dev, uint b, uint *bblock, int *nbblock)
+{
+  if(BBLOCK(b, sb) != *bblock){
+    *bblock = BBLOCK(b, sb);
+    if(++*nbblock > TRUNCBLOCKS){
+      end_op();
+      begin_op();
+      *nbblock = 1;
+    }
+  }
+  bfree(dev, b);
+}
+
+// Free indirect block addr and everything below it, level
+// levels of indirect blocks further down.  The buffer is not
+// held across tfree(), which may wait for a commit.
+static void
+tfreeind(uint dev, uint addr, int level, uint *bblock, int *nbblock)
+{
+  int j;
+  struct buf *bp;
+  uint b;
+
+  for(j = 0; j < NINDIRECT; j++){
+    bp = bread(dev, addr);
+    b = ((uint*)bp->data)[j];
+    brelse(bp);
+    if(b == 0)
+      continue;
+    if(level > 0)
+      tfreeind(dev, b, level-1, bblock, nbblock);
+    else
+      tfree(dev, b, bblock, nbblock);
   }
+  tfree(dev, addr, bblock, nbblock);
+}
 
-  panic("bmap: out of range");
+// Free the blocks of extent-mapped ip, as itrunc() does.
+static void
+etrunc(struct inode *ip, uint *bblock, int *nbblock)
+{
+  struct extent *e, x;
+  struct extblock *eb;
+  struct buf *bp;
+  uint addr, next, b;
+  int i;
+
+  e = (struct extent*)ip->addrs;
+  for(i = 0; i < NEXTENT; i++){
+    for(b = 0; b < e[i].len; b++)
+      tfree(ip->dev, e[i].start + b, bblock, nbblock);
+    e[i].start = e[i].len = 0;
+  }
+  for(addr = ip->addrs[EXTCHAIN]; addr; addr = next){
+    for(i = 0; i < NEXTBLOCK; i++){
+      bp = bread(ip->dev, addr);
+      eb = (struct extblock*)bp->data;
+      x = eb->e[i];
+      next = eb->next;
+      brelse(bp);
+      for(b = 0; b < x.len; b++)
+        tfree(ip->dev, x.start + b, bblock, nbblock);
+    }
+    tfree(ip->dev, addr, bblock, nbblock);
+  }
+  ip->addrs[EXTCHAIN] = 0;
+  ip->elen = 0;
 }
 
 // Truncate inode (discard contents).
@@ -407,27 +922,32 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i, nbblock;
+  uint bblock;
+
+  bblock = 0;
+  nbblock = 0;
+  if(ip->type == T_DIR && DIRROOT(ip->major, ip->minor))
+    dirifree(ip, &bblock, &nbblock);
+  if(sb.flags & FS_EXTENTS){
+    etrunc(ip, &bblock, &nbblock);
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
 
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
+      tfree(ip->dev, ip->addrs[i], &bblock, &nbblock);
       ip->addrs[i] = 0;
     }
   }
 
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+  for(i = 0; i < 3; i++){
+    if(ip->addrs[NDIRECT+i]){
+      tfreeind(ip->dev, ip->addrs[NDIRECT+i], i, &bblock, &nbblock);
+      ip->addrs[NDIRECT+i] = 0;
     }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
   }
 
   ip->size = 0;
@@ -446,6 +966,29 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Note a read of block bn of ip.  If it continues a sequential
+// run, keep the next NREADAHEAD blocks of the file on their way
+// into the buffer cache.  Caller must hold ip->lock.
+static void
+readahead(struct inode *ip, uint bn)
+{
+  uint end, nb;
+
+  if(bn != ip->ranext){
+    ip->ranext = bn + 1;
+    ip->raend = 0;
+    return;
+  }
+  ip->ranext = bn + 1;
+  end = (ip->size + BSIZE - 1) / BSIZE;
+  if(end > bn + 1 + NREADAHEAD)
+    end = bn + 1 + NREADAHEAD;
+  nb = ip->raend > bn + 1 ? ip->raend : bn + 1;
+  for(; nb < end; nb++)
+    breadahead(ip->dev, bmap(ip, nb));
+  ip->raend = nb;
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
@@ -467,6 +1010,8 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     n = ip->size - off;
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+    if(off/BSIZE != ip->ranext - 1)
+      readahead(ip, off/BSIZE);
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
@@ -495,6 +1040,11 @@ writei(struct inode *ip, char *src, uint off, uint n)
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
+  // Continue after the file's last block, even if ip was
+  // read back from disk since it was last extended.
+  if(ip->bgoal == 0 && ip->size > 0)
+    ip->bgoal = bmap(ip, (ip->size-1)/BSIZE) + 1;
+
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
@@ -519,8 +1069,258 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Hash of a name for the directory index.
+// mkfs.c has a copy.
+static ushort
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 0;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return h ^ (h >> 16);
+}
+
+// Read the index bucket of indexed directory dp for hash h.
+static struct buf*
+dirbucket(struct inode *dp, ushort h)
+{
+  struct buf *bp;
+  struct dirroot *r;
+  uint b;
+
+  bp = bread(dp->dev, DIRROOT(dp->major, dp->minor));
+  r = (struct dirroot*)bp->data;
+  b = r->bucket[h & ((1 << r->depth) - 1)];
+  brelse(bp);
+  return bread(dp->dev, b);
+}
+
+// Look name up in the index of dp.  Return the inum
+// and set *poff, or return 0.
+static uint
+dirilookup(struct inode *dp, char *name, uint *poff)
+{
+  struct buf *bp;
+  struct dirbucket *db;
+  struct dirent de;
+  ushort h;
+  uint i, next;
+
+  h = dirhash(name);
+  for(bp = dirbucket(dp, h); ; bp = bread(dp->dev, next)){
+    db = (struct dirbucket*)bp->data;
+    for(i = 0; i < db->n; i++){
+      if(db->e[i].hash != h)
+        continue;
+      if(readi(dp, (char*)&de, db->e[i].slot*sizeof(de), sizeof(de)) != sizeof(de))
+        panic("dirilookup read");
+      if(de.inum != 0 && namecmp(name, de.name) == 0){
+        *poff = db->e[i].slot*sizeof(de);
+        brelse(bp);
+        return de.inum;
+      }
+    }
+    next = db->next;
+    brelse(bp);
+    if(next == 0)
+      return 0;
+  }
+}
+
+// Split the full bucket that root entry j of dp's index
+// points at, doubling the table first if need be.
+// Caller holds the root in rbp.
+static void
+dirsplit(struct inode *dp, struct buf *rbp, uint j)
+{
+  struct dirroot *r;
+  struct dirbucket *db, *nd;
+  struct buf *bp, *nbp;
+  uint a, na, i, k, bit;
+
+  r = (struct dirroot*)rbp->data;
+  a = r->bucket[j];
+  bp = bread(dp->dev, a);
+  db = (struct dirbucket*)bp->data;
+  if(db->depth == r->depth){
+    for(k = 0; k < (1 << r->depth); k++)
+      r->bucket[k + (1 << r->depth)] = r->bucket[k];
+    r->depth++;
+  }
+
+  // Entries with the next bit of hash set move to a new bucket.
+  bit = 1 << db->depth;
+  na = iballoc(dp);
+  nbp = bread(dp->dev, na);
+  nd = (struct dirbucket*)nbp->data;
+  for(i = 0; i < db->n; ){
+    if(db->e[i].hash & bit){
+      nd->e[nd->n++] = db->e[i];
+      db->e[i] = db->e[--db->n];
+    } else
+      i++;
+  }
+  db->depth++;
+  nd->depth = db->depth;
+  for(k = 0; k < (1 << r->depth); k++)
+    if(r->bucket[k] == a && (k & bit))
+      r->bucket[k] = na;
+  log_write(nbp);
+  brelse(nbp);
+  log_write(bp);
+  brelse(bp);
+  log_write(rbp);
+}
+
+// Add dirent slot with name hash h to the index of dp.
+static void
+diriadd(struct inode *dp, ushort h, uint slot)
+{
+  struct buf *rbp, *bp;
+  struct dirroot *r;
+  struct dirbucket *db;
+  uint j, next;
+
+  rbp = bread(dp->dev, DIRROOT(dp->major, dp->minor));
+  r = (struct dirroot*)rbp->data;
+  j = h & ((1 << r->depth) - 1);
+  bp = bread(dp->dev, r->bucket[j]);
+  db = (struct dirbucket*)bp->data;
+  if(db->n == NDIRBUCKET && db->next == 0 && db->depth < DIRMAXDEPTH){
+    brelse(bp);
+    dirsplit(dp, rbp, j);
+    j = h & ((1 << r->depth) - 1);
+    bp = bread(dp->dev, r->bucket[j]);
+    db = (struct dirbucket*)bp->data;
+  }
+  brelse(rbp);
+
+  // Still full: use the overflow chain.
+  while(db->n == NDIRBUCKET){
+    if((next = db->next) == 0){
+      db->next = next = iballoc(dp);
+      log_write(bp);
+    }
+    brelse(bp);
+    bp = bread(dp->dev, next);
+    db = (struct dirbucket*)bp->data;
+  }
+  db->e[db->n].hash = h;
+  db->e[db->n].slot = slot;
+  db->n++;
+  log_write(bp);
+  brelse(bp);
+}
+
+// Remove dirent slot with name hash h from the index of dp.
+static void
+diriremove(struct inode *dp, ushort h, uint slot)
+{
+  struct buf *bp;
+  struct dirbucket *db;
+  uint i, next;
+
+  for(bp = dirbucket(dp, h); ; bp = bread(dp->dev, next)){
+    db = (struct dirbucket*)bp->data;
+    for(i = 0; i < db->n; i++){
+      if(db->e[i].slot == slot){
+        db->e[i] = db->e[--db->n];
+        log_write(bp);
+        brelse(bp);
+        return;
+      }
+    }
+    next = db->next;
+    brelse(bp);
+    if(next == 0)
+      panic("diriremove");
+  }
+}
+
+// Give directory dp, which has no index, an index of its
+// entries, and chain its empty dirents into a free list.
+static void
+dirindex(struct inode *dp)
+{
+  struct buf *rbp, *bp;
+  struct dirroot *r;
+  struct dirbucket *db;
+  struct dirent de;
+  uint root, off;
+
+  root = iballoc(dp);
+  rbp = bread(dp->dev, root);
+  r = (struct dirroot*)rbp->data;
+  r->bucket[0] = iballoc(dp);
+  bp = bread(dp->dev, r->bucket[0]);
+  db = (struct dirbucket*)bp->data;
+  for(off = dp->size; off > 0; ){
+    off -= sizeof(de);
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+      panic("dirindex read");
+    if(de.inum == 0){
+      memmove(de.name, &r->freeslot, sizeof(r->freeslot));
+      if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirindex write");
+      r->freeslot = off/sizeof(de) + 1;
+    } else {
+      if(db->n == NDIRBUCKET)
+        panic("dirindex");
+      db->e[db->n].hash = dirhash(de.name);
+      db->e[db->n].slot = off/sizeof(de);
+      db->n++;
+    }
+  }
+  log_write(bp);
+  brelse(bp);
+  log_write(rbp);
+  brelse(rbp);
+  dp->major = root >> 16;
+  dp->minor = root & 0xffff;
+  iupdate(dp);
+}
+
+// Free the index of directory dp, as itrunc() frees blocks.
+static void
+dirifree(struct inode *dp, uint *bblock, int *nbblock)
+{
+  struct buf *bp;
+  struct dirroot *r;
+  struct dirbucket *db;
+  uint root, depth, k, b, next, ld;
+
+  root = DIRROOT(dp->major, dp->minor);
+  bp = bread(dp->dev, root);
+  depth = ((struct dirroot*)bp->data)->depth;
+  brelse(bp);
+  for(k = 0; k < (1 << depth); k++){
+    bp = bread(dp->dev, root);
+    r = (struct dirroot*)bp->data;
+    b = r->bucket[k];
+    brelse(bp);
+    bp = bread(dp->dev, b);
+    ld = ((struct dirbucket*)bp->data)->depth;
+    brelse(bp);
+    if(k >= (1 << ld))
+      continue;  // seen already, through a lower k
+    for(; b; b = next){
+      bp = bread(dp->dev, b);
+      db = (struct dirbucket*)bp->data;
+      next = db->next;
+      brelse(bp);
+      tfree(dp->dev, b, bblock, nbblock);
+    }
+  }
+  tfree(dp->dev, root, bblock, nbblock);
+  dp->major = dp->minor = 0;
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// The answer, found or not, goes in the name cache.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
@@ -530,6 +1330,21 @@ dirlookup(struct inode *dp, char *name, uint *poff)
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
+  if(dcachelookup(dp->dev, dp->inum, name, &inum, &off)){
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+
+  if(DIRROOT(dp->major, dp->minor)){
+    if((inum = dirilookup(dp, name, &off)) != 0)
+      goto found;
+    dcacheadd(dp->dev, dp->inum, name, 0, 0);
+    return 0;
+  }
+
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("dirlookup read");
@@ -537,14 +1352,19 @@ dirlookup(struct inode *dp, char *name, uint *poff)
       continue;
     if(namecmp(name, de.name) == 0){
       // entry matches path element
-      if(poff)
-        *poff = off;
       inum = de.inum;
-      return iget(dp->dev, inum);
+      goto found;
     }
   }
 
+  dcacheadd(dp->dev, dp->inum, name, 0, 0);
   return 0;
+
+found:
+  if(poff)
+    *poff = off;
+  dcacheadd(dp->dev, dp->inum, name, inum, off);
+  return iget(dp->dev, inum);
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
@@ -554,6 +1374,8 @@ dirlink(struct inode *dp, char *name, uint inum)
   int off;
   struct dirent de;
   struct inode *ip;
+  struct buf *bp;
+  struct dirroot *r;
 
   // Check that name is not present.
   if((ip = dirlookup(dp, name, 0)) != 0){
@@ -561,22 +1383,69 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
-  // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
+  if(DIRROOT(dp->major, dp->minor) == 0 && dp->size >= DIRINDEXMIN)
+    dirindex(dp);
+
+  if(DIRROOT(dp->major, dp->minor)){
+    // Take the first free slot, or append.
+    off = dp->size;
+    bp = bread(dp->dev, DIRROOT(dp->major, dp->minor));
+    r = (struct dirroot*)bp->data;
+    if(r->freeslot){
+      off = (r->freeslot - 1) * sizeof(de);
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink read");
+      memmove(&r->freeslot, de.name, sizeof(r->freeslot));
+      log_write(bp);
+    }
+    brelse(bp);
+    if(off/sizeof(de) > 0xffff)
+      return -1;
+  } else {
+    // Look for an empty dirent.
+    for(off = 0; off < dp->size; off += sizeof(de)){
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink read");
+      if(de.inum == 0)
+        break;
+    }
   }
 
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  if(DIRROOT(dp->major, dp->minor))
+    diriadd(dp, dirhash(name), off/sizeof(de));
+  dcacheadd(dp->dev, dp->inum, name, inum, off);
 
   return 0;
 }
 
+// Remove the entry for name, found by dirlookup() at
+// offset off, from the directory dp.
+void
+dirunlink(struct inode *dp, char *name, uint off)
+{
+  struct dirent de;
+  struct buf *bp;
+  struct dirroot *r;
+
+  memset(&de, 0, sizeof(de));
+  if(DIRROOT(dp->major, dp->minor)){
+    diriremove(dp, dirhash(name), off/sizeof(de));
+    bp = bread(dp->dev, DIRROOT(dp->major, dp->minor));
+    r = (struct dirroot*)bp->data;
+    memmove(de.name, &r->freeslot, sizeof(r->freeslot));
+    r->freeslot = off/sizeof(de) + 1;
+    log_write(bp);
+    brelse(bp);
+  }
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("dirunlink");
+  dcacheadd(dp->dev, dp->inum, name, 0, 0);
+}
+
 //PAGEBREAK!
 // Paths
 
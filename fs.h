@@ -19,11 +19,19 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint flags;        // FS_ flags below
 };
 
-#define NDIRECT 12
+#define FS_EXTENTS 0x1  // inodes map their blocks with extents
+
+#define NLOGSEG 2  // log segments, each a header and data blocks
+#define LOGMAXBLOCKS ((BSIZE - 2*sizeof(uint)) / sizeof(uint))  // per segment
+
+#define NDIRECT 10
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define NTINDIRECT (NDINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT + NTINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +40,25 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+3];   // Data block addresses
+};
+
+// On a file system with FS_EXTENTS, a dinode's addrs[] instead
+// holds NEXTENT extents, runs of consecutive blocks, followed by
+// the address of the first of a chain of extent blocks.
+struct extent {
+  uint start;           // First block of the run
+  uint len;             // Number of blocks
+};
+
+#define NEXTENT ((NDIRECT+2)/2)
+#define EXTCHAIN (NDIRECT+2)  // addrs[] index of first extent block
+#define NEXTBLOCK (BSIZE / sizeof(struct extent) - 1)
+
+struct extblock {
+  struct extent e[NEXTBLOCK];
+  uint next;            // Next extent block, or 0
+  uint unused;
 };
 
 // Inodes per block.
@@ -55,3 +81,36 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// A directory that grows to DIRINDEXMIN bytes gets a hash index,
+// kept apart from its dirents so that they can still be read as
+// a plain array.  The index is an extendible hash table: a root
+// block maps the low depth bits of a name's 16-bit hash to a
+// bucket block, which lists the hash and dirent slot (offset /
+// sizeof(struct dirent)) of each entry.  A full bucket is split,
+// or, at DIRMAXDEPTH, chained to an overflow bucket.  Free
+// dirent slots are chained through their name fields.
+//
+// The root's block number is kept in the dinode's major and
+// minor fields, which directories do not otherwise use.
+#define DIRINDEXMIN (2*BSIZE)
+#define DIRMAXDEPTH 6
+#define DIRROOT(major, minor) \
+  (((uint)(ushort)(major) << 16) | (ushort)(minor))
+
+struct dirroot {
+  uint depth;           // Bits of hash that pick a bucket
+  uint freeslot;        // First free dirent slot + 1, or 0
+  uint bucket[1<<DIRMAXDEPTH];
+};
+
+#define NDIRBUCKET ((BSIZE - 2*sizeof(uint)) / (2*sizeof(ushort)))
+
+struct dirbucket {
+  ushort n;             // Entries in use
+  ushort depth;         // Bits of hash shared by all entries
+  uint next;            // Overflow bucket, or 0
+  struct {
+    ushort hash;
+    ushort slot;
+  } e[NDIRBUCKET];
+};
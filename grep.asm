@@ -0,0 +1,1642 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 fd 05 00 00       	call   657 <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 01 06 00 00       	call   66f <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 e8 0a 00 00       	push   $0xae8
+  7f:	6a 01                	push   $0x1
+  81:	e8 1a 07 00 00       	call   7a0 <printf>
+      exit();
+  86:	e8 a4 05 00 00       	call   62f <exit>
+  }
+  exit();
+  8b:	e8 9f 05 00 00       	call   62f <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 c8 0a 00 00       	push   $0xac8
+  97:	6a 02                	push   $0x2
+  99:	e8 02 07 00 00       	call   7a0 <printf>
+    exit();
+  9e:	e8 8c 05 00 00       	call   62f <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 7d 05 00 00       	call   62f <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 20 0f 00 00    	lea    0xf20(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 1a 04 00 00       	call   647 <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf 20 0f 00 00       	mov    $0xf20,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 20 0f 00 00 00 	movb   $0x0,0xf20(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 25 02 00 00       	call   480 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 98 03 00 00       	call   64f <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff 20 0f 00 00    	cmp    $0xf20,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d 20 0f 00 00       	sub    $0xf20,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 20 0f 00 00       	push   $0xf20
+ 31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4c9:	31 db                	xor    %ebx,%ebx
+{
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ce:	eb 2b                	jmp    4fb <gets+0x3b>
+    cc = read(0, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 01                	push   $0x1
+ 4d5:	56                   	push   %esi
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 6a 01 00 00       	call   647 <read>
+    if(cc < 1)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	7e 21                	jle    505 <gets+0x45>
+      break;
+    buf[i++] = c;
+ 4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(c == '\n' || c == '\r' || c == '\t')
+ 4eb:	8d 48 f7             	lea    -0x9(%eax),%ecx
+    buf[i++] = c;
+ 4ee:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r' || c == '\t')
+ 4f2:	80 f9 01             	cmp    $0x1,%cl
+ 4f5:	76 10                	jbe    507 <gets+0x47>
+ 4f7:	3c 0d                	cmp    $0xd,%al
+ 4f9:	74 0c                	je     507 <gets+0x47>
+  for(i=0; i+1 < max; ){
+ 4fb:	89 df                	mov    %ebx,%edi
+ 4fd:	83 c3 01             	add    $0x1,%ebx
+ 500:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 503:	7c cb                	jl     4d0 <gets+0x10>
+ 505:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 507:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50a:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 50e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 511:	5b                   	pop    %ebx
+ 512:	5e                   	pop    %esi
+ 513:	5f                   	pop    %edi
+ 514:	5d                   	pop    %ebp
+ 515:	c3                   	ret
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	6a 00                	push   $0x0
+ 52a:	ff 75 08             	push   0x8(%ebp)
+ 52d:	e8 3d 01 00 00       	call   66f <open>
+  if(fd < 0)
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	85 c0                	test   %eax,%eax
+ 537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 539:	83 ec 08             	sub    $0x8,%esp
+ 53c:	ff 75 0c             	push   0xc(%ebp)
+ 53f:	89 c3                	mov    %eax,%ebx
+ 541:	50                   	push   %eax
+ 542:	e8 40 01 00 00       	call   687 <fstat>
+  close(fd);
+ 547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 54c:	e8 06 01 00 00       	call   657 <close>
+  return r;
+ 551:	83 c4 10             	add    $0x10,%esp
+}
+ 554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 557:	89 f0                	mov    %esi,%eax
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb ed                	jmp    554 <stat+0x34>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 577:	0f be 02             	movsbl (%edx),%eax
+ 57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 585:	77 1e                	ja     5a5 <atoi+0x35>
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 590:	83 c2 01             	add    $0x1,%edx
+ 593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 59a:	0f be 02             	movsbl (%edx),%eax
+ 59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5a0:	80 fb 09             	cmp    $0x9,%bl
+ 5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	89 c8                	mov    %ecx,%eax
+ 5aa:	c9                   	leave
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+
+000005e0 <strncmp>:
+
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	53                   	push   %ebx
+ 5e4:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+ 5ed:	85 d2                	test   %edx,%edx
+ 5ef:	75 16                	jne    607 <strncmp+0x27>
+ 5f1:	eb 2d                	jmp    620 <strncmp+0x40>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+ 5f8:	3a 19                	cmp    (%ecx),%bl
+ 5fa:	75 12                	jne    60e <strncmp+0x2e>
+    n--, p++, q++;
+ 5fc:	83 c0 01             	add    $0x1,%eax
+ 5ff:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+ 602:	83 ea 01             	sub    $0x1,%edx
+ 605:	74 19                	je     620 <strncmp+0x40>
+ 607:	0f b6 18             	movzbl (%eax),%ebx
+ 60a:	84 db                	test   %bl,%bl
+ 60c:	75 ea                	jne    5f8 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+ 60e:	0f b6 00             	movzbl (%eax),%eax
+ 611:	0f b6 11             	movzbl (%ecx),%edx
+ 614:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 617:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+ 618:	29 d0                	sub    %edx,%eax
+ 61a:	c3                   	ret
+ 61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 61f:	90                   	nop
+ 620:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+ 623:	31 c0                	xor    %eax,%eax
+ 625:	c9                   	leave
+ 626:	c3                   	ret
+
+00000627 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 627:	b8 01 00 00 00       	mov    $0x1,%eax
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <exit>:
+SYSCALL(exit)
+ 62f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <wait>:
+SYSCALL(wait)
+ 637:	b8 03 00 00 00       	mov    $0x3,%eax
+ 63c:	cd 40                	int    $0x40
+ 63e:	c3                   	ret
+
+0000063f <pipe>:
+SYSCALL(pipe)
+ 63f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 644:	cd 40                	int    $0x40
+ 646:	c3                   	ret
+
+00000647 <read>:
+SYSCALL(read)
+ 647:	b8 05 00 00 00       	mov    $0x5,%eax
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <write>:
+SYSCALL(write)
+ 64f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <close>:
+SYSCALL(close)
+ 657:	b8 15 00 00 00       	mov    $0x15,%eax
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <kill>:
+SYSCALL(kill)
+ 65f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <exec>:
+SYSCALL(exec)
+ 667:	b8 07 00 00 00       	mov    $0x7,%eax
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <open>:
+SYSCALL(open)
+ 66f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <mknod>:
+SYSCALL(mknod)
+ 677:	b8 11 00 00 00       	mov    $0x11,%eax
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <unlink>:
+SYSCALL(unlink)
+ 67f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <fstat>:
+SYSCALL(fstat)
+ 687:	b8 08 00 00 00       	mov    $0x8,%eax
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <link>:
+SYSCALL(link)
+ 68f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <mkdir>:
+SYSCALL(mkdir)
+ 697:	b8 14 00 00 00       	mov    $0x14,%eax
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <chdir>:
+SYSCALL(chdir)
+ 69f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6a4:	cd 40                	int    $0x40
+ 6a6:	c3                   	ret
+
+000006a7 <dup>:
+SYSCALL(dup)
+ 6a7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6ac:	cd 40                	int    $0x40
+ 6ae:	c3                   	ret
+
+000006af <getpid>:
+SYSCALL(getpid)
+ 6af:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6b4:	cd 40                	int    $0x40
+ 6b6:	c3                   	ret
+
+000006b7 <sbrk>:
+SYSCALL(sbrk)
+ 6b7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <sleep>:
+SYSCALL(sleep)
+ 6bf:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6c4:	cd 40                	int    $0x40
+ 6c6:	c3                   	ret
+
+000006c7 <uptime>:
+SYSCALL(uptime)
+ 6c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6cc:	cd 40                	int    $0x40
+ 6ce:	c3                   	ret
+
+000006cf <setsched>:
+SYSCALL(setsched)
+ 6cf:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6d4:	cd 40                	int    $0x40
+ 6d6:	c3                   	ret
+
+000006d7 <memstat>:
+SYSCALL(memstat)
+ 6d7:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6dc:	cd 40                	int    $0x40
+ 6de:	c3                   	ret
+
+000006df <lseek>:
+SYSCALL(lseek)
+ 6df:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6e4:	cd 40                	int    $0x40
+ 6e6:	c3                   	ret
+
+000006e7 <setiosched>:
+SYSCALL(setiosched)
+ 6e7:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6ec:	cd 40                	int    $0x40
+ 6ee:	c3                   	ret
+
+000006ef <iostat>:
+SYSCALL(iostat)
+ 6ef:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6f4:	cd 40                	int    $0x40
+ 6f6:	c3                   	ret
+ 6f7:	66 90                	xchg   %ax,%ax
+ 6f9:	66 90                	xchg   %ax,%ax
+ 6fb:	66 90                	xchg   %ax,%ax
+ 6fd:	66 90                	xchg   %ax,%ax
+ 6ff:	90                   	nop
+
+00000700 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	57                   	push   %edi
+ 704:	56                   	push   %esi
+ 705:	53                   	push   %ebx
+ 706:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 708:	89 d1                	mov    %edx,%ecx
+{
+ 70a:	83 ec 3c             	sub    $0x3c,%esp
+ 70d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 710:	85 d2                	test   %edx,%edx
+ 712:	0f 89 80 00 00 00    	jns    798 <printint+0x98>
+ 718:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 71c:	74 7a                	je     798 <printint+0x98>
+    x = -xx;
+ 71e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 720:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 725:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 728:	31 f6                	xor    %esi,%esi
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 730:	89 c8                	mov    %ecx,%eax
+ 732:	31 d2                	xor    %edx,%edx
+ 734:	89 f7                	mov    %esi,%edi
+ 736:	f7 f3                	div    %ebx
+ 738:	8d 76 01             	lea    0x1(%esi),%esi
+ 73b:	0f b6 92 60 0b 00 00 	movzbl 0xb60(%edx),%edx
+ 742:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 746:	89 ca                	mov    %ecx,%edx
+ 748:	89 c1                	mov    %eax,%ecx
+ 74a:	39 da                	cmp    %ebx,%edx
+ 74c:	73 e2                	jae    730 <printint+0x30>
+  if(neg)
+ 74e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 751:	85 c0                	test   %eax,%eax
+ 753:	74 07                	je     75c <printint+0x5c>
+    buf[i++] = '-';
+ 755:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 75a:	89 f7                	mov    %esi,%edi
+ 75c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 75f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 762:	01 df                	add    %ebx,%edi
+ 764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 768:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 76b:	83 ec 04             	sub    $0x4,%esp
+ 76e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 771:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 774:	6a 01                	push   $0x1
+ 776:	50                   	push   %eax
+ 777:	56                   	push   %esi
+ 778:	e8 d2 fe ff ff       	call   64f <write>
+  while(--i >= 0)
+ 77d:	89 f8                	mov    %edi,%eax
+ 77f:	83 c4 10             	add    $0x10,%esp
+ 782:	83 ef 01             	sub    $0x1,%edi
+ 785:	39 d8                	cmp    %ebx,%eax
+ 787:	75 df                	jne    768 <printint+0x68>
+}
+ 789:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 78c:	5b                   	pop    %ebx
+ 78d:	5e                   	pop    %esi
+ 78e:	5f                   	pop    %edi
+ 78f:	5d                   	pop    %ebp
+ 790:	c3                   	ret
+ 791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 798:	31 c0                	xor    %eax,%eax
+ 79a:	eb 89                	jmp    725 <printint+0x25>
+ 79c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7af:	0f b6 1e             	movzbl (%esi),%ebx
+ 7b2:	83 c6 01             	add    $0x1,%esi
+ 7b5:	84 db                	test   %bl,%bl
+ 7b7:	74 67                	je     820 <printf+0x80>
+ 7b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7bc:	31 d2                	xor    %edx,%edx
+ 7be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7c1:	eb 34                	jmp    7f7 <printf+0x57>
+ 7c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7c7:	90                   	nop
+ 7c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7d0:	83 f8 25             	cmp    $0x25,%eax
+ 7d3:	74 18                	je     7ed <printf+0x4d>
+  write(fd, &c, 1);
+ 7d5:	83 ec 04             	sub    $0x4,%esp
+ 7d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7de:	6a 01                	push   $0x1
+ 7e0:	50                   	push   %eax
+ 7e1:	57                   	push   %edi
+ 7e2:	e8 68 fe ff ff       	call   64f <write>
+ 7e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 7f0:	83 c6 01             	add    $0x1,%esi
+ 7f3:	84 db                	test   %bl,%bl
+ 7f5:	74 29                	je     820 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7fa:	85 d2                	test   %edx,%edx
+ 7fc:	74 ca                	je     7c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7fe:	83 fa 25             	cmp    $0x25,%edx
+ 801:	75 ea                	jne    7ed <printf+0x4d>
+      if(c == 'd'){
+ 803:	83 f8 25             	cmp    $0x25,%eax
+ 806:	0f 84 24 01 00 00    	je     930 <printf+0x190>
+ 80c:	83 e8 63             	sub    $0x63,%eax
+ 80f:	83 f8 15             	cmp    $0x15,%eax
+ 812:	77 1c                	ja     830 <printf+0x90>
+ 814:	ff 24 85 08 0b 00 00 	jmp    *0xb08(,%eax,4)
+ 81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 820:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 823:	5b                   	pop    %ebx
+ 824:	5e                   	pop    %esi
+ 825:	5f                   	pop    %edi
+ 826:	5d                   	pop    %ebp
+ 827:	c3                   	ret
+ 828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 836:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 83a:	6a 01                	push   $0x1
+ 83c:	52                   	push   %edx
+ 83d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 840:	57                   	push   %edi
+ 841:	e8 09 fe ff ff       	call   64f <write>
+ 846:	83 c4 0c             	add    $0xc,%esp
+ 849:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 84c:	6a 01                	push   $0x1
+ 84e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 851:	52                   	push   %edx
+ 852:	57                   	push   %edi
+ 853:	e8 f7 fd ff ff       	call   64f <write>
+        putc(fd, c);
+ 858:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 85b:	31 d2                	xor    %edx,%edx
+ 85d:	eb 8e                	jmp    7ed <printf+0x4d>
+ 85f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 860:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 86b:	8b 13                	mov    (%ebx),%edx
+ 86d:	6a 00                	push   $0x0
+ 86f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 871:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 874:	e8 87 fe ff ff       	call   700 <printint>
+        ap++;
+ 879:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 87c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 87f:	31 d2                	xor    %edx,%edx
+ 881:	e9 67 ff ff ff       	jmp    7ed <printf+0x4d>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 890:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 893:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 895:	83 c0 04             	add    $0x4,%eax
+ 898:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 89b:	85 db                	test   %ebx,%ebx
+ 89d:	0f 84 9d 00 00 00    	je     940 <printf+0x1a0>
+        while(*s != 0){
+ 8a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8a8:	84 c0                	test   %al,%al
+ 8aa:	0f 84 3d ff ff ff    	je     7ed <printf+0x4d>
+ 8b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8b6:	89 de                	mov    %ebx,%esi
+ 8b8:	89 d3                	mov    %edx,%ebx
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8c0:	83 ec 04             	sub    $0x4,%esp
+ 8c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8c9:	6a 01                	push   $0x1
+ 8cb:	53                   	push   %ebx
+ 8cc:	57                   	push   %edi
+ 8cd:	e8 7d fd ff ff       	call   64f <write>
+        while(*s != 0){
+ 8d2:	0f b6 06             	movzbl (%esi),%eax
+ 8d5:	83 c4 10             	add    $0x10,%esp
+ 8d8:	84 c0                	test   %al,%al
+ 8da:	75 e4                	jne    8c0 <printf+0x120>
+      state = 0;
+ 8dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8df:	31 d2                	xor    %edx,%edx
+ 8e1:	e9 07 ff ff ff       	jmp    7ed <printf+0x4d>
+ 8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8fb:	8b 13                	mov    (%ebx),%edx
+ 8fd:	6a 01                	push   $0x1
+ 8ff:	e9 6b ff ff ff       	jmp    86f <printf+0xcf>
+ 904:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 908:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 90b:	83 ec 04             	sub    $0x4,%esp
+ 90e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 911:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 913:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 916:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 919:	6a 01                	push   $0x1
+ 91b:	52                   	push   %edx
+ 91c:	57                   	push   %edi
+ 91d:	e8 2d fd ff ff       	call   64f <write>
+        ap++;
+ 922:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 925:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 928:	31 d2                	xor    %edx,%edx
+ 92a:	e9 be fe ff ff       	jmp    7ed <printf+0x4d>
+ 92f:	90                   	nop
+  write(fd, &c, 1);
+ 930:	83 ec 04             	sub    $0x4,%esp
+ 933:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 936:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 939:	6a 01                	push   $0x1
+ 93b:	e9 11 ff ff ff       	jmp    851 <printf+0xb1>
+ 940:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 945:	bb fe 0a 00 00       	mov    $0xafe,%ebx
+ 94a:	e9 61 ff ff ff       	jmp    8b0 <printf+0x110>
+ 94f:	90                   	nop
+
+00000950 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 950:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 951:	a1 20 13 00 00       	mov    0x1320,%eax
+{
+ 956:	89 e5                	mov    %esp,%ebp
+ 958:	57                   	push   %edi
+ 959:	56                   	push   %esi
+ 95a:	53                   	push   %ebx
+ 95b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 95e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 968:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 96a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 96c:	39 ca                	cmp    %ecx,%edx
+ 96e:	73 30                	jae    9a0 <free+0x50>
+ 970:	39 c1                	cmp    %eax,%ecx
+ 972:	72 04                	jb     978 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 974:	39 c2                	cmp    %eax,%edx
+ 976:	72 f0                	jb     968 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 978:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 97b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 97e:	39 f8                	cmp    %edi,%eax
+ 980:	74 2e                	je     9b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 982:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 985:	8b 42 04             	mov    0x4(%edx),%eax
+ 988:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 98b:	39 f1                	cmp    %esi,%ecx
+ 98d:	74 38                	je     9c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 98f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 991:	5b                   	pop    %ebx
+  freep = p;
+ 992:	89 15 20 13 00 00    	mov    %edx,0x1320
+}
+ 998:	5e                   	pop    %esi
+ 999:	5f                   	pop    %edi
+ 99a:	5d                   	pop    %ebp
+ 99b:	c3                   	ret
+ 99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9a0:	39 c1                	cmp    %eax,%ecx
+ 9a2:	72 d0                	jb     974 <free+0x24>
+ 9a4:	eb c2                	jmp    968 <free+0x18>
+ 9a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9b0:	03 70 04             	add    0x4(%eax),%esi
+ 9b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9b6:	8b 02                	mov    (%edx),%eax
+ 9b8:	8b 00                	mov    (%eax),%eax
+ 9ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9bd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9c3:	39 f1                	cmp    %esi,%ecx
+ 9c5:	75 c8                	jne    98f <free+0x3f>
+    p->s.size += bp->s.size;
+ 9c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9ca:	89 15 20 13 00 00    	mov    %edx,0x1320
+    p->s.size += bp->s.size;
+ 9d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9d6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9d8:	5b                   	pop    %ebx
+ 9d9:	5e                   	pop    %esi
+ 9da:	5f                   	pop    %edi
+ 9db:	5d                   	pop    %ebp
+ 9dc:	c3                   	ret
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	56                   	push   %esi
+ 9e5:	53                   	push   %ebx
+ 9e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9ec:	8b 15 20 13 00 00    	mov    0x1320,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9f2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9f5:	c1 ef 03             	shr    $0x3,%edi
+ 9f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9fb:	85 d2                	test   %edx,%edx
+ 9fd:	0f 84 8d 00 00 00    	je     a90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a05:	8b 48 04             	mov    0x4(%eax),%ecx
+ a08:	39 f9                	cmp    %edi,%ecx
+ a0a:	73 64                	jae    a70 <malloc+0x90>
+  if(nu < 4096)
+ a0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a11:	39 df                	cmp    %ebx,%edi
+ a13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a1d:	eb 0a                	jmp    a29 <malloc+0x49>
+ a1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a22:	8b 48 04             	mov    0x4(%eax),%ecx
+ a25:	39 f9                	cmp    %edi,%ecx
+ a27:	73 47                	jae    a70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a29:	89 c2                	mov    %eax,%edx
+ a2b:	39 05 20 13 00 00    	cmp    %eax,0x1320
+ a31:	75 ed                	jne    a20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	56                   	push   %esi
+ a37:	e8 7b fc ff ff       	call   6b7 <sbrk>
+  if(p == (char*)-1)
+ a3c:	83 c4 10             	add    $0x10,%esp
+ a3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a42:	74 1c                	je     a60 <malloc+0x80>
+  hp->s.size = nu;
+ a44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a47:	83 ec 0c             	sub    $0xc,%esp
+ a4a:	83 c0 08             	add    $0x8,%eax
+ a4d:	50                   	push   %eax
+ a4e:	e8 fd fe ff ff       	call   950 <free>
+  return freep;
+ a53:	8b 15 20 13 00 00    	mov    0x1320,%edx
+      if((p = morecore(nunits)) == 0)
+ a59:	83 c4 10             	add    $0x10,%esp
+ a5c:	85 d2                	test   %edx,%edx
+ a5e:	75 c0                	jne    a20 <malloc+0x40>
+        return 0;
+  }
+}
+ a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a63:	31 c0                	xor    %eax,%eax
+}
+ a65:	5b                   	pop    %ebx
+ a66:	5e                   	pop    %esi
+ a67:	5f                   	pop    %edi
+ a68:	5d                   	pop    %ebp
+ a69:	c3                   	ret
+ a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a70:	39 cf                	cmp    %ecx,%edi
+ a72:	74 4c                	je     ac0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a74:	29 f9                	sub    %edi,%ecx
+ a76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a7f:	89 15 20 13 00 00    	mov    %edx,0x1320
+}
+ a85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a88:	83 c0 08             	add    $0x8,%eax
+}
+ a8b:	5b                   	pop    %ebx
+ a8c:	5e                   	pop    %esi
+ a8d:	5f                   	pop    %edi
+ a8e:	5d                   	pop    %ebp
+ a8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a90:	c7 05 20 13 00 00 24 	movl   $0x1324,0x1320
+ a97:	13 00 00 
+    base.s.size = 0;
+ a9a:	b8 24 13 00 00       	mov    $0x1324,%eax
+    base.s.ptr = freep = prevp = &base;
+ a9f:	c7 05 24 13 00 00 24 	movl   $0x1324,0x1324
+ aa6:	13 00 00 
+    base.s.size = 0;
+ aa9:	c7 05 28 13 00 00 00 	movl   $0x0,0x1328
+ ab0:	00 00 00 
+    if(p->s.size >= nunits){
+ ab3:	e9 54 ff ff ff       	jmp    a0c <malloc+0x2c>
+ ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ac0:	8b 08                	mov    (%eax),%ecx
+ ac2:	89 0a                	mov    %ecx,(%edx)
+ ac4:	eb b9                	jmp    a7f <malloc+0x9f>
@@ -1,17 +1,19 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code.  Transfers use bus-master DMA when the
+// controller supports it (QEMU's PIIX does), and PIO otherwise.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,15 +25,47 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+
+#define IDEMAXMULT    16  // sectors per interrupt we ask the disk for
+#define IDEMAXDMA     64  // sectors per DMA transfer
+
+// Bus-master DMA registers, at an offset from bmbase.
+#define BM_CMD        0
+#define BM_CMD_START  0x01
+#define BM_CMD_READ   0x08  // device to memory
+#define BM_STATUS     2
+#define BM_STATUS_ERR  0x02
+#define BM_STATUS_INTR 0x04
+#define BM_PRDT       4
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+// Physical region descriptor: one piece of memory in a DMA
+// transfer.  The table must not cross a 64 KB boundary.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last entry
+
+static ushort bmbase;  // bus-master registers, 0 if no DMA
+static struct prd prdt[IDEMAXDMA] __attribute__((aligned(sizeof(struct prd)*IDEMAXDMA)));
+
+// idecur points to the bufs now being read/written to the disk:
+// a run of consecutive blocks linked through qnext, moved with
+// one DMA, READ MULTIPLE or WRITE MULTIPLE command and completed
+// by a single interrupt.  idequeue holds the bufs waiting for the disk, to be
+// started in the order the I/O scheduler picks (see iosched.c).
+// You must hold idelock while manipulating either.
 
 static struct spinlock idelock;
-static struct buf *idequeue;
+static struct buf *idecur;
+static struct ioqueue idequeue;
 
 static int havedisk1;
+static int idemult[2];  // sectors per interrupt, for each disk
 static void idestart(struct buf*);
 
 // Wait for IDE disk to become ready.
@@ -50,6 +84,7 @@ idewait(int checkerr)
 void
 ideinit(void)
 {
+  struct pcidev pd;
   int i;
 
   initlock(&idelock, "ide");
@@ -65,35 +100,98 @@ ideinit(void)
     }
   }
 
+  // Ask each disk to move IDEMAXMULT sectors per interrupt
+  // in READ and WRITE MULTIPLE; a disk that refuses gets one.
+  for(i = 0; i <= havedisk1; i++){
+    outb(0x1f6, 0xe0 | (i<<4));
+    idewait(0);
+    outb(0x1f2, IDEMAXMULT);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    idemult[i] = idewait(1) < 0 ? 1 : IDEMAXMULT;
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  // Use DMA if there is a bus-mastering IDE controller.
+  if(pcifind(0, 0, 0x01, 0x01, &pd) == 0 && (pd.progif & 0x80) &&
+     (pd.bar[4] & PCI_BAR_IO)){
+    bmbase = pd.bar[4] & PCI_BAR_IOMASK;
+    pciwrite(&pd, PCI_COMMAND,
+             pciread(&pd, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+  }
+}
+
+// Take the next request off idequeue, together with any queued
+// requests for the blocks after it, as many as fit in one
+// interrupt's worth of sectors, and link them through qnext.
+// Caller must hold idelock.
+static struct buf*
+idenext(void)
+{
+  struct buf *b, *last;
+  int n;
+
+  if((b = ioqnext(&idequeue)) == 0)
+    return 0;
+  n = (bmbase ? IDEMAXDMA : idemult[b->dev&1]) * SECTOR_SIZE / BSIZE;
+  for(last = b; --n > 0 && (last->qnext = ioqmerge(&idequeue, last)); )
+    last = last->qnext;
+  last->qnext = 0;
+  return b;
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for the run of bufs at b.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *x;
+  int nblock, i;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  nblock = 0;
+  for(x = b; x; x = x->qnext)
+    nblock++;
+  if(b->blockno + nblock > FSSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int nsector = nblock * sector_per_block;
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsector == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  if (nsector > (bmbase ? IDEMAXDMA : idemult[b->dev&1]) && nsector > 1)
+    panic("idestart");
 
+  if(bmbase){
+    // Point the controller at the bufs' data.
+    for(x = b, i = 0; x; x = x->qnext, i++){
+      prdt[i].addr = V2P(x->data);
+      prdt[i].len = BSIZE;
+      prdt[i].flags = x->qnext ? 0 : PRD_EOT;
+    }
+    outl(bmbase + BM_PRDT, V2P(prdt));
+    outb(bmbase + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_CMD_READ);
+    outb(bmbase + BM_STATUS, BM_STATUS_INTR | BM_STATUS_ERR);
+  }
+
+  iocmd(b->dev);
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsector);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(bmbase){
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(bmbase + BM_CMD, inb(bmbase + BM_CMD) | BM_CMD_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    for(x = b; x; x = x->qnext)
+      outsl(0x1f0, x->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -103,42 +201,59 @@ idestart(struct buf *b)
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *next;
+  int ok, st;
 
-  // First queued buffer is the active request.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = idecur) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(bmbase){
+    // The data is already in place; stop the controller.
+    if(((st = inb(bmbase + BM_STATUS)) & BM_STATUS_INTR) == 0){
+      release(&idelock);
+      return;
+    }
+    outb(bmbase + BM_CMD, 0);
+    outb(bmbase + BM_STATUS, BM_STATUS_INTR | BM_STATUS_ERR);
+    ok = idewait(1) >= 0 && (st & BM_STATUS_ERR) == 0;
+    if(!ok)
+      cprintf("ide: DMA error at block %d\n", b->blockno);
+  } else
+    ok = (b->flags & B_DIRTY) || idewait(1) >= 0;
+
+  for(; b; b = next){
+    next = b->qnext;
+    // Read data if needed.
+    if(!(b->flags & B_DIRTY) && ok && !bmbase)
+      insl(0x1f0, b->data, BSIZE/4);
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    // Wake process waiting for this buf, or release
+    // it if nobody is.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    iodone(b);
+    if(b->flags & B_ASYNC)
+      bdone(b);
+    else
+      wakeup(b);
+  }
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  // Start disk on the next bufs the scheduler picks.
+  if((idecur = idenext()) != 0)
+    idestart(idecur);
 
   release(&idelock);
 }
 
-//PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Check that b is a valid request and add it to idequeue,
+// starting the disk if it was idle.  Caller must hold idelock.
+static void
+idequeueadd(struct buf *b)
 {
-  struct buf **pp;
-
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
@@ -146,17 +261,38 @@ iderw(struct buf *b)
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
+  iostart(b);
+  ioqadd(&idequeue, b);
+
+  // Start disk if necessary.
+  if(idecur == 0){
+    idecur = idenext();
+    idestart(idecur);
+  }
+}
+
+//PAGEBREAK!
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return once the request is queued;
+// ideintr() hands the buf to bdone() when it completes.
+void
+iderw(struct buf *b)
+{
+  if(virtioirq && b->dev == ROOTDEV){
+    virtiorw(&b, 1);
+    return;
+  }
+
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  idequeueadd(b);
 
-  // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(b->flags & B_ASYNC){
+    release(&idelock);
+    return;
+  }
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
@@ -166,3 +302,25 @@ iderw(struct buf *b)
 
   release(&idelock);
 }
+
+// Sync n bufs with disk, as iderw() does for one.
+// All are queued before waiting, so the disk moves from
+// one request straight to the next.
+void
+iderwv(struct buf **v, int n)
+{
+  int i;
+
+  if(virtioirq && n > 0 && v[0]->dev == ROOTDEV){
+    virtiorw(v, n);
+    return;
+  }
+
+  acquire(&idelock);
+  for(i = 0; i < n; i++)
+    idequeueadd(v[i]);
+  for(i = 0; i < n; i++)
+    while((v[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(v[i], &idelock);
+  release(&idelock);
+}
@@ -0,0 +1,84 @@
+// I/O accounting.
+//
+// The disk drivers report each request as it is queued
+// (iostart), each command they issue (iocmd) and each request
+// as it completes (iodone).  The block cache, name cache and
+// log keep their own counters; iostat() gathers everything
+// into one struct iostat for the iostat system call.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iostat.h"
+
+// Per-disk counters.  A disk's counters are guarded by the
+// lock of the driver serving it (idelock or the virtio lock).
+static struct iodevstat iodev[NIODEV];
+
+// Histogram bucket for v: 0 if v < 2*min, otherwise i such
+// that min<<i <= v < 2*min<<i, but at most NIOBUCKET-1.
+int
+iobucket(uint v, uint min)
+{
+  int i;
+
+  for(i = 0; v >= 2*min && i < NIOBUCKET-1; i++)
+    v >>= 1;
+  return i;
+}
+
+// b has been queued for the disk.
+void
+iostart(struct buf *b)
+{
+  struct iodevstat *d;
+
+  if(b->dev >= NIODEV)
+    return;
+  d = &iodev[b->dev];
+  b->qtsc = rdtsc();
+  if(b->flags & B_DIRTY)
+    d->nwrite++;
+  else
+    d->nread++;
+  if(++d->qdepth > d->maxqdepth)
+    d->maxqdepth = d->qdepth;
+}
+
+// A command has been issued to disk dev.
+void
+iocmd(uint dev)
+{
+  if(dev < NIODEV)
+    iodev[dev].ncmd++;
+}
+
+// The disk has completed b.
+void
+iodone(struct buf *b)
+{
+  struct iodevstat *d;
+
+  if(b->dev >= NIODEV)
+    return;
+  d = &iodev[b->dev];
+  d->qdepth--;
+  d->lat[iobucket(rdtsc() - b->qtsc, 8192)]++;
+}
+
+// Report I/O statistics.  The counters are read without
+// their locks, so they are approximate.
+void
+iostat(struct iostat *st)
+{
+  memset(st, 0, sizeof(*st));
+  memmove(st->dev, iodev, sizeof(iodev));
+  biostat(st);
+  dcachestat(st);
+  logstat(st);
+}
@@ -0,0 +1,157 @@
+// Disk request scheduling.
+//
+// A disk driver keeps its waiting requests in an ioqueue and
+// asks ioqnext() which one to start when the disk goes idle.
+// The queue is kept in order of arrival and the policy, chosen
+// by setiosched(), decides at each dispatch:
+//
+// * IOSCHED_FIFO: the oldest request.
+// * IOSCHED_CLOOK: the request with the lowest block number at
+//   or after where the disk head last was, or the lowest block
+//   number of all when there is none, so the head sweeps up the
+//   disk and jumps back.
+// * IOSCHED_DEADLINE: as C-LOOK, except that a read that has
+//   waited READDEADLINE ticks, or a write that has waited
+//   WRITEDEADLINE ticks, goes first, so that a stream of
+//   requests near the head cannot starve one far away.
+//
+// The driver may then take the requests that continue the chosen
+// one on disk with ioqmerge() and start them all as one transfer.
+//
+// The queue holds at most a few hundred buffers, so the
+// policies simply scan it.  The caller holds the driver's lock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iosched.h"
+
+#define READDEADLINE   5  // ticks
+#define WRITEDEADLINE 50
+
+#ifndef IOSCHEDPOLICY
+#define IOSCHEDPOLICY IOSCHED_DEADLINE
+#endif
+int iosched = IOSCHEDPOLICY;
+
+// Queue b behind the requests already in q.
+void
+ioqadd(struct ioqueue *q, struct buf *b)
+{
+  b->qnext = 0;
+  b->qtime = ticks;
+  if(q->tail)
+    q->tail->qnext = b;
+  else
+    q->head = b;
+  q->tail = b;
+  q->n++;
+}
+
+// Return the request C-LOOK would start next.
+static struct buf*
+clook(struct ioqueue *q)
+{
+  struct buf *b, *up, *low;
+
+  up = low = 0;
+  for(b = q->head; b; b = b->qnext){
+    if(b->blockno >= q->pos && (up == 0 || b->blockno < up->blockno))
+      up = b;
+    if(low == 0 || b->blockno < low->blockno)
+      low = b;
+  }
+  return up ? up : low;
+}
+
+// Return the oldest request that has waited past its
+// deadline, or 0.
+static struct buf*
+expired(struct ioqueue *q)
+{
+  struct buf *b;
+  uint wait;
+
+  for(b = q->head; b; b = b->qnext){
+    wait = (b->flags & B_DIRTY) ? WRITEDEADLINE : READDEADLINE;
+    if(ticks - b->qtime >= wait)
+      return b;
+  }
+  return 0;
+}
+
+// Take the request to start next off q, or return 0 if q
+// is empty.
+struct buf*
+ioqnext(struct ioqueue *q)
+{
+  struct buf *b, *prev, **pp;
+
+  if(q->head == 0)
+    return 0;
+  switch(iosched){
+  case IOSCHED_CLOOK:
+    b = clook(q);
+    break;
+  case IOSCHED_DEADLINE:
+    if((b = expired(q)) == 0)
+      b = clook(q);
+    break;
+  default:
+    b = q->head;
+    break;
+  }
+
+  prev = 0;
+  for(pp = &q->head; *pp != b; pp = &(*pp)->qnext)
+    prev = *pp;
+  *pp = b->qnext;
+  if(q->tail == b)
+    q->tail = prev;
+  q->n--;
+  q->pos = b->blockno + 1;
+  return b;
+}
+
+// Take the request that continues b on disk in the same
+// direction off q, so that the driver can start both with one
+// command, or return 0 if there is none.
+struct buf*
+ioqmerge(struct ioqueue *q, struct buf *b)
+{
+  struct buf *nb, *prev, **pp;
+
+  prev = 0;
+  for(pp = &q->head; (nb = *pp) != 0; pp = &nb->qnext){
+    if(nb->dev == b->dev && nb->blockno == b->blockno + 1 &&
+       (nb->flags & B_DIRTY) == (b->flags & B_DIRTY)){
+      *pp = nb->qnext;
+      if(q->tail == nb)
+        q->tail = prev;
+      q->n--;
+      q->pos = nb->blockno + 1;
+      return nb;
+    }
+    prev = nb;
+  }
+  return 0;
+}
+
+// Switch the disk scheduling policy.
+// Return the previous policy, or -1 if policy is unknown.
+int
+setiosched(int policy)
+{
+  int old;
+
+  if(policy != IOSCHED_FIFO && policy != IOSCHED_CLOOK &&
+     policy != IOSCHED_DEADLINE)
+    return -1;
+  old = iosched;
+  iosched = policy;
+  return old;
+}
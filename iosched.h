@@ -0,0 +1,4 @@
+// Disk scheduling policies for setiosched()
+#define IOSCHED_FIFO      0  // in order of arrival
+#define IOSCHED_CLOOK     1  // ascending block order, then wrap around
+#define IOSCHED_DEADLINE  2  // C-LOOK, but old requests go first
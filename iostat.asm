@@ -0,0 +1,1540 @@
+
+_iostat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return hit+miss ? hit*100/(hit+miss) : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  struct iostat st;
+  struct iodevstat *d;
+  char name[16];
+  int i;
+
+  if(iostat(&st) < 0){
+   f:	8d b5 94 fe ff ff    	lea    -0x16c(%ebp),%esi
+{
+  15:	53                   	push   %ebx
+  16:	51                   	push   %ecx
+  17:	81 ec 94 01 00 00    	sub    $0x194,%esp
+  if(iostat(&st) < 0){
+  1d:	56                   	push   %esi
+  1e:	e8 9c 06 00 00       	call   6bf <iostat>
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	85 c0                	test   %eax,%eax
+  28:	0f 88 03 02 00 00    	js     231 <main+0x231>
+    printf(2, "iostat: failed\n");
+    exit();
+  }
+
+  printf(1, "disk reads writes cmds blocks/cmd queue maxqueue\n");
+  2e:	50                   	push   %eax
+  for(i = 0; i < NIODEV; i++){
+  2f:	31 ff                	xor    %edi,%edi
+  printf(1, "disk reads writes cmds blocks/cmd queue maxqueue\n");
+  31:	50                   	push   %eax
+  32:	68 2c 0b 00 00       	push   $0xb2c
+  37:	6a 01                	push   $0x1
+  39:	e8 32 07 00 00       	call   770 <printf>
+  for(i = 0; i < NIODEV; i++){
+  3e:	83 c4 10             	add    $0x10,%esp
+    d = &st.dev[i];
+    if(d->nread + d->nwrite == 0)
+  41:	8b 1e                	mov    (%esi),%ebx
+  43:	8b 4e 04             	mov    0x4(%esi),%ecx
+  46:	89 da                	mov    %ebx,%edx
+  48:	01 ca                	add    %ecx,%edx
+  4a:	74 52                	je     9e <main+0x9e>
+      continue;
+    printf(1, "%d %d %d %d %d %d %d\n", i, d->nread, d->nwrite, d->ncmd,
+  4c:	8b 46 10             	mov    0x10(%esi),%eax
+  4f:	89 85 70 fe ff ff    	mov    %eax,-0x190(%ebp)
+  55:	8b 46 0c             	mov    0xc(%esi),%eax
+  58:	89 85 6c fe ff ff    	mov    %eax,-0x194(%ebp)
+           d->ncmd ? (d->nread+d->nwrite)/d->ncmd : 0,
+  5e:	8b 46 08             	mov    0x8(%esi),%eax
+  61:	89 85 74 fe ff ff    	mov    %eax,-0x18c(%ebp)
+    printf(1, "%d %d %d %d %d %d %d\n", i, d->nread, d->nwrite, d->ncmd,
+  67:	31 c0                	xor    %eax,%eax
+  69:	83 bd 74 fe ff ff 00 	cmpl   $0x0,-0x18c(%ebp)
+  70:	0f 85 3a 01 00 00    	jne    1b0 <main+0x1b0>
+  76:	83 ec 0c             	sub    $0xc,%esp
+  79:	ff b5 70 fe ff ff    	push   -0x190(%ebp)
+  7f:	ff b5 6c fe ff ff    	push   -0x194(%ebp)
+  85:	50                   	push   %eax
+  86:	ff b5 74 fe ff ff    	push   -0x18c(%ebp)
+  8c:	51                   	push   %ecx
+  8d:	53                   	push   %ebx
+  8e:	57                   	push   %edi
+  8f:	68 dc 0a 00 00       	push   $0xadc
+  94:	6a 01                	push   $0x1
+  96:	e8 d5 06 00 00       	call   770 <printf>
+  9b:	83 c4 30             	add    $0x30,%esp
+  for(i = 0; i < NIODEV; i++){
+  9e:	83 c6 54             	add    $0x54,%esi
+  a1:	85 ff                	test   %edi,%edi
+  a3:	75 07                	jne    ac <main+0xac>
+  a5:	bf 01 00 00 00       	mov    $0x1,%edi
+  aa:	eb 95                	jmp    41 <main+0x41>
+           d->qdepth, d->maxqdepth);
+  }
+  for(i = 0; i < NIODEV; i++){
+    if(st.dev[i].nread + st.dev[i].nwrite == 0)
+  ac:	8b 85 98 fe ff ff    	mov    -0x168(%ebp),%eax
+  b2:	03 85 94 fe ff ff    	add    -0x16c(%ebp),%eax
+  b8:	0f 85 3a 01 00 00    	jne    1f8 <main+0x1f8>
+  be:	8b 85 ec fe ff ff    	mov    -0x114(%ebp),%eax
+  c4:	03 85 e8 fe ff ff    	add    -0x118(%ebp),%eax
+  ca:	0f 85 ef 00 00 00    	jne    1bf <main+0x1bf>
+    strcpy(name, "disk 0 latency");
+    name[5] = '0' + i;
+    printhist(name, "cycles", st.dev[i].lat, 8192);
+  }
+
+  printf(1, "bcache hits %d misses %d (%d%%)\n",
+  d0:	8b 9d 40 ff ff ff    	mov    -0xc0(%ebp),%ebx
+  d6:	8b 8d 3c ff ff ff    	mov    -0xc4(%ebp),%ecx
+  return hit+miss ? hit*100/(hit+miss) : 0;
+  dc:	31 c0                	xor    %eax,%eax
+  de:	89 de                	mov    %ebx,%esi
+  e0:	01 ce                	add    %ecx,%esi
+  e2:	74 07                	je     eb <main+0xeb>
+  e4:	6b c1 64             	imul   $0x64,%ecx,%eax
+  e7:	31 d2                	xor    %edx,%edx
+  e9:	f7 f6                	div    %esi
+  printf(1, "bcache hits %d misses %d (%d%%)\n",
+  eb:	83 ec 0c             	sub    $0xc,%esp
+  ee:	50                   	push   %eax
+  ef:	53                   	push   %ebx
+  f0:	51                   	push   %ecx
+  f1:	68 60 0b 00 00       	push   $0xb60
+  f6:	6a 01                	push   $0x1
+  f8:	e8 73 06 00 00       	call   770 <printf>
+         st.bhit, st.bmiss, pct(st.bhit, st.bmiss));
+  printf(1, "read-ahead issued %d used %d wasted %d\n",
+  fd:	83 c4 14             	add    $0x14,%esp
+ 100:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+ 106:	ff b5 48 ff ff ff    	push   -0xb8(%ebp)
+ 10c:	ff b5 44 ff ff ff    	push   -0xbc(%ebp)
+ 112:	68 84 0b 00 00       	push   $0xb84
+ 117:	6a 01                	push   $0x1
+ 119:	e8 52 06 00 00       	call   770 <printf>
+         st.raissued, st.rahit, st.rawaste);
+  printf(1, "dcache hits %d misses %d (%d%%)\n",
+ 11e:	8b 9d 54 ff ff ff    	mov    -0xac(%ebp),%ebx
+  return hit+miss ? hit*100/(hit+miss) : 0;
+ 124:	83 c4 20             	add    $0x20,%esp
+ 127:	31 c0                	xor    %eax,%eax
+  printf(1, "dcache hits %d misses %d (%d%%)\n",
+ 129:	8b 8d 50 ff ff ff    	mov    -0xb0(%ebp),%ecx
+  return hit+miss ? hit*100/(hit+miss) : 0;
+ 12f:	89 de                	mov    %ebx,%esi
+ 131:	01 ce                	add    %ecx,%esi
+ 133:	74 07                	je     13c <main+0x13c>
+ 135:	6b c1 64             	imul   $0x64,%ecx,%eax
+ 138:	31 d2                	xor    %edx,%edx
+ 13a:	f7 f6                	div    %esi
+  printf(1, "dcache hits %d misses %d (%d%%)\n",
+ 13c:	83 ec 0c             	sub    $0xc,%esp
+ 13f:	50                   	push   %eax
+ 140:	53                   	push   %ebx
+ 141:	51                   	push   %ecx
+ 142:	68 ac 0b 00 00       	push   $0xbac
+ 147:	6a 01                	push   $0x1
+ 149:	e8 22 06 00 00       	call   770 <printf>
+         st.dhit, st.dmiss, pct(st.dhit, st.dmiss));
+
+  printf(1, "log commits %d blocks %d, installs %d blocks %d\n",
+ 14e:	83 c4 18             	add    $0x18,%esp
+ 151:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+ 157:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+ 15d:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+ 163:	ff b5 58 ff ff ff    	push   -0xa8(%ebp)
+ 169:	68 d0 0b 00 00       	push   $0xbd0
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 fb 05 00 00       	call   770 <printf>
+         st.ncommit, st.nlogged, st.ninstall, st.ninstalled);
+  printhist("commit size", "blocks", st.commitsz, 1);
+ 175:	83 c4 20             	add    $0x20,%esp
+ 178:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+ 17e:	6a 01                	push   $0x1
+ 180:	50                   	push   %eax
+ 181:	68 08 0b 00 00       	push   $0xb08
+ 186:	68 0f 0b 00 00       	push   $0xb0f
+ 18b:	e8 c0 00 00 00       	call   250 <printhist>
+  printhist("commit latency", "cycles", st.commitlat, 8192);
+ 190:	8d 45 a8             	lea    -0x58(%ebp),%eax
+ 193:	68 00 20 00 00       	push   $0x2000
+ 198:	50                   	push   %eax
+ 199:	68 01 0b 00 00       	push   $0xb01
+ 19e:	68 1b 0b 00 00       	push   $0xb1b
+ 1a3:	e8 a8 00 00 00       	call   250 <printhist>
+  exit();
+ 1a8:	83 c4 20             	add    $0x20,%esp
+ 1ab:	e8 4f 04 00 00       	call   5ff <exit>
+    printf(1, "%d %d %d %d %d %d %d\n", i, d->nread, d->nwrite, d->ncmd,
+ 1b0:	89 d0                	mov    %edx,%eax
+ 1b2:	31 d2                	xor    %edx,%edx
+ 1b4:	f7 b5 74 fe ff ff    	divl   -0x18c(%ebp)
+ 1ba:	e9 b7 fe ff ff       	jmp    76 <main+0x76>
+    strcpy(name, "disk 0 latency");
+ 1bf:	8d 9d 84 fe ff ff    	lea    -0x17c(%ebp),%ebx
+ 1c5:	50                   	push   %eax
+ 1c6:	50                   	push   %eax
+ 1c7:	68 f2 0a 00 00       	push   $0xaf2
+ 1cc:	53                   	push   %ebx
+ 1cd:	e8 9e 01 00 00       	call   370 <strcpy>
+    printhist(name, "cycles", st.dev[i].lat, 8192);
+ 1d2:	8d 85 fc fe ff ff    	lea    -0x104(%ebp),%eax
+    name[5] = '0' + i;
+ 1d8:	c6 85 89 fe ff ff 31 	movb   $0x31,-0x177(%ebp)
+    printhist(name, "cycles", st.dev[i].lat, 8192);
+ 1df:	68 00 20 00 00       	push   $0x2000
+ 1e4:	50                   	push   %eax
+ 1e5:	68 01 0b 00 00       	push   $0xb01
+ 1ea:	53                   	push   %ebx
+ 1eb:	e8 60 00 00 00       	call   250 <printhist>
+ 1f0:	83 c4 20             	add    $0x20,%esp
+ 1f3:	e9 d8 fe ff ff       	jmp    d0 <main+0xd0>
+    strcpy(name, "disk 0 latency");
+ 1f8:	8d 9d 84 fe ff ff    	lea    -0x17c(%ebp),%ebx
+ 1fe:	52                   	push   %edx
+ 1ff:	52                   	push   %edx
+ 200:	68 f2 0a 00 00       	push   $0xaf2
+ 205:	53                   	push   %ebx
+ 206:	e8 65 01 00 00       	call   370 <strcpy>
+    printhist(name, "cycles", st.dev[i].lat, 8192);
+ 20b:	8d 85 a8 fe ff ff    	lea    -0x158(%ebp),%eax
+    name[5] = '0' + i;
+ 211:	c6 85 89 fe ff ff 30 	movb   $0x30,-0x177(%ebp)
+    printhist(name, "cycles", st.dev[i].lat, 8192);
+ 218:	68 00 20 00 00       	push   $0x2000
+ 21d:	50                   	push   %eax
+ 21e:	68 01 0b 00 00       	push   $0xb01
+ 223:	53                   	push   %ebx
+ 224:	e8 27 00 00 00       	call   250 <printhist>
+ 229:	83 c4 20             	add    $0x20,%esp
+ 22c:	e9 8d fe ff ff       	jmp    be <main+0xbe>
+    printf(2, "iostat: failed\n");
+ 231:	52                   	push   %edx
+ 232:	52                   	push   %edx
+ 233:	68 cc 0a 00 00       	push   $0xacc
+ 238:	6a 02                	push   $0x2
+ 23a:	e8 31 05 00 00       	call   770 <printf>
+    exit();
+ 23f:	e8 bb 03 00 00       	call   5ff <exit>
+ 244:	66 90                	xchg   %ax,%ax
+ 246:	66 90                	xchg   %ax,%ax
+ 248:	66 90                	xchg   %ax,%ax
+ 24a:	66 90                	xchg   %ax,%ax
+ 24c:	66 90                	xchg   %ax,%ax
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <printhist>:
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+ 255:	53                   	push   %ebx
+ 256:	83 ec 1c             	sub    $0x1c,%esp
+ 259:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 25c:	8b 75 14             	mov    0x14(%ebp),%esi
+  printf(1, "%s (%s: count)\n", name, unit);
+ 25f:	ff 75 0c             	push   0xc(%ebp)
+ 262:	ff 75 08             	push   0x8(%ebp)
+ 265:	68 98 0a 00 00       	push   $0xa98
+ 26a:	6a 01                	push   $0x1
+ 26c:	e8 ff 04 00 00       	call   770 <printf>
+    if(h[i] == 0)
+ 271:	8b 03                	mov    (%ebx),%eax
+      printf(1, "  %d-%d: %d\n", min<<i, (2*min<<i)-1, h[i]);
+ 273:	8d 14 36             	lea    (%esi,%esi,1),%edx
+    if(h[i] == 0)
+ 276:	83 c4 10             	add    $0x10,%esp
+      printf(1, "  %d-%d: %d\n", min<<i, (2*min<<i)-1, h[i]);
+ 279:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    if(h[i] == 0)
+ 27c:	85 c0                	test   %eax,%eax
+ 27e:	0f 84 9c 00 00 00    	je     320 <printhist+0xd0>
+      printf(1, "  <%d: %d\n", 2*min, h[i]);
+ 284:	50                   	push   %eax
+  for(i = 0; i < NIOBUCKET; i++){
+ 285:	bf 01 00 00 00       	mov    $0x1,%edi
+      printf(1, "  <%d: %d\n", 2*min, h[i]);
+ 28a:	52                   	push   %edx
+ 28b:	68 a8 0a 00 00       	push   $0xaa8
+ 290:	6a 01                	push   $0x1
+ 292:	e8 d9 04 00 00       	call   770 <printf>
+    if(h[i] == 0)
+ 297:	8b 43 04             	mov    0x4(%ebx),%eax
+ 29a:	83 c4 10             	add    $0x10,%esp
+ 29d:	85 c0                	test   %eax,%eax
+ 29f:	75 24                	jne    2c5 <printhist+0x75>
+ 2a1:	8b 43 08             	mov    0x8(%ebx),%eax
+  for(i = 0; i < NIOBUCKET; i++){
+ 2a4:	bf 02 00 00 00       	mov    $0x2,%edi
+    if(h[i] == 0)
+ 2a9:	85 c0                	test   %eax,%eax
+ 2ab:	75 18                	jne    2c5 <printhist+0x75>
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < NIOBUCKET; i++){
+ 2b0:	83 c7 01             	add    $0x1,%edi
+ 2b3:	83 ff 10             	cmp    $0x10,%edi
+ 2b6:	75 33                	jne    2eb <printhist+0x9b>
+}
+ 2b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2bb:	5b                   	pop    %ebx
+ 2bc:	5e                   	pop    %esi
+ 2bd:	5f                   	pop    %edi
+ 2be:	5d                   	pop    %ebp
+ 2bf:	c3                   	ret
+    else if(i == NIOBUCKET-1)
+ 2c0:	83 ff 0f             	cmp    $0xf,%edi
+ 2c3:	74 33                	je     2f8 <printhist+0xa8>
+      printf(1, "  %d-%d: %d\n", min<<i, (2*min<<i)-1, h[i]);
+ 2c5:	83 ec 0c             	sub    $0xc,%esp
+ 2c8:	89 f9                	mov    %edi,%ecx
+  for(i = 0; i < NIOBUCKET; i++){
+ 2ca:	83 c7 01             	add    $0x1,%edi
+      printf(1, "  %d-%d: %d\n", min<<i, (2*min<<i)-1, h[i]);
+ 2cd:	50                   	push   %eax
+ 2ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2d1:	d3 e0                	shl    %cl,%eax
+ 2d3:	83 e8 01             	sub    $0x1,%eax
+ 2d6:	50                   	push   %eax
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	d3 e0                	shl    %cl,%eax
+ 2db:	50                   	push   %eax
+ 2dc:	68 bf 0a 00 00       	push   $0xabf
+ 2e1:	6a 01                	push   $0x1
+ 2e3:	e8 88 04 00 00       	call   770 <printf>
+  for(i = 0; i < NIOBUCKET; i++){
+ 2e8:	83 c4 20             	add    $0x20,%esp
+    if(h[i] == 0)
+ 2eb:	8b 04 bb             	mov    (%ebx,%edi,4),%eax
+ 2ee:	85 c0                	test   %eax,%eax
+ 2f0:	75 ce                	jne    2c0 <printhist+0x70>
+ 2f2:	eb bc                	jmp    2b0 <printhist+0x60>
+ 2f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "  >=%d: %d\n", min<<i, h[i]);
+ 2f8:	c1 e6 0f             	shl    $0xf,%esi
+ 2fb:	89 45 14             	mov    %eax,0x14(%ebp)
+ 2fe:	89 75 10             	mov    %esi,0x10(%ebp)
+ 301:	c7 45 0c b3 0a 00 00 	movl   $0xab3,0xc(%ebp)
+ 308:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 30f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 312:	5b                   	pop    %ebx
+ 313:	5e                   	pop    %esi
+ 314:	5f                   	pop    %edi
+ 315:	5d                   	pop    %ebp
+      printf(1, "  >=%d: %d\n", min<<i, h[i]);
+ 316:	e9 55 04 00 00       	jmp    770 <printf>
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+    if(h[i] == 0)
+ 320:	8b 43 04             	mov    0x4(%ebx),%eax
+  for(i = 0; i < NIOBUCKET; i++){
+ 323:	bf 01 00 00 00       	mov    $0x1,%edi
+    if(h[i] == 0)
+ 328:	85 c0                	test   %eax,%eax
+ 32a:	75 99                	jne    2c5 <printhist+0x75>
+  for(i = 0; i < NIOBUCKET; i++){
+ 32c:	83 c7 01             	add    $0x1,%edi
+ 32f:	83 ff 10             	cmp    $0x10,%edi
+ 332:	75 b7                	jne    2eb <printhist+0x9b>
+ 334:	eb 82                	jmp    2b8 <printhist+0x68>
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <pct>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	8b 55 08             	mov    0x8(%ebp),%edx
+  return hit+miss ? hit*100/(hit+miss) : 0;
+ 346:	89 d1                	mov    %edx,%ecx
+ 348:	03 4d 0c             	add    0xc(%ebp),%ecx
+ 34b:	74 13                	je     360 <pct+0x20>
+ 34d:	6b c2 64             	imul   $0x64,%edx,%eax
+ 350:	31 d2                	xor    %edx,%edx
+}
+ 352:	5d                   	pop    %ebp
+  return hit+miss ? hit*100/(hit+miss) : 0;
+ 353:	f7 f1                	div    %ecx
+}
+ 355:	c3                   	ret
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+ 360:	31 c0                	xor    %eax,%eax
+ 362:	5d                   	pop    %ebp
+ 363:	c3                   	ret
+ 364:	66 90                	xchg   %ax,%ax
+ 366:	66 90                	xchg   %ax,%ax
+ 368:	66 90                	xchg   %ax,%ax
+ 36a:	66 90                	xchg   %ax,%ax
+ 36c:	66 90                	xchg   %ax,%ax
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 370:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 371:	31 c0                	xor    %eax,%eax
+{
+ 373:	89 e5                	mov    %esp,%ebp
+ 375:	53                   	push   %ebx
+ 376:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 380:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 384:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 387:	83 c0 01             	add    $0x1,%eax
+ 38a:	84 d2                	test   %dl,%dl
+ 38c:	75 f2                	jne    380 <strcpy+0x10>
+    ;
+  return os;
+}
+ 38e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 391:	89 c8                	mov    %ecx,%eax
+ 393:	c9                   	leave
+ 394:	c3                   	ret
+ 395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3aa:	0f b6 02             	movzbl (%edx),%eax
+ 3ad:	84 c0                	test   %al,%al
+ 3af:	75 17                	jne    3c8 <strcmp+0x28>
+ 3b1:	eb 3a                	jmp    3ed <strcmp+0x4d>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3bc:	83 c2 01             	add    $0x1,%edx
+ 3bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3c2:	84 c0                	test   %al,%al
+ 3c4:	74 1a                	je     3e0 <strcmp+0x40>
+    p++, q++;
+ 3c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3cb:	38 c3                	cmp    %al,%bl
+ 3cd:	74 e9                	je     3b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3cf:	29 d8                	sub    %ebx,%eax
+}
+ 3d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d4:	c9                   	leave
+ 3d5:	c3                   	ret
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3e4:	31 c0                	xor    %eax,%eax
+ 3e6:	29 d8                	sub    %ebx,%eax
+}
+ 3e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3eb:	c9                   	leave
+ 3ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 3f0:	31 c0                	xor    %eax,%eax
+ 3f2:	eb db                	jmp    3cf <strcmp+0x2f>
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 406:	80 3a 00             	cmpb   $0x0,(%edx)
+ 409:	74 15                	je     420 <strlen+0x20>
+ 40b:	31 c0                	xor    %eax,%eax
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+ 410:	83 c0 01             	add    $0x1,%eax
+ 413:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 417:	89 c1                	mov    %eax,%ecx
+ 419:	75 f5                	jne    410 <strlen+0x10>
+    ;
+  return n;
+}
+ 41b:	89 c8                	mov    %ecx,%eax
+ 41d:	5d                   	pop    %ebp
+ 41e:	c3                   	ret
+ 41f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 420:	31 c9                	xor    %ecx,%ecx
+}
+ 422:	5d                   	pop    %ebp
+ 423:	89 c8                	mov    %ecx,%eax
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 437:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 43a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43d:	89 d7                	mov    %edx,%edi
+ 43f:	fc                   	cld
+ 440:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 442:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 445:	89 d0                	mov    %edx,%eax
+ 447:	c9                   	leave
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 45a:	0f b6 10             	movzbl (%eax),%edx
+ 45d:	84 d2                	test   %dl,%dl
+ 45f:	75 12                	jne    473 <strchr+0x23>
+ 461:	eb 1d                	jmp    480 <strchr+0x30>
+ 463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 467:	90                   	nop
+ 468:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 46c:	83 c0 01             	add    $0x1,%eax
+ 46f:	84 d2                	test   %dl,%dl
+ 471:	74 0d                	je     480 <strchr+0x30>
+    if(*s == c)
+ 473:	38 d1                	cmp    %dl,%cl
+ 475:	75 f1                	jne    468 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 477:	5d                   	pop    %ebp
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 480:	31 c0                	xor    %eax,%eax
+}
+ 482:	5d                   	pop    %ebp
+ 483:	c3                   	ret
+ 484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 495:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 498:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 499:	31 db                	xor    %ebx,%ebx
+{
+ 49b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 49e:	eb 2b                	jmp    4cb <gets+0x3b>
+    cc = read(0, &c, 1);
+ 4a0:	83 ec 04             	sub    $0x4,%esp
+ 4a3:	6a 01                	push   $0x1
+ 4a5:	56                   	push   %esi
+ 4a6:	6a 00                	push   $0x0
+ 4a8:	e8 6a 01 00 00       	call   617 <read>
+    if(cc < 1)
+ 4ad:	83 c4 10             	add    $0x10,%esp
+ 4b0:	85 c0                	test   %eax,%eax
+ 4b2:	7e 21                	jle    4d5 <gets+0x45>
+      break;
+    buf[i++] = c;
+ 4b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(c == '\n' || c == '\r' || c == '\t')
+ 4bb:	8d 48 f7             	lea    -0x9(%eax),%ecx
+    buf[i++] = c;
+ 4be:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r' || c == '\t')
+ 4c2:	80 f9 01             	cmp    $0x1,%cl
+ 4c5:	76 10                	jbe    4d7 <gets+0x47>
+ 4c7:	3c 0d                	cmp    $0xd,%al
+ 4c9:	74 0c                	je     4d7 <gets+0x47>
+  for(i=0; i+1 < max; ){
+ 4cb:	89 df                	mov    %ebx,%edi
+ 4cd:	83 c3 01             	add    $0x1,%ebx
+ 4d0:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4d3:	7c cb                	jl     4a0 <gets+0x10>
+ 4d5:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4da:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4e1:	5b                   	pop    %ebx
+ 4e2:	5e                   	pop    %esi
+ 4e3:	5f                   	pop    %edi
+ 4e4:	5d                   	pop    %ebp
+ 4e5:	c3                   	ret
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	56                   	push   %esi
+ 4f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4f5:	83 ec 08             	sub    $0x8,%esp
+ 4f8:	6a 00                	push   $0x0
+ 4fa:	ff 75 08             	push   0x8(%ebp)
+ 4fd:	e8 3d 01 00 00       	call   63f <open>
+  if(fd < 0)
+ 502:	83 c4 10             	add    $0x10,%esp
+ 505:	85 c0                	test   %eax,%eax
+ 507:	78 27                	js     530 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 509:	83 ec 08             	sub    $0x8,%esp
+ 50c:	ff 75 0c             	push   0xc(%ebp)
+ 50f:	89 c3                	mov    %eax,%ebx
+ 511:	50                   	push   %eax
+ 512:	e8 40 01 00 00       	call   657 <fstat>
+  close(fd);
+ 517:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 51a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 51c:	e8 06 01 00 00       	call   627 <close>
+  return r;
+ 521:	83 c4 10             	add    $0x10,%esp
+}
+ 524:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 527:	89 f0                	mov    %esi,%eax
+ 529:	5b                   	pop    %ebx
+ 52a:	5e                   	pop    %esi
+ 52b:	5d                   	pop    %ebp
+ 52c:	c3                   	ret
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 530:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 535:	eb ed                	jmp    524 <stat+0x34>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 547:	0f be 02             	movsbl (%edx),%eax
+ 54a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 54d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 555:	77 1e                	ja     575 <atoi+0x35>
+ 557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 560:	83 c2 01             	add    $0x1,%edx
+ 563:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 566:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 56a:	0f be 02             	movsbl (%edx),%eax
+ 56d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 570:	80 fb 09             	cmp    $0x9,%bl
+ 573:	76 eb                	jbe    560 <atoi+0x20>
+  return n;
+}
+ 575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 578:	89 c8                	mov    %ecx,%eax
+ 57a:	c9                   	leave
+ 57b:	c3                   	ret
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	8b 45 10             	mov    0x10(%ebp),%eax
+ 588:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 58e:	85 c0                	test   %eax,%eax
+ 590:	7e 13                	jle    5a5 <memmove+0x25>
+ 592:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 594:	89 d7                	mov    %edx,%edi
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5a1:	39 f8                	cmp    %edi,%eax
+ 5a3:	75 fb                	jne    5a0 <memmove+0x20>
+  return vdst;
+}
+ 5a5:	5e                   	pop    %esi
+ 5a6:	89 d0                	mov    %edx,%eax
+ 5a8:	5f                   	pop    %edi
+ 5a9:	5d                   	pop    %ebp
+ 5aa:	c3                   	ret
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+
+000005b0 <strncmp>:
+
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	53                   	push   %ebx
+ 5b4:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+ 5bd:	85 d2                	test   %edx,%edx
+ 5bf:	75 16                	jne    5d7 <strncmp+0x27>
+ 5c1:	eb 2d                	jmp    5f0 <strncmp+0x40>
+ 5c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5c7:	90                   	nop
+ 5c8:	3a 19                	cmp    (%ecx),%bl
+ 5ca:	75 12                	jne    5de <strncmp+0x2e>
+    n--, p++, q++;
+ 5cc:	83 c0 01             	add    $0x1,%eax
+ 5cf:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+ 5d2:	83 ea 01             	sub    $0x1,%edx
+ 5d5:	74 19                	je     5f0 <strncmp+0x40>
+ 5d7:	0f b6 18             	movzbl (%eax),%ebx
+ 5da:	84 db                	test   %bl,%bl
+ 5dc:	75 ea                	jne    5c8 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+ 5de:	0f b6 00             	movzbl (%eax),%eax
+ 5e1:	0f b6 11             	movzbl (%ecx),%edx
+ 5e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5e7:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+ 5e8:	29 d0                	sub    %edx,%eax
+ 5ea:	c3                   	ret
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+ 5f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+ 5f3:	31 c0                	xor    %eax,%eax
+ 5f5:	c9                   	leave
+ 5f6:	c3                   	ret
+
+000005f7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5f7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5fc:	cd 40                	int    $0x40
+ 5fe:	c3                   	ret
+
+000005ff <exit>:
+SYSCALL(exit)
+ 5ff:	b8 02 00 00 00       	mov    $0x2,%eax
+ 604:	cd 40                	int    $0x40
+ 606:	c3                   	ret
+
+00000607 <wait>:
+SYSCALL(wait)
+ 607:	b8 03 00 00 00       	mov    $0x3,%eax
+ 60c:	cd 40                	int    $0x40
+ 60e:	c3                   	ret
+
+0000060f <pipe>:
+SYSCALL(pipe)
+ 60f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 614:	cd 40                	int    $0x40
+ 616:	c3                   	ret
+
+00000617 <read>:
+SYSCALL(read)
+ 617:	b8 05 00 00 00       	mov    $0x5,%eax
+ 61c:	cd 40                	int    $0x40
+ 61e:	c3                   	ret
+
+0000061f <write>:
+SYSCALL(write)
+ 61f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 624:	cd 40                	int    $0x40
+ 626:	c3                   	ret
+
+00000627 <close>:
+SYSCALL(close)
+ 627:	b8 15 00 00 00       	mov    $0x15,%eax
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <kill>:
+SYSCALL(kill)
+ 62f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <exec>:
+SYSCALL(exec)
+ 637:	b8 07 00 00 00       	mov    $0x7,%eax
+ 63c:	cd 40                	int    $0x40
+ 63e:	c3                   	ret
+
+0000063f <open>:
+SYSCALL(open)
+ 63f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 644:	cd 40                	int    $0x40
+ 646:	c3                   	ret
+
+00000647 <mknod>:
+SYSCALL(mknod)
+ 647:	b8 11 00 00 00       	mov    $0x11,%eax
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <unlink>:
+SYSCALL(unlink)
+ 64f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <fstat>:
+SYSCALL(fstat)
+ 657:	b8 08 00 00 00       	mov    $0x8,%eax
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <link>:
+SYSCALL(link)
+ 65f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <mkdir>:
+SYSCALL(mkdir)
+ 667:	b8 14 00 00 00       	mov    $0x14,%eax
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <chdir>:
+SYSCALL(chdir)
+ 66f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <dup>:
+SYSCALL(dup)
+ 677:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <getpid>:
+SYSCALL(getpid)
+ 67f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <sbrk>:
+SYSCALL(sbrk)
+ 687:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <sleep>:
+SYSCALL(sleep)
+ 68f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <uptime>:
+SYSCALL(uptime)
+ 697:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <setsched>:
+SYSCALL(setsched)
+ 69f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6a4:	cd 40                	int    $0x40
+ 6a6:	c3                   	ret
+
+000006a7 <memstat>:
+SYSCALL(memstat)
+ 6a7:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6ac:	cd 40                	int    $0x40
+ 6ae:	c3                   	ret
+
+000006af <lseek>:
+SYSCALL(lseek)
+ 6af:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6b4:	cd 40                	int    $0x40
+ 6b6:	c3                   	ret
+
+000006b7 <setiosched>:
+SYSCALL(setiosched)
+ 6b7:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <iostat>:
+SYSCALL(iostat)
+ 6bf:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6c4:	cd 40                	int    $0x40
+ 6c6:	c3                   	ret
+ 6c7:	66 90                	xchg   %ax,%ax
+ 6c9:	66 90                	xchg   %ax,%ax
+ 6cb:	66 90                	xchg   %ax,%ax
+ 6cd:	66 90                	xchg   %ax,%ax
+ 6cf:	90                   	nop
+
+000006d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6d8:	89 d1                	mov    %edx,%ecx
+{
+ 6da:	83 ec 3c             	sub    $0x3c,%esp
+ 6dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6e0:	85 d2                	test   %edx,%edx
+ 6e2:	0f 89 80 00 00 00    	jns    768 <printint+0x98>
+ 6e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6ec:	74 7a                	je     768 <printint+0x98>
+    x = -xx;
+ 6ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6f8:	31 f6                	xor    %esi,%esi
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 700:	89 c8                	mov    %ecx,%eax
+ 702:	31 d2                	xor    %edx,%edx
+ 704:	89 f7                	mov    %esi,%edi
+ 706:	f7 f3                	div    %ebx
+ 708:	8d 76 01             	lea    0x1(%esi),%esi
+ 70b:	0f b6 92 60 0c 00 00 	movzbl 0xc60(%edx),%edx
+ 712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 716:	89 ca                	mov    %ecx,%edx
+ 718:	89 c1                	mov    %eax,%ecx
+ 71a:	39 da                	cmp    %ebx,%edx
+ 71c:	73 e2                	jae    700 <printint+0x30>
+  if(neg)
+ 71e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 721:	85 c0                	test   %eax,%eax
+ 723:	74 07                	je     72c <printint+0x5c>
+    buf[i++] = '-';
+ 725:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 72a:	89 f7                	mov    %esi,%edi
+ 72c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 72f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 732:	01 df                	add    %ebx,%edi
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 738:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 741:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 744:	6a 01                	push   $0x1
+ 746:	50                   	push   %eax
+ 747:	56                   	push   %esi
+ 748:	e8 d2 fe ff ff       	call   61f <write>
+  while(--i >= 0)
+ 74d:	89 f8                	mov    %edi,%eax
+ 74f:	83 c4 10             	add    $0x10,%esp
+ 752:	83 ef 01             	sub    $0x1,%edi
+ 755:	39 d8                	cmp    %ebx,%eax
+ 757:	75 df                	jne    738 <printint+0x68>
+}
+ 759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 75c:	5b                   	pop    %ebx
+ 75d:	5e                   	pop    %esi
+ 75e:	5f                   	pop    %edi
+ 75f:	5d                   	pop    %ebp
+ 760:	c3                   	ret
+ 761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 768:	31 c0                	xor    %eax,%eax
+ 76a:	eb 89                	jmp    6f5 <printint+0x25>
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000770 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 779:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 77c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 77f:	0f b6 1e             	movzbl (%esi),%ebx
+ 782:	83 c6 01             	add    $0x1,%esi
+ 785:	84 db                	test   %bl,%bl
+ 787:	74 67                	je     7f0 <printf+0x80>
+ 789:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 78c:	31 d2                	xor    %edx,%edx
+ 78e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 791:	eb 34                	jmp    7c7 <printf+0x57>
+ 793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 797:	90                   	nop
+ 798:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 79b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7a0:	83 f8 25             	cmp    $0x25,%eax
+ 7a3:	74 18                	je     7bd <printf+0x4d>
+  write(fd, &c, 1);
+ 7a5:	83 ec 04             	sub    $0x4,%esp
+ 7a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ae:	6a 01                	push   $0x1
+ 7b0:	50                   	push   %eax
+ 7b1:	57                   	push   %edi
+ 7b2:	e8 68 fe ff ff       	call   61f <write>
+ 7b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c0:	83 c6 01             	add    $0x1,%esi
+ 7c3:	84 db                	test   %bl,%bl
+ 7c5:	74 29                	je     7f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ca:	85 d2                	test   %edx,%edx
+ 7cc:	74 ca                	je     798 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ce:	83 fa 25             	cmp    $0x25,%edx
+ 7d1:	75 ea                	jne    7bd <printf+0x4d>
+      if(c == 'd'){
+ 7d3:	83 f8 25             	cmp    $0x25,%eax
+ 7d6:	0f 84 24 01 00 00    	je     900 <printf+0x190>
+ 7dc:	83 e8 63             	sub    $0x63,%eax
+ 7df:	83 f8 15             	cmp    $0x15,%eax
+ 7e2:	77 1c                	ja     800 <printf+0x90>
+ 7e4:	ff 24 85 08 0c 00 00 	jmp    *0xc08(,%eax,4)
+ 7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7f3:	5b                   	pop    %ebx
+ 7f4:	5e                   	pop    %esi
+ 7f5:	5f                   	pop    %edi
+ 7f6:	5d                   	pop    %ebp
+ 7f7:	c3                   	ret
+ 7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 806:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 80a:	6a 01                	push   $0x1
+ 80c:	52                   	push   %edx
+ 80d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 810:	57                   	push   %edi
+ 811:	e8 09 fe ff ff       	call   61f <write>
+ 816:	83 c4 0c             	add    $0xc,%esp
+ 819:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 81c:	6a 01                	push   $0x1
+ 81e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 821:	52                   	push   %edx
+ 822:	57                   	push   %edi
+ 823:	e8 f7 fd ff ff       	call   61f <write>
+        putc(fd, c);
+ 828:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 82b:	31 d2                	xor    %edx,%edx
+ 82d:	eb 8e                	jmp    7bd <printf+0x4d>
+ 82f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 00                	push   $0x0
+ 83f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 841:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 844:	e8 87 fe ff ff       	call   6d0 <printint>
+        ap++;
+ 849:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 84c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 67 ff ff ff       	jmp    7bd <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 860:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 863:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 865:	83 c0 04             	add    $0x4,%eax
+ 868:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 86b:	85 db                	test   %ebx,%ebx
+ 86d:	0f 84 9d 00 00 00    	je     910 <printf+0x1a0>
+        while(*s != 0){
+ 873:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 876:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 878:	84 c0                	test   %al,%al
+ 87a:	0f 84 3d ff ff ff    	je     7bd <printf+0x4d>
+ 880:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 883:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 886:	89 de                	mov    %ebx,%esi
+ 888:	89 d3                	mov    %edx,%ebx
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 896:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 899:	6a 01                	push   $0x1
+ 89b:	53                   	push   %ebx
+ 89c:	57                   	push   %edi
+ 89d:	e8 7d fd ff ff       	call   61f <write>
+        while(*s != 0){
+ 8a2:	0f b6 06             	movzbl (%esi),%eax
+ 8a5:	83 c4 10             	add    $0x10,%esp
+ 8a8:	84 c0                	test   %al,%al
+ 8aa:	75 e4                	jne    890 <printf+0x120>
+      state = 0;
+ 8ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 07 ff ff ff       	jmp    7bd <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8cb:	8b 13                	mov    (%ebx),%edx
+ 8cd:	6a 01                	push   $0x1
+ 8cf:	e9 6b ff ff ff       	jmp    83f <printf+0xcf>
+ 8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8db:	83 ec 04             	sub    $0x4,%esp
+ 8de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	52                   	push   %edx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 2d fd ff ff       	call   61f <write>
+        ap++;
+ 8f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8f8:	31 d2                	xor    %edx,%edx
+ 8fa:	e9 be fe ff ff       	jmp    7bd <printf+0x4d>
+ 8ff:	90                   	nop
+  write(fd, &c, 1);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 906:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 909:	6a 01                	push   $0x1
+ 90b:	e9 11 ff ff ff       	jmp    821 <printf+0xb1>
+ 910:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 915:	bb 01 0c 00 00       	mov    $0xc01,%ebx
+ 91a:	e9 61 ff ff ff       	jmp    880 <printf+0x110>
+ 91f:	90                   	nop
+
+00000920 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 920:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 921:	a1 a0 0f 00 00       	mov    0xfa0,%eax
+{
+ 926:	89 e5                	mov    %esp,%ebp
+ 928:	57                   	push   %edi
+ 929:	56                   	push   %esi
+ 92a:	53                   	push   %ebx
+ 92b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 92e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 938:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 93a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 93c:	39 ca                	cmp    %ecx,%edx
+ 93e:	73 30                	jae    970 <free+0x50>
+ 940:	39 c1                	cmp    %eax,%ecx
+ 942:	72 04                	jb     948 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 944:	39 c2                	cmp    %eax,%edx
+ 946:	72 f0                	jb     938 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 948:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 94b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 94e:	39 f8                	cmp    %edi,%eax
+ 950:	74 2e                	je     980 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 952:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 955:	8b 42 04             	mov    0x4(%edx),%eax
+ 958:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 95b:	39 f1                	cmp    %esi,%ecx
+ 95d:	74 38                	je     997 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 95f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 961:	5b                   	pop    %ebx
+  freep = p;
+ 962:	89 15 a0 0f 00 00    	mov    %edx,0xfa0
+}
+ 968:	5e                   	pop    %esi
+ 969:	5f                   	pop    %edi
+ 96a:	5d                   	pop    %ebp
+ 96b:	c3                   	ret
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 970:	39 c1                	cmp    %eax,%ecx
+ 972:	72 d0                	jb     944 <free+0x24>
+ 974:	eb c2                	jmp    938 <free+0x18>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 980:	03 70 04             	add    0x4(%eax),%esi
+ 983:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 986:	8b 02                	mov    (%edx),%eax
+ 988:	8b 00                	mov    (%eax),%eax
+ 98a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 98d:	8b 42 04             	mov    0x4(%edx),%eax
+ 990:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 993:	39 f1                	cmp    %esi,%ecx
+ 995:	75 c8                	jne    95f <free+0x3f>
+    p->s.size += bp->s.size;
+ 997:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 99a:	89 15 a0 0f 00 00    	mov    %edx,0xfa0
+    p->s.size += bp->s.size;
+ 9a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9a8:	5b                   	pop    %ebx
+ 9a9:	5e                   	pop    %esi
+ 9aa:	5f                   	pop    %edi
+ 9ab:	5d                   	pop    %ebp
+ 9ac:	c3                   	ret
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9bc:	8b 15 a0 0f 00 00    	mov    0xfa0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9c5:	c1 ef 03             	shr    $0x3,%edi
+ 9c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9cb:	85 d2                	test   %edx,%edx
+ 9cd:	0f 84 8d 00 00 00    	je     a60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9d8:	39 f9                	cmp    %edi,%ecx
+ 9da:	73 64                	jae    a40 <malloc+0x90>
+  if(nu < 4096)
+ 9dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9e1:	39 df                	cmp    %ebx,%edi
+ 9e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9ed:	eb 0a                	jmp    9f9 <malloc+0x49>
+ 9ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9f5:	39 f9                	cmp    %edi,%ecx
+ 9f7:	73 47                	jae    a40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9f9:	89 c2                	mov    %eax,%edx
+ 9fb:	39 05 a0 0f 00 00    	cmp    %eax,0xfa0
+ a01:	75 ed                	jne    9f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	56                   	push   %esi
+ a07:	e8 7b fc ff ff       	call   687 <sbrk>
+  if(p == (char*)-1)
+ a0c:	83 c4 10             	add    $0x10,%esp
+ a0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a12:	74 1c                	je     a30 <malloc+0x80>
+  hp->s.size = nu;
+ a14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a17:	83 ec 0c             	sub    $0xc,%esp
+ a1a:	83 c0 08             	add    $0x8,%eax
+ a1d:	50                   	push   %eax
+ a1e:	e8 fd fe ff ff       	call   920 <free>
+  return freep;
+ a23:	8b 15 a0 0f 00 00    	mov    0xfa0,%edx
+      if((p = morecore(nunits)) == 0)
+ a29:	83 c4 10             	add    $0x10,%esp
+ a2c:	85 d2                	test   %edx,%edx
+ a2e:	75 c0                	jne    9f0 <malloc+0x40>
+        return 0;
+  }
+}
+ a30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a33:	31 c0                	xor    %eax,%eax
+}
+ a35:	5b                   	pop    %ebx
+ a36:	5e                   	pop    %esi
+ a37:	5f                   	pop    %edi
+ a38:	5d                   	pop    %ebp
+ a39:	c3                   	ret
+ a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a40:	39 cf                	cmp    %ecx,%edi
+ a42:	74 4c                	je     a90 <malloc+0xe0>
+        p->s.size -= nunits;
+ a44:	29 f9                	sub    %edi,%ecx
+ a46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a4f:	89 15 a0 0f 00 00    	mov    %edx,0xfa0
+}
+ a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a58:	83 c0 08             	add    $0x8,%eax
+}
+ a5b:	5b                   	pop    %ebx
+ a5c:	5e                   	pop    %esi
+ a5d:	5f                   	pop    %edi
+ a5e:	5d                   	pop    %ebp
+ a5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a60:	c7 05 a0 0f 00 00 a4 	movl   $0xfa4,0xfa0
+ a67:	0f 00 00 
+    base.s.size = 0;
+ a6a:	b8 a4 0f 00 00       	mov    $0xfa4,%eax
+    base.s.ptr = freep = prevp = &base;
+ a6f:	c7 05 a4 0f 00 00 a4 	movl   $0xfa4,0xfa4
+ a76:	0f 00 00 
+    base.s.size = 0;
+ a79:	c7 05 a8 0f 00 00 00 	movl   $0x0,0xfa8
+ a80:	00 00 00 
+    if(p->s.size >= nunits){
+ a83:	e9 54 ff ff ff       	jmp    9dc <malloc+0x2c>
+ a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a90:	8b 08                	mov    (%eax),%ecx
+ a92:	89 0a                	mov    %ecx,(%edx)
+ a94:	eb b9                	jmp    a4f <malloc+0x9f>
@@ -0,0 +1,77 @@
+// Print I/O statistics: per-disk request counts, queue depth
+// and latency, block cache and name cache hit rates, and log
+// commit counts, sizes and latency.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "iostat.h"
+
+void
+printhist(char *name, char *unit, uint *h, uint min)
+{
+  int i;
+
+  printf(1, "%s (%s: count)\n", name, unit);
+  for(i = 0; i < NIOBUCKET; i++){
+    if(h[i] == 0)
+      continue;
+    if(i == 0)
+      printf(1, "  <%d: %d\n", 2*min, h[i]);
+    else if(i == NIOBUCKET-1)
+      printf(1, "  >=%d: %d\n", min<<i, h[i]);
+    else
+      printf(1, "  %d-%d: %d\n", min<<i, (2*min<<i)-1, h[i]);
+  }
+}
+
+// Hits as a percentage of hits plus misses.
+int
+pct(uint hit, uint miss)
+{
+  return hit+miss ? hit*100/(hit+miss) : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct iostat st;
+  struct iodevstat *d;
+  char name[16];
+  int i;
+
+  if(iostat(&st) < 0){
+    printf(2, "iostat: failed\n");
+    exit();
+  }
+
+  printf(1, "disk reads writes cmds blocks/cmd queue maxqueue\n");
+  for(i = 0; i < NIODEV; i++){
+    d = &st.dev[i];
+    if(d->nread + d->nwrite == 0)
+      continue;
+    printf(1, "%d %d %d %d %d %d %d\n", i, d->nread, d->nwrite, d->ncmd,
+           d->ncmd ? (d->nread+d->nwrite)/d->ncmd : 0,
+           d->qdepth, d->maxqdepth);
+  }
+  for(i = 0; i < NIODEV; i++){
+    if(st.dev[i].nread + st.dev[i].nwrite == 0)
+      continue;
+    strcpy(name, "disk 0 latency");
+    name[5] = '0' + i;
+    printhist(name, "cycles", st.dev[i].lat, 8192);
+  }
+
+  printf(1, "bcache hits %d misses %d (%d%%)\n",
+         st.bhit, st.bmiss, pct(st.bhit, st.bmiss));
+  printf(1, "read-ahead issued %d used %d wasted %d\n",
+         st.raissued, st.rahit, st.rawaste);
+  printf(1, "dcache hits %d misses %d (%d%%)\n",
+         st.dhit, st.dmiss, pct(st.dhit, st.dmiss));
+
+  printf(1, "log commits %d blocks %d, installs %d blocks %d\n",
+         st.ncommit, st.nlogged, st.ninstall, st.ninstalled);
+  printhist("commit size", "blocks", st.commitsz, 1);
+  printhist("commit latency", "cycles", st.commitlat, 8192);
+  exit();
+}
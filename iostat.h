@@ -0,0 +1,34 @@
+#define NIODEV      2  // disks accounted for, by device number
+#define NIOBUCKET  16  // histogram buckets
+
+// Disk, block cache, name cache and log statistics, filled in
+// by iostat().  Latency bucket 0 counts requests that took fewer
+// than 16384 TSC cycles, bucket i those that took
+// [8192<<i, 16384<<i) cycles, and the last bucket everything
+// slower.  Commit size bucket 0 counts one-block commits and
+// bucket i those of [1<<i, 2<<i) blocks.
+struct iodevstat {
+  uint nread;                // Blocks read
+  uint nwrite;               // Blocks written
+  uint ncmd;                 // Commands issued, after merging
+  uint qdepth;               // Requests queued or in flight now
+  uint maxqdepth;            // ... and the most there have been
+  uint lat[NIOBUCKET];       // Time from queueing to completion
+};
+
+struct iostat {
+  struct iodevstat dev[NIODEV];
+  uint bhit;                 // bread() found the block cached
+  uint bmiss;                // ... or had to read it
+  uint raissued;             // Read-ahead blocks sent to the disk
+  uint rahit;                // ... later read by bread()
+  uint rawaste;              // ... recycled without being read
+  uint dhit;                 // Name cache hits
+  uint dmiss;                // Name cache misses
+  uint ncommit;              // Log commits
+  uint nlogged;              // Blocks they wrote to the log
+  uint ninstall;             // Installs of committed segments
+  uint ninstalled;           // Blocks they wrote home
+  uint commitsz[NIOBUCKET];  // Blocks per commit
+  uint commitlat[NIOBUCKET]; // Time to write a commit to the log
+};
@@ -1,13 +1,28 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, and physically
+// contiguous runs of PGSIZE<<order bytes through buddyalloc().
+//
+// Free memory is kept by a buddy allocator: a free block of
+// order k is PGSIZE<<k bytes, aligned to its size, and is merged
+// with its equally sized neighbour (its buddy) when both are free.
+//
+// Each CPU also keeps a small cache of free pages guarded by its
+// own lock, so kalloc() and kfree() normally touch no shared state.
+// Caches are refilled from and returned to the buddy allocator in
+// batches of KBATCH pages.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "x86.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "memstat.h"
+
+#define KBATCH 32  // pages moved between a CPU cache and the pool
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -15,12 +30,28 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 struct run {
   struct run *next;
+  struct run *prev;            // Only used on the buddy free lists
+};
+
+// Per-CPU cache of free pages.
+struct kcache {
+  struct spinlock lock;
+  struct run *freelist;
+  int nfree;
+  uint lat[NLATBUCKET];        // kalloc() latency on this CPU
 };
 
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run *free[MAXORDER+1];       // Buddy free lists
+  uchar freeorder[PHYSTOP/PGSIZE];    // 1+order if page heads a free block
+  ushort ref[PHYSTOP/PGSIZE];         // References to each physical page
+  struct kcache cache[NCPU];
+  uint nfree[MAXORDER+1];
+  uint nalloc[MAXORDER+1];
+  uint nfail[MAXORDER+1];
+  uint lat[NLATBUCKET];               // buddyalloc() latency
 } kmem;
 
 // Initialization happens in two phases.
@@ -28,10 +59,15 @@ struct {
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// Until then only the boot CPU allocates, straight from the pool.
 void
 kinit1(void *vstart, void *vend)
 {
+  int i;
+
   initlock(&kmem.lock, "kmem");
+  for(i = 0; i < NCPU; i++)
+    initlock(&kmem.cache[i].lock, "kcache");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -48,32 +84,188 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    kmem.ref[V2P(p)/PGSIZE] = 1;
     kfree(p);
+  }
+}
+
+// Histogram bucket for an allocation that took c cycles.
+static int
+latbucket(uint c)
+{
+  int i;
+
+  for(i = 0; c >= 64 && i < NLATBUCKET-1; i++)
+    c >>= 1;
+  return i;
+}
+
+//PAGEBREAK: 30
+// Buddy free list maintenance.  Caller must hold kmem.lock.
+static void
+blistadd(struct run *r, int k)
+{
+  r->prev = 0;
+  r->next = kmem.free[k];
+  if(r->next)
+    r->next->prev = r;
+  kmem.free[k] = r;
+  kmem.freeorder[V2P(r)/PGSIZE] = k+1;
+  kmem.nfree[k]++;
+}
+
+static void
+blistdel(struct run *r, int k)
+{
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.free[k] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  kmem.freeorder[V2P(r)/PGSIZE] = 0;
+  kmem.nfree[k]--;
+}
+
+// Take a block of the given order off the free lists,
+// splitting a larger block if necessary.
+// Caller must hold kmem.lock.
+static struct run*
+bget(int order)
+{
+  struct run *r;
+  int k;
+
+  for(k = order; k <= MAXORDER && kmem.free[k] == 0; k++)
+    ;
+  if(k > MAXORDER){
+    kmem.nfail[order]++;
+    return 0;
+  }
+  r = kmem.free[k];
+  blistdel(r, k);
+  // Give back the upper half until the block is small enough.
+  while(k > order){
+    k--;
+    blistadd((struct run*)((char*)r + (PGSIZE<<k)), k);
+  }
+  kmem.nalloc[order]++;
+  return r;
+}
+
+// Return a block of the given order to the free lists,
+// merging it with its buddy for as long as that is free.
+// Caller must hold kmem.lock.
+static void
+bput(struct run *r, int order)
+{
+  uint pa, buddy;
+  int k;
+
+  pa = V2P(r);
+  for(k = order; k < MAXORDER; k++){
+    buddy = pa ^ (PGSIZE<<k);
+    if(buddy >= PHYSTOP || kmem.freeorder[buddy/PGSIZE] != k+1)
+      break;
+    blistdel(P2V(buddy), k);
+    pa &= ~(PGSIZE<<k);
+  }
+  blistadd(P2V(pa), k);
+}
+
+// Move up to n pages from the buddy allocator to kc.
+// Caller must hold kc->lock.
+static void
+krefill(struct kcache *kc, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  for(; n > 0 && (r = bget(0)) != 0; n--){
+    r->next = kc->freelist;
+    kc->freelist = r;
+    kc->nfree++;
+  }
+  release(&kmem.lock);
+}
+
+// Move n pages from kc back to the buddy allocator.
+// Caller must hold kc->lock.
+static void
+kdrain(struct kcache *kc, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  for(; n > 0 && (r = kc->freelist) != 0; n--){
+    kc->freelist = r->next;
+    kc->nfree--;
+    bput(r, 0);
+  }
+  release(&kmem.lock);
+}
+
+// The pool is empty: take a page from another CPU's cache.
+static struct run*
+ksteal(struct kcache *self)
+{
+  struct kcache *kc;
+  struct run *r;
+
+  for(kc = kmem.cache; kc < &kmem.cache[ncpu]; kc++){
+    if(kc == self)
+      continue;
+    acquire(&kc->lock);
+    if((r = kc->freelist) != 0){
+      kc->freelist = r->next;
+      kc->nfree--;
+    }
+    release(&kc->lock);
+    if(r)
+      return r;
+  }
+  return 0;
 }
+
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
+// Drop a reference to the page of physical memory
+// pointed at by v, which normally should have been
+// returned by a call to kalloc(), and free it when
+// no references remain.  (The exception is when
 // initializing the allocator; see kinit above.)
 void
 kfree(char *v)
 {
   struct run *r;
+  struct kcache *kc;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  if(kmem.ref[V2P(v)/PGSIZE] == 0)
+    panic("kfree ref");
+  if(__sync_sub_and_fetch(&kmem.ref[V2P(v)/PGSIZE], 1) > 0)
+    return;
+
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  if(!kmem.use_lock){
+    bput(r, 0);
+    return;
+  }
+
+  pushcli();
+  kc = &kmem.cache[cpuid()];
+  acquire(&kc->lock);
+  r->next = kc->freelist;
+  kc->freelist = r;
+  if(++kc->nfree > 2*KBATCH)
+    kdrain(kc, KBATCH);
+  release(&kc->lock);
+  popcli();
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -83,14 +275,116 @@ char*
 kalloc(void)
 {
   struct run *r;
+  struct kcache *kc;
+  uint t0;
+
+  if(!kmem.use_lock){
+    r = bget(0);
+  } else {
+    pushcli();
+    t0 = rdtsc();
+    kc = &kmem.cache[cpuid()];
+    acquire(&kc->lock);
+    if(kc->freelist == 0)
+      krefill(kc, KBATCH);
+    r = kc->freelist;
+    if(r){
+      kc->freelist = r->next;
+      kc->nfree--;
+    }
+    release(&kc->lock);
+    if(r == 0)
+      r = ksteal(kc);
+    kc->lat[latbucket(rdtsc() - t0)]++;
+    popcli();
+  }
+  if(r)
+    kmem.ref[V2P(r)/PGSIZE] = 1;
+  return (char*)r;
+}
+
+// Allocate PGSIZE<<order bytes of physically contiguous
+// memory, aligned to their size.  Free with buddyfree().
+// Returns 0 if no block that large is free.
+char*
+buddyalloc(int order)
+{
+  struct run *r;
+  uint t0;
 
+  if(order < 0 || order > MAXORDER)
+    return 0;
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
+  t0 = rdtsc();
+  r = bget(order);
+  kmem.lat[latbucket(rdtsc() - t0)]++;
   if(kmem.use_lock)
     release(&kmem.lock);
+  if(r)
+    kmem.ref[V2P(r)/PGSIZE] = 1;
   return (char*)r;
 }
 
+// Free a block returned by buddyalloc(order).
+void
+buddyfree(char *v, int order)
+{
+  if(order < 0 || order > MAXORDER || V2P(v) % (PGSIZE<<order) ||
+     v < end || V2P(v) + (PGSIZE<<order) > PHYSTOP)
+    panic("buddyfree");
+
+  kmem.ref[V2P(v)/PGSIZE] = 0;
+  memset(v, 1, PGSIZE<<order);
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  bput((struct run*)v, order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Add a reference to the page pointed at by v,
+// which must already be allocated.
+void
+kref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kref");
+
+  if(kmem.ref[V2P(v)/PGSIZE] == 0)
+    panic("kref free");
+  __sync_fetch_and_add(&kmem.ref[V2P(v)/PGSIZE], 1);
+}
+
+// Return the number of references to the page pointed at by v.
+int
+krefcount(char *v)
+{
+  return kmem.ref[V2P(v)/PGSIZE];
+}
+
+// Report allocator statistics.  The per-CPU numbers are
+// summed without their locks, so they are approximate.
+void
+kmemstat(struct memstat *st)
+{
+  struct kcache *kc;
+  int i;
+
+  memset(st, 0, sizeof(*st));
+  acquire(&kmem.lock);
+  for(i = 0; i <= MAXORDER; i++){
+    st->nfree[i] = kmem.nfree[i];
+    st->nalloc[i] = kmem.nalloc[i];
+    st->nfail[i] = kmem.nfail[i];
+  }
+  for(i = 0; i < NLATBUCKET; i++)
+    st->buddylat[i] = kmem.lat[i];
+  release(&kmem.lock);
+
+  for(kc = kmem.cache; kc < &kmem.cache[ncpu]; kc++){
+    st->ncached += kc->nfree;
+    for(i = 0; i < NLATBUCKET; i++)
+      st->kalloclat[i] += kc->lat[i];
+  }
+}
@@ -1,10 +1,13 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "x86.h"
+#include "iostat.h"
 
 // Simple logging that allows concurrent FS system calls.
 //
@@ -18,62 +21,132 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// asks for a commit and sleeps until it has happened.
 //
 // The log is a physical re-do log containing disk blocks.
-// The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+// mkfs chooses its size, and it is split into NLOGSEG segments,
+// each with the on-disk format:
+//   header block, containing sequence # and block #s for A, B, C, ...
 //   block A
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+//
+// Commits are done by the flusher thread, in groups: the open
+// transaction keeps absorbing system calls until it runs short
+// of space or COMMITTICKS pass, and end_op() does not wait for
+// the disk.  Even then, new system calls are only held back for
+// a commit once the flusher is idle and a segment is free, so
+// they do not wait for disk writes unless the log is full.  The
+// flusher copies the transaction's blocks aside and writes the
+// copies to a free segment while the next transaction fills up.
+// It then installs the copies at their home locations, merging
+// and sorting every committed segment into one batch, and erases
+// the segments' headers.  Recovery replays segments in sequence
+// order.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
 struct logheader {
   int n;
-  int block[LOGSIZE];
+  uint seq;
+  int block[LOGMAXBLOCKS];
+};
+
+// A log segment.  While lh.n > 0 it holds a committed
+// transaction waiting to be installed: copy[i] holds the
+// committed contents of home[i], a cached buffer that stays
+// pinned until copy[i] reaches the disk.  Only the flusher
+// (and recovery, before it starts) touches segments.
+struct segment {
+  int start;       // header block
+  struct logheader lh;
+  struct buf *copy[LOGMAXBLOCKS];
+  struct buf *home[LOGMAXBLOCKS];
 };
 
 struct log {
   struct spinlock lock;
   int start;
-  int size;
+  int size;        // blocks per segment
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int reserved;    // blocks they may still log.
+  int committing;  // copying blocks for commit, please wait.
+  int commitreq;   // commit once outstanding reaches zero.
+  int flushing;    // flusher is writing a commit or installing.
   int dev;
+  uint seq;        // sequence # of the next commit
+  int cur;         // segment the next commit goes to
   struct logheader lh;
+  struct segment seg[NLOGSEG];
+
+  // Statistics, only updated by the flusher.
+  uint ncommit;
+  uint nlogged;    // blocks written to the log by commits
+  uint ninstall;
+  uint ninstalled; // blocks written home by installs
+  uint commitsz[NIOBUCKET];
+  uint commitlat[NIOBUCKET];
 };
 struct log log;
 
 static void recover_from_log(void);
-static void commit();
+static void flusher(void);
+
+// Allocate the n buffers of s->copy, packed into pages.
+static void
+alloccopies(struct segment *s, int n)
+{
+  char *p;
+  int i, perpage;
+
+  perpage = PGSIZE / sizeof(struct buf);
+  p = 0;
+  for (i = 0; i < n; i++) {
+    if (i % perpage == 0) {
+      if ((p = kalloc()) == 0)
+        panic("initlog: out of memory");
+      memset(p, 0, PGSIZE);
+    }
+    s->copy[i] = (struct buf*)p + i % perpage;
+    initsleeplock(&s->copy[i]->lock, "logcopy");
+  }
+}
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
+  struct segment *s;
+
+  if (sizeof(struct logheader) > BSIZE)
     panic("initlog: too big logheader");
 
   struct superblock sb;
   initlock(&log.lock, "log");
   readsb(dev, &sb);
   log.start = sb.logstart;
-  log.size = sb.nlog;
+  log.size = sb.nlog / NLOGSEG;
   log.dev = dev;
+  if (log.size < MAXOPBLOCKS+2 || log.size > LOGMAXBLOCKS+1)
+    panic("initlog: bad log size");
+  for (s = log.seg; s < &log.seg[NLOGSEG]; s++) {
+    s->start = log.start + (s - log.seg)*log.size;
+    alloccopies(s, log.size - 1);
+  }
   recover_from_log();
+  kthread("flusher", flusher);
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks of s from log to their home location.
+// Only used by recovery; see install() otherwise.
 static void
-install_trans(void)
+install_trans(struct segment *s)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+  for (tail = 0; tail < s->lh.n; tail++) {
+    struct buf *lbuf = bread(log.dev, s->start+tail+1); // read log block
+    struct buf *dbuf = bread(log.dev, s->lh.block[tail]); // read dst
     memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
     bwrite(dbuf);  // write dst to disk
     brelse(lbuf);
@@ -81,59 +154,133 @@ install_trans(void)
   }
 }
 
-// Read the log header from disk into the in-memory log header
+// Read the log header of s from disk into s->lh
 static void
-read_head(void)
+read_head(struct segment *s)
 {
-  struct buf *buf = bread(log.dev, log.start);
+  struct buf *buf = bread(log.dev, s->start);
   struct logheader *lh = (struct logheader *) (buf->data);
   int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  s->lh.n = lh->n;
+  s->lh.seq = lh->seq;
+  for (i = 0; i < s->lh.n; i++) {
+    s->lh.block[i] = lh->block[i];
   }
   brelse(buf);
 }
 
-// Write in-memory log header to disk.
+// Write log header lh to the header block of s.
 // This is the true point at which the
-// current transaction commits.
+// transaction commits.
 static void
-write_head(void)
+write_head(struct segment *s, struct logheader *lh)
 {
-  struct buf *buf = bread(log.dev, log.start);
+  struct buf *buf = bread(log.dev, s->start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  hb->n = lh->n;
+  hb->seq = lh->seq;
+  for (i = 0; i < lh->n; i++) {
+    hb->block[i] = lh->block[i];
   }
   bwrite(buf);
   brelse(buf);
 }
 
+// Erase the headers of the committed segments, oldest first,
+// so that a crash part way through never leaves an older
+// segment to be replayed over a newer one.
+static void
+erase_heads(struct segment **v, int n)
+{
+  static struct logheader empty;
+  int i;
+
+  for (i = 0; i < n; i++)
+    write_head(v[i], &empty);
+}
+
+// The committed segments, oldest first.  Return how many.
+static int
+committed(struct segment **v)
+{
+  struct segment *s;
+  int i, n;
+
+  n = 0;
+  for (s = log.seg; s < &log.seg[NLOGSEG]; s++) {
+    if (s->lh.n == 0)
+      continue;
+    for (i = n; i > 0 && v[i-1]->lh.seq > s->lh.seq; i--)
+      v[i] = v[i-1];
+    v[i] = s;
+    n++;
+  }
+  return n;
+}
+
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  struct segment *v[NLOGSEG], *s;
+  int i, n;
+
+  for (s = log.seg; s < &log.seg[NLOGSEG]; s++)
+    read_head(s);
+  n = committed(v);
+  for (i = 0; i < n; i++) {
+    install_trans(v[i]); // if committed, copy from log to disk
+    log.seq = v[i]->lh.seq + 1;
+  }
+  erase_heads(v, n); // clear the log
+  for (i = 0; i < n; i++)
+    v[i]->lh.n = 0;
+}
+
+// The most blocks one operation may reserve: half a
+// segment, so that two such operations fit in a transaction.
+int
+logopblocks(void)
+{
+  int n;
+
+  n = (log.size - 1) / 2;
+  return n > MAXOPBLOCKS ? n : MAXOPBLOCKS;
+}
+
+// Could the flusher start a commit as soon as the outstanding
+// operations end?  Caller must hold log.lock.
+static int
+cancommit(void)
+{
+  return !log.flushing && log.seg[log.cur].lh.n == 0;
 }
 
 // called at the start of each FS system call.
 void
 begin_op(void)
+{
+  begin_opn(MAXOPBLOCKS);
+}
+
+// begin_op() for an operation that may write up to
+// n <= logopblocks() blocks.  Pair with end_opn(n).
+void
+begin_opn(int n)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.committing || (log.commitreq && cancommit())){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh.n + log.reserved + n > log.size - 1){
       // this op might exhaust log space; wait for commit.
+      log.commitreq = 1;
+      if(log.outstanding == 0)
+        wakeup(&log.seg);
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      log.reserved += n;
       release(&log.lock);
       break;
     }
@@ -141,19 +288,24 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// lets the flusher commit if this was the last outstanding
+// operation and a commit is wanted.
 void
 end_op(void)
 {
-  int do_commit = 0;
+  end_opn(MAXOPBLOCKS);
+}
 
+void
+end_opn(int n)
+{
   acquire(&log.lock);
   log.outstanding -= 1;
+  log.reserved -= n;
   if(log.committing)
     panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
+  if(log.outstanding == 0 && log.commitreq){
+    wakeup(&log.seg);
   } else {
     // begin_op() may be waiting for log space,
     // and decrementing log.outstanding has decreased
@@ -161,49 +313,171 @@ end_op(void)
     wakeup(&log);
   }
   release(&log.lock);
+}
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
+// Called every COMMITTICKS timer ticks to commit
+// whatever the open transaction holds.
+void
+logtimer(void)
+{
+  acquire(&log.lock);
+  if(log.lh.n > 0){
+    log.commitreq = 1;
+    if(log.outstanding == 0)
+      wakeup(&log.seg);
   }
+  release(&log.lock);
 }
 
-// Copy modified blocks from cache to log.
+// Copy the open transaction's blocks into s.  The cached
+// blocks stay pinned by a reference instead of B_DIRTY
+// until install() has written the copies home.
 static void
-write_log(void)
+copy_trans(struct segment *s)
 {
+  struct buf *from;
   int tail;
 
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+    from = bread(log.dev, log.lh.block[tail]); // cache block
+    memmove(s->copy[tail]->data, from->data, BSIZE);
+    s->home[tail] = from;
+    from->flags &= ~B_DIRTY;
+    bpin(from);
     brelse(from);
-    brelse(to);
+    s->lh.block[tail] = log.lh.block[tail];
   }
+  s->lh.n = log.lh.n;
+  s->lh.seq = log.seq++;
 }
 
+// Write the copies in v to disk, each at the block
+// number set in it, as one batch.
 static void
-commit()
+write_copies(struct buf **v, int n)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+  int i;
+
+  for (i = 0; i < n; i++) {
+    acquiresleep(&v[i]->lock);
+    v[i]->dev = log.dev;
+    v[i]->flags = B_VALID | B_DIRTY;
+  }
+  iderwv(v, n);
+  for (i = 0; i < n; i++)
+    releasesleep(&v[i]->lock);
+}
+
+// Commit the open transaction to segment s.
+static void
+commit(struct segment *s)
+{
+  static struct buf *v[LOGMAXBLOCKS];
+  uint t0;
+  int i;
+
+  copy_trans(s);
+
+  // New transactions may start now.
+  acquire(&log.lock);
+  log.lh.n = 0;
+  log.committing = 0;
+  wakeup(&log);
+  release(&log.lock);
+
+  for (i = 0; i < s->lh.n; i++) {
+    s->copy[i]->blockno = s->start+1+i;
+    v[i] = s->copy[i];
+  }
+  t0 = rdtsc();
+  write_copies(v, s->lh.n);  // Write the copies to the log
+  write_head(s, &s->lh);     // Write header to disk -- the real commit
+  log.cur = (log.cur + 1) % NLOGSEG;
+
+  log.ncommit++;
+  log.nlogged += s->lh.n;
+  log.commitsz[iobucket(s->lh.n, 1)]++;
+  log.commitlat[iobucket(rdtsc() - t0, 8192)]++;
+}
+
+// Install every committed segment at the home locations.
+// Where segments share a block, only the newest copy is written.
+static void
+install(void)
+{
+  static struct buf *v[NLOGSEG*LOGMAXBLOCKS];
+  struct segment *seg[NLOGSEG];
+  struct buf *b;
+  int i, j, k, n, nseg;
+
+  nseg = committed(seg);
+  n = 0;
+  for (k = nseg - 1; k >= 0; k--) {
+    for (i = 0; i < seg[k]->lh.n; i++) {
+      b = seg[k]->copy[i];
+      b->blockno = seg[k]->lh.block[i];
+      // Insertion sort by block number, skipping blocks
+      // a newer segment has already supplied.
+      for (j = n; j > 0 && v[j-1]->blockno > b->blockno; j--)
+        ;
+      if (j > 0 && v[j-1]->blockno == b->blockno)
+        continue;
+      memmove(&v[j+1], &v[j], (n-j)*sizeof(v[0]));
+      v[j] = b;
+      n++;
+    }
+  }
+  write_copies(v, n);
+  log.ninstall++;
+  log.ninstalled += n;
+
+  for (k = 0; k < nseg; k++)
+    for (i = 0; i < seg[k]->lh.n; i++)
+      bunpin(seg[k]->home[i]);
+  erase_heads(seg, nseg);  // Erase the transactions from the log
+  for (k = 0; k < nseg; k++)
+    seg[k]->lh.n = 0;
+}
+
+// Kernel thread that commits and installs transactions.
+// A commit goes first whenever one is wanted and a segment
+// is free, so that under load several commits can be
+// installed together.
+static void
+flusher(void)
+{
+  struct segment *v[NLOGSEG], *s;
+
+  for (;;) {
+    acquire(&log.lock);
+    log.flushing = 0;
+    for (;;) {
+      s = &log.seg[log.cur];
+      if (log.commitreq && log.outstanding == 0 && s->lh.n == 0) {
+        log.committing = 1;
+        log.commitreq = 0;
+        log.flushing = 1;
+        release(&log.lock);
+        commit(s);
+        break;
+      }
+      if (committed(v) > 0) {
+        // Operations held back for a commit may go ahead
+        // while the install runs.
+        log.flushing = 1;
+        wakeup(&log);
+        release(&log.lock);
+        install();
+        break;
+      }
+      sleep(&log.seg, &log.lock);
+    }
   }
 }
 
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// The flusher will do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -215,7 +489,7 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= log.size - 1)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
@@ -232,3 +506,14 @@ log_write(struct buf *b)
   release(&log.lock);
 }
 
+// Report log statistics.
+void
+logstat(struct iostat *st)
+{
+  st->ncommit = log.ncommit;
+  st->nlogged = log.nlogged;
+  st->ninstall = log.ninstall;
+  st->ninstalled = log.ninstalled;
+  memmove(st->commitsz, log.commitsz, sizeof(log.commitsz));
+  memmove(st->commitlat, log.commitlat, sizeof(log.commitlat));
+}
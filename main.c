@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 
@@ -29,11 +30,15 @@ main(void)
   uartinit();      // serial port
   pinit();         // process table
   tvinit();        // trap vectors
-  binit();         // buffer cache
   fileinit();      // file table
+  pipeinit();      // pipe cache
+  dcacheinit();    // directory name cache
   ideinit();       // disk 
+  virtioinit();    // virtio disk, if any
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  binit();         // buffer cache, sized from free memory
+  icacheinit();    // inode cache, sized from free memory
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 }
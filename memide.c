@@ -5,10 +5,10 @@
 #include "defs.h"
 #include "param.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
@@ -57,4 +57,15 @@ iderw(struct buf *b)
   } else
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  if(b->flags & B_ASYNC)
+    bdone(b);
+}
+
+void
+iderwv(struct buf **v, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    iderw(v[i]);
 }
@@ -0,0 +1,1419 @@
+
+_memstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  struct memstat st;
+  uint pages, above;
+  int j, k;
+
+  if(memstat(&st) < 0){
+  10:	8d 9d e0 fe ff ff    	lea    -0x120(%ebp),%ebx
+{
+  16:	51                   	push   %ecx
+  17:	81 ec 34 01 00 00    	sub    $0x134,%esp
+  if(memstat(&st) < 0){
+  1d:	53                   	push   %ebx
+  1e:	e8 34 05 00 00       	call   557 <memstat>
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	85 c0                	test   %eax,%eax
+  28:	0f 88 e4 00 00 00    	js     112 <main+0x112>
+    printf(2, "memstat: failed\n");
+    exit();
+  }
+
+  pages = st.ncached;
+  2e:	8b 95 0c ff ff ff    	mov    -0xf4(%ebp),%edx
+  for(k = 0; k <= MAXORDER; k++)
+  34:	31 c9                	xor    %ecx,%ecx
+  pages = st.ncached;
+  36:	89 d6                	mov    %edx,%esi
+  38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3f:	90                   	nop
+    pages += st.nfree[k] << k;
+  40:	8b 04 8b             	mov    (%ebx,%ecx,4),%eax
+  43:	d3 e0                	shl    %cl,%eax
+  for(k = 0; k <= MAXORDER; k++)
+  45:	83 c1 01             	add    $0x1,%ecx
+    pages += st.nfree[k] << k;
+  48:	01 c6                	add    %eax,%esi
+  for(k = 0; k <= MAXORDER; k++)
+  4a:	83 f9 0b             	cmp    $0xb,%ecx
+  4d:	75 f1                	jne    40 <main+0x40>
+  printf(1, "free pages %d (%d in per-cpu caches)\n", pages, st.ncached);
+  4f:	52                   	push   %edx
+  50:	56                   	push   %esi
+  51:	68 bc 09 00 00       	push   $0x9bc
+  56:	6a 01                	push   $0x1
+  58:	e8 c3 05 00 00       	call   620 <printf>
+
+  // A request of order k can only be met from blocks of
+  // order >= k; the rest of free memory is fragmented for it.
+  printf(1, "order free usable%% allocs fails\n");
+  5d:	59                   	pop    %ecx
+  5e:	5f                   	pop    %edi
+  5f:	68 e4 09 00 00       	push   $0x9e4
+  64:	6a 01                	push   $0x1
+  for(k = 0; k <= MAXORDER; k++){
+    above = k == 0 ? st.ncached : 0;
+  66:	31 ff                	xor    %edi,%edi
+  printf(1, "order free usable%% allocs fails\n");
+  68:	e8 b3 05 00 00       	call   620 <printf>
+    above = k == 0 ? st.ncached : 0;
+  6d:	8b 95 0c ff ff ff    	mov    -0xf4(%ebp),%edx
+  73:	83 c4 10             	add    $0x10,%esp
+  76:	31 c9                	xor    %ecx,%ecx
+  78:	c7 85 d0 fe ff ff 00 	movl   $0x0,-0x130(%ebp)
+  7f:	00 00 00 
+  82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    for(j = k; j <= MAXORDER; j++)
+      above += st.nfree[j] << j;
+  88:	8b 04 8b             	mov    (%ebx,%ecx,4),%eax
+  8b:	d3 e0                	shl    %cl,%eax
+    for(j = k; j <= MAXORDER; j++)
+  8d:	83 c1 01             	add    $0x1,%ecx
+      above += st.nfree[j] << j;
+  90:	01 c2                	add    %eax,%edx
+    for(j = k; j <= MAXORDER; j++)
+  92:	83 f9 0b             	cmp    $0xb,%ecx
+  95:	75 f1                	jne    88 <main+0x88>
+    printf(1, "%d %d %d %d %d\n", k, st.nfree[k],
+  97:	8b 44 bb 30          	mov    0x30(%ebx,%edi,4),%eax
+  9b:	8b 4c bb 5c          	mov    0x5c(%ebx,%edi,4),%ecx
+  9f:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  a5:	31 c0                	xor    %eax,%eax
+  a7:	85 f6                	test   %esi,%esi
+  a9:	74 07                	je     b2 <main+0xb2>
+           pages ? above*100/pages : 0, st.nalloc[k], st.nfail[k]);
+  ab:	6b c2 64             	imul   $0x64,%edx,%eax
+    printf(1, "%d %d %d %d %d\n", k, st.nfree[k],
+  ae:	31 d2                	xor    %edx,%edx
+  b0:	f7 f6                	div    %esi
+  b2:	83 ec 04             	sub    $0x4,%esp
+  b5:	51                   	push   %ecx
+  b6:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  bc:	50                   	push   %eax
+  bd:	ff 34 bb             	push   (%ebx,%edi,4)
+  for(k = 0; k <= MAXORDER; k++){
+  c0:	83 c7 01             	add    $0x1,%edi
+    printf(1, "%d %d %d %d %d\n", k, st.nfree[k],
+  c3:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+  c9:	68 99 09 00 00       	push   $0x999
+  ce:	6a 01                	push   $0x1
+  d0:	e8 4b 05 00 00       	call   620 <printf>
+  for(k = 0; k <= MAXORDER; k++){
+  d5:	83 c4 20             	add    $0x20,%esp
+  d8:	83 ff 0b             	cmp    $0xb,%edi
+  db:	74 0c                	je     e9 <main+0xe9>
+  dd:	89 bd d0 fe ff ff    	mov    %edi,-0x130(%ebp)
+  e3:	89 f9                	mov    %edi,%ecx
+    above = k == 0 ? st.ncached : 0;
+  e5:	31 d2                	xor    %edx,%edx
+  e7:	eb 9f                	jmp    88 <main+0x88>
+  }
+
+  printlat("kalloc", st.kalloclat);
+  e9:	83 ec 08             	sub    $0x8,%esp
+  ec:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  f2:	50                   	push   %eax
+  f3:	68 a9 09 00 00       	push   $0x9a9
+  f8:	e8 33 00 00 00       	call   130 <printlat>
+  printlat("buddyalloc", st.buddylat);
+  fd:	58                   	pop    %eax
+  fe:	8d 45 a8             	lea    -0x58(%ebp),%eax
+ 101:	5a                   	pop    %edx
+ 102:	50                   	push   %eax
+ 103:	68 b0 09 00 00       	push   $0x9b0
+ 108:	e8 23 00 00 00       	call   130 <printlat>
+  exit();
+ 10d:	e8 9d 03 00 00       	call   4af <exit>
+    printf(2, "memstat: failed\n");
+ 112:	50                   	push   %eax
+ 113:	50                   	push   %eax
+ 114:	68 88 09 00 00       	push   $0x988
+ 119:	6a 02                	push   $0x2
+ 11b:	e8 00 05 00 00       	call   620 <printf>
+    exit();
+ 120:	e8 8a 03 00 00       	call   4af <exit>
+ 125:	66 90                	xchg   %ax,%ax
+ 127:	66 90                	xchg   %ax,%ax
+ 129:	66 90                	xchg   %ax,%ax
+ 12b:	66 90                	xchg   %ax,%ax
+ 12d:	66 90                	xchg   %ax,%ax
+ 12f:	90                   	nop
+
+00000130 <printlat>:
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	56                   	push   %esi
+ 134:	53                   	push   %ebx
+ 135:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(1, "%s latency (cycles: count)\n", name);
+ 138:	83 ec 04             	sub    $0x4,%esp
+ 13b:	ff 75 08             	push   0x8(%ebp)
+ 13e:	68 48 09 00 00       	push   $0x948
+ 143:	6a 01                	push   $0x1
+ 145:	e8 d6 04 00 00       	call   620 <printf>
+    if(lat[i] == 0)
+ 14a:	8b 06                	mov    (%esi),%eax
+ 14c:	83 c4 10             	add    $0x10,%esp
+ 14f:	85 c0                	test   %eax,%eax
+ 151:	0f 84 a9 00 00 00    	je     200 <printlat+0xd0>
+      printf(1, "  <%d: %d\n", 64, lat[i]);
+ 157:	50                   	push   %eax
+  for(i = 0; i < NLATBUCKET; i++){
+ 158:	bb 01 00 00 00       	mov    $0x1,%ebx
+      printf(1, "  <%d: %d\n", 64, lat[i]);
+ 15d:	6a 40                	push   $0x40
+ 15f:	68 64 09 00 00       	push   $0x964
+ 164:	6a 01                	push   $0x1
+ 166:	e8 b5 04 00 00       	call   620 <printf>
+    if(lat[i] == 0)
+ 16b:	8b 46 04             	mov    0x4(%esi),%eax
+ 16e:	83 c4 10             	add    $0x10,%esp
+ 171:	85 c0                	test   %eax,%eax
+ 173:	75 30                	jne    1a5 <printlat+0x75>
+ 175:	8b 46 08             	mov    0x8(%esi),%eax
+  for(i = 0; i < NLATBUCKET; i++){
+ 178:	bb 02 00 00 00       	mov    $0x2,%ebx
+    if(lat[i] == 0)
+ 17d:	85 c0                	test   %eax,%eax
+ 17f:	75 24                	jne    1a5 <printlat+0x75>
+ 181:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < NLATBUCKET; i++){
+ 188:	83 c3 01             	add    $0x1,%ebx
+ 18b:	83 fb 10             	cmp    $0x10,%ebx
+ 18e:	75 40                	jne    1d0 <printlat+0xa0>
+}
+ 190:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 193:	5b                   	pop    %ebx
+ 194:	5e                   	pop    %esi
+ 195:	5d                   	pop    %ebp
+ 196:	c3                   	ret
+ 197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19e:	66 90                	xchg   %ax,%ax
+    else if(i == NLATBUCKET-1)
+ 1a0:	83 fb 0f             	cmp    $0xf,%ebx
+ 1a3:	74 3b                	je     1e0 <printlat+0xb0>
+      printf(1, "  %d-%d: %d\n", 32<<i, (64<<i)-1, lat[i]);
+ 1a5:	83 ec 0c             	sub    $0xc,%esp
+ 1a8:	89 d9                	mov    %ebx,%ecx
+  for(i = 0; i < NLATBUCKET; i++){
+ 1aa:	83 c3 01             	add    $0x1,%ebx
+      printf(1, "  %d-%d: %d\n", 32<<i, (64<<i)-1, lat[i]);
+ 1ad:	50                   	push   %eax
+ 1ae:	b8 40 00 00 00       	mov    $0x40,%eax
+ 1b3:	d3 e0                	shl    %cl,%eax
+ 1b5:	83 e8 01             	sub    $0x1,%eax
+ 1b8:	50                   	push   %eax
+ 1b9:	b8 20 00 00 00       	mov    $0x20,%eax
+ 1be:	d3 e0                	shl    %cl,%eax
+ 1c0:	50                   	push   %eax
+ 1c1:	68 7b 09 00 00       	push   $0x97b
+ 1c6:	6a 01                	push   $0x1
+ 1c8:	e8 53 04 00 00       	call   620 <printf>
+  for(i = 0; i < NLATBUCKET; i++){
+ 1cd:	83 c4 20             	add    $0x20,%esp
+    if(lat[i] == 0)
+ 1d0:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+ 1d3:	85 c0                	test   %eax,%eax
+ 1d5:	75 c9                	jne    1a0 <printlat+0x70>
+ 1d7:	eb af                	jmp    188 <printlat+0x58>
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "  >=%d: %d\n", 32<<i, lat[i]);
+ 1e0:	50                   	push   %eax
+ 1e1:	68 00 00 10 00       	push   $0x100000
+ 1e6:	68 6f 09 00 00       	push   $0x96f
+ 1eb:	6a 01                	push   $0x1
+ 1ed:	e8 2e 04 00 00       	call   620 <printf>
+ 1f2:	83 c4 10             	add    $0x10,%esp
+}
+ 1f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1f8:	5b                   	pop    %ebx
+ 1f9:	5e                   	pop    %esi
+ 1fa:	5d                   	pop    %ebp
+ 1fb:	c3                   	ret
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(lat[i] == 0)
+ 200:	8b 46 04             	mov    0x4(%esi),%eax
+  for(i = 0; i < NLATBUCKET; i++){
+ 203:	bb 01 00 00 00       	mov    $0x1,%ebx
+    if(lat[i] == 0)
+ 208:	85 c0                	test   %eax,%eax
+ 20a:	75 99                	jne    1a5 <printlat+0x75>
+  for(i = 0; i < NLATBUCKET; i++){
+ 20c:	83 c3 01             	add    $0x1,%ebx
+ 20f:	83 fb 10             	cmp    $0x10,%ebx
+ 212:	75 bc                	jne    1d0 <printlat+0xa0>
+ 214:	e9 77 ff ff ff       	jmp    190 <printlat+0x60>
+ 219:	66 90                	xchg   %ax,%ax
+ 21b:	66 90                	xchg   %ax,%ax
+ 21d:	66 90                	xchg   %ax,%ax
+ 21f:	90                   	nop
+
+00000220 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 220:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 221:	31 c0                	xor    %eax,%eax
+{
+ 223:	89 e5                	mov    %esp,%ebp
+ 225:	53                   	push   %ebx
+ 226:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 230:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 234:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 237:	83 c0 01             	add    $0x1,%eax
+ 23a:	84 d2                	test   %dl,%dl
+ 23c:	75 f2                	jne    230 <strcpy+0x10>
+    ;
+  return os;
+}
+ 23e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 241:	89 c8                	mov    %ecx,%eax
+ 243:	c9                   	leave
+ 244:	c3                   	ret
+ 245:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+ 257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 25a:	0f b6 02             	movzbl (%edx),%eax
+ 25d:	84 c0                	test   %al,%al
+ 25f:	75 17                	jne    278 <strcmp+0x28>
+ 261:	eb 3a                	jmp    29d <strcmp+0x4d>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 26c:	83 c2 01             	add    $0x1,%edx
+ 26f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 272:	84 c0                	test   %al,%al
+ 274:	74 1a                	je     290 <strcmp+0x40>
+    p++, q++;
+ 276:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 278:	0f b6 19             	movzbl (%ecx),%ebx
+ 27b:	38 c3                	cmp    %al,%bl
+ 27d:	74 e9                	je     268 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 27f:	29 d8                	sub    %ebx,%eax
+}
+ 281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 284:	c9                   	leave
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 290:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 294:	31 c0                	xor    %eax,%eax
+ 296:	29 d8                	sub    %ebx,%eax
+}
+ 298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 29b:	c9                   	leave
+ 29c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 29d:	0f b6 19             	movzbl (%ecx),%ebx
+ 2a0:	31 c0                	xor    %eax,%eax
+ 2a2:	eb db                	jmp    27f <strcmp+0x2f>
+ 2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2b9:	74 15                	je     2d0 <strlen+0x20>
+ 2bb:	31 c0                	xor    %eax,%eax
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2c0:	83 c0 01             	add    $0x1,%eax
+ 2c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2c7:	89 c1                	mov    %eax,%ecx
+ 2c9:	75 f5                	jne    2c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2cb:	89 c8                	mov    %ecx,%eax
+ 2cd:	5d                   	pop    %ebp
+ 2ce:	c3                   	ret
+ 2cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2d0:	31 c9                	xor    %ecx,%ecx
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	89 c8                	mov    %ecx,%eax
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ed:	89 d7                	mov    %edx,%edi
+ 2ef:	fc                   	cld
+ 2f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2f5:	89 d0                	mov    %edx,%eax
+ 2f7:	c9                   	leave
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 30a:	0f b6 10             	movzbl (%eax),%edx
+ 30d:	84 d2                	test   %dl,%dl
+ 30f:	75 12                	jne    323 <strchr+0x23>
+ 311:	eb 1d                	jmp    330 <strchr+0x30>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+ 318:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 31c:	83 c0 01             	add    $0x1,%eax
+ 31f:	84 d2                	test   %dl,%dl
+ 321:	74 0d                	je     330 <strchr+0x30>
+    if(*s == c)
+ 323:	38 d1                	cmp    %dl,%cl
+ 325:	75 f1                	jne    318 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 327:	5d                   	pop    %ebp
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 330:	31 c0                	xor    %eax,%eax
+}
+ 332:	5d                   	pop    %ebp
+ 333:	c3                   	ret
+ 334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 345:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 348:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 349:	31 db                	xor    %ebx,%ebx
+{
+ 34b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 34e:	eb 2b                	jmp    37b <gets+0x3b>
+    cc = read(0, &c, 1);
+ 350:	83 ec 04             	sub    $0x4,%esp
+ 353:	6a 01                	push   $0x1
+ 355:	56                   	push   %esi
+ 356:	6a 00                	push   $0x0
+ 358:	e8 6a 01 00 00       	call   4c7 <read>
+    if(cc < 1)
+ 35d:	83 c4 10             	add    $0x10,%esp
+ 360:	85 c0                	test   %eax,%eax
+ 362:	7e 21                	jle    385 <gets+0x45>
+      break;
+    buf[i++] = c;
+ 364:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(c == '\n' || c == '\r' || c == '\t')
+ 36b:	8d 48 f7             	lea    -0x9(%eax),%ecx
+    buf[i++] = c;
+ 36e:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r' || c == '\t')
+ 372:	80 f9 01             	cmp    $0x1,%cl
+ 375:	76 10                	jbe    387 <gets+0x47>
+ 377:	3c 0d                	cmp    $0xd,%al
+ 379:	74 0c                	je     387 <gets+0x47>
+  for(i=0; i+1 < max; ){
+ 37b:	89 df                	mov    %ebx,%edi
+ 37d:	83 c3 01             	add    $0x1,%ebx
+ 380:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 383:	7c cb                	jl     350 <gets+0x10>
+ 385:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 387:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38a:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 38e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 391:	5b                   	pop    %ebx
+ 392:	5e                   	pop    %esi
+ 393:	5f                   	pop    %edi
+ 394:	5d                   	pop    %ebp
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	56                   	push   %esi
+ 3a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3a5:	83 ec 08             	sub    $0x8,%esp
+ 3a8:	6a 00                	push   $0x0
+ 3aa:	ff 75 08             	push   0x8(%ebp)
+ 3ad:	e8 3d 01 00 00       	call   4ef <open>
+  if(fd < 0)
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	78 27                	js     3e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3b9:	83 ec 08             	sub    $0x8,%esp
+ 3bc:	ff 75 0c             	push   0xc(%ebp)
+ 3bf:	89 c3                	mov    %eax,%ebx
+ 3c1:	50                   	push   %eax
+ 3c2:	e8 40 01 00 00       	call   507 <fstat>
+  close(fd);
+ 3c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3cc:	e8 06 01 00 00       	call   4d7 <close>
+  return r;
+ 3d1:	83 c4 10             	add    $0x10,%esp
+}
+ 3d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d7:	89 f0                	mov    %esi,%eax
+ 3d9:	5b                   	pop    %ebx
+ 3da:	5e                   	pop    %esi
+ 3db:	5d                   	pop    %ebp
+ 3dc:	c3                   	ret
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3e5:	eb ed                	jmp    3d4 <stat+0x34>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	53                   	push   %ebx
+ 3f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3f7:	0f be 02             	movsbl (%edx),%eax
+ 3fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 400:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 405:	77 1e                	ja     425 <atoi+0x35>
+ 407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 410:	83 c2 01             	add    $0x1,%edx
+ 413:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 416:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 41a:	0f be 02             	movsbl (%edx),%eax
+ 41d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 420:	80 fb 09             	cmp    $0x9,%bl
+ 423:	76 eb                	jbe    410 <atoi+0x20>
+  return n;
+}
+ 425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 428:	89 c8                	mov    %ecx,%eax
+ 42a:	c9                   	leave
+ 42b:	c3                   	ret
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	8b 45 10             	mov    0x10(%ebp),%eax
+ 438:	8b 55 08             	mov    0x8(%ebp),%edx
+ 43b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 43e:	85 c0                	test   %eax,%eax
+ 440:	7e 13                	jle    455 <memmove+0x25>
+ 442:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 444:	89 d7                	mov    %edx,%edi
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 450:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 451:	39 f8                	cmp    %edi,%eax
+ 453:	75 fb                	jne    450 <memmove+0x20>
+  return vdst;
+}
+ 455:	5e                   	pop    %esi
+ 456:	89 d0                	mov    %edx,%eax
+ 458:	5f                   	pop    %edi
+ 459:	5d                   	pop    %ebp
+ 45a:	c3                   	ret
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <strncmp>:
+
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	53                   	push   %ebx
+ 464:	8b 55 10             	mov    0x10(%ebp),%edx
+ 467:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+ 46d:	85 d2                	test   %edx,%edx
+ 46f:	75 16                	jne    487 <strncmp+0x27>
+ 471:	eb 2d                	jmp    4a0 <strncmp+0x40>
+ 473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 477:	90                   	nop
+ 478:	3a 19                	cmp    (%ecx),%bl
+ 47a:	75 12                	jne    48e <strncmp+0x2e>
+    n--, p++, q++;
+ 47c:	83 c0 01             	add    $0x1,%eax
+ 47f:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+ 482:	83 ea 01             	sub    $0x1,%edx
+ 485:	74 19                	je     4a0 <strncmp+0x40>
+ 487:	0f b6 18             	movzbl (%eax),%ebx
+ 48a:	84 db                	test   %bl,%bl
+ 48c:	75 ea                	jne    478 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+ 48e:	0f b6 00             	movzbl (%eax),%eax
+ 491:	0f b6 11             	movzbl (%ecx),%edx
+ 494:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 497:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+ 498:	29 d0                	sub    %edx,%eax
+ 49a:	c3                   	ret
+ 49b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 49f:	90                   	nop
+ 4a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+ 4a3:	31 c0                	xor    %eax,%eax
+ 4a5:	c9                   	leave
+ 4a6:	c3                   	ret
+
+000004a7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4a7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4ac:	cd 40                	int    $0x40
+ 4ae:	c3                   	ret
+
+000004af <exit>:
+SYSCALL(exit)
+ 4af:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4b4:	cd 40                	int    $0x40
+ 4b6:	c3                   	ret
+
+000004b7 <wait>:
+SYSCALL(wait)
+ 4b7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4bc:	cd 40                	int    $0x40
+ 4be:	c3                   	ret
+
+000004bf <pipe>:
+SYSCALL(pipe)
+ 4bf:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4c4:	cd 40                	int    $0x40
+ 4c6:	c3                   	ret
+
+000004c7 <read>:
+SYSCALL(read)
+ 4c7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4cc:	cd 40                	int    $0x40
+ 4ce:	c3                   	ret
+
+000004cf <write>:
+SYSCALL(write)
+ 4cf:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4d4:	cd 40                	int    $0x40
+ 4d6:	c3                   	ret
+
+000004d7 <close>:
+SYSCALL(close)
+ 4d7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4dc:	cd 40                	int    $0x40
+ 4de:	c3                   	ret
+
+000004df <kill>:
+SYSCALL(kill)
+ 4df:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4e4:	cd 40                	int    $0x40
+ 4e6:	c3                   	ret
+
+000004e7 <exec>:
+SYSCALL(exec)
+ 4e7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4ec:	cd 40                	int    $0x40
+ 4ee:	c3                   	ret
+
+000004ef <open>:
+SYSCALL(open)
+ 4ef:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4f4:	cd 40                	int    $0x40
+ 4f6:	c3                   	ret
+
+000004f7 <mknod>:
+SYSCALL(mknod)
+ 4f7:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4fc:	cd 40                	int    $0x40
+ 4fe:	c3                   	ret
+
+000004ff <unlink>:
+SYSCALL(unlink)
+ 4ff:	b8 12 00 00 00       	mov    $0x12,%eax
+ 504:	cd 40                	int    $0x40
+ 506:	c3                   	ret
+
+00000507 <fstat>:
+SYSCALL(fstat)
+ 507:	b8 08 00 00 00       	mov    $0x8,%eax
+ 50c:	cd 40                	int    $0x40
+ 50e:	c3                   	ret
+
+0000050f <link>:
+SYSCALL(link)
+ 50f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 514:	cd 40                	int    $0x40
+ 516:	c3                   	ret
+
+00000517 <mkdir>:
+SYSCALL(mkdir)
+ 517:	b8 14 00 00 00       	mov    $0x14,%eax
+ 51c:	cd 40                	int    $0x40
+ 51e:	c3                   	ret
+
+0000051f <chdir>:
+SYSCALL(chdir)
+ 51f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 524:	cd 40                	int    $0x40
+ 526:	c3                   	ret
+
+00000527 <dup>:
+SYSCALL(dup)
+ 527:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 52c:	cd 40                	int    $0x40
+ 52e:	c3                   	ret
+
+0000052f <getpid>:
+SYSCALL(getpid)
+ 52f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 534:	cd 40                	int    $0x40
+ 536:	c3                   	ret
+
+00000537 <sbrk>:
+SYSCALL(sbrk)
+ 537:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 53c:	cd 40                	int    $0x40
+ 53e:	c3                   	ret
+
+0000053f <sleep>:
+SYSCALL(sleep)
+ 53f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 544:	cd 40                	int    $0x40
+ 546:	c3                   	ret
+
+00000547 <uptime>:
+SYSCALL(uptime)
+ 547:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 54c:	cd 40                	int    $0x40
+ 54e:	c3                   	ret
+
+0000054f <setsched>:
+SYSCALL(setsched)
+ 54f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 554:	cd 40                	int    $0x40
+ 556:	c3                   	ret
+
+00000557 <memstat>:
+SYSCALL(memstat)
+ 557:	b8 17 00 00 00       	mov    $0x17,%eax
+ 55c:	cd 40                	int    $0x40
+ 55e:	c3                   	ret
+
+0000055f <lseek>:
+SYSCALL(lseek)
+ 55f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 564:	cd 40                	int    $0x40
+ 566:	c3                   	ret
+
+00000567 <setiosched>:
+SYSCALL(setiosched)
+ 567:	b8 19 00 00 00       	mov    $0x19,%eax
+ 56c:	cd 40                	int    $0x40
+ 56e:	c3                   	ret
+
+0000056f <iostat>:
+SYSCALL(iostat)
+ 56f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 574:	cd 40                	int    $0x40
+ 576:	c3                   	ret
+ 577:	66 90                	xchg   %ax,%ax
+ 579:	66 90                	xchg   %ax,%ax
+ 57b:	66 90                	xchg   %ax,%ax
+ 57d:	66 90                	xchg   %ax,%ax
+ 57f:	90                   	nop
+
+00000580 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 588:	89 d1                	mov    %edx,%ecx
+{
+ 58a:	83 ec 3c             	sub    $0x3c,%esp
+ 58d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 590:	85 d2                	test   %edx,%edx
+ 592:	0f 89 80 00 00 00    	jns    618 <printint+0x98>
+ 598:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 59c:	74 7a                	je     618 <printint+0x98>
+    x = -xx;
+ 59e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5a8:	31 f6                	xor    %esi,%esi
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5b0:	89 c8                	mov    %ecx,%eax
+ 5b2:	31 d2                	xor    %edx,%edx
+ 5b4:	89 f7                	mov    %esi,%edi
+ 5b6:	f7 f3                	div    %ebx
+ 5b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5bb:	0f b6 92 68 0a 00 00 	movzbl 0xa68(%edx),%edx
+ 5c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5c6:	89 ca                	mov    %ecx,%edx
+ 5c8:	89 c1                	mov    %eax,%ecx
+ 5ca:	39 da                	cmp    %ebx,%edx
+ 5cc:	73 e2                	jae    5b0 <printint+0x30>
+  if(neg)
+ 5ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5d1:	85 c0                	test   %eax,%eax
+ 5d3:	74 07                	je     5dc <printint+0x5c>
+    buf[i++] = '-';
+ 5d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5da:	89 f7                	mov    %esi,%edi
+ 5dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5e2:	01 df                	add    %ebx,%edi
+ 5e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5eb:	83 ec 04             	sub    $0x4,%esp
+ 5ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5f4:	6a 01                	push   $0x1
+ 5f6:	50                   	push   %eax
+ 5f7:	56                   	push   %esi
+ 5f8:	e8 d2 fe ff ff       	call   4cf <write>
+  while(--i >= 0)
+ 5fd:	89 f8                	mov    %edi,%eax
+ 5ff:	83 c4 10             	add    $0x10,%esp
+ 602:	83 ef 01             	sub    $0x1,%edi
+ 605:	39 d8                	cmp    %ebx,%eax
+ 607:	75 df                	jne    5e8 <printint+0x68>
+}
+ 609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 60c:	5b                   	pop    %ebx
+ 60d:	5e                   	pop    %esi
+ 60e:	5f                   	pop    %edi
+ 60f:	5d                   	pop    %ebp
+ 610:	c3                   	ret
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 618:	31 c0                	xor    %eax,%eax
+ 61a:	eb 89                	jmp    5a5 <printint+0x25>
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 629:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 62c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 62f:	0f b6 1e             	movzbl (%esi),%ebx
+ 632:	83 c6 01             	add    $0x1,%esi
+ 635:	84 db                	test   %bl,%bl
+ 637:	74 67                	je     6a0 <printf+0x80>
+ 639:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 63c:	31 d2                	xor    %edx,%edx
+ 63e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 641:	eb 34                	jmp    677 <printf+0x57>
+ 643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 647:	90                   	nop
+ 648:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 64b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 650:	83 f8 25             	cmp    $0x25,%eax
+ 653:	74 18                	je     66d <printf+0x4d>
+  write(fd, &c, 1);
+ 655:	83 ec 04             	sub    $0x4,%esp
+ 658:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 65b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 65e:	6a 01                	push   $0x1
+ 660:	50                   	push   %eax
+ 661:	57                   	push   %edi
+ 662:	e8 68 fe ff ff       	call   4cf <write>
+ 667:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 66a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 66d:	0f b6 1e             	movzbl (%esi),%ebx
+ 670:	83 c6 01             	add    $0x1,%esi
+ 673:	84 db                	test   %bl,%bl
+ 675:	74 29                	je     6a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 677:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 67a:	85 d2                	test   %edx,%edx
+ 67c:	74 ca                	je     648 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 67e:	83 fa 25             	cmp    $0x25,%edx
+ 681:	75 ea                	jne    66d <printf+0x4d>
+      if(c == 'd'){
+ 683:	83 f8 25             	cmp    $0x25,%eax
+ 686:	0f 84 24 01 00 00    	je     7b0 <printf+0x190>
+ 68c:	83 e8 63             	sub    $0x63,%eax
+ 68f:	83 f8 15             	cmp    $0x15,%eax
+ 692:	77 1c                	ja     6b0 <printf+0x90>
+ 694:	ff 24 85 10 0a 00 00 	jmp    *0xa10(,%eax,4)
+ 69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6a3:	5b                   	pop    %ebx
+ 6a4:	5e                   	pop    %esi
+ 6a5:	5f                   	pop    %edi
+ 6a6:	5d                   	pop    %ebp
+ 6a7:	c3                   	ret
+ 6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ba:	6a 01                	push   $0x1
+ 6bc:	52                   	push   %edx
+ 6bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6c0:	57                   	push   %edi
+ 6c1:	e8 09 fe ff ff       	call   4cf <write>
+ 6c6:	83 c4 0c             	add    $0xc,%esp
+ 6c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6cc:	6a 01                	push   $0x1
+ 6ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6d1:	52                   	push   %edx
+ 6d2:	57                   	push   %edi
+ 6d3:	e8 f7 fd ff ff       	call   4cf <write>
+        putc(fd, c);
+ 6d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6db:	31 d2                	xor    %edx,%edx
+ 6dd:	eb 8e                	jmp    66d <printf+0x4d>
+ 6df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6eb:	8b 13                	mov    (%ebx),%edx
+ 6ed:	6a 00                	push   $0x0
+ 6ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6f4:	e8 87 fe ff ff       	call   580 <printint>
+        ap++;
+ 6f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 67 ff ff ff       	jmp    66d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 710:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 713:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 715:	83 c0 04             	add    $0x4,%eax
+ 718:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 71b:	85 db                	test   %ebx,%ebx
+ 71d:	0f 84 9d 00 00 00    	je     7c0 <printf+0x1a0>
+        while(*s != 0){
+ 723:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 726:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 728:	84 c0                	test   %al,%al
+ 72a:	0f 84 3d ff ff ff    	je     66d <printf+0x4d>
+ 730:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 733:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 736:	89 de                	mov    %ebx,%esi
+ 738:	89 d3                	mov    %edx,%ebx
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 746:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	53                   	push   %ebx
+ 74c:	57                   	push   %edi
+ 74d:	e8 7d fd ff ff       	call   4cf <write>
+        while(*s != 0){
+ 752:	0f b6 06             	movzbl (%esi),%eax
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	84 c0                	test   %al,%al
+ 75a:	75 e4                	jne    740 <printf+0x120>
+      state = 0;
+ 75c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 75f:	31 d2                	xor    %edx,%edx
+ 761:	e9 07 ff ff ff       	jmp    66d <printf+0x4d>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 01                	push   $0x1
+ 77f:	e9 6b ff ff ff       	jmp    6ef <printf+0xcf>
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 788:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 791:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 793:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 796:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	52                   	push   %edx
+ 79c:	57                   	push   %edi
+ 79d:	e8 2d fd ff ff       	call   4cf <write>
+        ap++;
+ 7a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7a8:	31 d2                	xor    %edx,%edx
+ 7aa:	e9 be fe ff ff       	jmp    66d <printf+0x4d>
+ 7af:	90                   	nop
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	e9 11 ff ff ff       	jmp    6d1 <printf+0xb1>
+ 7c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7c5:	bb 06 0a 00 00       	mov    $0xa06,%ebx
+ 7ca:	e9 61 ff ff ff       	jmp    730 <printf+0x110>
+ 7cf:	90                   	nop
+
+000007d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d1:	a1 78 0d 00 00       	mov    0xd78,%eax
+{
+ 7d6:	89 e5                	mov    %esp,%ebp
+ 7d8:	57                   	push   %edi
+ 7d9:	56                   	push   %esi
+ 7da:	53                   	push   %ebx
+ 7db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7ec:	39 ca                	cmp    %ecx,%edx
+ 7ee:	73 30                	jae    820 <free+0x50>
+ 7f0:	39 c1                	cmp    %eax,%ecx
+ 7f2:	72 04                	jb     7f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f4:	39 c2                	cmp    %eax,%edx
+ 7f6:	72 f0                	jb     7e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7fe:	39 f8                	cmp    %edi,%eax
+ 800:	74 2e                	je     830 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 802:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 805:	8b 42 04             	mov    0x4(%edx),%eax
+ 808:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 80b:	39 f1                	cmp    %esi,%ecx
+ 80d:	74 38                	je     847 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 80f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 811:	5b                   	pop    %ebx
+  freep = p;
+ 812:	89 15 78 0d 00 00    	mov    %edx,0xd78
+}
+ 818:	5e                   	pop    %esi
+ 819:	5f                   	pop    %edi
+ 81a:	5d                   	pop    %ebp
+ 81b:	c3                   	ret
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 820:	39 c1                	cmp    %eax,%ecx
+ 822:	72 d0                	jb     7f4 <free+0x24>
+ 824:	eb c2                	jmp    7e8 <free+0x18>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 830:	03 70 04             	add    0x4(%eax),%esi
+ 833:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 836:	8b 02                	mov    (%edx),%eax
+ 838:	8b 00                	mov    (%eax),%eax
+ 83a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 83d:	8b 42 04             	mov    0x4(%edx),%eax
+ 840:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 843:	39 f1                	cmp    %esi,%ecx
+ 845:	75 c8                	jne    80f <free+0x3f>
+    p->s.size += bp->s.size;
+ 847:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 84a:	89 15 78 0d 00 00    	mov    %edx,0xd78
+    p->s.size += bp->s.size;
+ 850:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 853:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 856:	89 0a                	mov    %ecx,(%edx)
+}
+ 858:	5b                   	pop    %ebx
+ 859:	5e                   	pop    %esi
+ 85a:	5f                   	pop    %edi
+ 85b:	5d                   	pop    %ebp
+ 85c:	c3                   	ret
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000860 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	56                   	push   %esi
+ 865:	53                   	push   %ebx
+ 866:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 869:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 86c:	8b 15 78 0d 00 00    	mov    0xd78,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 872:	8d 78 07             	lea    0x7(%eax),%edi
+ 875:	c1 ef 03             	shr    $0x3,%edi
+ 878:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 87b:	85 d2                	test   %edx,%edx
+ 87d:	0f 84 8d 00 00 00    	je     910 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 883:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 885:	8b 48 04             	mov    0x4(%eax),%ecx
+ 888:	39 f9                	cmp    %edi,%ecx
+ 88a:	73 64                	jae    8f0 <malloc+0x90>
+  if(nu < 4096)
+ 88c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 891:	39 df                	cmp    %ebx,%edi
+ 893:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 896:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 89d:	eb 0a                	jmp    8a9 <malloc+0x49>
+ 89f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8a5:	39 f9                	cmp    %edi,%ecx
+ 8a7:	73 47                	jae    8f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8a9:	89 c2                	mov    %eax,%edx
+ 8ab:	39 05 78 0d 00 00    	cmp    %eax,0xd78
+ 8b1:	75 ed                	jne    8a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	56                   	push   %esi
+ 8b7:	e8 7b fc ff ff       	call   537 <sbrk>
+  if(p == (char*)-1)
+ 8bc:	83 c4 10             	add    $0x10,%esp
+ 8bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8c2:	74 1c                	je     8e0 <malloc+0x80>
+  hp->s.size = nu;
+ 8c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8c7:	83 ec 0c             	sub    $0xc,%esp
+ 8ca:	83 c0 08             	add    $0x8,%eax
+ 8cd:	50                   	push   %eax
+ 8ce:	e8 fd fe ff ff       	call   7d0 <free>
+  return freep;
+ 8d3:	8b 15 78 0d 00 00    	mov    0xd78,%edx
+      if((p = morecore(nunits)) == 0)
+ 8d9:	83 c4 10             	add    $0x10,%esp
+ 8dc:	85 d2                	test   %edx,%edx
+ 8de:	75 c0                	jne    8a0 <malloc+0x40>
+        return 0;
+  }
+}
+ 8e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8e3:	31 c0                	xor    %eax,%eax
+}
+ 8e5:	5b                   	pop    %ebx
+ 8e6:	5e                   	pop    %esi
+ 8e7:	5f                   	pop    %edi
+ 8e8:	5d                   	pop    %ebp
+ 8e9:	c3                   	ret
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8f0:	39 cf                	cmp    %ecx,%edi
+ 8f2:	74 4c                	je     940 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8f4:	29 f9                	sub    %edi,%ecx
+ 8f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8ff:	89 15 78 0d 00 00    	mov    %edx,0xd78
+}
+ 905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 908:	83 c0 08             	add    $0x8,%eax
+}
+ 90b:	5b                   	pop    %ebx
+ 90c:	5e                   	pop    %esi
+ 90d:	5f                   	pop    %edi
+ 90e:	5d                   	pop    %ebp
+ 90f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 910:	c7 05 78 0d 00 00 7c 	movl   $0xd7c,0xd78
+ 917:	0d 00 00 
+    base.s.size = 0;
+ 91a:	b8 7c 0d 00 00       	mov    $0xd7c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 91f:	c7 05 7c 0d 00 00 7c 	movl   $0xd7c,0xd7c
+ 926:	0d 00 00 
+    base.s.size = 0;
+ 929:	c7 05 80 0d 00 00 00 	movl   $0x0,0xd80
+ 930:	00 00 00 
+    if(p->s.size >= nunits){
+ 933:	e9 54 ff ff ff       	jmp    88c <malloc+0x2c>
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 940:	8b 08                	mov    (%eax),%ecx
+ 942:	89 0a                	mov    %ecx,(%edx)
+ 944:	eb b9                	jmp    8ff <malloc+0x9f>
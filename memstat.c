@@ -0,0 +1,60 @@
+// Print physical memory allocator statistics:
+// free buddy blocks by order, how much of the free memory
+// could satisfy a request of each order, and allocation
+// latency histograms.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "memstat.h"
+
+void
+printlat(char *name, uint *lat)
+{
+  int i;
+
+  printf(1, "%s latency (cycles: count)\n", name);
+  for(i = 0; i < NLATBUCKET; i++){
+    if(lat[i] == 0)
+      continue;
+    if(i == 0)
+      printf(1, "  <%d: %d\n", 64, lat[i]);
+    else if(i == NLATBUCKET-1)
+      printf(1, "  >=%d: %d\n", 32<<i, lat[i]);
+    else
+      printf(1, "  %d-%d: %d\n", 32<<i, (64<<i)-1, lat[i]);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct memstat st;
+  uint pages, above;
+  int j, k;
+
+  if(memstat(&st) < 0){
+    printf(2, "memstat: failed\n");
+    exit();
+  }
+
+  pages = st.ncached;
+  for(k = 0; k <= MAXORDER; k++)
+    pages += st.nfree[k] << k;
+  printf(1, "free pages %d (%d in per-cpu caches)\n", pages, st.ncached);
+
+  // A request of order k can only be met from blocks of
+  // order >= k; the rest of free memory is fragmented for it.
+  printf(1, "order free usable%% allocs fails\n");
+  for(k = 0; k <= MAXORDER; k++){
+    above = k == 0 ? st.ncached : 0;
+    for(j = k; j <= MAXORDER; j++)
+      above += st.nfree[j] << j;
+    printf(1, "%d %d %d %d %d\n", k, st.nfree[k],
+           pages ? above*100/pages : 0, st.nalloc[k], st.nfail[k]);
+  }
+
+  printlat("kalloc", st.kalloclat);
+  printlat("buddyalloc", st.buddylat);
+  exit();
+}
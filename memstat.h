@@ -0,0 +1,15 @@
+#define MAXORDER    10  // largest buddy block is PGSIZE<<MAXORDER bytes
+#define NLATBUCKET  16  // allocation latency histogram buckets
+
+// Physical memory allocator statistics, filled in by memstat().
+// Latency bucket 0 counts allocations that took fewer than 64
+// TSC cycles, bucket i those that took [32<<i, 64<<i) cycles,
+// and the last bucket everything slower.
+struct memstat {
+  uint nfree[MAXORDER+1];      // Free buddy blocks of each order
+  uint ncached;                // Free pages in per-CPU caches
+  uint nalloc[MAXORDER+1];     // Buddy allocations of each order
+  uint nfail[MAXORDER+1];      // Failed buddy allocations of each order
+  uint kalloclat[NLATBUCKET];  // kalloc() latency
+  uint buddylat[NLATBUCKET];   // buddyalloc() latency
+};
@@ -22,7 +22,9 @@
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+int nlog;     // Number of log blocks, NLOGSEG segments of logsize
+int logsize = LOGSIZE;
+int extents;  // -e: map file blocks with extents
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -39,7 +41,10 @@ void winode(uint, struct dinode*);
 void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
+uint febmap(struct dinode *din, uint fbn);
+uint fbmap(struct dinode *din, uint fbn);
 void iappend(uint inum, void *p, int n);
+void dirindex(uint inum);
 
 // convert to intel byte order
 ushort
@@ -76,10 +81,28 @@ main(int argc, char *argv[])
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
+  for(;;){
+    if(argc >= 3 && strcmp(argv[1], "-l") == 0){
+      logsize = atoi(argv[2]);
+      argc -= 2;
+      argv += 2;
+    } else if(argc >= 2 && strcmp(argv[1], "-e") == 0){
+      extents = 1;
+      argc--;
+      argv++;
+    } else
+      break;
+  }
   if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+    fprintf(stderr, "Usage: mkfs [-e] [-l logsize] fs.img files...\n");
+    exit(1);
+  }
+  if(logsize < MAXOPBLOCKS+2 || logsize > LOGMAXBLOCKS+1){
+    fprintf(stderr, "mkfs: log segment size must be %d..%d blocks\n",
+            MAXOPBLOCKS+2, (int)LOGMAXBLOCKS+1);
     exit(1);
   }
+  nlog = NLOGSEG*logsize;
 
   assert((BSIZE % sizeof(struct dinode)) == 0);
   assert((BSIZE % sizeof(struct dirent)) == 0);
@@ -101,6 +124,7 @@ main(int argc, char *argv[])
   sb.logstart = xint(2);
   sb.inodestart = xint(2+nlog);
   sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.flags = xint(extents ? FS_EXTENTS : 0);
 
   printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
          nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
@@ -161,6 +185,8 @@ main(int argc, char *argv[])
   off = ((off/BSIZE) + 1) * BSIZE;
   din.size = xint(off);
   winode(rootino, &din);
+  if(off >= DIRINDEXMIN)
+    dirindex(rootino);
 
   balloc(freeblock);
 
@@ -252,6 +278,76 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// fbmap() for an extent-mapped file.  Blocks are handed out
+// in order, so a file written in one go is a single extent;
+// the extents in the inode are plenty.
+uint
+febmap(struct dinode *din, uint fbn)
+{
+  struct extent *e;
+  uint base;
+  int i;
+
+  e = (struct extent*)din->addrs;
+  base = 0;
+  for(i = 0; i < NEXTENT && xint(e[i].len) > 0; i++){
+    if(fbn < base + xint(e[i].len))
+      return xint(e[i].start) + fbn - base;
+    base += xint(e[i].len);
+  }
+  assert(fbn == base);
+  if(i > 0 && xint(e[i-1].start) + xint(e[i-1].len) == freeblock){
+    e[i-1].len = xint(xint(e[i-1].len) + 1);
+    return freeblock++;
+  }
+  assert(i < NEXTENT);
+  e[i].start = xint(freeblock);
+  e[i].len = xint(1);
+  return freeblock++;
+}
+
+// Return the block holding block fbn of din, allocating
+// blocks as needed, like bmap() in fs.c.
+uint
+fbmap(struct dinode *din, uint fbn)
+{
+  uint indirect[NINDIRECT];
+  uint addr, n;
+  int level;
+
+  if(extents)
+    return febmap(din, fbn);
+  assert(fbn < MAXFILE);
+  if(fbn < NDIRECT){
+    if(xint(din->addrs[fbn]) == 0){
+      din->addrs[fbn] = xint(freeblock++);
+    }
+    return xint(din->addrs[fbn]);
+  }
+  fbn -= NDIRECT;
+
+  n = NINDIRECT;
+  for(level = 0; fbn >= n; level++){
+    fbn -= n;
+    n *= NINDIRECT;
+  }
+  if(xint(din->addrs[NDIRECT+level]) == 0){
+    din->addrs[NDIRECT+level] = xint(freeblock++);
+  }
+  addr = xint(din->addrs[NDIRECT+level]);
+  for(; level >= 0; level--){
+    n /= NINDIRECT;
+    rsect(addr, (char*)indirect);
+    if(indirect[fbn/n] == 0){
+      indirect[fbn/n] = xint(freeblock++);
+      wsect(addr, (char*)indirect);
+    }
+    addr = xint(indirect[fbn/n]);
+    fbn %= n;
+  }
+  return addr;
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -259,7 +355,6 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
@@ -267,23 +362,7 @@ iappend(uint inum, void *xp, int n)
   // printf("append inum %d at off %d sz %d\n", inum, off, n);
   while(n > 0){
     fbn = off / BSIZE;
-    assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-      }
-      x = xint(din.addrs[fbn]);
-    } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
-    }
+    x = fbmap(&din, fbn);
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
     bcopy(p, buf + off - (fbn * BSIZE), n1);
@@ -295,3 +374,94 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Hash of a name for the directory index; as dirhash() in fs.c.
+ushort
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 0;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return h ^ (h >> 16);
+}
+
+// Give directory inum a hash index, as dirindex() in fs.c
+// does.  Uses as many hash bits as it takes for every
+// bucket to fit in one block, up to DIRMAXDEPTH.
+void
+dirindex(uint inum)
+{
+  struct dinode din;
+  struct dirent *de;
+  struct dirroot root;
+  struct dirbucket *db;
+  char buf[BSIZE];
+  uint i, n, depth, k, fbn, b, max, count[1<<DIRMAXDEPTH];
+
+  rinode(inum, &din);
+  n = xint(din.size) / sizeof(struct dirent);
+  de = malloc(n * sizeof(struct dirent));
+  for(fbn = 0; fbn * BSIZE < xint(din.size); fbn++)
+    rsect(fbmap(&din, fbn), (char*)de + fbn*BSIZE);
+
+  for(depth = 0; depth < DIRMAXDEPTH; depth++){
+    memset(count, 0, sizeof(count));
+    max = 0;
+    for(i = 0; i < n; i++){
+      if(de[i].inum == 0)
+        continue;
+      k = dirhash(de[i].name) & ((1 << depth) - 1);
+      if(++count[k] > max)
+        max = count[k];
+    }
+    if(max <= NDIRBUCKET)
+      break;
+  }
+
+  // Buckets, each followed by its overflow buckets if any.
+  memset(&root, 0, sizeof(root));
+  root.depth = xint(depth);
+  b = freeblock++;
+  for(k = 0; k < (1 << depth); k++){
+    root.bucket[k] = xint(freeblock);
+    memset(buf, 0, sizeof(buf));
+    db = (struct dirbucket*)buf;
+    db->depth = xshort(depth);
+    for(i = 0; i < n; i++){
+      if(de[i].inum == 0 ||
+         (dirhash(de[i].name) & ((1 << depth) - 1)) != k)
+        continue;
+      if(xshort(db->n) == NDIRBUCKET){
+        db->next = xint(freeblock + 1);
+        wsect(freeblock++, buf);
+        memset(buf, 0, sizeof(buf));
+        db->depth = xshort(depth);
+      }
+      db->e[xshort(db->n)].hash = xshort(dirhash(de[i].name));
+      db->e[xshort(db->n)].slot = xshort(i);
+      db->n = xshort(xshort(db->n) + 1);
+    }
+    wsect(freeblock++, buf);
+  }
+
+  // Chain the free dirents, lowest first.
+  for(i = n; i-- > 0; ){
+    if(de[i].inum != 0)
+      continue;
+    memmove(de[i].name, &root.freeslot, sizeof(root.freeslot));
+    root.freeslot = xint(i + 1);
+  }
+  for(fbn = 0; fbn * BSIZE < xint(din.size); fbn++)
+    wsect(fbmap(&din, fbn), (char*)de + fbn*BSIZE);
+
+  memset(buf, 0, sizeof(buf));
+  memmove(buf, &root, sizeof(root));
+  wsect(b, buf);
+  din.major = xshort(b >> 16);
+  din.minor = xshort(b & 0xffff);
+  winode(inum, &din);
+  free(de);
+}
@@ -95,6 +95,12 @@ struct segdesc {
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
 #define PTE_PS          0x080   // Page Size
+#define PTE_COW         0x200   // Copy-on-write (available to software)
+
+// Page fault error code bits
+#define FEC_PR          0x1     // Protection violation (else not present)
+#define FEC_WR          0x2     // Caused by a write
+#define FEC_U           0x4     // Occurred in user mode
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
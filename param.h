@@ -1,14 +1,20 @@
-#define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define BALANCETICKS 10  // timer ticks between run queue rebalances
+#define NPRIO         3  // MLFQ priority levels
+#define BOOSTTICKS  100  // timer ticks between MLFQ priority boosts
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define LOGSIZE      127  // default blocks per log segment (mkfs -l)
+#define COMMITTICKS  10  // timer ticks between group commits
+#define NBUF         (MAXOPBLOCKS*3)  // minimum size of disk block cache
+#define BUFMEMFRAC   32  // block cache gets 1/BUFMEMFRAC of free memory
+#define INODEMEMFRAC 64  // idle inodes get up to 1/INODEMEMFRAC of it
+#define NREADAHEAD    8  // blocks read ahead of a sequential reader
+#ifndef FSSIZE
+#define FSSIZE       4096  // size of file system in blocks
+#endif
 
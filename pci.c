@@ -0,0 +1,66 @@
+// PCI bus enumeration, through configuration mechanism #1.
+// Only bus 0 is searched, which is where QEMU puts its devices.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+#include "pci.h"
+
+#define PCI_CONFIG_ADDR 0xcf8
+#define PCI_CONFIG_DATA 0xcfc
+#define PCI_NDEV        32
+#define PCI_NFUNC       8
+
+static uint
+confaddr(uint bus, uint dev, uint func, uint off)
+{
+  return 0x80000000 | (bus << 16) | (dev << 11) | (func << 8) | (off & 0xfc);
+}
+
+// Read the 32-bit configuration register at off.
+uint
+pciread(struct pcidev *d, uint off)
+{
+  outl(PCI_CONFIG_ADDR, confaddr(d->bus, d->dev, d->func, off));
+  return inl(PCI_CONFIG_DATA);
+}
+
+void
+pciwrite(struct pcidev *d, uint off, uint v)
+{
+  outl(PCI_CONFIG_ADDR, confaddr(d->bus, d->dev, d->func, off));
+  outl(PCI_CONFIG_DATA, v);
+}
+
+// Find the first function on bus 0 with the given vendor and
+// device ids, or, if vendor is 0, the given class and subclass.
+// Fill in *d and return 0, or return -1 if there is none.
+int
+pcifind(ushort vendor, ushort device, uchar class, uchar subclass,
+        struct pcidev *d)
+{
+  uint id, cl, i;
+
+  d->bus = 0;
+  for(d->dev = 0; d->dev < PCI_NDEV; d->dev++){
+    for(d->func = 0; d->func < PCI_NFUNC; d->func++){
+      id = pciread(d, 0x00);
+      if((id & 0xffff) == 0xffff)
+        continue;
+      cl = pciread(d, 0x08);
+      d->vendor = id & 0xffff;
+      d->device = id >> 16;
+      d->class = cl >> 24;
+      d->subclass = cl >> 16;
+      d->progif = cl >> 8;
+      if(vendor ? (d->vendor != vendor || d->device != device) :
+                  (d->class != class || d->subclass != subclass))
+        continue;
+      for(i = 0; i < 6; i++)
+        d->bar[i] = pciread(d, 0x10 + 4*i);
+      d->irq = pciread(d, 0x3c);
+      return 0;
+    }
+  }
+  return -1;
+}
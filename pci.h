@@ -0,0 +1,21 @@
+// PCI configuration space.
+
+struct pcidev {
+  uint bus;
+  uint dev;
+  uint func;
+  ushort vendor;
+  ushort device;
+  uchar class;
+  uchar subclass;
+  uchar progif;
+  uchar irq;            // interrupt line
+  uint bar[6];          // base address registers
+};
+
+#define PCI_COMMAND       0x04  // command register
+#define PCI_CMD_IO        0x1   // respond to I/O space accesses
+#define PCI_CMD_MASTER    0x4   // may act as bus master
+
+#define PCI_BAR_IO        0x1   // BAR maps I/O space
+#define PCI_BAR_IOMASK    0xfffffffc
@@ -4,26 +4,77 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
-#include "proc.h"
 #include "spinlock.h"
-
+#include "proc.h"
+#include "sched.h"
+#include "slab.h"
+
+// There is no fixed-size process table: procs come from a slab
+// cache.  Like Linux's threads-max, allow one process per PROCMEM
+// bytes of physical memory, so that a fork bomb fails cleanly
+// before memory runs out.
+#define PROCMEM (128*PGSIZE)
+
+// Every struct proc ever constructed is on ptable.all, free or
+// not, and stays there; slab memory is never reused for anything
+// else, so the list can be walked without a lock.
+// ptable.lock serializes additions to that list, pid allocation
+// and the parent/child links used by exit() and wait().
+// Scheduling state is protected by each proc's own lock.
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct proc *all;            // List of all procs, via allnext
+  int nproc;                   // Procs currently allocated
 } ptable;
 
+static struct slabcache proccache;
+
+// Per-CPU queue of RUNNABLE processes: one FIFO list per
+// priority level, level 0 first.  Round robin only uses level 0.
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NPRIO];
+  struct proc *tail[NPRIO];
+  volatile int len;            // Number of queued processes
+};
+
+static struct runq runqs[NCPU];
+
+#ifndef SCHEDPOLICY
+#define SCHEDPOLICY SCHED_RR
+#endif
+int schedpolicy = SCHEDPOLICY;
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
+// Slab constructor: runs once for each struct proc ever created.
+static void
+procctor(void *v)
+{
+  struct proc *p = v;
+
+  initlock(&p->lock, "proc");
+  p->state = UNUSED;
+  acquire(&ptable.lock);
+  p->allnext = ptable.all;
+  __sync_synchronize();  // p is complete before others can see it
+  ptable.all = p;
+  release(&ptable.lock);
+}
 
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  slabinit(&proccache, "proc", sizeof(struct proc), procctor);
+  for(i = 0; i < NCPU; i++)
+    initlock(&runqs[i].lock, "runq");
 }
 
 // Must be called with interrupts disabled
@@ -65,9 +116,172 @@ myproc(void) {
   return p;
 }
 
+// Append p to rq at its priority level.
+static void
+runqput(struct runq *rq, struct proc *p)
+{
+  int lv = schedpolicy == SCHED_MLFQ ? p->level : 0;
+
+  acquire(&rq->lock);
+  p->rqnext = 0;
+  if(rq->tail[lv])
+    rq->tail[lv]->rqnext = p;
+  else
+    rq->head[lv] = p;
+  rq->tail[lv] = p;
+  rq->len++;
+  release(&rq->lock);
+}
+
+// Remove and return the first process of the highest
+// non-empty level of rq, or 0.  The peek at len avoids
+// taking the lock when the queue is empty.
+static struct proc*
+runqget(struct runq *rq)
+{
+  struct proc *p;
+  int lv;
+
+  if(rq->len == 0)
+    return 0;
+  p = 0;
+  acquire(&rq->lock);
+  for(lv = 0; lv < NPRIO; lv++){
+    if((p = rq->head[lv]) == 0)
+      continue;
+    rq->head[lv] = p->rqnext;
+    if(rq->head[lv] == 0)
+      rq->tail[lv] = 0;
+    rq->len--;
+    p->rqnext = 0;
+    break;
+  }
+  release(&rq->lock);
+  return p;
+}
+
+// Move every process queued on rq to level 0, keeping
+// their order within each level.
+static void
+runqflatten(struct runq *rq)
+{
+  int lv;
+
+  acquire(&rq->lock);
+  for(lv = 1; lv < NPRIO; lv++){
+    if(rq->head[lv] == 0)
+      continue;
+    if(rq->tail[0])
+      rq->tail[0]->rqnext = rq->head[lv];
+    else
+      rq->head[0] = rq->head[lv];
+    rq->tail[0] = rq->tail[lv];
+    rq->head[lv] = rq->tail[lv] = 0;
+  }
+  release(&rq->lock);
+}
+
+// Is a process of higher priority than level lv
+// waiting on rq?  Unlocked, so only a hint.
+static int
+runqhigher(struct runq *rq, int lv)
+{
+  int i;
+
+  for(i = 0; i < lv; i++)
+    if(rq->head[i])
+      return 1;
+  return 0;
+}
+
+// Mark p RUNNABLE and queue it for its CPU.
+// Caller must hold p->lock.
+static void
+makerunnable(struct proc *p)
+{
+  p->state = RUNNABLE;
+  runqput(&runqs[p->cpu], p);
+}
+
+// Return the run queue of the CPU with the most queued
+// processes, or 0 if every queue is empty.  The lengths
+// are read without locks, so the answer is only a hint.
+static struct runq*
+busiest(void)
+{
+  struct runq *rq, *best;
+
+  best = 0;
+  for(rq = runqs; rq < &runqs[ncpu]; rq++)
+    if(rq->len > 0 && (best == 0 || rq->len > best->len))
+      best = rq;
+  return best;
+}
+
+// Idle-time work stealing: take one process off the
+// busiest peer's queue so that this CPU can run it.
+static struct proc*
+steal(struct runq *self)
+{
+  struct runq *rq;
+
+  if((rq = busiest()) == 0 || rq == self)
+    return 0;
+  return runqget(rq);
+}
+
+// Called from the timer interrupt on every CPU.  Every
+// BALANCETICKS of this CPU's ticks, pull processes from
+// the busiest queue until the two queues are about even.
+// A process off all queues can only be reached through
+// this code, so moving it needs no p->lock.
+void
+rebalance(void)
+{
+  struct cpu *c = mycpu();
+  struct runq *self, *rq;
+  struct proc *p;
+  int n;
+
+  if(++c->nticks % BALANCETICKS != 0)
+    return;
+  self = &runqs[c-cpus];
+  if((rq = busiest()) == 0 || rq == self)
+    return;
+  for(n = (rq->len - self->len) / 2; n > 0; n--){
+    if((p = runqget(rq)) == 0)
+      break;
+    p->cpu = c-cpus;
+    runqput(self, p);
+  }
+}
+
+// Release p's kernel stack and page table and give p back
+// to the proc cache.  No CPU may still be running on p's
+// kernel stack.
+static void
+freeproc(struct proc *p)
+{
+  if(p->kstack)
+    kfree(p->kstack);
+  p->kstack = 0;
+  if(p->pgdir)
+    freevm(p->pgdir);
+  p->pgdir = 0;
+  acquire(&p->lock);
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+  release(&p->lock);
+  __sync_fetch_and_sub(&ptable.nproc, 1);
+  slabfree(&proccache, p);
+}
+
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
+// Allocate a proc from the proc cache.
+// If that works, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
 static struct proc*
@@ -76,24 +290,24 @@ allocproc(void)
   struct proc *p;
   char *sp;
 
-  acquire(&ptable.lock);
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-
-  release(&ptable.lock);
-  return 0;
+  if(__sync_add_and_fetch(&ptable.nproc, 1) > PHYSTOP/PROCMEM ||
+     (p = slaballoc(&proccache)) == 0){
+    __sync_fetch_and_sub(&ptable.nproc, 1);
+    return 0;
+  }
 
-found:
+  acquire(&ptable.lock);
+  acquire(&p->lock);
   p->state = EMBRYO;
   p->pid = nextpid++;
-
+  p->level = 0;
+  p->slice = 0;
+  release(&p->lock);
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    freeproc(p);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -115,6 +329,28 @@ found:
   return p;
 }
 
+// Start a kernel thread that runs fn, which must never return.
+// It has no user memory; its page table only maps the kernel.
+void
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kthread");
+  p->sz = 0;
+  p->parent = 0;
+  p->cwd = 0;
+  // forkret() returns to fn instead of trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&p->lock);
+  p->cpu = myproc() ? myproc()->cpu : 0;
+  makerunnable(p);
+  release(&p->lock);
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -146,14 +382,17 @@ userinit(void)
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(&p->lock);
 
-  p->state = RUNNABLE;
+  p->cpu = cpuid();
+  makerunnable(p);
 
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
+// Growing only moves sz: pages are allocated on
+// first touch by pagefault() in vm.c.
 // Return 0 on success, -1 on failure.
 int
 growproc(int n)
@@ -163,8 +402,9 @@ growproc(int n)
 
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if(sz + n < sz || sz + n >= KERNBASE)
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
@@ -191,13 +431,10 @@ fork(void)
 
   // Copy process state from proc.
   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
-    kfree(np->kstack);
-    np->kstack = 0;
-    np->state = UNUSED;
+    freeproc(np);
     return -1;
   }
   np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -213,11 +450,15 @@ fork(void)
   pid = np->pid;
 
   acquire(&ptable.lock);
-
-  np->state = RUNNABLE;
-
+  np->parent = curproc;
   release(&ptable.lock);
 
+  // The child starts on the parent's run queue.
+  acquire(&np->lock);
+  np->cpu = curproc->cpu;
+  makerunnable(np);
+  release(&np->lock);
+
   return pid;
 }
 
@@ -250,19 +491,24 @@ exit(void)
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  wakeup(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.all; p; p = p->allnext){
     if(p->parent == curproc){
       p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
+      wakeup(initproc);
     }
   }
 
-  // Jump into the scheduler, never to return.
+  // Become a zombie before the parent can look at us:
+  // it needs ptable.lock to do so, which we hold until
+  // our own lock is held.
+  acquire(&curproc->lock);
   curproc->state = ZOMBIE;
+  release(&ptable.lock);
+
+  // Jump into the scheduler, never to return.
   sched();
   panic("zombie exit");
 }
@@ -278,26 +524,24 @@ wait(void)
   
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for exited children.
+    // Scan through all procs looking for exited children.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.all; p; p = p->allnext){
       if(p->parent != curproc)
         continue;
       havekids = 1;
+      // Holding p->lock also waits for a zombie to finish
+      // switching away from its kernel stack.
+      acquire(&p->lock);
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        release(&p->lock);
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
+      release(&p->lock);
     }
 
     // No point waiting if we don't have any children.
@@ -315,7 +559,7 @@ wait(void)
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
-//  - choose a process to run
+//  - take the next process off this CPU's run queue
 //  - swtch to start running that process
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
@@ -324,38 +568,42 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  struct runq *rq = &runqs[c-cpus];
   c->proc = 0;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
-    }
-    release(&ptable.lock);
+    if((p = runqget(rq)) == 0 && (p = steal(rq)) == 0)
+      continue;
 
+    // A process that just queued itself may still be
+    // switching away on another CPU; its lock is held
+    // until that finishes.
+    acquire(&p->lock);
+    if(p->state != RUNNABLE)
+      panic("scheduler runnable");
+
+    // Switch to chosen process.  It is the process's job
+    // to release p->lock and then reacquire it
+    // before jumping back to us.
+    c->proc = p;
+    p->cpu = c-cpus;
+    switchuvm(p);
+    p->state = RUNNING;
+
+    swtch(&(c->scheduler), p->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    c->proc = 0;
+    release(&p->lock);
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only p->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -368,8 +616,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&p->lock))
+    panic("sched p->lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -385,10 +633,81 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct proc *p = myproc();
+
+  acquire(&p->lock);  //DOC: yieldlock
+  makerunnable(p);
   sched();
-  release(&ptable.lock);
+  release(&p->lock);
+}
+
+// Charge the current process for one clock tick and report
+// whether it should give up the CPU.  Round robin switches on
+// every tick.  MLFQ lets a process at level lv run for 1<<lv
+// ticks before demoting it, and preempts it early when a
+// higher-priority process is waiting on this CPU.  The ticks
+// used at a level survive sleeping, so a process cannot keep
+// its priority by blocking just before its quantum runs out.
+int
+timeslice(void)
+{
+  struct proc *p = myproc();
+  int expired;
+
+  if(schedpolicy != SCHED_MLFQ)
+    return 1;
+  acquire(&p->lock);
+  expired = ++p->slice >= (1 << p->level);
+  if(expired){
+    if(p->level < NPRIO-1)
+      p->level++;
+    p->slice = 0;
+  }
+  release(&p->lock);
+  return expired || runqhigher(&runqs[p->cpu], p->level);
+}
+
+// Put every process back at the top priority level.
+static void
+resetlevels(void)
+{
+  struct proc *p;
+  int i;
+
+  for(p = ptable.all; p; p = p->allnext){
+    acquire(&p->lock);
+    p->level = 0;
+    p->slice = 0;
+    release(&p->lock);
+  }
+  for(i = 0; i < ncpu; i++)
+    runqflatten(&runqs[i]);
+}
+
+// Periodic MLFQ priority boost, run every BOOSTTICKS ticks,
+// so that CPU-bound processes cannot starve and processes
+// that became interactive regain their priority.
+void
+priboost(void)
+{
+  if(schedpolicy == SCHED_MLFQ)
+    resetlevels();
+}
+
+// Switch the scheduling policy.
+// Return the previous policy, or -1 if policy is unknown.
+int
+setsched(int policy)
+{
+  int old;
+
+  if(policy != SCHED_RR && policy != SCHED_MLFQ)
+    return -1;
+  old = schedpolicy;
+  schedpolicy = policy;
+  if(old != policy)
+    resetlevels();
+  return old;
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -397,8 +716,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding p->lock from scheduler.
+  release(&myproc()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -407,6 +726,8 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    ballocinit(ROOTDEV);
+    iallocinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -425,16 +746,15 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire p->lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
+  // Once we hold p->lock, we can be
   // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // (wakeup locks each proc it looks at),
   // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  acquire(&p->lock);  //DOC: sleeplock1
+  release(lk);
+
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
@@ -445,32 +765,26 @@ sleep(void *chan, struct spinlock *lk)
   p->chan = 0;
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  release(&p->lock);  //DOC: sleeplock2
+  acquire(lk);
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
-{
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
-}
-
-// Wake up all processes sleeping on chan.
+// Must be called without any p->lock held.
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct proc *p, *curproc = myproc();
+
+  for(p = ptable.all; p; p = p->allnext){
+    if(p == curproc)
+      continue;
+    acquire(&p->lock);
+    if(p->state == SLEEPING && p->chan == chan)
+      makerunnable(p);
+    release(&p->lock);
+  }
 }
 
 // Kill the process with the given pid.
@@ -481,18 +795,18 @@ kill(int pid)
 {
   struct proc *p;
 
-  acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.all; p; p = p->allnext){
+    acquire(&p->lock);
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
+        makerunnable(p);
+      release(&p->lock);
       return 0;
     }
+    release(&p->lock);
   }
-  release(&ptable.lock);
   return -1;
 }
 
@@ -516,7 +830,7 @@ procdump(void)
   char *state;
   uint pc[10];
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.all; p; p = p->allnext){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
@@ -8,6 +8,7 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  uint nticks;                 // Timer interrupts taken by this cpu
 };
 
 extern struct cpu cpus[NCPU];
@@ -36,10 +37,16 @@ enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
 struct proc {
+  struct spinlock lock;        // Protects state, chan, killed, pid
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
+  int cpu;                     // CPU whose run queue this process uses
+  struct proc *rqnext;         // Next process on that run queue
+  struct proc *allnext;        // Next on the list of all procs
+  int level;                   // MLFQ priority level, 0 is highest
+  int slice;                   // Ticks used at the current level
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
   struct trapframe *tf;        // Trap frame for current syscall
@@ -0,0 +1,3 @@
+// Scheduling policies for setsched()
+#define SCHED_RR    0  // round robin, one tick per turn
+#define SCHED_MLFQ  1  // multi-level feedback queue
@@ -0,0 +1,42 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "sched.h"
+#include "iosched.h"
+
+int
+main(int argc, char **argv)
+{
+  int policy;
+
+  if(argc == 3 && strcmp(argv[1], "io") == 0){
+    if(strcmp(argv[2], "fifo") == 0)
+      policy = IOSCHED_FIFO;
+    else if(strcmp(argv[2], "clook") == 0)
+      policy = IOSCHED_CLOOK;
+    else if(strcmp(argv[2], "deadline") == 0)
+      policy = IOSCHED_DEADLINE;
+    else
+      goto usage;
+    if(setiosched(policy) < 0)
+      printf(2, "setsched: failed\n");
+    exit();
+  }
+
+  if(argc != 2)
+    goto usage;
+  if(strcmp(argv[1], "rr") == 0)
+    policy = SCHED_RR;
+  else if(strcmp(argv[1], "mlfq") == 0)
+    policy = SCHED_MLFQ;
+  else
+    goto usage;
+  if(setsched(policy) < 0)
+    printf(2, "setsched: failed\n");
+  exit();
+
+usage:
+  printf(2, "usage: setsched rr|mlfq\n");
+  printf(2, "       setsched io fifo|clook|deadline\n");
+  exit();
+}
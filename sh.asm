@@ -0,0 +1,3112 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+  exit();
+}
+
+int main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  static char buf[100];
+  int fd;
+  printf(2, "$ ");
+      11:	68 fc 16 00 00       	push   $0x16fc
+      16:	6a 02                	push   $0x2
+      18:	e8 13 13 00 00       	call   1330 <printf>
+
+  // Ensure that three file descriptors are open.
+  while ((fd = open("console", O_RDWR)) >= 0)
+      1d:	83 c4 10             	add    $0x10,%esp
+      20:	eb 0f                	jmp    31 <main+0x31>
+      22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  {
+    if (fd >= 3)
+      28:	83 f8 02             	cmp    $0x2,%eax
+      2b:	0f 8f 0b 01 00 00    	jg     13c <main+0x13c>
+  while ((fd = open("console", O_RDWR)) >= 0)
+      31:	83 ec 08             	sub    $0x8,%esp
+      34:	6a 02                	push   $0x2
+      36:	68 ff 16 00 00       	push   $0x16ff
+      3b:	e8 bf 11 00 00       	call   11ff <open>
+      40:	83 c4 10             	add    $0x10,%esp
+      43:	85 c0                	test   %eax,%eax
+      45:	79 e1                	jns    28 <main+0x28>
+      47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      4e:	66 90                	xchg   %ax,%ax
+  memset(buf, 0, nbuf);
+      50:	83 ec 04             	sub    $0x4,%esp
+      53:	6a 64                	push   $0x64
+      55:	6a 00                	push   $0x0
+      57:	68 60 1e 00 00       	push   $0x1e60
+      5c:	e8 8f 0f 00 00       	call   ff0 <memset>
+  gets(buf, nbuf);
+      61:	58                   	pop    %eax
+      62:	5a                   	pop    %edx
+      63:	6a 64                	push   $0x64
+      65:	68 60 1e 00 00       	push   $0x1e60
+      6a:	e8 e1 0f 00 00       	call   1050 <gets>
+  if (buf[0] == 0) // EOF
+      6f:	0f b6 05 60 1e 00 00 	movzbl 0x1e60,%eax
+      76:	83 c4 10             	add    $0x10,%esp
+      79:	84 c0                	test   %al,%al
+      7b:	0f 84 b6 00 00 00    	je     137 <main+0x137>
+  }
+
+  // Read and run input commands.
+  while (getcmd(buf, sizeof(buf)) >= 0)
+  {
+    if (buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' ')
+      81:	3c 63                	cmp    $0x63,%al
+      83:	b8 00 00 00 00       	mov    $0x0,%eax
+      88:	74 56                	je     e0 <main+0xe0>
+      8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    n++;
+      90:	89 c2                	mov    %eax,%edx
+      92:	83 c0 01             	add    $0x1,%eax
+  while (s[n])
+      95:	80 b8 60 1e 00 00 00 	cmpb   $0x0,0x1e60(%eax)
+      9c:	75 f2                	jne    90 <main+0x90>
+      if (chdir(buf + 3) < 0)
+        printf(2, "cannot cd %s\n", buf + 3);
+      continue;
+    }
+
+    if (buf[0] != 0 && buf[my_strlen(buf) - 1] == '\t')
+      9e:	80 ba 60 1e 00 00 09 	cmpb   $0x9,0x1e60(%edx)
+      a5:	0f 84 b7 00 00 00    	je     162 <main+0x162>
+
+int fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      ab:	e8 07 11 00 00       	call   11b7 <fork>
+  if (pid == -1)
+      b0:	83 f8 ff             	cmp    $0xffffffff,%eax
+      b3:	0f 84 d3 00 00 00    	je     18c <main+0x18c>
+    if (fork1() == 0)
+      b9:	85 c0                	test   %eax,%eax
+      bb:	0f 84 8c 00 00 00    	je     14d <main+0x14d>
+    wait();
+      c1:	e8 01 11 00 00       	call   11c7 <wait>
+    printf(2, "$ ");
+      c6:	83 ec 08             	sub    $0x8,%esp
+      c9:	68 fc 16 00 00       	push   $0x16fc
+      ce:	6a 02                	push   $0x2
+      d0:	e8 5b 12 00 00       	call   1330 <printf>
+      d5:	83 c4 10             	add    $0x10,%esp
+      d8:	e9 73 ff ff ff       	jmp    50 <main+0x50>
+      dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if (buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' ')
+      e0:	80 3d 61 1e 00 00 64 	cmpb   $0x64,0x1e61
+      e7:	75 a7                	jne    90 <main+0x90>
+      e9:	80 3d 62 1e 00 00 20 	cmpb   $0x20,0x1e62
+      f0:	75 9e                	jne    90 <main+0x90>
+      buf[strlen(buf) - 1] = 0; // chop \n
+      f2:	83 ec 0c             	sub    $0xc,%esp
+      f5:	68 60 1e 00 00       	push   $0x1e60
+      fa:	e8 c1 0e 00 00       	call   fc0 <strlen>
+      if (chdir(buf + 3) < 0)
+      ff:	c7 04 24 63 1e 00 00 	movl   $0x1e63,(%esp)
+      buf[strlen(buf) - 1] = 0; // chop \n
+     106:	c6 80 5f 1e 00 00 00 	movb   $0x0,0x1e5f(%eax)
+      if (chdir(buf + 3) < 0)
+     10d:	e8 1d 11 00 00       	call   122f <chdir>
+     112:	83 c4 10             	add    $0x10,%esp
+     115:	85 c0                	test   %eax,%eax
+     117:	0f 89 33 ff ff ff    	jns    50 <main+0x50>
+        printf(2, "cannot cd %s\n", buf + 3);
+     11d:	50                   	push   %eax
+     11e:	68 63 1e 00 00       	push   $0x1e63
+     123:	68 07 17 00 00       	push   $0x1707
+     128:	6a 02                	push   $0x2
+     12a:	e8 01 12 00 00       	call   1330 <printf>
+     12f:	83 c4 10             	add    $0x10,%esp
+     132:	e9 19 ff ff ff       	jmp    50 <main+0x50>
+  exit();
+     137:	e8 83 10 00 00       	call   11bf <exit>
+      close(fd);
+     13c:	83 ec 0c             	sub    $0xc,%esp
+     13f:	50                   	push   %eax
+     140:	e8 a2 10 00 00       	call   11e7 <close>
+      break;
+     145:	83 c4 10             	add    $0x10,%esp
+     148:	e9 03 ff ff ff       	jmp    50 <main+0x50>
+      runcmd(parsecmd(buf));
+     14d:	83 ec 0c             	sub    $0xc,%esp
+     150:	68 60 1e 00 00       	push   $0x1e60
+     155:	e8 66 0d 00 00       	call   ec0 <parsecmd>
+     15a:	89 04 24             	mov    %eax,(%esp)
+     15d:	e8 ae 03 00 00       	call   510 <runcmd>
+      handle_autocomplete(buf, sizeof(buf));
+     162:	51                   	push   %ecx
+     163:	51                   	push   %ecx
+     164:	6a 64                	push   $0x64
+     166:	68 60 1e 00 00       	push   $0x1e60
+     16b:	e8 10 01 00 00       	call   280 <handle_autocomplete>
+      printf(1, "%s", buf);
+     170:	83 c4 0c             	add    $0xc,%esp
+     173:	68 60 1e 00 00       	push   $0x1e60
+     178:	68 15 17 00 00       	push   $0x1715
+     17d:	6a 01                	push   $0x1
+     17f:	e8 ac 11 00 00       	call   1330 <printf>
+      continue;
+     184:	83 c4 10             	add    $0x10,%esp
+     187:	e9 c4 fe ff ff       	jmp    50 <main+0x50>
+    panic("fork");
+     18c:	83 ec 0c             	sub    $0xc,%esp
+     18f:	68 5e 16 00 00       	push   $0x165e
+     194:	e8 37 03 00 00       	call   4d0 <panic>
+     199:	66 90                	xchg   %ax,%ax
+     19b:	66 90                	xchg   %ax,%ax
+     19d:	66 90                	xchg   %ax,%ax
+     19f:	90                   	nop
+
+000001a0 <my_strlen>:
+{
+     1a0:	55                   	push   %ebp
+  int n = 0;
+     1a1:	31 c0                	xor    %eax,%eax
+{
+     1a3:	89 e5                	mov    %esp,%ebp
+     1a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  while (s[n])
+     1a8:	80 3a 00             	cmpb   $0x0,(%edx)
+     1ab:	74 0c                	je     1b9 <my_strlen+0x19>
+     1ad:	8d 76 00             	lea    0x0(%esi),%esi
+    n++;
+     1b0:	83 c0 01             	add    $0x1,%eax
+  while (s[n])
+     1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     1b7:	75 f7                	jne    1b0 <my_strlen+0x10>
+}
+     1b9:	5d                   	pop    %ebp
+     1ba:	c3                   	ret
+     1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1bf:	90                   	nop
+
+000001c0 <my_strcpy>:
+{
+     1c0:	55                   	push   %ebp
+  if (start < 0)
+     1c1:	31 d2                	xor    %edx,%edx
+{
+     1c3:	89 e5                	mov    %esp,%ebp
+     1c5:	53                   	push   %ebx
+     1c6:	8b 45 10             	mov    0x10(%ebp),%eax
+  while ((*dst++ = src[start++]) != 0)
+     1c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+{
+     1cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if (start < 0)
+     1cf:	85 c0                	test   %eax,%eax
+     1d1:	0f 48 c2             	cmovs  %edx,%eax
+  while ((*dst++ = src[start++]) != 0)
+     1d4:	29 c1                	sub    %eax,%ecx
+     1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1dd:	8d 76 00             	lea    0x0(%esi),%esi
+     1e0:	83 c0 01             	add    $0x1,%eax
+     1e3:	0f b6 54 03 ff       	movzbl -0x1(%ebx,%eax,1),%edx
+     1e8:	88 54 01 ff          	mov    %dl,-0x1(%ecx,%eax,1)
+     1ec:	84 d2                	test   %dl,%dl
+     1ee:	75 f0                	jne    1e0 <my_strcpy+0x20>
+}
+     1f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1f3:	c9                   	leave
+     1f4:	c3                   	ret
+     1f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <my_strncmp>:
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	53                   	push   %ebx
+     204:	8b 45 10             	mov    0x10(%ebp),%eax
+     207:	8b 55 08             	mov    0x8(%ebp),%edx
+     20a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while (n > 0 && *p && *p == *q)
+     20d:	85 c0                	test   %eax,%eax
+     20f:	7f 16                	jg     227 <my_strncmp+0x27>
+     211:	eb 1b                	jmp    22e <my_strncmp+0x2e>
+     213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     217:	90                   	nop
+     218:	3a 19                	cmp    (%ecx),%bl
+     21a:	75 12                	jne    22e <my_strncmp+0x2e>
+    p++;
+     21c:	83 c2 01             	add    $0x1,%edx
+    q++;
+     21f:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+     222:	83 e8 01             	sub    $0x1,%eax
+     225:	74 19                	je     240 <my_strncmp+0x40>
+     227:	0f b6 1a             	movzbl (%edx),%ebx
+     22a:	84 db                	test   %bl,%bl
+     22c:	75 ea                	jne    218 <my_strncmp+0x18>
+  if (n == 0)
+     22e:	85 c0                	test   %eax,%eax
+     230:	74 0e                	je     240 <my_strncmp+0x40>
+  return (unsigned char)*p - (unsigned char)*q;
+     232:	0f b6 02             	movzbl (%edx),%eax
+     235:	0f b6 11             	movzbl (%ecx),%edx
+}
+     238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     23b:	c9                   	leave
+  return (unsigned char)*p - (unsigned char)*q;
+     23c:	29 d0                	sub    %edx,%eax
+}
+     23e:	c3                   	ret
+     23f:	90                   	nop
+     240:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+     243:	31 c0                	xor    %eax,%eax
+}
+     245:	c9                   	leave
+     246:	c3                   	ret
+     247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24e:	66 90                	xchg   %ax,%ax
+
+00000250 <getcmd>:
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	56                   	push   %esi
+     254:	53                   	push   %ebx
+     255:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     258:	8b 75 0c             	mov    0xc(%ebp),%esi
+  memset(buf, 0, nbuf);
+     25b:	83 ec 04             	sub    $0x4,%esp
+     25e:	56                   	push   %esi
+     25f:	6a 00                	push   $0x0
+     261:	53                   	push   %ebx
+     262:	e8 89 0d 00 00       	call   ff0 <memset>
+  gets(buf, nbuf);
+     267:	58                   	pop    %eax
+     268:	5a                   	pop    %edx
+     269:	56                   	push   %esi
+     26a:	53                   	push   %ebx
+     26b:	e8 e0 0d 00 00       	call   1050 <gets>
+  if (buf[0] == 0) // EOF
+     270:	83 c4 10             	add    $0x10,%esp
+     273:	80 3b 01             	cmpb   $0x1,(%ebx)
+     276:	19 c0                	sbb    %eax,%eax
+}
+     278:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     27b:	5b                   	pop    %ebx
+     27c:	5e                   	pop    %esi
+     27d:	5d                   	pop    %ebp
+     27e:	c3                   	ret
+     27f:	90                   	nop
+
+00000280 <handle_autocomplete>:
+{
+     280:	55                   	push   %ebp
+     281:	89 e5                	mov    %esp,%ebp
+     283:	57                   	push   %edi
+     284:	56                   	push   %esi
+     285:	53                   	push   %ebx
+     286:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+     28c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (buf[0] == 0 || buf[my_strlen(buf) - 1] != '\t')
+     28f:	80 3b 00             	cmpb   $0x0,(%ebx)
+     292:	0f 84 73 01 00 00    	je     40b <handle_autocomplete+0x18b>
+  int n = 0;
+     298:	31 c0                	xor    %eax,%eax
+     29a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    n++;
+     2a0:	89 c2                	mov    %eax,%edx
+     2a2:	83 c0 01             	add    $0x1,%eax
+  while (s[n])
+     2a5:	80 3c 03 00          	cmpb   $0x0,(%ebx,%eax,1)
+     2a9:	75 f5                	jne    2a0 <handle_autocomplete+0x20>
+  if (buf[0] == 0 || buf[my_strlen(buf) - 1] != '\t')
+     2ab:	80 3c 13 09          	cmpb   $0x9,(%ebx,%edx,1)
+     2af:	0f 85 56 01 00 00    	jne    40b <handle_autocomplete+0x18b>
+  int n = 0;
+     2b5:	31 c0                	xor    %eax,%eax
+     2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2be:	66 90                	xchg   %ax,%ax
+    n++;
+     2c0:	89 c2                	mov    %eax,%edx
+     2c2:	83 c0 01             	add    $0x1,%eax
+  while (s[n])
+     2c5:	80 3c 03 00          	cmpb   $0x0,(%ebx,%eax,1)
+     2c9:	75 f5                	jne    2c0 <handle_autocomplete+0x40>
+  buf[my_strlen(buf) - 1] = 0;
+     2cb:	c6 04 13 00          	movb   $0x0,(%ebx,%edx,1)
+     2cf:	31 c0                	xor    %eax,%eax
+     2d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while ((*dst++ = src[start++]) != 0)
+     2d8:	83 c0 01             	add    $0x1,%eax
+     2db:	0f b6 54 03 ff       	movzbl -0x1(%ebx,%eax,1),%edx
+     2e0:	88 54 05 83          	mov    %dl,-0x7d(%ebp,%eax,1)
+     2e4:	84 d2                	test   %dl,%dl
+     2e6:	75 f0                	jne    2d8 <handle_autocomplete+0x58>
+  int n = 0;
+     2e8:	31 ff                	xor    %edi,%edi
+  while (s[n])
+     2ea:	80 7d 84 00          	cmpb   $0x0,-0x7c(%ebp)
+     2ee:	74 0a                	je     2fa <handle_autocomplete+0x7a>
+    n++;
+     2f0:	83 c7 01             	add    $0x1,%edi
+  while (s[n])
+     2f3:	80 7c 3d 84 00       	cmpb   $0x0,-0x7c(%ebp,%edi,1)
+     2f8:	75 f6                	jne    2f0 <handle_autocomplete+0x70>
+  fd = open(".", 0);
+     2fa:	83 ec 08             	sub    $0x8,%esp
+     2fd:	6a 00                	push   $0x0
+     2ff:	68 58 16 00 00       	push   $0x1658
+     304:	e8 f6 0e 00 00       	call   11ff <open>
+  if (fd < 0)
+     309:	83 c4 10             	add    $0x10,%esp
+  int match_count = 0;
+     30c:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+     313:	00 00 00 
+  fd = open(".", 0);
+     316:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  if (fd < 0)
+     31c:	85 c0                	test   %eax,%eax
+     31e:	0f 88 8f 01 00 00    	js     4b3 <handle_autocomplete+0x233>
+     324:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while (read(fd, &de, sizeof(de)) == sizeof(de))
+     328:	83 ec 04             	sub    $0x4,%esp
+     32b:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+     331:	6a 10                	push   $0x10
+     333:	50                   	push   %eax
+     334:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+     33a:	e8 98 0e 00 00       	call   11d7 <read>
+     33f:	83 c4 10             	add    $0x10,%esp
+     342:	83 f8 10             	cmp    $0x10,%eax
+     345:	0f 85 a5 00 00 00    	jne    3f0 <handle_autocomplete+0x170>
+    if (de.inum == 0)
+     34b:	66 83 bd 74 ff ff ff 	cmpw   $0x0,-0x8c(%ebp)
+     352:	00 
+     353:	74 d3                	je     328 <handle_autocomplete+0xa8>
+  while (n > 0 && *p && *p == *q)
+     355:	8d 8d 76 ff ff ff    	lea    -0x8a(%ebp),%ecx
+     35b:	85 ff                	test   %edi,%edi
+     35d:	74 49                	je     3a8 <handle_autocomplete+0x128>
+     35f:	8d 8d 76 ff ff ff    	lea    -0x8a(%ebp),%ecx
+     365:	89 bd 60 ff ff ff    	mov    %edi,-0xa0(%ebp)
+     36b:	89 fe                	mov    %edi,%esi
+     36d:	8d 55 84             	lea    -0x7c(%ebp),%edx
+     370:	89 cf                	mov    %ecx,%edi
+     372:	eb 17                	jmp    38b <handle_autocomplete+0x10b>
+     374:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     378:	3a 02                	cmp    (%edx),%al
+     37a:	75 16                	jne    392 <handle_autocomplete+0x112>
+    p++;
+     37c:	83 c7 01             	add    $0x1,%edi
+    q++;
+     37f:	83 c2 01             	add    $0x1,%edx
+  while (n > 0 && *p && *p == *q)
+     382:	83 ee 01             	sub    $0x1,%esi
+     385:	0f 84 8d 00 00 00    	je     418 <handle_autocomplete+0x198>
+     38b:	0f b6 07             	movzbl (%edi),%eax
+     38e:	84 c0                	test   %al,%al
+     390:	75 e6                	jne    378 <handle_autocomplete+0xf8>
+    if (my_strncmp(de.name, prefix, prefix_len) == 0)
+     392:	89 f8                	mov    %edi,%eax
+     394:	0f b6 12             	movzbl (%edx),%edx
+     397:	8b bd 60 ff ff ff    	mov    -0xa0(%ebp),%edi
+     39d:	38 10                	cmp    %dl,(%eax)
+     39f:	75 87                	jne    328 <handle_autocomplete+0xa8>
+     3a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3a8:	6b b5 5c ff ff ff 0e 	imul   $0xe,-0xa4(%ebp),%esi
+  while (n > 0 && *p && *p == *q)
+     3af:	31 c0                	xor    %eax,%eax
+     3b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      while (i < 13 && de.name[i] != 0)
+     3b8:	0f b6 14 01          	movzbl (%ecx,%eax,1),%edx
+     3bc:	84 d2                	test   %dl,%dl
+     3be:	74 0f                	je     3cf <handle_autocomplete+0x14f>
+        matches[match_count][i] = de.name[i];
+     3c0:	88 94 06 e0 1e 00 00 	mov    %dl,0x1ee0(%esi,%eax,1)
+        i++;
+     3c7:	83 c0 01             	add    $0x1,%eax
+      while (i < 13 && de.name[i] != 0)
+     3ca:	83 f8 0d             	cmp    $0xd,%eax
+     3cd:	75 e9                	jne    3b8 <handle_autocomplete+0x138>
+      matches[match_count][i] = 0;
+     3cf:	8b 8d 5c ff ff ff    	mov    -0xa4(%ebp),%ecx
+     3d5:	6b d1 0e             	imul   $0xe,%ecx,%edx
+      match_count++;
+     3d8:	83 c1 01             	add    $0x1,%ecx
+     3db:	89 8d 5c ff ff ff    	mov    %ecx,-0xa4(%ebp)
+      matches[match_count][i] = 0;
+     3e1:	c6 84 10 e0 1e 00 00 	movb   $0x0,0x1ee0(%eax,%edx,1)
+     3e8:	00 
+      match_count++;
+     3e9:	e9 3a ff ff ff       	jmp    328 <handle_autocomplete+0xa8>
+     3ee:	66 90                	xchg   %ax,%ax
+  close(fd);
+     3f0:	83 ec 0c             	sub    $0xc,%esp
+     3f3:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+     3f9:	e8 e9 0d 00 00       	call   11e7 <close>
+  if (match_count == 0)
+     3fe:	8b b5 5c ff ff ff    	mov    -0xa4(%ebp),%esi
+     404:	83 c4 10             	add    $0x10,%esp
+     407:	85 f6                	test   %esi,%esi
+     409:	75 15                	jne    420 <handle_autocomplete+0x1a0>
+}
+     40b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     40e:	5b                   	pop    %ebx
+     40f:	5e                   	pop    %esi
+     410:	5f                   	pop    %edi
+     411:	5d                   	pop    %ebp
+     412:	c3                   	ret
+     413:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     417:	90                   	nop
+     418:	8b bd 60 ff ff ff    	mov    -0xa0(%ebp),%edi
+     41e:	eb 88                	jmp    3a8 <handle_autocomplete+0x128>
+  while ((*dst++ = src[start++]) != 0)
+     420:	89 da                	mov    %ebx,%edx
+     422:	29 fa                	sub    %edi,%edx
+  else if (match_count == 1)
+     424:	83 fe 01             	cmp    $0x1,%esi
+     427:	74 57                	je     480 <handle_autocomplete+0x200>
+    printf(1, "\n");
+     429:	83 ec 08             	sub    $0x8,%esp
+     42c:	6b f6 0e             	imul   $0xe,%esi,%esi
+     42f:	bf e0 1e 00 00       	mov    $0x1ee0,%edi
+     434:	68 78 16 00 00       	push   $0x1678
+     439:	6a 01                	push   $0x1
+     43b:	01 fe                	add    %edi,%esi
+     43d:	e8 ee 0e 00 00       	call   1330 <printf>
+    for (int i = 0; i < match_count; i++)
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(1, "%s ", matches[i]);
+     448:	83 ec 04             	sub    $0x4,%esp
+     44b:	57                   	push   %edi
+    for (int i = 0; i < match_count; i++)
+     44c:	83 c7 0e             	add    $0xe,%edi
+      printf(1, "%s ", matches[i]);
+     44f:	68 5a 16 00 00       	push   $0x165a
+     454:	6a 01                	push   $0x1
+     456:	e8 d5 0e 00 00       	call   1330 <printf>
+    for (int i = 0; i < match_count; i++)
+     45b:	83 c4 10             	add    $0x10,%esp
+     45e:	39 fe                	cmp    %edi,%esi
+     460:	75 e6                	jne    448 <handle_autocomplete+0x1c8>
+    printf(1, "\n");
+     462:	83 ec 08             	sub    $0x8,%esp
+     465:	68 78 16 00 00       	push   $0x1678
+     46a:	6a 01                	push   $0x1
+     46c:	e8 bf 0e 00 00       	call   1330 <printf>
+    buf[-1] = '\n';
+     471:	c6 43 ff 0a          	movb   $0xa,-0x1(%ebx)
+     475:	83 c4 10             	add    $0x10,%esp
+     478:	eb 91                	jmp    40b <handle_autocomplete+0x18b>
+     47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  while ((*dst++ = src[start++]) != 0)
+     480:	0f b6 87 e0 1e 00 00 	movzbl 0x1ee0(%edi),%eax
+     487:	83 c7 01             	add    $0x1,%edi
+     48a:	88 44 3a ff          	mov    %al,-0x1(%edx,%edi,1)
+     48e:	84 c0                	test   %al,%al
+     490:	75 ee                	jne    480 <handle_autocomplete+0x200>
+  while (s[n])
+     492:	80 3b 00             	cmpb   $0x0,(%ebx)
+     495:	74 14                	je     4ab <handle_autocomplete+0x22b>
+     497:	8d 43 01             	lea    0x1(%ebx),%eax
+     49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     4a0:	89 c3                	mov    %eax,%ebx
+     4a2:	83 c0 01             	add    $0x1,%eax
+     4a5:	80 78 ff 00          	cmpb   $0x0,-0x1(%eax)
+     4a9:	75 f5                	jne    4a0 <handle_autocomplete+0x220>
+    buf[my_strlen(buf)] = '\r';
+     4ab:	c6 03 0d             	movb   $0xd,(%ebx)
+     4ae:	e9 58 ff ff ff       	jmp    40b <handle_autocomplete+0x18b>
+    printf(2, "cannot open current directory\n");
+     4b3:	83 ec 08             	sub    $0x8,%esp
+     4b6:	68 18 17 00 00       	push   $0x1718
+     4bb:	6a 02                	push   $0x2
+     4bd:	e8 6e 0e 00 00       	call   1330 <printf>
+    buf[0] = 0; // Clear buffer on error
+     4c2:	c6 03 00             	movb   $0x0,(%ebx)
+    return;
+     4c5:	83 c4 10             	add    $0x10,%esp
+     4c8:	e9 3e ff ff ff       	jmp    40b <handle_autocomplete+0x18b>
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004d0 <panic>:
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     4d6:	ff 75 08             	push   0x8(%ebp)
+     4d9:	68 f8 16 00 00       	push   $0x16f8
+     4de:	6a 02                	push   $0x2
+     4e0:	e8 4b 0e 00 00       	call   1330 <printf>
+  exit();
+     4e5:	e8 d5 0c 00 00       	call   11bf <exit>
+     4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004f0 <fork1>:
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     4f6:	e8 bc 0c 00 00       	call   11b7 <fork>
+  if (pid == -1)
+     4fb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     4fe:	74 02                	je     502 <fork1+0x12>
+  return pid;
+}
+     500:	c9                   	leave
+     501:	c3                   	ret
+    panic("fork");
+     502:	83 ec 0c             	sub    $0xc,%esp
+     505:	68 5e 16 00 00       	push   $0x165e
+     50a:	e8 c1 ff ff ff       	call   4d0 <panic>
+     50f:	90                   	nop
+
+00000510 <runcmd>:
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	53                   	push   %ebx
+     514:	83 ec 14             	sub    $0x14,%esp
+     517:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (cmd == 0)
+     51a:	85 db                	test   %ebx,%ebx
+     51c:	74 42                	je     560 <runcmd+0x50>
+  switch (cmd->type)
+     51e:	83 3b 05             	cmpl   $0x5,(%ebx)
+     521:	0f 87 e3 00 00 00    	ja     60a <runcmd+0xfa>
+     527:	8b 03                	mov    (%ebx),%eax
+     529:	ff 24 85 38 17 00 00 	jmp    *0x1738(,%eax,4)
+    if (ecmd->argv[0] == 0)
+     530:	8b 43 04             	mov    0x4(%ebx),%eax
+     533:	85 c0                	test   %eax,%eax
+     535:	74 29                	je     560 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     537:	8d 53 04             	lea    0x4(%ebx),%edx
+     53a:	51                   	push   %ecx
+     53b:	51                   	push   %ecx
+     53c:	52                   	push   %edx
+     53d:	50                   	push   %eax
+     53e:	e8 b4 0c 00 00       	call   11f7 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     543:	83 c4 0c             	add    $0xc,%esp
+     546:	ff 73 04             	push   0x4(%ebx)
+     549:	68 6a 16 00 00       	push   $0x166a
+     54e:	6a 02                	push   $0x2
+     550:	e8 db 0d 00 00       	call   1330 <printf>
+    break;
+     555:	83 c4 10             	add    $0x10,%esp
+     558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     55f:	90                   	nop
+    exit();
+     560:	e8 5a 0c 00 00       	call   11bf <exit>
+    if (fork1() == 0)
+     565:	e8 86 ff ff ff       	call   4f0 <fork1>
+     56a:	85 c0                	test   %eax,%eax
+     56c:	75 f2                	jne    560 <runcmd+0x50>
+     56e:	e9 8c 00 00 00       	jmp    5ff <runcmd+0xef>
+    if (pipe(p) < 0)
+     573:	83 ec 0c             	sub    $0xc,%esp
+     576:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     579:	50                   	push   %eax
+     57a:	e8 50 0c 00 00       	call   11cf <pipe>
+     57f:	83 c4 10             	add    $0x10,%esp
+     582:	85 c0                	test   %eax,%eax
+     584:	0f 88 a2 00 00 00    	js     62c <runcmd+0x11c>
+    if (fork1() == 0)
+     58a:	e8 61 ff ff ff       	call   4f0 <fork1>
+     58f:	85 c0                	test   %eax,%eax
+     591:	0f 84 a2 00 00 00    	je     639 <runcmd+0x129>
+    if (fork1() == 0)
+     597:	e8 54 ff ff ff       	call   4f0 <fork1>
+     59c:	85 c0                	test   %eax,%eax
+     59e:	0f 84 c3 00 00 00    	je     667 <runcmd+0x157>
+    close(p[0]);
+     5a4:	83 ec 0c             	sub    $0xc,%esp
+     5a7:	ff 75 f0             	push   -0x10(%ebp)
+     5aa:	e8 38 0c 00 00       	call   11e7 <close>
+    close(p[1]);
+     5af:	58                   	pop    %eax
+     5b0:	ff 75 f4             	push   -0xc(%ebp)
+     5b3:	e8 2f 0c 00 00       	call   11e7 <close>
+    wait();
+     5b8:	e8 0a 0c 00 00       	call   11c7 <wait>
+    wait();
+     5bd:	e8 05 0c 00 00       	call   11c7 <wait>
+    break;
+     5c2:	83 c4 10             	add    $0x10,%esp
+     5c5:	eb 99                	jmp    560 <runcmd+0x50>
+    if (fork1() == 0)
+     5c7:	e8 24 ff ff ff       	call   4f0 <fork1>
+     5cc:	85 c0                	test   %eax,%eax
+     5ce:	74 2f                	je     5ff <runcmd+0xef>
+    wait();
+     5d0:	e8 f2 0b 00 00       	call   11c7 <wait>
+    runcmd(lcmd->right);
+     5d5:	83 ec 0c             	sub    $0xc,%esp
+     5d8:	ff 73 08             	push   0x8(%ebx)
+     5db:	e8 30 ff ff ff       	call   510 <runcmd>
+    close(rcmd->fd);
+     5e0:	83 ec 0c             	sub    $0xc,%esp
+     5e3:	ff 73 14             	push   0x14(%ebx)
+     5e6:	e8 fc 0b 00 00       	call   11e7 <close>
+    if (open(rcmd->file, rcmd->mode) < 0)
+     5eb:	58                   	pop    %eax
+     5ec:	5a                   	pop    %edx
+     5ed:	ff 73 10             	push   0x10(%ebx)
+     5f0:	ff 73 08             	push   0x8(%ebx)
+     5f3:	e8 07 0c 00 00       	call   11ff <open>
+     5f8:	83 c4 10             	add    $0x10,%esp
+     5fb:	85 c0                	test   %eax,%eax
+     5fd:	78 18                	js     617 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     5ff:	83 ec 0c             	sub    $0xc,%esp
+     602:	ff 73 04             	push   0x4(%ebx)
+     605:	e8 06 ff ff ff       	call   510 <runcmd>
+    panic("runcmd");
+     60a:	83 ec 0c             	sub    $0xc,%esp
+     60d:	68 63 16 00 00       	push   $0x1663
+     612:	e8 b9 fe ff ff       	call   4d0 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     617:	51                   	push   %ecx
+     618:	ff 73 08             	push   0x8(%ebx)
+     61b:	68 7a 16 00 00       	push   $0x167a
+     620:	6a 02                	push   $0x2
+     622:	e8 09 0d 00 00       	call   1330 <printf>
+      exit();
+     627:	e8 93 0b 00 00       	call   11bf <exit>
+      panic("pipe");
+     62c:	83 ec 0c             	sub    $0xc,%esp
+     62f:	68 8a 16 00 00       	push   $0x168a
+     634:	e8 97 fe ff ff       	call   4d0 <panic>
+      close(1);
+     639:	83 ec 0c             	sub    $0xc,%esp
+     63c:	6a 01                	push   $0x1
+     63e:	e8 a4 0b 00 00       	call   11e7 <close>
+      dup(p[1]);
+     643:	58                   	pop    %eax
+     644:	ff 75 f4             	push   -0xc(%ebp)
+     647:	e8 eb 0b 00 00       	call   1237 <dup>
+      close(p[0]);
+     64c:	58                   	pop    %eax
+     64d:	ff 75 f0             	push   -0x10(%ebp)
+     650:	e8 92 0b 00 00       	call   11e7 <close>
+      close(p[1]);
+     655:	58                   	pop    %eax
+     656:	ff 75 f4             	push   -0xc(%ebp)
+     659:	e8 89 0b 00 00       	call   11e7 <close>
+      runcmd(pcmd->left);
+     65e:	5a                   	pop    %edx
+     65f:	ff 73 04             	push   0x4(%ebx)
+     662:	e8 a9 fe ff ff       	call   510 <runcmd>
+      close(0);
+     667:	83 ec 0c             	sub    $0xc,%esp
+     66a:	6a 00                	push   $0x0
+     66c:	e8 76 0b 00 00       	call   11e7 <close>
+      dup(p[0]);
+     671:	5a                   	pop    %edx
+     672:	ff 75 f0             	push   -0x10(%ebp)
+     675:	e8 bd 0b 00 00       	call   1237 <dup>
+      close(p[0]);
+     67a:	59                   	pop    %ecx
+     67b:	ff 75 f0             	push   -0x10(%ebp)
+     67e:	e8 64 0b 00 00       	call   11e7 <close>
+      close(p[1]);
+     683:	58                   	pop    %eax
+     684:	ff 75 f4             	push   -0xc(%ebp)
+     687:	e8 5b 0b 00 00       	call   11e7 <close>
+      runcmd(pcmd->right);
+     68c:	58                   	pop    %eax
+     68d:	ff 73 08             	push   0x8(%ebx)
+     690:	e8 7b fe ff ff       	call   510 <runcmd>
+     695:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <execcmd>:
+// PAGEBREAK!
+//  Constructors
+
+struct cmd *
+execcmd(void)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	53                   	push   %ebx
+     6a4:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     6a7:	6a 54                	push   $0x54
+     6a9:	e8 c2 0e 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6ae:	83 c4 0c             	add    $0xc,%esp
+     6b1:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     6b3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     6b5:	6a 00                	push   $0x0
+     6b7:	50                   	push   %eax
+     6b8:	e8 33 09 00 00       	call   ff0 <memset>
+  cmd->type = EXEC;
+     6bd:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd *)cmd;
+}
+     6c3:	89 d8                	mov    %ebx,%eax
+     6c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6c8:	c9                   	leave
+     6c9:	c3                   	ret
+     6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006d0 <redircmd>:
+
+struct cmd *
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	53                   	push   %ebx
+     6d4:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     6d7:	6a 18                	push   $0x18
+     6d9:	e8 92 0e 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6de:	83 c4 0c             	add    $0xc,%esp
+     6e1:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     6e3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     6e5:	6a 00                	push   $0x0
+     6e7:	50                   	push   %eax
+     6e8:	e8 03 09 00 00       	call   ff0 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     6ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     6f0:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     6f6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     6f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6fc:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     6ff:	8b 45 10             	mov    0x10(%ebp),%eax
+     702:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     705:	8b 45 14             	mov    0x14(%ebp),%eax
+     708:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     70b:	8b 45 18             	mov    0x18(%ebp),%eax
+     70e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd *)cmd;
+}
+     711:	89 d8                	mov    %ebx,%eax
+     713:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     716:	c9                   	leave
+     717:	c3                   	ret
+     718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71f:	90                   	nop
+
+00000720 <pipecmd>:
+
+struct cmd *
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	53                   	push   %ebx
+     724:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     727:	6a 0c                	push   $0xc
+     729:	e8 42 0e 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     72e:	83 c4 0c             	add    $0xc,%esp
+     731:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     733:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     735:	6a 00                	push   $0x0
+     737:	50                   	push   %eax
+     738:	e8 b3 08 00 00       	call   ff0 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     73d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     740:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     746:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     749:	8b 45 0c             	mov    0xc(%ebp),%eax
+     74c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd *)cmd;
+}
+     74f:	89 d8                	mov    %ebx,%eax
+     751:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     754:	c9                   	leave
+     755:	c3                   	ret
+     756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000760 <listcmd>:
+
+struct cmd *
+listcmd(struct cmd *left, struct cmd *right)
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	53                   	push   %ebx
+     764:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     767:	6a 0c                	push   $0xc
+     769:	e8 02 0e 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     76e:	83 c4 0c             	add    $0xc,%esp
+     771:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     773:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     775:	6a 00                	push   $0x0
+     777:	50                   	push   %eax
+     778:	e8 73 08 00 00       	call   ff0 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     77d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     780:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     786:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     789:	8b 45 0c             	mov    0xc(%ebp),%eax
+     78c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd *)cmd;
+}
+     78f:	89 d8                	mov    %ebx,%eax
+     791:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     794:	c9                   	leave
+     795:	c3                   	ret
+     796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007a0 <backcmd>:
+
+struct cmd *
+backcmd(struct cmd *subcmd)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	53                   	push   %ebx
+     7a4:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     7a7:	6a 08                	push   $0x8
+     7a9:	e8 c2 0d 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7ae:	83 c4 0c             	add    $0xc,%esp
+     7b1:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     7b3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     7b5:	6a 00                	push   $0x0
+     7b7:	50                   	push   %eax
+     7b8:	e8 33 08 00 00       	call   ff0 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     7bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     7c0:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     7c6:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd *)cmd;
+}
+     7c9:	89 d8                	mov    %ebx,%eax
+     7cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7ce:	c9                   	leave
+     7cf:	c3                   	ret
+
+000007d0 <gettoken>:
+
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int gettoken(char **ps, char *es, char **q, char **eq)
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	57                   	push   %edi
+     7d4:	56                   	push   %esi
+     7d5:	53                   	push   %ebx
+     7d6:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     7d9:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     7dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     7df:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     7e2:	8b 38                	mov    (%eax),%edi
+  while (s < es && strchr(whitespace, *s))
+     7e4:	39 df                	cmp    %ebx,%edi
+     7e6:	72 0f                	jb     7f7 <gettoken+0x27>
+     7e8:	eb 25                	jmp    80f <gettoken+0x3f>
+     7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     7f0:	83 c7 01             	add    $0x1,%edi
+  while (s < es && strchr(whitespace, *s))
+     7f3:	39 fb                	cmp    %edi,%ebx
+     7f5:	74 18                	je     80f <gettoken+0x3f>
+     7f7:	0f be 07             	movsbl (%edi),%eax
+     7fa:	83 ec 08             	sub    $0x8,%esp
+     7fd:	50                   	push   %eax
+     7fe:	68 4c 1e 00 00       	push   $0x1e4c
+     803:	e8 08 08 00 00       	call   1010 <strchr>
+     808:	83 c4 10             	add    $0x10,%esp
+     80b:	85 c0                	test   %eax,%eax
+     80d:	75 e1                	jne    7f0 <gettoken+0x20>
+  if (q)
+     80f:	85 f6                	test   %esi,%esi
+     811:	74 02                	je     815 <gettoken+0x45>
+    *q = s;
+     813:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     815:	0f b6 07             	movzbl (%edi),%eax
+  switch (*s)
+     818:	3c 3c                	cmp    $0x3c,%al
+     81a:	0f 8f d0 00 00 00    	jg     8f0 <gettoken+0x120>
+     820:	3c 3a                	cmp    $0x3a,%al
+     822:	0f 8f bc 00 00 00    	jg     8e4 <gettoken+0x114>
+     828:	84 c0                	test   %al,%al
+     82a:	75 44                	jne    870 <gettoken+0xa0>
+     82c:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if (eq)
+     82e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     831:	85 c9                	test   %ecx,%ecx
+     833:	74 05                	je     83a <gettoken+0x6a>
+    *eq = s;
+     835:	8b 45 14             	mov    0x14(%ebp),%eax
+     838:	89 38                	mov    %edi,(%eax)
+
+  while (s < es && strchr(whitespace, *s))
+     83a:	39 df                	cmp    %ebx,%edi
+     83c:	72 09                	jb     847 <gettoken+0x77>
+     83e:	eb 1f                	jmp    85f <gettoken+0x8f>
+    s++;
+     840:	83 c7 01             	add    $0x1,%edi
+  while (s < es && strchr(whitespace, *s))
+     843:	39 fb                	cmp    %edi,%ebx
+     845:	74 18                	je     85f <gettoken+0x8f>
+     847:	0f be 07             	movsbl (%edi),%eax
+     84a:	83 ec 08             	sub    $0x8,%esp
+     84d:	50                   	push   %eax
+     84e:	68 4c 1e 00 00       	push   $0x1e4c
+     853:	e8 b8 07 00 00       	call   1010 <strchr>
+     858:	83 c4 10             	add    $0x10,%esp
+     85b:	85 c0                	test   %eax,%eax
+     85d:	75 e1                	jne    840 <gettoken+0x70>
+  *ps = s;
+     85f:	8b 45 08             	mov    0x8(%ebp),%eax
+     862:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     864:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     867:	89 f0                	mov    %esi,%eax
+     869:	5b                   	pop    %ebx
+     86a:	5e                   	pop    %esi
+     86b:	5f                   	pop    %edi
+     86c:	5d                   	pop    %ebp
+     86d:	c3                   	ret
+     86e:	66 90                	xchg   %ax,%ax
+  switch (*s)
+     870:	79 66                	jns    8d8 <gettoken+0x108>
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     872:	39 df                	cmp    %ebx,%edi
+     874:	72 39                	jb     8af <gettoken+0xdf>
+  if (eq)
+     876:	8b 55 14             	mov    0x14(%ebp),%edx
+     879:	85 d2                	test   %edx,%edx
+     87b:	0f 84 b3 00 00 00    	je     934 <gettoken+0x164>
+    *eq = s;
+     881:	8b 45 14             	mov    0x14(%ebp),%eax
+     884:	89 38                	mov    %edi,(%eax)
+  while (s < es && strchr(whitespace, *s))
+     886:	e9 a9 00 00 00       	jmp    934 <gettoken+0x164>
+     88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     88f:	90                   	nop
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     890:	0f be 07             	movsbl (%edi),%eax
+     893:	83 ec 08             	sub    $0x8,%esp
+     896:	50                   	push   %eax
+     897:	68 44 1e 00 00       	push   $0x1e44
+     89c:	e8 6f 07 00 00       	call   1010 <strchr>
+     8a1:	83 c4 10             	add    $0x10,%esp
+     8a4:	85 c0                	test   %eax,%eax
+     8a6:	75 1f                	jne    8c7 <gettoken+0xf7>
+      s++;
+     8a8:	83 c7 01             	add    $0x1,%edi
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     8ab:	39 fb                	cmp    %edi,%ebx
+     8ad:	74 77                	je     926 <gettoken+0x156>
+     8af:	0f be 07             	movsbl (%edi),%eax
+     8b2:	83 ec 08             	sub    $0x8,%esp
+     8b5:	50                   	push   %eax
+     8b6:	68 4c 1e 00 00       	push   $0x1e4c
+     8bb:	e8 50 07 00 00       	call   1010 <strchr>
+     8c0:	83 c4 10             	add    $0x10,%esp
+     8c3:	85 c0                	test   %eax,%eax
+     8c5:	74 c9                	je     890 <gettoken+0xc0>
+    ret = 'a';
+     8c7:	be 61 00 00 00       	mov    $0x61,%esi
+     8cc:	e9 5d ff ff ff       	jmp    82e <gettoken+0x5e>
+     8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch (*s)
+     8d8:	3c 26                	cmp    $0x26,%al
+     8da:	74 08                	je     8e4 <gettoken+0x114>
+     8dc:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     8df:	80 f9 01             	cmp    $0x1,%cl
+     8e2:	77 8e                	ja     872 <gettoken+0xa2>
+  ret = *s;
+     8e4:	0f be f0             	movsbl %al,%esi
+    s++;
+     8e7:	83 c7 01             	add    $0x1,%edi
+    break;
+     8ea:	e9 3f ff ff ff       	jmp    82e <gettoken+0x5e>
+     8ef:	90                   	nop
+  switch (*s)
+     8f0:	3c 3e                	cmp    $0x3e,%al
+     8f2:	75 1c                	jne    910 <gettoken+0x140>
+    if (*s == '>')
+     8f4:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     8f8:	74 1f                	je     919 <gettoken+0x149>
+    s++;
+     8fa:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     8fd:	be 3e 00 00 00       	mov    $0x3e,%esi
+     902:	e9 27 ff ff ff       	jmp    82e <gettoken+0x5e>
+     907:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     90e:	66 90                	xchg   %ax,%ax
+  switch (*s)
+     910:	3c 7c                	cmp    $0x7c,%al
+     912:	74 d0                	je     8e4 <gettoken+0x114>
+     914:	e9 59 ff ff ff       	jmp    872 <gettoken+0xa2>
+      s++;
+     919:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     91c:	be 2b 00 00 00       	mov    $0x2b,%esi
+     921:	e9 08 ff ff ff       	jmp    82e <gettoken+0x5e>
+  if (eq)
+     926:	8b 45 14             	mov    0x14(%ebp),%eax
+     929:	85 c0                	test   %eax,%eax
+     92b:	74 05                	je     932 <gettoken+0x162>
+    *eq = s;
+     92d:	8b 45 14             	mov    0x14(%ebp),%eax
+     930:	89 18                	mov    %ebx,(%eax)
+      s++;
+     932:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     934:	be 61 00 00 00       	mov    $0x61,%esi
+     939:	e9 21 ff ff ff       	jmp    85f <gettoken+0x8f>
+     93e:	66 90                	xchg   %ax,%ax
+
+00000940 <peek>:
+
+int peek(char **ps, char *es, char *toks)
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	57                   	push   %edi
+     944:	56                   	push   %esi
+     945:	53                   	push   %ebx
+     946:	83 ec 0c             	sub    $0xc,%esp
+     949:	8b 7d 08             	mov    0x8(%ebp),%edi
+     94c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     94f:	8b 1f                	mov    (%edi),%ebx
+  while (s < es && strchr(whitespace, *s))
+     951:	39 f3                	cmp    %esi,%ebx
+     953:	72 12                	jb     967 <peek+0x27>
+     955:	eb 28                	jmp    97f <peek+0x3f>
+     957:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95e:	66 90                	xchg   %ax,%ax
+    s++;
+     960:	83 c3 01             	add    $0x1,%ebx
+  while (s < es && strchr(whitespace, *s))
+     963:	39 de                	cmp    %ebx,%esi
+     965:	74 18                	je     97f <peek+0x3f>
+     967:	0f be 03             	movsbl (%ebx),%eax
+     96a:	83 ec 08             	sub    $0x8,%esp
+     96d:	50                   	push   %eax
+     96e:	68 4c 1e 00 00       	push   $0x1e4c
+     973:	e8 98 06 00 00       	call   1010 <strchr>
+     978:	83 c4 10             	add    $0x10,%esp
+     97b:	85 c0                	test   %eax,%eax
+     97d:	75 e1                	jne    960 <peek+0x20>
+  *ps = s;
+     97f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     981:	0f be 03             	movsbl (%ebx),%eax
+     984:	31 d2                	xor    %edx,%edx
+     986:	84 c0                	test   %al,%al
+     988:	75 0e                	jne    998 <peek+0x58>
+}
+     98a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     98d:	89 d0                	mov    %edx,%eax
+     98f:	5b                   	pop    %ebx
+     990:	5e                   	pop    %esi
+     991:	5f                   	pop    %edi
+     992:	5d                   	pop    %ebp
+     993:	c3                   	ret
+     994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     998:	83 ec 08             	sub    $0x8,%esp
+     99b:	50                   	push   %eax
+     99c:	ff 75 10             	push   0x10(%ebp)
+     99f:	e8 6c 06 00 00       	call   1010 <strchr>
+     9a4:	83 c4 10             	add    $0x10,%esp
+     9a7:	31 d2                	xor    %edx,%edx
+     9a9:	85 c0                	test   %eax,%eax
+     9ab:	0f 95 c2             	setne  %dl
+}
+     9ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9b1:	5b                   	pop    %ebx
+     9b2:	89 d0                	mov    %edx,%eax
+     9b4:	5e                   	pop    %esi
+     9b5:	5f                   	pop    %edi
+     9b6:	5d                   	pop    %ebp
+     9b7:	c3                   	ret
+     9b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bf:	90                   	nop
+
+000009c0 <parseredirs>:
+  return cmd;
+}
+
+struct cmd *
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	57                   	push   %edi
+     9c4:	56                   	push   %esi
+     9c5:	53                   	push   %ebx
+     9c6:	83 ec 2c             	sub    $0x2c,%esp
+     9c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     9cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while (peek(ps, es, "<>"))
+     9cf:	90                   	nop
+     9d0:	83 ec 04             	sub    $0x4,%esp
+     9d3:	68 ac 16 00 00       	push   $0x16ac
+     9d8:	53                   	push   %ebx
+     9d9:	56                   	push   %esi
+     9da:	e8 61 ff ff ff       	call   940 <peek>
+     9df:	83 c4 10             	add    $0x10,%esp
+     9e2:	85 c0                	test   %eax,%eax
+     9e4:	0f 84 f6 00 00 00    	je     ae0 <parseredirs+0x120>
+  {
+    tok = gettoken(ps, es, 0, 0);
+     9ea:	6a 00                	push   $0x0
+     9ec:	6a 00                	push   $0x0
+     9ee:	53                   	push   %ebx
+     9ef:	56                   	push   %esi
+     9f0:	e8 db fd ff ff       	call   7d0 <gettoken>
+     9f5:	89 c7                	mov    %eax,%edi
+    if (gettoken(ps, es, &q, &eq) != 'a')
+     9f7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     9fa:	50                   	push   %eax
+     9fb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     9fe:	50                   	push   %eax
+     9ff:	53                   	push   %ebx
+     a00:	56                   	push   %esi
+     a01:	e8 ca fd ff ff       	call   7d0 <gettoken>
+     a06:	83 c4 20             	add    $0x20,%esp
+     a09:	83 f8 61             	cmp    $0x61,%eax
+     a0c:	0f 85 d9 00 00 00    	jne    aeb <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch (tok)
+     a12:	83 ff 3c             	cmp    $0x3c,%edi
+     a15:	74 69                	je     a80 <parseredirs+0xc0>
+     a17:	83 ff 3e             	cmp    $0x3e,%edi
+     a1a:	74 05                	je     a21 <parseredirs+0x61>
+     a1c:	83 ff 2b             	cmp    $0x2b,%edi
+     a1f:	75 af                	jne    9d0 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY | O_CREATE, 1);
+      break;
+    case '+': // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY | O_CREATE, 1);
+     a21:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     a24:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     a27:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY | O_CREATE, 1);
+     a2a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     a2d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     a30:	6a 18                	push   $0x18
+     a32:	e8 39 0b 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a37:	83 c4 0c             	add    $0xc,%esp
+     a3a:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     a3c:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     a3e:	6a 00                	push   $0x0
+     a40:	50                   	push   %eax
+     a41:	e8 aa 05 00 00       	call   ff0 <memset>
+  cmd->type = REDIR;
+     a46:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     a4f:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     a52:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     a55:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     a58:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     a5b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     a5e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     a65:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     a68:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     a6f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     a72:	e9 59 ff ff ff       	jmp    9d0 <parseredirs+0x10>
+     a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     a80:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     a83:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     a86:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     a89:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     a8c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     a8f:	6a 18                	push   $0x18
+     a91:	e8 da 0a 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a96:	83 c4 0c             	add    $0xc,%esp
+     a99:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     a9b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     a9d:	6a 00                	push   $0x0
+     a9f:	50                   	push   %eax
+     aa0:	e8 4b 05 00 00       	call   ff0 <memset>
+  cmd->cmd = subcmd;
+     aa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     aa8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     aab:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     aae:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     ab1:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     ab7:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     aba:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     abd:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     ac0:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     ac3:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     aca:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     ad1:	e9 fa fe ff ff       	jmp    9d0 <parseredirs+0x10>
+     ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     add:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ae3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ae6:	5b                   	pop    %ebx
+     ae7:	5e                   	pop    %esi
+     ae8:	5f                   	pop    %edi
+     ae9:	5d                   	pop    %ebp
+     aea:	c3                   	ret
+      panic("missing file for redirection");
+     aeb:	83 ec 0c             	sub    $0xc,%esp
+     aee:	68 8f 16 00 00       	push   $0x168f
+     af3:	e8 d8 f9 ff ff       	call   4d0 <panic>
+     af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aff:	90                   	nop
+
+00000b00 <parseexec>:
+  return cmd;
+}
+
+struct cmd *
+parseexec(char **ps, char *es)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	57                   	push   %edi
+     b04:	56                   	push   %esi
+     b05:	53                   	push   %ebx
+     b06:	83 ec 30             	sub    $0x30,%esp
+     b09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b0c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if (peek(ps, es, "("))
+     b0f:	68 af 16 00 00       	push   $0x16af
+     b14:	56                   	push   %esi
+     b15:	53                   	push   %ebx
+     b16:	e8 25 fe ff ff       	call   940 <peek>
+     b1b:	83 c4 10             	add    $0x10,%esp
+     b1e:	85 c0                	test   %eax,%eax
+     b20:	0f 85 aa 00 00 00    	jne    bd0 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     b26:	83 ec 0c             	sub    $0xc,%esp
+     b29:	89 c7                	mov    %eax,%edi
+     b2b:	6a 54                	push   $0x54
+     b2d:	e8 3e 0a 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b32:	83 c4 0c             	add    $0xc,%esp
+     b35:	6a 54                	push   $0x54
+     b37:	6a 00                	push   $0x0
+     b39:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     b3c:	50                   	push   %eax
+     b3d:	e8 ae 04 00 00       	call   ff0 <memset>
+  cmd->type = EXEC;
+     b42:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd *)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     b45:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     b48:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     b4e:	56                   	push   %esi
+     b4f:	53                   	push   %ebx
+     b50:	50                   	push   %eax
+     b51:	e8 6a fe ff ff       	call   9c0 <parseredirs>
+  while (!peek(ps, es, "|)&;"))
+     b56:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     b59:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while (!peek(ps, es, "|)&;"))
+     b5c:	eb 15                	jmp    b73 <parseexec+0x73>
+     b5e:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if (argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     b60:	83 ec 04             	sub    $0x4,%esp
+     b63:	56                   	push   %esi
+     b64:	53                   	push   %ebx
+     b65:	ff 75 d4             	push   -0x2c(%ebp)
+     b68:	e8 53 fe ff ff       	call   9c0 <parseredirs>
+     b6d:	83 c4 10             	add    $0x10,%esp
+     b70:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while (!peek(ps, es, "|)&;"))
+     b73:	83 ec 04             	sub    $0x4,%esp
+     b76:	68 c6 16 00 00       	push   $0x16c6
+     b7b:	56                   	push   %esi
+     b7c:	53                   	push   %ebx
+     b7d:	e8 be fd ff ff       	call   940 <peek>
+     b82:	83 c4 10             	add    $0x10,%esp
+     b85:	85 c0                	test   %eax,%eax
+     b87:	75 5f                	jne    be8 <parseexec+0xe8>
+    if ((tok = gettoken(ps, es, &q, &eq)) == 0)
+     b89:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     b8c:	50                   	push   %eax
+     b8d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     b90:	50                   	push   %eax
+     b91:	56                   	push   %esi
+     b92:	53                   	push   %ebx
+     b93:	e8 38 fc ff ff       	call   7d0 <gettoken>
+     b98:	83 c4 10             	add    $0x10,%esp
+     b9b:	85 c0                	test   %eax,%eax
+     b9d:	74 49                	je     be8 <parseexec+0xe8>
+    if (tok != 'a')
+     b9f:	83 f8 61             	cmp    $0x61,%eax
+     ba2:	75 62                	jne    c06 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     ba4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     ba7:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     baa:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     bae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bb1:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     bb5:	83 c7 01             	add    $0x1,%edi
+    if (argc >= MAXARGS)
+     bb8:	83 ff 0a             	cmp    $0xa,%edi
+     bbb:	75 a3                	jne    b60 <parseexec+0x60>
+      panic("too many args");
+     bbd:	83 ec 0c             	sub    $0xc,%esp
+     bc0:	68 b8 16 00 00       	push   $0x16b8
+     bc5:	e8 06 f9 ff ff       	call   4d0 <panic>
+     bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     bd0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     bd3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bd9:	5b                   	pop    %ebx
+     bda:	5e                   	pop    %esi
+     bdb:	5f                   	pop    %edi
+     bdc:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     bdd:	e9 ae 01 00 00       	jmp    d90 <parseblock>
+     be2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     be8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     beb:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     bf2:	00 
+  cmd->eargv[argc] = 0;
+     bf3:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     bfa:	00 
+}
+     bfb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     bfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c01:	5b                   	pop    %ebx
+     c02:	5e                   	pop    %esi
+     c03:	5f                   	pop    %edi
+     c04:	5d                   	pop    %ebp
+     c05:	c3                   	ret
+      panic("syntax");
+     c06:	83 ec 0c             	sub    $0xc,%esp
+     c09:	68 b1 16 00 00       	push   $0x16b1
+     c0e:	e8 bd f8 ff ff       	call   4d0 <panic>
+     c13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c20 <parsepipe>:
+{
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	57                   	push   %edi
+     c24:	56                   	push   %esi
+     c25:	53                   	push   %ebx
+     c26:	83 ec 14             	sub    $0x14,%esp
+     c29:	8b 75 08             	mov    0x8(%ebp),%esi
+     c2c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     c2f:	57                   	push   %edi
+     c30:	56                   	push   %esi
+     c31:	e8 ca fe ff ff       	call   b00 <parseexec>
+  if (peek(ps, es, "|"))
+     c36:	83 c4 0c             	add    $0xc,%esp
+     c39:	68 cb 16 00 00       	push   $0x16cb
+  cmd = parseexec(ps, es);
+     c3e:	89 c3                	mov    %eax,%ebx
+  if (peek(ps, es, "|"))
+     c40:	57                   	push   %edi
+     c41:	56                   	push   %esi
+     c42:	e8 f9 fc ff ff       	call   940 <peek>
+     c47:	83 c4 10             	add    $0x10,%esp
+     c4a:	85 c0                	test   %eax,%eax
+     c4c:	75 12                	jne    c60 <parsepipe+0x40>
+}
+     c4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c51:	89 d8                	mov    %ebx,%eax
+     c53:	5b                   	pop    %ebx
+     c54:	5e                   	pop    %esi
+     c55:	5f                   	pop    %edi
+     c56:	5d                   	pop    %ebp
+     c57:	c3                   	ret
+     c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     c60:	6a 00                	push   $0x0
+     c62:	6a 00                	push   $0x0
+     c64:	57                   	push   %edi
+     c65:	56                   	push   %esi
+     c66:	e8 65 fb ff ff       	call   7d0 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     c6b:	58                   	pop    %eax
+     c6c:	5a                   	pop    %edx
+     c6d:	57                   	push   %edi
+     c6e:	56                   	push   %esi
+     c6f:	e8 ac ff ff ff       	call   c20 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     c74:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     c7b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     c7d:	e8 ee 08 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     c82:	83 c4 0c             	add    $0xc,%esp
+     c85:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     c87:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     c89:	6a 00                	push   $0x0
+     c8b:	50                   	push   %eax
+     c8c:	e8 5f 03 00 00       	call   ff0 <memset>
+  cmd->left = left;
+     c91:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     c94:	83 c4 10             	add    $0x10,%esp
+     c97:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     c99:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     c9f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     ca1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     ca4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ca7:	5b                   	pop    %ebx
+     ca8:	5e                   	pop    %esi
+     ca9:	5f                   	pop    %edi
+     caa:	5d                   	pop    %ebp
+     cab:	c3                   	ret
+     cac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cb0 <parseline>:
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	57                   	push   %edi
+     cb4:	56                   	push   %esi
+     cb5:	53                   	push   %ebx
+     cb6:	83 ec 24             	sub    $0x24,%esp
+     cb9:	8b 75 08             	mov    0x8(%ebp),%esi
+     cbc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     cbf:	57                   	push   %edi
+     cc0:	56                   	push   %esi
+     cc1:	e8 5a ff ff ff       	call   c20 <parsepipe>
+  while (peek(ps, es, "&"))
+     cc6:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     cc9:	89 c3                	mov    %eax,%ebx
+  while (peek(ps, es, "&"))
+     ccb:	eb 3b                	jmp    d08 <parseline+0x58>
+     ccd:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     cd0:	6a 00                	push   $0x0
+     cd2:	6a 00                	push   $0x0
+     cd4:	57                   	push   %edi
+     cd5:	56                   	push   %esi
+     cd6:	e8 f5 fa ff ff       	call   7d0 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     cdb:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     ce2:	e8 89 08 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     ce7:	83 c4 0c             	add    $0xc,%esp
+     cea:	6a 08                	push   $0x8
+     cec:	6a 00                	push   $0x0
+     cee:	50                   	push   %eax
+     cef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     cf2:	e8 f9 02 00 00       	call   ff0 <memset>
+  cmd->type = BACK;
+     cf7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     cfa:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     cfd:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     d03:	89 5a 04             	mov    %ebx,0x4(%edx)
+     d06:	89 d3                	mov    %edx,%ebx
+  while (peek(ps, es, "&"))
+     d08:	83 ec 04             	sub    $0x4,%esp
+     d0b:	68 cd 16 00 00       	push   $0x16cd
+     d10:	57                   	push   %edi
+     d11:	56                   	push   %esi
+     d12:	e8 29 fc ff ff       	call   940 <peek>
+     d17:	83 c4 10             	add    $0x10,%esp
+     d1a:	85 c0                	test   %eax,%eax
+     d1c:	75 b2                	jne    cd0 <parseline+0x20>
+  if (peek(ps, es, ";"))
+     d1e:	83 ec 04             	sub    $0x4,%esp
+     d21:	68 c9 16 00 00       	push   $0x16c9
+     d26:	57                   	push   %edi
+     d27:	56                   	push   %esi
+     d28:	e8 13 fc ff ff       	call   940 <peek>
+     d2d:	83 c4 10             	add    $0x10,%esp
+     d30:	85 c0                	test   %eax,%eax
+     d32:	75 0c                	jne    d40 <parseline+0x90>
+}
+     d34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d37:	89 d8                	mov    %ebx,%eax
+     d39:	5b                   	pop    %ebx
+     d3a:	5e                   	pop    %esi
+     d3b:	5f                   	pop    %edi
+     d3c:	5d                   	pop    %ebp
+     d3d:	c3                   	ret
+     d3e:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     d40:	6a 00                	push   $0x0
+     d42:	6a 00                	push   $0x0
+     d44:	57                   	push   %edi
+     d45:	56                   	push   %esi
+     d46:	e8 85 fa ff ff       	call   7d0 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     d4b:	58                   	pop    %eax
+     d4c:	5a                   	pop    %edx
+     d4d:	57                   	push   %edi
+     d4e:	56                   	push   %esi
+     d4f:	e8 5c ff ff ff       	call   cb0 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     d54:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     d5b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     d5d:	e8 0e 08 00 00       	call   1570 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     d62:	83 c4 0c             	add    $0xc,%esp
+     d65:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     d67:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     d69:	6a 00                	push   $0x0
+     d6b:	50                   	push   %eax
+     d6c:	e8 7f 02 00 00       	call   ff0 <memset>
+  cmd->left = left;
+     d71:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     d74:	83 c4 10             	add    $0x10,%esp
+     d77:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     d79:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     d7f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     d81:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     d84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d87:	5b                   	pop    %ebx
+     d88:	5e                   	pop    %esi
+     d89:	5f                   	pop    %edi
+     d8a:	5d                   	pop    %ebp
+     d8b:	c3                   	ret
+     d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d90 <parseblock>:
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	57                   	push   %edi
+     d94:	56                   	push   %esi
+     d95:	53                   	push   %ebx
+     d96:	83 ec 10             	sub    $0x10,%esp
+     d99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     d9c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (!peek(ps, es, "("))
+     d9f:	68 af 16 00 00       	push   $0x16af
+     da4:	56                   	push   %esi
+     da5:	53                   	push   %ebx
+     da6:	e8 95 fb ff ff       	call   940 <peek>
+     dab:	83 c4 10             	add    $0x10,%esp
+     dae:	85 c0                	test   %eax,%eax
+     db0:	74 4a                	je     dfc <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     db2:	6a 00                	push   $0x0
+     db4:	6a 00                	push   $0x0
+     db6:	56                   	push   %esi
+     db7:	53                   	push   %ebx
+     db8:	e8 13 fa ff ff       	call   7d0 <gettoken>
+  cmd = parseline(ps, es);
+     dbd:	58                   	pop    %eax
+     dbe:	5a                   	pop    %edx
+     dbf:	56                   	push   %esi
+     dc0:	53                   	push   %ebx
+     dc1:	e8 ea fe ff ff       	call   cb0 <parseline>
+  if (!peek(ps, es, ")"))
+     dc6:	83 c4 0c             	add    $0xc,%esp
+     dc9:	68 eb 16 00 00       	push   $0x16eb
+  cmd = parseline(ps, es);
+     dce:	89 c7                	mov    %eax,%edi
+  if (!peek(ps, es, ")"))
+     dd0:	56                   	push   %esi
+     dd1:	53                   	push   %ebx
+     dd2:	e8 69 fb ff ff       	call   940 <peek>
+     dd7:	83 c4 10             	add    $0x10,%esp
+     dda:	85 c0                	test   %eax,%eax
+     ddc:	74 2b                	je     e09 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     dde:	6a 00                	push   $0x0
+     de0:	6a 00                	push   $0x0
+     de2:	56                   	push   %esi
+     de3:	53                   	push   %ebx
+     de4:	e8 e7 f9 ff ff       	call   7d0 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     de9:	83 c4 0c             	add    $0xc,%esp
+     dec:	56                   	push   %esi
+     ded:	53                   	push   %ebx
+     dee:	57                   	push   %edi
+     def:	e8 cc fb ff ff       	call   9c0 <parseredirs>
+}
+     df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     df7:	5b                   	pop    %ebx
+     df8:	5e                   	pop    %esi
+     df9:	5f                   	pop    %edi
+     dfa:	5d                   	pop    %ebp
+     dfb:	c3                   	ret
+    panic("parseblock");
+     dfc:	83 ec 0c             	sub    $0xc,%esp
+     dff:	68 cf 16 00 00       	push   $0x16cf
+     e04:	e8 c7 f6 ff ff       	call   4d0 <panic>
+    panic("syntax - missing )");
+     e09:	83 ec 0c             	sub    $0xc,%esp
+     e0c:	68 da 16 00 00       	push   $0x16da
+     e11:	e8 ba f6 ff ff       	call   4d0 <panic>
+     e16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e20 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd *
+nulterminate(struct cmd *cmd)
+{
+     e20:	55                   	push   %ebp
+     e21:	89 e5                	mov    %esp,%ebp
+     e23:	53                   	push   %ebx
+     e24:	83 ec 04             	sub    $0x4,%esp
+     e27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if (cmd == 0)
+     e2a:	85 db                	test   %ebx,%ebx
+     e2c:	0f 84 7e 00 00 00    	je     eb0 <nulterminate+0x90>
+    return 0;
+
+  switch (cmd->type)
+     e32:	83 3b 05             	cmpl   $0x5,(%ebx)
+     e35:	77 20                	ja     e57 <nulterminate+0x37>
+     e37:	8b 03                	mov    (%ebx),%eax
+     e39:	ff 24 85 50 17 00 00 	jmp    *0x1750(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd *)cmd;
+    nulterminate(lcmd->left);
+     e40:	83 ec 0c             	sub    $0xc,%esp
+     e43:	ff 73 04             	push   0x4(%ebx)
+     e46:	e8 d5 ff ff ff       	call   e20 <nulterminate>
+    nulterminate(lcmd->right);
+     e4b:	58                   	pop    %eax
+     e4c:	ff 73 08             	push   0x8(%ebx)
+     e4f:	e8 cc ff ff ff       	call   e20 <nulterminate>
+    break;
+     e54:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     e57:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd *)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     e59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e5c:	c9                   	leave
+     e5d:	c3                   	ret
+     e5e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     e60:	83 ec 0c             	sub    $0xc,%esp
+     e63:	ff 73 04             	push   0x4(%ebx)
+     e66:	e8 b5 ff ff ff       	call   e20 <nulterminate>
+    break;
+     e6b:	83 c4 10             	add    $0x10,%esp
+     e6e:	eb e7                	jmp    e57 <nulterminate+0x37>
+    for (i = 0; ecmd->argv[i]; i++)
+     e70:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     e73:	8d 43 08             	lea    0x8(%ebx),%eax
+     e76:	85 c9                	test   %ecx,%ecx
+     e78:	74 dd                	je     e57 <nulterminate+0x37>
+     e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     e80:	8b 50 24             	mov    0x24(%eax),%edx
+    for (i = 0; ecmd->argv[i]; i++)
+     e83:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     e86:	c6 02 00             	movb   $0x0,(%edx)
+    for (i = 0; ecmd->argv[i]; i++)
+     e89:	8b 50 fc             	mov    -0x4(%eax),%edx
+     e8c:	85 d2                	test   %edx,%edx
+     e8e:	75 f0                	jne    e80 <nulterminate+0x60>
+     e90:	eb c5                	jmp    e57 <nulterminate+0x37>
+     e92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     e98:	83 ec 0c             	sub    $0xc,%esp
+     e9b:	ff 73 04             	push   0x4(%ebx)
+     e9e:	e8 7d ff ff ff       	call   e20 <nulterminate>
+    *rcmd->efile = 0;
+     ea3:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     ea6:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     ea9:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     eac:	eb a9                	jmp    e57 <nulterminate+0x37>
+     eae:	66 90                	xchg   %ax,%ax
+    return 0;
+     eb0:	31 c0                	xor    %eax,%eax
+     eb2:	eb a5                	jmp    e59 <nulterminate+0x39>
+     eb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ebf:	90                   	nop
+
+00000ec0 <parsecmd>:
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	57                   	push   %edi
+     ec4:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     ec5:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     ec8:	53                   	push   %ebx
+     ec9:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     ecc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     ecf:	53                   	push   %ebx
+     ed0:	e8 eb 00 00 00       	call   fc0 <strlen>
+  cmd = parseline(&s, es);
+     ed5:	59                   	pop    %ecx
+     ed6:	5e                   	pop    %esi
+  es = s + strlen(s);
+     ed7:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     ed9:	53                   	push   %ebx
+     eda:	57                   	push   %edi
+     edb:	e8 d0 fd ff ff       	call   cb0 <parseline>
+  peek(&s, es, "");
+     ee0:	83 c4 0c             	add    $0xc,%esp
+     ee3:	68 79 16 00 00       	push   $0x1679
+  cmd = parseline(&s, es);
+     ee8:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     eea:	53                   	push   %ebx
+     eeb:	57                   	push   %edi
+     eec:	e8 4f fa ff ff       	call   940 <peek>
+  if (s != es)
+     ef1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ef4:	83 c4 10             	add    $0x10,%esp
+     ef7:	39 d8                	cmp    %ebx,%eax
+     ef9:	75 13                	jne    f0e <parsecmd+0x4e>
+  nulterminate(cmd);
+     efb:	83 ec 0c             	sub    $0xc,%esp
+     efe:	56                   	push   %esi
+     eff:	e8 1c ff ff ff       	call   e20 <nulterminate>
+}
+     f04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f07:	89 f0                	mov    %esi,%eax
+     f09:	5b                   	pop    %ebx
+     f0a:	5e                   	pop    %esi
+     f0b:	5f                   	pop    %edi
+     f0c:	5d                   	pop    %ebp
+     f0d:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     f0e:	52                   	push   %edx
+     f0f:	50                   	push   %eax
+     f10:	68 ed 16 00 00       	push   $0x16ed
+     f15:	6a 02                	push   $0x2
+     f17:	e8 14 04 00 00       	call   1330 <printf>
+    panic("syntax");
+     f1c:	c7 04 24 b1 16 00 00 	movl   $0x16b1,(%esp)
+     f23:	e8 a8 f5 ff ff       	call   4d0 <panic>
+     f28:	66 90                	xchg   %ax,%ax
+     f2a:	66 90                	xchg   %ax,%ax
+     f2c:	66 90                	xchg   %ax,%ax
+     f2e:	66 90                	xchg   %ax,%ax
+
+00000f30 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     f30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     f31:	31 c0                	xor    %eax,%eax
+{
+     f33:	89 e5                	mov    %esp,%ebp
+     f35:	53                   	push   %ebx
+     f36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     f39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     f40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     f44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     f47:	83 c0 01             	add    $0x1,%eax
+     f4a:	84 d2                	test   %dl,%dl
+     f4c:	75 f2                	jne    f40 <strcpy+0x10>
+    ;
+  return os;
+}
+     f4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f51:	89 c8                	mov    %ecx,%eax
+     f53:	c9                   	leave
+     f54:	c3                   	ret
+     f55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f60 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	53                   	push   %ebx
+     f64:	8b 55 08             	mov    0x8(%ebp),%edx
+     f67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     f6a:	0f b6 02             	movzbl (%edx),%eax
+     f6d:	84 c0                	test   %al,%al
+     f6f:	75 17                	jne    f88 <strcmp+0x28>
+     f71:	eb 3a                	jmp    fad <strcmp+0x4d>
+     f73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f77:	90                   	nop
+     f78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     f7c:	83 c2 01             	add    $0x1,%edx
+     f7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     f82:	84 c0                	test   %al,%al
+     f84:	74 1a                	je     fa0 <strcmp+0x40>
+    p++, q++;
+     f86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     f88:	0f b6 19             	movzbl (%ecx),%ebx
+     f8b:	38 c3                	cmp    %al,%bl
+     f8d:	74 e9                	je     f78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     f8f:	29 d8                	sub    %ebx,%eax
+}
+     f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f94:	c9                   	leave
+     f95:	c3                   	ret
+     f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     fa0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     fa4:	31 c0                	xor    %eax,%eax
+     fa6:	29 d8                	sub    %ebx,%eax
+}
+     fa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fab:	c9                   	leave
+     fac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     fad:	0f b6 19             	movzbl (%ecx),%ebx
+     fb0:	31 c0                	xor    %eax,%eax
+     fb2:	eb db                	jmp    f8f <strcmp+0x2f>
+     fb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+
+00000fc0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     fc6:	80 3a 00             	cmpb   $0x0,(%edx)
+     fc9:	74 15                	je     fe0 <strlen+0x20>
+     fcb:	31 c0                	xor    %eax,%eax
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+     fd0:	83 c0 01             	add    $0x1,%eax
+     fd3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     fd7:	89 c1                	mov    %eax,%ecx
+     fd9:	75 f5                	jne    fd0 <strlen+0x10>
+    ;
+  return n;
+}
+     fdb:	89 c8                	mov    %ecx,%eax
+     fdd:	5d                   	pop    %ebp
+     fde:	c3                   	ret
+     fdf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     fe0:	31 c9                	xor    %ecx,%ecx
+}
+     fe2:	5d                   	pop    %ebp
+     fe3:	89 c8                	mov    %ecx,%eax
+     fe5:	c3                   	ret
+     fe6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ff0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     ff7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ffa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ffd:	89 d7                	mov    %edx,%edi
+     fff:	fc                   	cld
+    1000:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1002:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1005:	89 d0                	mov    %edx,%eax
+    1007:	c9                   	leave
+    1008:	c3                   	ret
+    1009:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001010 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	8b 45 08             	mov    0x8(%ebp),%eax
+    1016:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    101a:	0f b6 10             	movzbl (%eax),%edx
+    101d:	84 d2                	test   %dl,%dl
+    101f:	75 12                	jne    1033 <strchr+0x23>
+    1021:	eb 1d                	jmp    1040 <strchr+0x30>
+    1023:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1027:	90                   	nop
+    1028:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    102c:	83 c0 01             	add    $0x1,%eax
+    102f:	84 d2                	test   %dl,%dl
+    1031:	74 0d                	je     1040 <strchr+0x30>
+    if(*s == c)
+    1033:	38 d1                	cmp    %dl,%cl
+    1035:	75 f1                	jne    1028 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1037:	5d                   	pop    %ebp
+    1038:	c3                   	ret
+    1039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1040:	31 c0                	xor    %eax,%eax
+}
+    1042:	5d                   	pop    %ebp
+    1043:	c3                   	ret
+    1044:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    104f:	90                   	nop
+
+00001050 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	57                   	push   %edi
+    1054:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1055:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1058:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1059:	31 db                	xor    %ebx,%ebx
+{
+    105b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    105e:	eb 2b                	jmp    108b <gets+0x3b>
+    cc = read(0, &c, 1);
+    1060:	83 ec 04             	sub    $0x4,%esp
+    1063:	6a 01                	push   $0x1
+    1065:	56                   	push   %esi
+    1066:	6a 00                	push   $0x0
+    1068:	e8 6a 01 00 00       	call   11d7 <read>
+    if(cc < 1)
+    106d:	83 c4 10             	add    $0x10,%esp
+    1070:	85 c0                	test   %eax,%eax
+    1072:	7e 21                	jle    1095 <gets+0x45>
+      break;
+    buf[i++] = c;
+    1074:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1078:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(c == '\n' || c == '\r' || c == '\t')
+    107b:	8d 48 f7             	lea    -0x9(%eax),%ecx
+    buf[i++] = c;
+    107e:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r' || c == '\t')
+    1082:	80 f9 01             	cmp    $0x1,%cl
+    1085:	76 10                	jbe    1097 <gets+0x47>
+    1087:	3c 0d                	cmp    $0xd,%al
+    1089:	74 0c                	je     1097 <gets+0x47>
+  for(i=0; i+1 < max; ){
+    108b:	89 df                	mov    %ebx,%edi
+    108d:	83 c3 01             	add    $0x1,%ebx
+    1090:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    1093:	7c cb                	jl     1060 <gets+0x10>
+    1095:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1097:	8b 45 08             	mov    0x8(%ebp),%eax
+    109a:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    109e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10a1:	5b                   	pop    %ebx
+    10a2:	5e                   	pop    %esi
+    10a3:	5f                   	pop    %edi
+    10a4:	5d                   	pop    %ebp
+    10a5:	c3                   	ret
+    10a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	56                   	push   %esi
+    10b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    10b5:	83 ec 08             	sub    $0x8,%esp
+    10b8:	6a 00                	push   $0x0
+    10ba:	ff 75 08             	push   0x8(%ebp)
+    10bd:	e8 3d 01 00 00       	call   11ff <open>
+  if(fd < 0)
+    10c2:	83 c4 10             	add    $0x10,%esp
+    10c5:	85 c0                	test   %eax,%eax
+    10c7:	78 27                	js     10f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    10c9:	83 ec 08             	sub    $0x8,%esp
+    10cc:	ff 75 0c             	push   0xc(%ebp)
+    10cf:	89 c3                	mov    %eax,%ebx
+    10d1:	50                   	push   %eax
+    10d2:	e8 40 01 00 00       	call   1217 <fstat>
+  close(fd);
+    10d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    10da:	89 c6                	mov    %eax,%esi
+  close(fd);
+    10dc:	e8 06 01 00 00       	call   11e7 <close>
+  return r;
+    10e1:	83 c4 10             	add    $0x10,%esp
+}
+    10e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10e7:	89 f0                	mov    %esi,%eax
+    10e9:	5b                   	pop    %ebx
+    10ea:	5e                   	pop    %esi
+    10eb:	5d                   	pop    %ebp
+    10ec:	c3                   	ret
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    10f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    10f5:	eb ed                	jmp    10e4 <stat+0x34>
+    10f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10fe:	66 90                	xchg   %ax,%ax
+
+00001100 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	53                   	push   %ebx
+    1104:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1107:	0f be 02             	movsbl (%edx),%eax
+    110a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    110d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1110:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1115:	77 1e                	ja     1135 <atoi+0x35>
+    1117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1120:	83 c2 01             	add    $0x1,%edx
+    1123:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1126:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    112a:	0f be 02             	movsbl (%edx),%eax
+    112d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1130:	80 fb 09             	cmp    $0x9,%bl
+    1133:	76 eb                	jbe    1120 <atoi+0x20>
+  return n;
+}
+    1135:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1138:	89 c8                	mov    %ecx,%eax
+    113a:	c9                   	leave
+    113b:	c3                   	ret
+    113c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001140 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	57                   	push   %edi
+    1144:	56                   	push   %esi
+    1145:	8b 45 10             	mov    0x10(%ebp),%eax
+    1148:	8b 55 08             	mov    0x8(%ebp),%edx
+    114b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    114e:	85 c0                	test   %eax,%eax
+    1150:	7e 13                	jle    1165 <memmove+0x25>
+    1152:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1154:	89 d7                	mov    %edx,%edi
+    1156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1160:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1161:	39 f8                	cmp    %edi,%eax
+    1163:	75 fb                	jne    1160 <memmove+0x20>
+  return vdst;
+}
+    1165:	5e                   	pop    %esi
+    1166:	89 d0                	mov    %edx,%eax
+    1168:	5f                   	pop    %edi
+    1169:	5d                   	pop    %ebp
+    116a:	c3                   	ret
+    116b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    116f:	90                   	nop
+
+00001170 <strncmp>:
+
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	53                   	push   %ebx
+    1174:	8b 55 10             	mov    0x10(%ebp),%edx
+    1177:	8b 45 08             	mov    0x8(%ebp),%eax
+    117a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+    117d:	85 d2                	test   %edx,%edx
+    117f:	75 16                	jne    1197 <strncmp+0x27>
+    1181:	eb 2d                	jmp    11b0 <strncmp+0x40>
+    1183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1187:	90                   	nop
+    1188:	3a 19                	cmp    (%ecx),%bl
+    118a:	75 12                	jne    119e <strncmp+0x2e>
+    n--, p++, q++;
+    118c:	83 c0 01             	add    $0x1,%eax
+    118f:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+    1192:	83 ea 01             	sub    $0x1,%edx
+    1195:	74 19                	je     11b0 <strncmp+0x40>
+    1197:	0f b6 18             	movzbl (%eax),%ebx
+    119a:	84 db                	test   %bl,%bl
+    119c:	75 ea                	jne    1188 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+    119e:	0f b6 00             	movzbl (%eax),%eax
+    11a1:	0f b6 11             	movzbl (%ecx),%edx
+    11a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11a7:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+    11a8:	29 d0                	sub    %edx,%eax
+    11aa:	c3                   	ret
+    11ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11af:	90                   	nop
+    11b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+    11b3:	31 c0                	xor    %eax,%eax
+    11b5:	c9                   	leave
+    11b6:	c3                   	ret
+
+000011b7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    11b7:	b8 01 00 00 00       	mov    $0x1,%eax
+    11bc:	cd 40                	int    $0x40
+    11be:	c3                   	ret
+
+000011bf <exit>:
+SYSCALL(exit)
+    11bf:	b8 02 00 00 00       	mov    $0x2,%eax
+    11c4:	cd 40                	int    $0x40
+    11c6:	c3                   	ret
+
+000011c7 <wait>:
+SYSCALL(wait)
+    11c7:	b8 03 00 00 00       	mov    $0x3,%eax
+    11cc:	cd 40                	int    $0x40
+    11ce:	c3                   	ret
+
+000011cf <pipe>:
+SYSCALL(pipe)
+    11cf:	b8 04 00 00 00       	mov    $0x4,%eax
+    11d4:	cd 40                	int    $0x40
+    11d6:	c3                   	ret
+
+000011d7 <read>:
+SYSCALL(read)
+    11d7:	b8 05 00 00 00       	mov    $0x5,%eax
+    11dc:	cd 40                	int    $0x40
+    11de:	c3                   	ret
+
+000011df <write>:
+SYSCALL(write)
+    11df:	b8 10 00 00 00       	mov    $0x10,%eax
+    11e4:	cd 40                	int    $0x40
+    11e6:	c3                   	ret
+
+000011e7 <close>:
+SYSCALL(close)
+    11e7:	b8 15 00 00 00       	mov    $0x15,%eax
+    11ec:	cd 40                	int    $0x40
+    11ee:	c3                   	ret
+
+000011ef <kill>:
+SYSCALL(kill)
+    11ef:	b8 06 00 00 00       	mov    $0x6,%eax
+    11f4:	cd 40                	int    $0x40
+    11f6:	c3                   	ret
+
+000011f7 <exec>:
+SYSCALL(exec)
+    11f7:	b8 07 00 00 00       	mov    $0x7,%eax
+    11fc:	cd 40                	int    $0x40
+    11fe:	c3                   	ret
+
+000011ff <open>:
+SYSCALL(open)
+    11ff:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1204:	cd 40                	int    $0x40
+    1206:	c3                   	ret
+
+00001207 <mknod>:
+SYSCALL(mknod)
+    1207:	b8 11 00 00 00       	mov    $0x11,%eax
+    120c:	cd 40                	int    $0x40
+    120e:	c3                   	ret
+
+0000120f <unlink>:
+SYSCALL(unlink)
+    120f:	b8 12 00 00 00       	mov    $0x12,%eax
+    1214:	cd 40                	int    $0x40
+    1216:	c3                   	ret
+
+00001217 <fstat>:
+SYSCALL(fstat)
+    1217:	b8 08 00 00 00       	mov    $0x8,%eax
+    121c:	cd 40                	int    $0x40
+    121e:	c3                   	ret
+
+0000121f <link>:
+SYSCALL(link)
+    121f:	b8 13 00 00 00       	mov    $0x13,%eax
+    1224:	cd 40                	int    $0x40
+    1226:	c3                   	ret
+
+00001227 <mkdir>:
+SYSCALL(mkdir)
+    1227:	b8 14 00 00 00       	mov    $0x14,%eax
+    122c:	cd 40                	int    $0x40
+    122e:	c3                   	ret
+
+0000122f <chdir>:
+SYSCALL(chdir)
+    122f:	b8 09 00 00 00       	mov    $0x9,%eax
+    1234:	cd 40                	int    $0x40
+    1236:	c3                   	ret
+
+00001237 <dup>:
+SYSCALL(dup)
+    1237:	b8 0a 00 00 00       	mov    $0xa,%eax
+    123c:	cd 40                	int    $0x40
+    123e:	c3                   	ret
+
+0000123f <getpid>:
+SYSCALL(getpid)
+    123f:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1244:	cd 40                	int    $0x40
+    1246:	c3                   	ret
+
+00001247 <sbrk>:
+SYSCALL(sbrk)
+    1247:	b8 0c 00 00 00       	mov    $0xc,%eax
+    124c:	cd 40                	int    $0x40
+    124e:	c3                   	ret
+
+0000124f <sleep>:
+SYSCALL(sleep)
+    124f:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1254:	cd 40                	int    $0x40
+    1256:	c3                   	ret
+
+00001257 <uptime>:
+SYSCALL(uptime)
+    1257:	b8 0e 00 00 00       	mov    $0xe,%eax
+    125c:	cd 40                	int    $0x40
+    125e:	c3                   	ret
+
+0000125f <setsched>:
+SYSCALL(setsched)
+    125f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1264:	cd 40                	int    $0x40
+    1266:	c3                   	ret
+
+00001267 <memstat>:
+SYSCALL(memstat)
+    1267:	b8 17 00 00 00       	mov    $0x17,%eax
+    126c:	cd 40                	int    $0x40
+    126e:	c3                   	ret
+
+0000126f <lseek>:
+SYSCALL(lseek)
+    126f:	b8 18 00 00 00       	mov    $0x18,%eax
+    1274:	cd 40                	int    $0x40
+    1276:	c3                   	ret
+
+00001277 <setiosched>:
+SYSCALL(setiosched)
+    1277:	b8 19 00 00 00       	mov    $0x19,%eax
+    127c:	cd 40                	int    $0x40
+    127e:	c3                   	ret
+
+0000127f <iostat>:
+SYSCALL(iostat)
+    127f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1284:	cd 40                	int    $0x40
+    1286:	c3                   	ret
+    1287:	66 90                	xchg   %ax,%ax
+    1289:	66 90                	xchg   %ax,%ax
+    128b:	66 90                	xchg   %ax,%ax
+    128d:	66 90                	xchg   %ax,%ax
+    128f:	90                   	nop
+
+00001290 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	57                   	push   %edi
+    1294:	56                   	push   %esi
+    1295:	53                   	push   %ebx
+    1296:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1298:	89 d1                	mov    %edx,%ecx
+{
+    129a:	83 ec 3c             	sub    $0x3c,%esp
+    129d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    12a0:	85 d2                	test   %edx,%edx
+    12a2:	0f 89 80 00 00 00    	jns    1328 <printint+0x98>
+    12a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    12ac:	74 7a                	je     1328 <printint+0x98>
+    x = -xx;
+    12ae:	f7 d9                	neg    %ecx
+    neg = 1;
+    12b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    12b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    12b8:	31 f6                	xor    %esi,%esi
+    12ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    12c0:	89 c8                	mov    %ecx,%eax
+    12c2:	31 d2                	xor    %edx,%edx
+    12c4:	89 f7                	mov    %esi,%edi
+    12c6:	f7 f3                	div    %ebx
+    12c8:	8d 76 01             	lea    0x1(%esi),%esi
+    12cb:	0f b6 92 c8 17 00 00 	movzbl 0x17c8(%edx),%edx
+    12d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    12d6:	89 ca                	mov    %ecx,%edx
+    12d8:	89 c1                	mov    %eax,%ecx
+    12da:	39 da                	cmp    %ebx,%edx
+    12dc:	73 e2                	jae    12c0 <printint+0x30>
+  if(neg)
+    12de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    12e1:	85 c0                	test   %eax,%eax
+    12e3:	74 07                	je     12ec <printint+0x5c>
+    buf[i++] = '-';
+    12e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    12ea:	89 f7                	mov    %esi,%edi
+    12ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    12ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    12f2:	01 df                	add    %ebx,%edi
+    12f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    12f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    12fb:	83 ec 04             	sub    $0x4,%esp
+    12fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1301:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1304:	6a 01                	push   $0x1
+    1306:	50                   	push   %eax
+    1307:	56                   	push   %esi
+    1308:	e8 d2 fe ff ff       	call   11df <write>
+  while(--i >= 0)
+    130d:	89 f8                	mov    %edi,%eax
+    130f:	83 c4 10             	add    $0x10,%esp
+    1312:	83 ef 01             	sub    $0x1,%edi
+    1315:	39 d8                	cmp    %ebx,%eax
+    1317:	75 df                	jne    12f8 <printint+0x68>
+}
+    1319:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    131c:	5b                   	pop    %ebx
+    131d:	5e                   	pop    %esi
+    131e:	5f                   	pop    %edi
+    131f:	5d                   	pop    %ebp
+    1320:	c3                   	ret
+    1321:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1328:	31 c0                	xor    %eax,%eax
+    132a:	eb 89                	jmp    12b5 <printint+0x25>
+    132c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001330 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1330:	55                   	push   %ebp
+    1331:	89 e5                	mov    %esp,%ebp
+    1333:	57                   	push   %edi
+    1334:	56                   	push   %esi
+    1335:	53                   	push   %ebx
+    1336:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1339:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    133c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    133f:	0f b6 1e             	movzbl (%esi),%ebx
+    1342:	83 c6 01             	add    $0x1,%esi
+    1345:	84 db                	test   %bl,%bl
+    1347:	74 67                	je     13b0 <printf+0x80>
+    1349:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    134c:	31 d2                	xor    %edx,%edx
+    134e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1351:	eb 34                	jmp    1387 <printf+0x57>
+    1353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1357:	90                   	nop
+    1358:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    135b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1360:	83 f8 25             	cmp    $0x25,%eax
+    1363:	74 18                	je     137d <printf+0x4d>
+  write(fd, &c, 1);
+    1365:	83 ec 04             	sub    $0x4,%esp
+    1368:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    136b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    136e:	6a 01                	push   $0x1
+    1370:	50                   	push   %eax
+    1371:	57                   	push   %edi
+    1372:	e8 68 fe ff ff       	call   11df <write>
+    1377:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    137a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    137d:	0f b6 1e             	movzbl (%esi),%ebx
+    1380:	83 c6 01             	add    $0x1,%esi
+    1383:	84 db                	test   %bl,%bl
+    1385:	74 29                	je     13b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1387:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    138a:	85 d2                	test   %edx,%edx
+    138c:	74 ca                	je     1358 <printf+0x28>
+      }
+    } else if(state == '%'){
+    138e:	83 fa 25             	cmp    $0x25,%edx
+    1391:	75 ea                	jne    137d <printf+0x4d>
+      if(c == 'd'){
+    1393:	83 f8 25             	cmp    $0x25,%eax
+    1396:	0f 84 24 01 00 00    	je     14c0 <printf+0x190>
+    139c:	83 e8 63             	sub    $0x63,%eax
+    139f:	83 f8 15             	cmp    $0x15,%eax
+    13a2:	77 1c                	ja     13c0 <printf+0x90>
+    13a4:	ff 24 85 70 17 00 00 	jmp    *0x1770(,%eax,4)
+    13ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    13b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13b3:	5b                   	pop    %ebx
+    13b4:	5e                   	pop    %esi
+    13b5:	5f                   	pop    %edi
+    13b6:	5d                   	pop    %ebp
+    13b7:	c3                   	ret
+    13b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13bf:	90                   	nop
+  write(fd, &c, 1);
+    13c0:	83 ec 04             	sub    $0x4,%esp
+    13c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    13c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    13ca:	6a 01                	push   $0x1
+    13cc:	52                   	push   %edx
+    13cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    13d0:	57                   	push   %edi
+    13d1:	e8 09 fe ff ff       	call   11df <write>
+    13d6:	83 c4 0c             	add    $0xc,%esp
+    13d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    13dc:	6a 01                	push   $0x1
+    13de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    13e1:	52                   	push   %edx
+    13e2:	57                   	push   %edi
+    13e3:	e8 f7 fd ff ff       	call   11df <write>
+        putc(fd, c);
+    13e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13eb:	31 d2                	xor    %edx,%edx
+    13ed:	eb 8e                	jmp    137d <printf+0x4d>
+    13ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    13f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    13f3:	83 ec 0c             	sub    $0xc,%esp
+    13f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    13fb:	8b 13                	mov    (%ebx),%edx
+    13fd:	6a 00                	push   $0x0
+    13ff:	89 f8                	mov    %edi,%eax
+        ap++;
+    1401:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1404:	e8 87 fe ff ff       	call   1290 <printint>
+        ap++;
+    1409:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    140c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    140f:	31 d2                	xor    %edx,%edx
+    1411:	e9 67 ff ff ff       	jmp    137d <printf+0x4d>
+    1416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1420:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1423:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1425:	83 c0 04             	add    $0x4,%eax
+    1428:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    142b:	85 db                	test   %ebx,%ebx
+    142d:	0f 84 9d 00 00 00    	je     14d0 <printf+0x1a0>
+        while(*s != 0){
+    1433:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1436:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1438:	84 c0                	test   %al,%al
+    143a:	0f 84 3d ff ff ff    	je     137d <printf+0x4d>
+    1440:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1443:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1446:	89 de                	mov    %ebx,%esi
+    1448:	89 d3                	mov    %edx,%ebx
+    144a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1450:	83 ec 04             	sub    $0x4,%esp
+    1453:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1456:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1459:	6a 01                	push   $0x1
+    145b:	53                   	push   %ebx
+    145c:	57                   	push   %edi
+    145d:	e8 7d fd ff ff       	call   11df <write>
+        while(*s != 0){
+    1462:	0f b6 06             	movzbl (%esi),%eax
+    1465:	83 c4 10             	add    $0x10,%esp
+    1468:	84 c0                	test   %al,%al
+    146a:	75 e4                	jne    1450 <printf+0x120>
+      state = 0;
+    146c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    146f:	31 d2                	xor    %edx,%edx
+    1471:	e9 07 ff ff ff       	jmp    137d <printf+0x4d>
+    1476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1480:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1483:	83 ec 0c             	sub    $0xc,%esp
+    1486:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    148b:	8b 13                	mov    (%ebx),%edx
+    148d:	6a 01                	push   $0x1
+    148f:	e9 6b ff ff ff       	jmp    13ff <printf+0xcf>
+    1494:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1498:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    149b:	83 ec 04             	sub    $0x4,%esp
+    149e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    14a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    14a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    14a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    14a9:	6a 01                	push   $0x1
+    14ab:	52                   	push   %edx
+    14ac:	57                   	push   %edi
+    14ad:	e8 2d fd ff ff       	call   11df <write>
+        ap++;
+    14b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    14b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    14b8:	31 d2                	xor    %edx,%edx
+    14ba:	e9 be fe ff ff       	jmp    137d <printf+0x4d>
+    14bf:	90                   	nop
+  write(fd, &c, 1);
+    14c0:	83 ec 04             	sub    $0x4,%esp
+    14c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    14c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    14c9:	6a 01                	push   $0x1
+    14cb:	e9 11 ff ff ff       	jmp    13e1 <printf+0xb1>
+    14d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    14d5:	bb 68 17 00 00       	mov    $0x1768,%ebx
+    14da:	e9 61 ff ff ff       	jmp    1440 <printf+0x110>
+    14df:	90                   	nop
+
+000014e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    14e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14e1:	a1 6c 1f 00 00       	mov    0x1f6c,%eax
+{
+    14e6:	89 e5                	mov    %esp,%ebp
+    14e8:	57                   	push   %edi
+    14e9:	56                   	push   %esi
+    14ea:	53                   	push   %ebx
+    14eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    14ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14fc:	39 ca                	cmp    %ecx,%edx
+    14fe:	73 30                	jae    1530 <free+0x50>
+    1500:	39 c1                	cmp    %eax,%ecx
+    1502:	72 04                	jb     1508 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1504:	39 c2                	cmp    %eax,%edx
+    1506:	72 f0                	jb     14f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1508:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    150b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    150e:	39 f8                	cmp    %edi,%eax
+    1510:	74 2e                	je     1540 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1512:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1515:	8b 42 04             	mov    0x4(%edx),%eax
+    1518:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    151b:	39 f1                	cmp    %esi,%ecx
+    151d:	74 38                	je     1557 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    151f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1521:	5b                   	pop    %ebx
+  freep = p;
+    1522:	89 15 6c 1f 00 00    	mov    %edx,0x1f6c
+}
+    1528:	5e                   	pop    %esi
+    1529:	5f                   	pop    %edi
+    152a:	5d                   	pop    %ebp
+    152b:	c3                   	ret
+    152c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1530:	39 c1                	cmp    %eax,%ecx
+    1532:	72 d0                	jb     1504 <free+0x24>
+    1534:	eb c2                	jmp    14f8 <free+0x18>
+    1536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    153d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1540:	03 70 04             	add    0x4(%eax),%esi
+    1543:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1546:	8b 02                	mov    (%edx),%eax
+    1548:	8b 00                	mov    (%eax),%eax
+    154a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    154d:	8b 42 04             	mov    0x4(%edx),%eax
+    1550:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1553:	39 f1                	cmp    %esi,%ecx
+    1555:	75 c8                	jne    151f <free+0x3f>
+    p->s.size += bp->s.size;
+    1557:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    155a:	89 15 6c 1f 00 00    	mov    %edx,0x1f6c
+    p->s.size += bp->s.size;
+    1560:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1563:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1566:	89 0a                	mov    %ecx,(%edx)
+}
+    1568:	5b                   	pop    %ebx
+    1569:	5e                   	pop    %esi
+    156a:	5f                   	pop    %edi
+    156b:	5d                   	pop    %ebp
+    156c:	c3                   	ret
+    156d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001570 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1570:	55                   	push   %ebp
+    1571:	89 e5                	mov    %esp,%ebp
+    1573:	57                   	push   %edi
+    1574:	56                   	push   %esi
+    1575:	53                   	push   %ebx
+    1576:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1579:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    157c:	8b 15 6c 1f 00 00    	mov    0x1f6c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1582:	8d 78 07             	lea    0x7(%eax),%edi
+    1585:	c1 ef 03             	shr    $0x3,%edi
+    1588:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    158b:	85 d2                	test   %edx,%edx
+    158d:	0f 84 8d 00 00 00    	je     1620 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1593:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1595:	8b 48 04             	mov    0x4(%eax),%ecx
+    1598:	39 f9                	cmp    %edi,%ecx
+    159a:	73 64                	jae    1600 <malloc+0x90>
+  if(nu < 4096)
+    159c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    15a1:	39 df                	cmp    %ebx,%edi
+    15a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    15a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    15ad:	eb 0a                	jmp    15b9 <malloc+0x49>
+    15af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    15b2:	8b 48 04             	mov    0x4(%eax),%ecx
+    15b5:	39 f9                	cmp    %edi,%ecx
+    15b7:	73 47                	jae    1600 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    15b9:	89 c2                	mov    %eax,%edx
+    15bb:	39 05 6c 1f 00 00    	cmp    %eax,0x1f6c
+    15c1:	75 ed                	jne    15b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    15c3:	83 ec 0c             	sub    $0xc,%esp
+    15c6:	56                   	push   %esi
+    15c7:	e8 7b fc ff ff       	call   1247 <sbrk>
+  if(p == (char*)-1)
+    15cc:	83 c4 10             	add    $0x10,%esp
+    15cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15d2:	74 1c                	je     15f0 <malloc+0x80>
+  hp->s.size = nu;
+    15d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    15d7:	83 ec 0c             	sub    $0xc,%esp
+    15da:	83 c0 08             	add    $0x8,%eax
+    15dd:	50                   	push   %eax
+    15de:	e8 fd fe ff ff       	call   14e0 <free>
+  return freep;
+    15e3:	8b 15 6c 1f 00 00    	mov    0x1f6c,%edx
+      if((p = morecore(nunits)) == 0)
+    15e9:	83 c4 10             	add    $0x10,%esp
+    15ec:	85 d2                	test   %edx,%edx
+    15ee:	75 c0                	jne    15b0 <malloc+0x40>
+        return 0;
+  }
+}
+    15f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    15f3:	31 c0                	xor    %eax,%eax
+}
+    15f5:	5b                   	pop    %ebx
+    15f6:	5e                   	pop    %esi
+    15f7:	5f                   	pop    %edi
+    15f8:	5d                   	pop    %ebp
+    15f9:	c3                   	ret
+    15fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1600:	39 cf                	cmp    %ecx,%edi
+    1602:	74 4c                	je     1650 <malloc+0xe0>
+        p->s.size -= nunits;
+    1604:	29 f9                	sub    %edi,%ecx
+    1606:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1609:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    160c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    160f:	89 15 6c 1f 00 00    	mov    %edx,0x1f6c
+}
+    1615:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1618:	83 c0 08             	add    $0x8,%eax
+}
+    161b:	5b                   	pop    %ebx
+    161c:	5e                   	pop    %esi
+    161d:	5f                   	pop    %edi
+    161e:	5d                   	pop    %ebp
+    161f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1620:	c7 05 6c 1f 00 00 70 	movl   $0x1f70,0x1f6c
+    1627:	1f 00 00 
+    base.s.size = 0;
+    162a:	b8 70 1f 00 00       	mov    $0x1f70,%eax
+    base.s.ptr = freep = prevp = &base;
+    162f:	c7 05 70 1f 00 00 70 	movl   $0x1f70,0x1f70
+    1636:	1f 00 00 
+    base.s.size = 0;
+    1639:	c7 05 74 1f 00 00 00 	movl   $0x0,0x1f74
+    1640:	00 00 00 
+    if(p->s.size >= nunits){
+    1643:	e9 54 ff ff ff       	jmp    159c <malloc+0x2c>
+    1648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    164f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1650:	8b 08                	mov    (%eax),%ecx
+    1652:	89 0a                	mov    %ecx,(%edx)
+    1654:	eb b9                	jmp    160f <malloc+0x9f>
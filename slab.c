@@ -0,0 +1,156 @@
+// Slab allocator for fixed-size kernel objects.
+//
+// Each slabcache serves one kind of object.  A slab is one page
+// from kalloc() holding a struct slab header followed by as many
+// objects as fit.  A free object links to the next free object
+// of its slab through a word stored just past the object, so the
+// object's own contents survive being freed (see slab.h).
+//
+// In front of the slabs each CPU has a magazine of free objects,
+// so slaballoc() and slabfree() normally take no lock at all.
+// An empty magazine is refilled with MAGSIZE/2 objects under the
+// cache lock, and a full one gives back MAGSIZE/2.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "slab.h"
+
+struct slab {
+  struct slab *next;         // Next slab on the partial list
+  void *free;                // First free object
+  uint nfree;                // Number of free objects
+};
+
+#define NEXTFREE(c, o) (*(void**)((char*)(o) + (c)->size))
+
+void
+slabinit(struct slabcache *c, char *name, uint size, void (*ctor)(void*))
+{
+  initlock(&c->lock, name);
+  c->name = name;
+  c->size = (size + 3) & ~3;
+  c->stride = c->size + sizeof(void*);
+  c->perslab = (PGSIZE - sizeof(struct slab)) / c->stride;
+  if(c->perslab == 0)
+    panic("slabinit: object too big");
+  c->ctor = ctor;
+  c->partial = 0;
+  c->nslab = 0;
+  c->ninuse = 0;
+  memset(c->mag, 0, sizeof(c->mag));
+}
+
+// Allocate and construct a new slab.  Runs without c->lock
+// so that constructors may take locks of their own.
+static struct slab*
+newslab(struct slabcache *c)
+{
+  struct slab *s;
+  char *o;
+  int i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return 0;
+  memset(s, 0, PGSIZE);
+  s->free = 0;
+  s->nfree = c->perslab;
+  for(i = c->perslab - 1; i >= 0; i--){
+    o = (char*)(s + 1) + i*c->stride;
+    if(c->ctor)
+      c->ctor(o);
+    NEXTFREE(c, o) = s->free;
+    s->free = o;
+  }
+  return s;
+}
+
+// Move up to n free objects from the slabs into m,
+// adding a slab if there are none.
+static void
+refill(struct slabcache *c, struct magazine *m, int n)
+{
+  struct slab *s;
+  void *o;
+
+  acquire(&c->lock);
+  if(c->partial == 0){
+    release(&c->lock);
+    if((s = newslab(c)) == 0)
+      return;
+    acquire(&c->lock);
+    s->next = c->partial;
+    c->partial = s;
+    c->nslab++;
+  }
+  while(n > 0 && (s = c->partial) != 0){
+    o = s->free;
+    s->free = NEXTFREE(c, o);
+    if(--s->nfree == 0)
+      c->partial = s->next;
+    m->obj[m->n++] = o;
+    n--;
+  }
+  release(&c->lock);
+}
+
+// Return n objects from m to their slabs.
+static void
+flush(struct slabcache *c, struct magazine *m, int n)
+{
+  struct slab *s;
+  void *o;
+
+  acquire(&c->lock);
+  while(n-- > 0){
+    o = m->obj[--m->n];
+    s = (struct slab*)PGROUNDDOWN((uint)o);
+    if(s->nfree++ == 0){
+      s->next = c->partial;
+      c->partial = s;
+    }
+    NEXTFREE(c, o) = s->free;
+    s->free = o;
+  }
+  release(&c->lock);
+}
+
+// Allocate an object from c.
+// Returns 0 if memory cannot be allocated.
+void*
+slaballoc(struct slabcache *c)
+{
+  struct magazine *m;
+  void *o;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n == 0)
+    refill(c, m, MAGSIZE/2);
+  o = 0;
+  if(m->n > 0){
+    o = m->obj[--m->n];
+    __sync_fetch_and_add(&c->ninuse, 1);
+  }
+  popcli();
+  return o;
+}
+
+// Return object o to c.
+void
+slabfree(struct slabcache *c, void *o)
+{
+  struct magazine *m;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n == MAGSIZE)
+    flush(c, m, MAGSIZE/2);
+  m->obj[m->n++] = o;
+  __sync_fetch_and_sub(&c->ninuse, 1);
+  popcli();
+}
@@ -0,0 +1,27 @@
+#define MAGSIZE 16  // objects cached per CPU in a slab magazine
+
+// Per-CPU stack of free objects, used without locks
+// while interrupts are off on its CPU.
+struct magazine {
+  int n;
+  void *obj[MAGSIZE];
+};
+
+// Object cache for one kind of kernel object.  Objects are
+// carved out of whole pages (slabs) and never handed back to
+// kalloc(), so a pointer to a freed object still points to an
+// object of the same type: the constructor runs only once,
+// when the slab is created, and its work (initializing locks,
+// say) stays valid across frees.
+struct slabcache {
+  struct spinlock lock;
+  char *name;
+  uint size;                 // Object size in bytes
+  uint stride;               // Object size plus free-list link
+  uint perslab;              // Objects per slab page
+  void (*ctor)(void*);       // Run once per object, or 0
+  struct slab *partial;      // Slabs with free objects
+  uint nslab;                // Slab pages allocated
+  uint ninuse;               // Objects handed out to callers
+  struct magazine mag[NCPU];
+};
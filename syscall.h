@@ -20,3 +20,8 @@
 #define SYS_link   19
 #define SYS_mkdir  20
 #define SYS_close  21
+#define SYS_setsched 22
+#define SYS_memstat 23
+#define SYS_lseek  24
+#define SYS_setiosched 25
+#define SYS_iostat 26
@@ -5,7 +5,10 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
+#include "memstat.h"
+#include "iostat.h"
 
 int
 sys_fork(void)
@@ -89,3 +92,55 @@ sys_uptime(void)
   release(&tickslock);
   return xticks;
 }
+
+// Select the scheduling policy (see sched.h).
+// Return the previous policy.
+int
+sys_setsched(void)
+{
+  int policy;
+
+  if(argint(0, &policy) < 0)
+    return -1;
+  return setsched(policy);
+}
+
+// Select the disk scheduling policy (see iosched.h).
+// Return the previous policy.
+int
+sys_setiosched(void)
+{
+  int policy;
+
+  if(argint(0, &policy) < 0)
+    return -1;
+  return setiosched(policy);
+}
+
+// Copy physical memory allocator statistics to user space.
+// They are gathered into a kernel copy first, since touching
+// user memory may fault and allocate while kmem.lock is held.
+int
+sys_memstat(void)
+{
+  struct memstat *ust, st;
+
+  if(argptr(0, (void*)&ust, sizeof(*ust)) < 0)
+    return -1;
+  kmemstat(&st);
+  memmove(ust, &st, sizeof(st));
+  return 0;
+}
+
+// Copy I/O statistics to user space.
+int
+sys_iostat(void)
+{
+  struct iostat *ust, st;
+
+  if(argptr(0, (void*)&ust, sizeof(*ust)) < 0)
+    return -1;
+  iostat(&st);
+  memmove(ust, &st, sizeof(st));
+  return 0;
+}
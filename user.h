@@ -1,5 +1,7 @@
 struct stat;
 struct rtcdate;
+struct memstat;
+struct iostat;
 
 // system calls
 int fork(void);
@@ -23,6 +25,11 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int setsched(int);
+int memstat(struct memstat*);
+int lseek(int, int, int);
+int setiosched(int);
+int iostat(struct iostat*);
 
 // ulib.c
 int stat(const char*, struct stat*);
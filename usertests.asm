@@ -0,0 +1,7193 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 11 55 00 00       	push   $0x5511
+      16:	6a 01                	push   $0x1
+      18:	e8 13 40 00 00       	call   4030 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 25 55 00 00       	push   $0x5525
+      26:	e8 d4 3e 00 00       	call   3eff <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 b4 5c 00 00       	push   $0x5cb4
+      39:	6a 01                	push   $0x1
+      3b:	e8 f0 3f 00 00       	call   4030 <printf>
+    exit();
+      40:	e8 7a 3e 00 00       	call   3ebf <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 25 55 00 00       	push   $0x5525
+      51:	e8 a9 3e 00 00       	call   3eff <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 89 3e 00 00       	call   3ee7 <close>
+
+  argptest();
+      5e:	e8 3d 3b 00 00       	call   3ba0 <argptest>
+  createdelete();
+      63:	e8 c8 11 00 00       	call   1230 <createdelete>
+  linkunlink();
+      68:	e8 63 1a 00 00       	call   1ad0 <linkunlink>
+  concreate();
+      6d:	e8 5e 17 00 00       	call   17d0 <concreate>
+  fourfiles();
+      72:	e8 b9 0f 00 00       	call   1030 <fourfiles>
+  sharedfd();
+      77:	e8 f4 0d 00 00       	call   e70 <sharedfd>
+
+  bigargtest();
+      7c:	e8 df 37 00 00       	call   3860 <bigargtest>
+  bigwrite();
+      81:	e8 1a 26 00 00       	call   26a0 <bigwrite>
+  bigargtest();
+      86:	e8 d5 37 00 00       	call   3860 <bigargtest>
+  bsstest();
+      8b:	e8 60 37 00 00       	call   37f0 <bsstest>
+  sbrktest();
+      90:	e8 5b 32 00 00       	call   32f0 <sbrktest>
+  lazytest();
+      95:	e8 26 31 00 00       	call   31c0 <lazytest>
+  cowtest();
+      9a:	e8 41 2f 00 00       	call   2fe0 <cowtest>
+  validatetest();
+      9f:	e8 9c 36 00 00       	call   3740 <validatetest>
+
+  opentest();
+      a4:	e8 67 03 00 00       	call   410 <opentest>
+  writetest();
+      a9:	e8 f2 03 00 00       	call   4a0 <writetest>
+  writetest1();
+      ae:	e8 cd 05 00 00       	call   680 <writetest1>
+  createtest();
+      b3:	e8 88 07 00 00       	call   840 <createtest>
+
+  openiputtest();
+      b8:	e8 53 02 00 00       	call   310 <openiputtest>
+  exitiputtest();
+      bd:	e8 4e 01 00 00       	call   210 <exitiputtest>
+  iputtest();
+      c2:	e8 69 00 00 00       	call   130 <iputtest>
+
+  mem();
+      c7:	e8 d4 0c 00 00       	call   da0 <mem>
+  pipe1();
+      cc:	e8 4f 09 00 00       	call   a20 <pipe1>
+  preempt();
+      d1:	e8 ea 0a 00 00       	call   bc0 <preempt>
+  exitwait();
+      d6:	e8 45 0c 00 00       	call   d20 <exitwait>
+
+  rmdot();
+      db:	e8 b0 29 00 00       	call   2a90 <rmdot>
+  fourteen();
+      e0:	e8 6b 28 00 00       	call   2950 <fourteen>
+  bigfile();
+      e5:	e8 96 26 00 00       	call   2780 <bigfile>
+  subdir();
+      ea:	e8 d1 1e 00 00       	call   1fc0 <subdir>
+  linktest();
+      ef:	e8 cc 14 00 00       	call   15c0 <linktest>
+  unlinkread();
+      f4:	e8 37 13 00 00       	call   1430 <unlinkread>
+  dirfile();
+      f9:	e8 12 2b 00 00       	call   2c10 <dirfile>
+  iref();
+      fe:	e8 0d 2d 00 00       	call   2e10 <iref>
+  forktest();
+     103:	e8 28 2e 00 00       	call   2f30 <forktest>
+  bigdir(); // slow
+     108:	e8 d3 1a 00 00       	call   1be0 <bigdir>
+  indexdir();
+     10d:	e8 fe 1b 00 00       	call   1d10 <indexdir>
+
+  uio();
+     112:	e8 19 3a 00 00       	call   3b30 <uio>
+
+  exectest();
+     117:	e8 b4 08 00 00       	call   9d0 <exectest>
+
+  exit();
+     11c:	e8 9e 3d 00 00       	call   3ebf <exit>
+     121:	66 90                	xchg   %ax,%ax
+     123:	66 90                	xchg   %ax,%ax
+     125:	66 90                	xchg   %ax,%ax
+     127:	66 90                	xchg   %ax,%ax
+     129:	66 90                	xchg   %ax,%ax
+     12b:	66 90                	xchg   %ax,%ax
+     12d:	66 90                	xchg   %ax,%ax
+     12f:	90                   	nop
+
+00000130 <iputtest>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     136:	68 de 43 00 00       	push   $0x43de
+     13b:	ff 35 dc 66 00 00    	push   0x66dc
+     141:	e8 ea 3e 00 00       	call   4030 <printf>
+  if(mkdir("iputdir") < 0){
+     146:	c7 04 24 71 43 00 00 	movl   $0x4371,(%esp)
+     14d:	e8 d5 3d 00 00       	call   3f27 <mkdir>
+     152:	83 c4 10             	add    $0x10,%esp
+     155:	85 c0                	test   %eax,%eax
+     157:	78 58                	js     1b1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	68 71 43 00 00       	push   $0x4371
+     161:	e8 c9 3d 00 00       	call   3f2f <chdir>
+     166:	83 c4 10             	add    $0x10,%esp
+     169:	85 c0                	test   %eax,%eax
+     16b:	0f 88 85 00 00 00    	js     1f6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     171:	83 ec 0c             	sub    $0xc,%esp
+     174:	68 6e 43 00 00       	push   $0x436e
+     179:	e8 91 3d 00 00       	call   3f0f <unlink>
+     17e:	83 c4 10             	add    $0x10,%esp
+     181:	85 c0                	test   %eax,%eax
+     183:	78 5a                	js     1df <iputtest+0xaf>
+  if(chdir("/") < 0){
+     185:	83 ec 0c             	sub    $0xc,%esp
+     188:	68 93 43 00 00       	push   $0x4393
+     18d:	e8 9d 3d 00 00       	call   3f2f <chdir>
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	78 2f                	js     1c8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     199:	83 ec 08             	sub    $0x8,%esp
+     19c:	68 07 44 00 00       	push   $0x4407
+     1a1:	ff 35 dc 66 00 00    	push   0x66dc
+     1a7:	e8 84 3e 00 00       	call   4030 <printf>
+}
+     1ac:	83 c4 10             	add    $0x10,%esp
+     1af:	c9                   	leave
+     1b0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1b1:	50                   	push   %eax
+     1b2:	50                   	push   %eax
+     1b3:	68 a1 4a 00 00       	push   $0x4aa1
+     1b8:	ff 35 dc 66 00 00    	push   0x66dc
+     1be:	e8 6d 3e 00 00       	call   4030 <printf>
+    exit();
+     1c3:	e8 f7 3c 00 00       	call   3ebf <exit>
+    printf(stdout, "chdir / failed\n");
+     1c8:	50                   	push   %eax
+     1c9:	50                   	push   %eax
+     1ca:	68 95 43 00 00       	push   $0x4395
+     1cf:	ff 35 dc 66 00 00    	push   0x66dc
+     1d5:	e8 56 3e 00 00       	call   4030 <printf>
+    exit();
+     1da:	e8 e0 3c 00 00       	call   3ebf <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1df:	52                   	push   %edx
+     1e0:	52                   	push   %edx
+     1e1:	68 79 43 00 00       	push   $0x4379
+     1e6:	ff 35 dc 66 00 00    	push   0x66dc
+     1ec:	e8 3f 3e 00 00       	call   4030 <printf>
+    exit();
+     1f1:	e8 c9 3c 00 00       	call   3ebf <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1f6:	51                   	push   %ecx
+     1f7:	51                   	push   %ecx
+     1f8:	68 58 43 00 00       	push   $0x4358
+     1fd:	ff 35 dc 66 00 00    	push   0x66dc
+     203:	e8 28 3e 00 00       	call   4030 <printf>
+    exit();
+     208:	e8 b2 3c 00 00       	call   3ebf <exit>
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <exitiputtest>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     216:	68 a5 43 00 00       	push   $0x43a5
+     21b:	ff 35 dc 66 00 00    	push   0x66dc
+     221:	e8 0a 3e 00 00       	call   4030 <printf>
+  pid = fork();
+     226:	e8 8c 3c 00 00       	call   3eb7 <fork>
+  if(pid < 0){
+     22b:	83 c4 10             	add    $0x10,%esp
+     22e:	85 c0                	test   %eax,%eax
+     230:	0f 88 8a 00 00 00    	js     2c0 <exitiputtest+0xb0>
+  if(pid == 0){
+     236:	75 50                	jne    288 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     238:	83 ec 0c             	sub    $0xc,%esp
+     23b:	68 71 43 00 00       	push   $0x4371
+     240:	e8 e2 3c 00 00       	call   3f27 <mkdir>
+     245:	83 c4 10             	add    $0x10,%esp
+     248:	85 c0                	test   %eax,%eax
+     24a:	0f 88 87 00 00 00    	js     2d7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     250:	83 ec 0c             	sub    $0xc,%esp
+     253:	68 71 43 00 00       	push   $0x4371
+     258:	e8 d2 3c 00 00       	call   3f2f <chdir>
+     25d:	83 c4 10             	add    $0x10,%esp
+     260:	85 c0                	test   %eax,%eax
+     262:	0f 88 86 00 00 00    	js     2ee <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     268:	83 ec 0c             	sub    $0xc,%esp
+     26b:	68 6e 43 00 00       	push   $0x436e
+     270:	e8 9a 3c 00 00       	call   3f0f <unlink>
+     275:	83 c4 10             	add    $0x10,%esp
+     278:	85 c0                	test   %eax,%eax
+     27a:	78 2c                	js     2a8 <exitiputtest+0x98>
+    exit();
+     27c:	e8 3e 3c 00 00       	call   3ebf <exit>
+     281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     288:	e8 3a 3c 00 00       	call   3ec7 <wait>
+  printf(stdout, "exitiput test ok\n");
+     28d:	83 ec 08             	sub    $0x8,%esp
+     290:	68 c8 43 00 00       	push   $0x43c8
+     295:	ff 35 dc 66 00 00    	push   0x66dc
+     29b:	e8 90 3d 00 00       	call   4030 <printf>
+}
+     2a0:	83 c4 10             	add    $0x10,%esp
+     2a3:	c9                   	leave
+     2a4:	c3                   	ret
+     2a5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2a8:	83 ec 08             	sub    $0x8,%esp
+     2ab:	68 79 43 00 00       	push   $0x4379
+     2b0:	ff 35 dc 66 00 00    	push   0x66dc
+     2b6:	e8 75 3d 00 00       	call   4030 <printf>
+      exit();
+     2bb:	e8 ff 3b 00 00       	call   3ebf <exit>
+    printf(stdout, "fork failed\n");
+     2c0:	51                   	push   %ecx
+     2c1:	51                   	push   %ecx
+     2c2:	68 64 54 00 00       	push   $0x5464
+     2c7:	ff 35 dc 66 00 00    	push   0x66dc
+     2cd:	e8 5e 3d 00 00       	call   4030 <printf>
+    exit();
+     2d2:	e8 e8 3b 00 00       	call   3ebf <exit>
+      printf(stdout, "mkdir failed\n");
+     2d7:	52                   	push   %edx
+     2d8:	52                   	push   %edx
+     2d9:	68 a1 4a 00 00       	push   $0x4aa1
+     2de:	ff 35 dc 66 00 00    	push   0x66dc
+     2e4:	e8 47 3d 00 00       	call   4030 <printf>
+      exit();
+     2e9:	e8 d1 3b 00 00       	call   3ebf <exit>
+      printf(stdout, "child chdir failed\n");
+     2ee:	50                   	push   %eax
+     2ef:	50                   	push   %eax
+     2f0:	68 b4 43 00 00       	push   $0x43b4
+     2f5:	ff 35 dc 66 00 00    	push   0x66dc
+     2fb:	e8 30 3d 00 00       	call   4030 <printf>
+      exit();
+     300:	e8 ba 3b 00 00       	call   3ebf <exit>
+     305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <openiputtest>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     316:	68 da 43 00 00       	push   $0x43da
+     31b:	ff 35 dc 66 00 00    	push   0x66dc
+     321:	e8 0a 3d 00 00       	call   4030 <printf>
+  if(mkdir("oidir") < 0){
+     326:	c7 04 24 e9 43 00 00 	movl   $0x43e9,(%esp)
+     32d:	e8 f5 3b 00 00       	call   3f27 <mkdir>
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	0f 88 9f 00 00 00    	js     3dc <openiputtest+0xcc>
+  pid = fork();
+     33d:	e8 75 3b 00 00       	call   3eb7 <fork>
+  if(pid < 0){
+     342:	85 c0                	test   %eax,%eax
+     344:	78 7f                	js     3c5 <openiputtest+0xb5>
+  if(pid == 0){
+     346:	75 38                	jne    380 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     348:	83 ec 08             	sub    $0x8,%esp
+     34b:	6a 02                	push   $0x2
+     34d:	68 e9 43 00 00       	push   $0x43e9
+     352:	e8 a8 3b 00 00       	call   3eff <open>
+    if(fd >= 0){
+     357:	83 c4 10             	add    $0x10,%esp
+     35a:	85 c0                	test   %eax,%eax
+     35c:	78 62                	js     3c0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     35e:	83 ec 08             	sub    $0x8,%esp
+     361:	68 44 55 00 00       	push   $0x5544
+     366:	ff 35 dc 66 00 00    	push   0x66dc
+     36c:	e8 bf 3c 00 00       	call   4030 <printf>
+      exit();
+     371:	e8 49 3b 00 00       	call   3ebf <exit>
+     376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     380:	83 ec 0c             	sub    $0xc,%esp
+     383:	6a 01                	push   $0x1
+     385:	e8 c5 3b 00 00       	call   3f4f <sleep>
+  if(unlink("oidir") != 0){
+     38a:	c7 04 24 e9 43 00 00 	movl   $0x43e9,(%esp)
+     391:	e8 79 3b 00 00       	call   3f0f <unlink>
+     396:	83 c4 10             	add    $0x10,%esp
+     399:	85 c0                	test   %eax,%eax
+     39b:	75 56                	jne    3f3 <openiputtest+0xe3>
+  wait();
+     39d:	e8 25 3b 00 00       	call   3ec7 <wait>
+  printf(stdout, "openiput test ok\n");
+     3a2:	83 ec 08             	sub    $0x8,%esp
+     3a5:	68 03 44 00 00       	push   $0x4403
+     3aa:	ff 35 dc 66 00 00    	push   0x66dc
+     3b0:	e8 7b 3c 00 00       	call   4030 <printf>
+}
+     3b5:	83 c4 10             	add    $0x10,%esp
+     3b8:	c9                   	leave
+     3b9:	c3                   	ret
+     3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3c0:	e8 fa 3a 00 00       	call   3ebf <exit>
+    printf(stdout, "fork failed\n");
+     3c5:	52                   	push   %edx
+     3c6:	52                   	push   %edx
+     3c7:	68 64 54 00 00       	push   $0x5464
+     3cc:	ff 35 dc 66 00 00    	push   0x66dc
+     3d2:	e8 59 3c 00 00       	call   4030 <printf>
+    exit();
+     3d7:	e8 e3 3a 00 00       	call   3ebf <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3dc:	51                   	push   %ecx
+     3dd:	51                   	push   %ecx
+     3de:	68 ef 43 00 00       	push   $0x43ef
+     3e3:	ff 35 dc 66 00 00    	push   0x66dc
+     3e9:	e8 42 3c 00 00       	call   4030 <printf>
+    exit();
+     3ee:	e8 cc 3a 00 00       	call   3ebf <exit>
+    printf(stdout, "unlink failed\n");
+     3f3:	50                   	push   %eax
+     3f4:	50                   	push   %eax
+     3f5:	68 39 4b 00 00       	push   $0x4b39
+     3fa:	ff 35 dc 66 00 00    	push   0x66dc
+     400:	e8 2b 3c 00 00       	call   4030 <printf>
+    exit();
+     405:	e8 b5 3a 00 00       	call   3ebf <exit>
+     40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000410 <opentest>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     416:	68 15 44 00 00       	push   $0x4415
+     41b:	ff 35 dc 66 00 00    	push   0x66dc
+     421:	e8 0a 3c 00 00       	call   4030 <printf>
+  fd = open("echo", 0);
+     426:	58                   	pop    %eax
+     427:	5a                   	pop    %edx
+     428:	6a 00                	push   $0x0
+     42a:	68 20 44 00 00       	push   $0x4420
+     42f:	e8 cb 3a 00 00       	call   3eff <open>
+  if(fd < 0){
+     434:	83 c4 10             	add    $0x10,%esp
+     437:	85 c0                	test   %eax,%eax
+     439:	78 36                	js     471 <opentest+0x61>
+  close(fd);
+     43b:	83 ec 0c             	sub    $0xc,%esp
+     43e:	50                   	push   %eax
+     43f:	e8 a3 3a 00 00       	call   3ee7 <close>
+  fd = open("doesnotexist", 0);
+     444:	5a                   	pop    %edx
+     445:	59                   	pop    %ecx
+     446:	6a 00                	push   $0x0
+     448:	68 38 44 00 00       	push   $0x4438
+     44d:	e8 ad 3a 00 00       	call   3eff <open>
+  if(fd >= 0){
+     452:	83 c4 10             	add    $0x10,%esp
+     455:	85 c0                	test   %eax,%eax
+     457:	79 2f                	jns    488 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     459:	83 ec 08             	sub    $0x8,%esp
+     45c:	68 63 44 00 00       	push   $0x4463
+     461:	ff 35 dc 66 00 00    	push   0x66dc
+     467:	e8 c4 3b 00 00       	call   4030 <printf>
+}
+     46c:	83 c4 10             	add    $0x10,%esp
+     46f:	c9                   	leave
+     470:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     471:	50                   	push   %eax
+     472:	50                   	push   %eax
+     473:	68 25 44 00 00       	push   $0x4425
+     478:	ff 35 dc 66 00 00    	push   0x66dc
+     47e:	e8 ad 3b 00 00       	call   4030 <printf>
+    exit();
+     483:	e8 37 3a 00 00       	call   3ebf <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     488:	50                   	push   %eax
+     489:	50                   	push   %eax
+     48a:	68 45 44 00 00       	push   $0x4445
+     48f:	ff 35 dc 66 00 00    	push   0x66dc
+     495:	e8 96 3b 00 00       	call   4030 <printf>
+    exit();
+     49a:	e8 20 3a 00 00       	call   3ebf <exit>
+     49f:	90                   	nop
+
+000004a0 <writetest>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	56                   	push   %esi
+     4a4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4a5:	83 ec 08             	sub    $0x8,%esp
+     4a8:	68 71 44 00 00       	push   $0x4471
+     4ad:	ff 35 dc 66 00 00    	push   0x66dc
+     4b3:	e8 78 3b 00 00       	call   4030 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4b8:	58                   	pop    %eax
+     4b9:	5a                   	pop    %edx
+     4ba:	68 02 02 00 00       	push   $0x202
+     4bf:	68 82 44 00 00       	push   $0x4482
+     4c4:	e8 36 3a 00 00       	call   3eff <open>
+  if(fd >= 0){
+     4c9:	83 c4 10             	add    $0x10,%esp
+     4cc:	85 c0                	test   %eax,%eax
+     4ce:	0f 88 88 01 00 00    	js     65c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4d4:	83 ec 08             	sub    $0x8,%esp
+     4d7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4d9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4db:	68 88 44 00 00       	push   $0x4488
+     4e0:	ff 35 dc 66 00 00    	push   0x66dc
+     4e6:	e8 45 3b 00 00       	call   4030 <printf>
+     4eb:	83 c4 10             	add    $0x10,%esp
+     4ee:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4f0:	83 ec 04             	sub    $0x4,%esp
+     4f3:	6a 0a                	push   $0xa
+     4f5:	68 bf 44 00 00       	push   $0x44bf
+     4fa:	56                   	push   %esi
+     4fb:	e8 df 39 00 00       	call   3edf <write>
+     500:	83 c4 10             	add    $0x10,%esp
+     503:	83 f8 0a             	cmp    $0xa,%eax
+     506:	0f 85 d9 00 00 00    	jne    5e5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     50c:	83 ec 04             	sub    $0x4,%esp
+     50f:	6a 0a                	push   $0xa
+     511:	68 ca 44 00 00       	push   $0x44ca
+     516:	56                   	push   %esi
+     517:	e8 c3 39 00 00       	call   3edf <write>
+     51c:	83 c4 10             	add    $0x10,%esp
+     51f:	83 f8 0a             	cmp    $0xa,%eax
+     522:	0f 85 d6 00 00 00    	jne    5fe <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     528:	83 c3 01             	add    $0x1,%ebx
+     52b:	83 fb 64             	cmp    $0x64,%ebx
+     52e:	75 c0                	jne    4f0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     530:	83 ec 08             	sub    $0x8,%esp
+     533:	68 d5 44 00 00       	push   $0x44d5
+     538:	ff 35 dc 66 00 00    	push   0x66dc
+     53e:	e8 ed 3a 00 00       	call   4030 <printf>
+  close(fd);
+     543:	89 34 24             	mov    %esi,(%esp)
+     546:	e8 9c 39 00 00       	call   3ee7 <close>
+  fd = open("small", O_RDONLY);
+     54b:	5b                   	pop    %ebx
+     54c:	5e                   	pop    %esi
+     54d:	6a 00                	push   $0x0
+     54f:	68 82 44 00 00       	push   $0x4482
+     554:	e8 a6 39 00 00       	call   3eff <open>
+  if(fd >= 0){
+     559:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     55c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     55e:	85 c0                	test   %eax,%eax
+     560:	0f 88 b1 00 00 00    	js     617 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     566:	83 ec 08             	sub    $0x8,%esp
+     569:	68 e0 44 00 00       	push   $0x44e0
+     56e:	ff 35 dc 66 00 00    	push   0x66dc
+     574:	e8 b7 3a 00 00       	call   4030 <printf>
+  i = read(fd, buf, 2000);
+     579:	83 c4 0c             	add    $0xc,%esp
+     57c:	68 d0 07 00 00       	push   $0x7d0
+     581:	68 20 8e 00 00       	push   $0x8e20
+     586:	53                   	push   %ebx
+     587:	e8 4b 39 00 00       	call   3ed7 <read>
+  if(i == 2000){
+     58c:	83 c4 10             	add    $0x10,%esp
+     58f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     594:	0f 85 94 00 00 00    	jne    62e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     59a:	83 ec 08             	sub    $0x8,%esp
+     59d:	68 14 45 00 00       	push   $0x4514
+     5a2:	ff 35 dc 66 00 00    	push   0x66dc
+     5a8:	e8 83 3a 00 00       	call   4030 <printf>
+  close(fd);
+     5ad:	89 1c 24             	mov    %ebx,(%esp)
+     5b0:	e8 32 39 00 00       	call   3ee7 <close>
+  if(unlink("small") < 0){
+     5b5:	c7 04 24 82 44 00 00 	movl   $0x4482,(%esp)
+     5bc:	e8 4e 39 00 00       	call   3f0f <unlink>
+     5c1:	83 c4 10             	add    $0x10,%esp
+     5c4:	85 c0                	test   %eax,%eax
+     5c6:	78 7d                	js     645 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5c8:	83 ec 08             	sub    $0x8,%esp
+     5cb:	68 3c 45 00 00       	push   $0x453c
+     5d0:	ff 35 dc 66 00 00    	push   0x66dc
+     5d6:	e8 55 3a 00 00       	call   4030 <printf>
+}
+     5db:	83 c4 10             	add    $0x10,%esp
+     5de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5e1:	5b                   	pop    %ebx
+     5e2:	5e                   	pop    %esi
+     5e3:	5d                   	pop    %ebp
+     5e4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5e5:	83 ec 04             	sub    $0x4,%esp
+     5e8:	53                   	push   %ebx
+     5e9:	68 68 55 00 00       	push   $0x5568
+     5ee:	ff 35 dc 66 00 00    	push   0x66dc
+     5f4:	e8 37 3a 00 00       	call   4030 <printf>
+      exit();
+     5f9:	e8 c1 38 00 00       	call   3ebf <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5fe:	83 ec 04             	sub    $0x4,%esp
+     601:	53                   	push   %ebx
+     602:	68 8c 55 00 00       	push   $0x558c
+     607:	ff 35 dc 66 00 00    	push   0x66dc
+     60d:	e8 1e 3a 00 00       	call   4030 <printf>
+      exit();
+     612:	e8 a8 38 00 00       	call   3ebf <exit>
+    printf(stdout, "error: open small failed!\n");
+     617:	51                   	push   %ecx
+     618:	51                   	push   %ecx
+     619:	68 f9 44 00 00       	push   $0x44f9
+     61e:	ff 35 dc 66 00 00    	push   0x66dc
+     624:	e8 07 3a 00 00       	call   4030 <printf>
+    exit();
+     629:	e8 91 38 00 00       	call   3ebf <exit>
+    printf(stdout, "read failed\n");
+     62e:	52                   	push   %edx
+     62f:	52                   	push   %edx
+     630:	68 5b 52 00 00       	push   $0x525b
+     635:	ff 35 dc 66 00 00    	push   0x66dc
+     63b:	e8 f0 39 00 00       	call   4030 <printf>
+    exit();
+     640:	e8 7a 38 00 00       	call   3ebf <exit>
+    printf(stdout, "unlink small failed\n");
+     645:	50                   	push   %eax
+     646:	50                   	push   %eax
+     647:	68 27 45 00 00       	push   $0x4527
+     64c:	ff 35 dc 66 00 00    	push   0x66dc
+     652:	e8 d9 39 00 00       	call   4030 <printf>
+    exit();
+     657:	e8 63 38 00 00       	call   3ebf <exit>
+    printf(stdout, "error: creat small failed!\n");
+     65c:	50                   	push   %eax
+     65d:	50                   	push   %eax
+     65e:	68 a3 44 00 00       	push   $0x44a3
+     663:	ff 35 dc 66 00 00    	push   0x66dc
+     669:	e8 c2 39 00 00       	call   4030 <printf>
+    exit();
+     66e:	e8 4c 38 00 00       	call   3ebf <exit>
+     673:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000680 <writetest1>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	56                   	push   %esi
+     684:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     685:	83 ec 08             	sub    $0x8,%esp
+     688:	68 50 45 00 00       	push   $0x4550
+     68d:	ff 35 dc 66 00 00    	push   0x66dc
+     693:	e8 98 39 00 00       	call   4030 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     698:	58                   	pop    %eax
+     699:	5a                   	pop    %edx
+     69a:	68 02 02 00 00       	push   $0x202
+     69f:	68 ca 45 00 00       	push   $0x45ca
+     6a4:	e8 56 38 00 00       	call   3eff <open>
+  if(fd < 0){
+     6a9:	83 c4 10             	add    $0x10,%esp
+     6ac:	85 c0                	test   %eax,%eax
+     6ae:	0f 88 5d 01 00 00    	js     811 <writetest1+0x191>
+     6b4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGBLOCKS; i++){
+     6b6:	31 db                	xor    %ebx,%ebx
+     6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bf:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6c0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6c3:	89 1d 20 8e 00 00    	mov    %ebx,0x8e20
+    if(write(fd, buf, 512) != 512){
+     6c9:	68 00 02 00 00       	push   $0x200
+     6ce:	68 20 8e 00 00       	push   $0x8e20
+     6d3:	56                   	push   %esi
+     6d4:	e8 06 38 00 00       	call   3edf <write>
+     6d9:	83 c4 10             	add    $0x10,%esp
+     6dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6e1:	0f 85 b3 00 00 00    	jne    79a <writetest1+0x11a>
+  for(i = 0; i < BIGBLOCKS; i++){
+     6e7:	83 c3 01             	add    $0x1,%ebx
+     6ea:	81 fb 8a 01 00 00    	cmp    $0x18a,%ebx
+     6f0:	75 ce                	jne    6c0 <writetest1+0x40>
+  close(fd);
+     6f2:	83 ec 0c             	sub    $0xc,%esp
+     6f5:	56                   	push   %esi
+     6f6:	e8 ec 37 00 00       	call   3ee7 <close>
+  fd = open("big", O_RDONLY);
+     6fb:	5b                   	pop    %ebx
+     6fc:	5e                   	pop    %esi
+     6fd:	6a 00                	push   $0x0
+     6ff:	68 ca 45 00 00       	push   $0x45ca
+     704:	e8 f6 37 00 00       	call   3eff <open>
+  if(fd < 0){
+     709:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     70c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     70e:	85 c0                	test   %eax,%eax
+     710:	0f 88 e4 00 00 00    	js     7fa <writetest1+0x17a>
+  n = 0;
+     716:	31 f6                	xor    %esi,%esi
+     718:	eb 1d                	jmp    737 <writetest1+0xb7>
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     720:	3d 00 02 00 00       	cmp    $0x200,%eax
+     725:	0f 85 9f 00 00 00    	jne    7ca <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     72b:	a1 20 8e 00 00       	mov    0x8e20,%eax
+     730:	39 f0                	cmp    %esi,%eax
+     732:	75 7f                	jne    7b3 <writetest1+0x133>
+    n++;
+     734:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     737:	83 ec 04             	sub    $0x4,%esp
+     73a:	68 00 02 00 00       	push   $0x200
+     73f:	68 20 8e 00 00       	push   $0x8e20
+     744:	53                   	push   %ebx
+     745:	e8 8d 37 00 00       	call   3ed7 <read>
+    if(i == 0){
+     74a:	83 c4 10             	add    $0x10,%esp
+     74d:	85 c0                	test   %eax,%eax
+     74f:	75 cf                	jne    720 <writetest1+0xa0>
+      if(n != BIGBLOCKS){
+     751:	81 fe 8a 01 00 00    	cmp    $0x18a,%esi
+     757:	0f 85 86 00 00 00    	jne    7e3 <writetest1+0x163>
+  close(fd);
+     75d:	83 ec 0c             	sub    $0xc,%esp
+     760:	53                   	push   %ebx
+     761:	e8 81 37 00 00       	call   3ee7 <close>
+  if(unlink("big") < 0){
+     766:	c7 04 24 ca 45 00 00 	movl   $0x45ca,(%esp)
+     76d:	e8 9d 37 00 00       	call   3f0f <unlink>
+     772:	83 c4 10             	add    $0x10,%esp
+     775:	85 c0                	test   %eax,%eax
+     777:	0f 88 ab 00 00 00    	js     828 <writetest1+0x1a8>
+  printf(stdout, "big files ok\n");
+     77d:	83 ec 08             	sub    $0x8,%esp
+     780:	68 f1 45 00 00       	push   $0x45f1
+     785:	ff 35 dc 66 00 00    	push   0x66dc
+     78b:	e8 a0 38 00 00       	call   4030 <printf>
+}
+     790:	83 c4 10             	add    $0x10,%esp
+     793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     796:	5b                   	pop    %ebx
+     797:	5e                   	pop    %esi
+     798:	5d                   	pop    %ebp
+     799:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     79a:	83 ec 04             	sub    $0x4,%esp
+     79d:	53                   	push   %ebx
+     79e:	68 7a 45 00 00       	push   $0x457a
+     7a3:	ff 35 dc 66 00 00    	push   0x66dc
+     7a9:	e8 82 38 00 00       	call   4030 <printf>
+      exit();
+     7ae:	e8 0c 37 00 00       	call   3ebf <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7b3:	50                   	push   %eax
+     7b4:	56                   	push   %esi
+     7b5:	68 b0 55 00 00       	push   $0x55b0
+     7ba:	ff 35 dc 66 00 00    	push   0x66dc
+     7c0:	e8 6b 38 00 00       	call   4030 <printf>
+      exit();
+     7c5:	e8 f5 36 00 00       	call   3ebf <exit>
+      printf(stdout, "read failed %d\n", i);
+     7ca:	83 ec 04             	sub    $0x4,%esp
+     7cd:	50                   	push   %eax
+     7ce:	68 ce 45 00 00       	push   $0x45ce
+     7d3:	ff 35 dc 66 00 00    	push   0x66dc
+     7d9:	e8 52 38 00 00       	call   4030 <printf>
+      exit();
+     7de:	e8 dc 36 00 00       	call   3ebf <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7e3:	52                   	push   %edx
+     7e4:	56                   	push   %esi
+     7e5:	68 b1 45 00 00       	push   $0x45b1
+     7ea:	ff 35 dc 66 00 00    	push   0x66dc
+     7f0:	e8 3b 38 00 00       	call   4030 <printf>
+        exit();
+     7f5:	e8 c5 36 00 00       	call   3ebf <exit>
+    printf(stdout, "error: open big failed!\n");
+     7fa:	51                   	push   %ecx
+     7fb:	51                   	push   %ecx
+     7fc:	68 98 45 00 00       	push   $0x4598
+     801:	ff 35 dc 66 00 00    	push   0x66dc
+     807:	e8 24 38 00 00       	call   4030 <printf>
+    exit();
+     80c:	e8 ae 36 00 00       	call   3ebf <exit>
+    printf(stdout, "error: creat big failed!\n");
+     811:	50                   	push   %eax
+     812:	50                   	push   %eax
+     813:	68 60 45 00 00       	push   $0x4560
+     818:	ff 35 dc 66 00 00    	push   0x66dc
+     81e:	e8 0d 38 00 00       	call   4030 <printf>
+    exit();
+     823:	e8 97 36 00 00       	call   3ebf <exit>
+    printf(stdout, "unlink big failed\n");
+     828:	50                   	push   %eax
+     829:	50                   	push   %eax
+     82a:	68 de 45 00 00       	push   $0x45de
+     82f:	ff 35 dc 66 00 00    	push   0x66dc
+     835:	e8 f6 37 00 00       	call   4030 <printf>
+    exit();
+     83a:	e8 80 36 00 00       	call   3ebf <exit>
+     83f:	90                   	nop
+
+00000840 <createtest>:
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	53                   	push   %ebx
+  name[2] = '\0';
+     844:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     849:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     84c:	68 d0 55 00 00       	push   $0x55d0
+     851:	ff 35 dc 66 00 00    	push   0x66dc
+     857:	e8 d4 37 00 00       	call   4030 <printf>
+  name[0] = 'a';
+     85c:	c6 05 10 8e 00 00 61 	movb   $0x61,0x8e10
+  name[2] = '\0';
+     863:	83 c4 10             	add    $0x10,%esp
+     866:	c6 05 12 8e 00 00 00 	movb   $0x0,0x8e12
+  for(i = 0; i < 52; i++){
+     86d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     870:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     873:	88 1d 11 8e 00 00    	mov    %bl,0x8e11
+  for(i = 0; i < 52; i++){
+     879:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     87c:	68 02 02 00 00       	push   $0x202
+     881:	68 10 8e 00 00       	push   $0x8e10
+     886:	e8 74 36 00 00       	call   3eff <open>
+    close(fd);
+     88b:	89 04 24             	mov    %eax,(%esp)
+     88e:	e8 54 36 00 00       	call   3ee7 <close>
+  for(i = 0; i < 52; i++){
+     893:	83 c4 10             	add    $0x10,%esp
+     896:	80 fb 64             	cmp    $0x64,%bl
+     899:	75 d5                	jne    870 <createtest+0x30>
+  name[0] = 'a';
+     89b:	c6 05 10 8e 00 00 61 	movb   $0x61,0x8e10
+  name[2] = '\0';
+     8a2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8a7:	c6 05 12 8e 00 00 00 	movb   $0x0,0x8e12
+  for(i = 0; i < 52; i++){
+     8ae:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8b0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8b3:	88 1d 11 8e 00 00    	mov    %bl,0x8e11
+  for(i = 0; i < 52; i++){
+     8b9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8bc:	68 10 8e 00 00       	push   $0x8e10
+     8c1:	e8 49 36 00 00       	call   3f0f <unlink>
+  for(i = 0; i < 52; i++){
+     8c6:	83 c4 10             	add    $0x10,%esp
+     8c9:	80 fb 64             	cmp    $0x64,%bl
+     8cc:	75 e2                	jne    8b0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8ce:	83 ec 08             	sub    $0x8,%esp
+     8d1:	68 f8 55 00 00       	push   $0x55f8
+     8d6:	ff 35 dc 66 00 00    	push   0x66dc
+     8dc:	e8 4f 37 00 00       	call   4030 <printf>
+}
+     8e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8e4:	83 c4 10             	add    $0x10,%esp
+     8e7:	c9                   	leave
+     8e8:	c3                   	ret
+     8e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <dirtest>:
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     8f6:	68 ff 45 00 00       	push   $0x45ff
+     8fb:	ff 35 dc 66 00 00    	push   0x66dc
+     901:	e8 2a 37 00 00       	call   4030 <printf>
+  if(mkdir("dir0") < 0){
+     906:	c7 04 24 0b 46 00 00 	movl   $0x460b,(%esp)
+     90d:	e8 15 36 00 00       	call   3f27 <mkdir>
+     912:	83 c4 10             	add    $0x10,%esp
+     915:	85 c0                	test   %eax,%eax
+     917:	78 58                	js     971 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     919:	83 ec 0c             	sub    $0xc,%esp
+     91c:	68 0b 46 00 00       	push   $0x460b
+     921:	e8 09 36 00 00       	call   3f2f <chdir>
+     926:	83 c4 10             	add    $0x10,%esp
+     929:	85 c0                	test   %eax,%eax
+     92b:	0f 88 85 00 00 00    	js     9b6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     931:	83 ec 0c             	sub    $0xc,%esp
+     934:	68 99 4c 00 00       	push   $0x4c99
+     939:	e8 f1 35 00 00       	call   3f2f <chdir>
+     93e:	83 c4 10             	add    $0x10,%esp
+     941:	85 c0                	test   %eax,%eax
+     943:	78 5a                	js     99f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     945:	83 ec 0c             	sub    $0xc,%esp
+     948:	68 0b 46 00 00       	push   $0x460b
+     94d:	e8 bd 35 00 00       	call   3f0f <unlink>
+     952:	83 c4 10             	add    $0x10,%esp
+     955:	85 c0                	test   %eax,%eax
+     957:	78 2f                	js     988 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     959:	83 ec 08             	sub    $0x8,%esp
+     95c:	68 48 46 00 00       	push   $0x4648
+     961:	ff 35 dc 66 00 00    	push   0x66dc
+     967:	e8 c4 36 00 00       	call   4030 <printf>
+}
+     96c:	83 c4 10             	add    $0x10,%esp
+     96f:	c9                   	leave
+     970:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     971:	50                   	push   %eax
+     972:	50                   	push   %eax
+     973:	68 a1 4a 00 00       	push   $0x4aa1
+     978:	ff 35 dc 66 00 00    	push   0x66dc
+     97e:	e8 ad 36 00 00       	call   4030 <printf>
+    exit();
+     983:	e8 37 35 00 00       	call   3ebf <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     988:	50                   	push   %eax
+     989:	50                   	push   %eax
+     98a:	68 34 46 00 00       	push   $0x4634
+     98f:	ff 35 dc 66 00 00    	push   0x66dc
+     995:	e8 96 36 00 00       	call   4030 <printf>
+    exit();
+     99a:	e8 20 35 00 00       	call   3ebf <exit>
+    printf(stdout, "chdir .. failed\n");
+     99f:	52                   	push   %edx
+     9a0:	52                   	push   %edx
+     9a1:	68 23 46 00 00       	push   $0x4623
+     9a6:	ff 35 dc 66 00 00    	push   0x66dc
+     9ac:	e8 7f 36 00 00       	call   4030 <printf>
+    exit();
+     9b1:	e8 09 35 00 00       	call   3ebf <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9b6:	51                   	push   %ecx
+     9b7:	51                   	push   %ecx
+     9b8:	68 10 46 00 00       	push   $0x4610
+     9bd:	ff 35 dc 66 00 00    	push   0x66dc
+     9c3:	e8 68 36 00 00       	call   4030 <printf>
+    exit();
+     9c8:	e8 f2 34 00 00       	call   3ebf <exit>
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009d0 <exectest>:
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9d6:	68 57 46 00 00       	push   $0x4657
+     9db:	ff 35 dc 66 00 00    	push   0x66dc
+     9e1:	e8 4a 36 00 00       	call   4030 <printf>
+  if(exec("echo", echoargv) < 0){
+     9e6:	5a                   	pop    %edx
+     9e7:	59                   	pop    %ecx
+     9e8:	68 e0 66 00 00       	push   $0x66e0
+     9ed:	68 20 44 00 00       	push   $0x4420
+     9f2:	e8 00 35 00 00       	call   3ef7 <exec>
+     9f7:	83 c4 10             	add    $0x10,%esp
+     9fa:	85 c0                	test   %eax,%eax
+     9fc:	78 02                	js     a00 <exectest+0x30>
+}
+     9fe:	c9                   	leave
+     9ff:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a00:	50                   	push   %eax
+     a01:	50                   	push   %eax
+     a02:	68 62 46 00 00       	push   $0x4662
+     a07:	ff 35 dc 66 00 00    	push   0x66dc
+     a0d:	e8 1e 36 00 00       	call   4030 <printf>
+    exit();
+     a12:	e8 a8 34 00 00       	call   3ebf <exit>
+     a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1e:	66 90                	xchg   %ax,%ax
+
+00000a20 <pipe1>:
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	57                   	push   %edi
+     a24:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a25:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a28:	53                   	push   %ebx
+     a29:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a2c:	50                   	push   %eax
+     a2d:	e8 9d 34 00 00       	call   3ecf <pipe>
+     a32:	83 c4 10             	add    $0x10,%esp
+     a35:	85 c0                	test   %eax,%eax
+     a37:	0f 85 41 01 00 00    	jne    b7e <pipe1+0x15e>
+     a3d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a3f:	e8 73 34 00 00       	call   3eb7 <fork>
+  if(pid == 0){
+     a44:	85 c0                	test   %eax,%eax
+     a46:	0f 84 92 00 00 00    	je     ade <pipe1+0xbe>
+  } else if(pid > 0){
+     a4c:	0f 8e 3f 01 00 00    	jle    b91 <pipe1+0x171>
+    close(fds[1]);
+     a52:	83 ec 0c             	sub    $0xc,%esp
+     a55:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a58:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a5a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a5f:	e8 83 34 00 00       	call   3ee7 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a64:	83 c4 10             	add    $0x10,%esp
+     a67:	83 ec 04             	sub    $0x4,%esp
+     a6a:	57                   	push   %edi
+     a6b:	68 20 8e 00 00       	push   $0x8e20
+     a70:	ff 75 e0             	push   -0x20(%ebp)
+     a73:	e8 5f 34 00 00       	call   3ed7 <read>
+     a78:	83 c4 10             	add    $0x10,%esp
+     a7b:	89 c1                	mov    %eax,%ecx
+     a7d:	85 c0                	test   %eax,%eax
+     a7f:	0f 8e b8 00 00 00    	jle    b3d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     a85:	89 f0                	mov    %esi,%eax
+     a87:	32 05 20 8e 00 00    	xor    0x8e20,%al
+     a8d:	0f b6 c0             	movzbl %al,%eax
+     a90:	85 c0                	test   %eax,%eax
+     a92:	75 30                	jne    ac4 <pipe1+0xa4>
+     a94:	83 c6 01             	add    $0x1,%esi
+     a97:	eb 0f                	jmp    aa8 <pipe1+0x88>
+     a99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aa0:	38 90 20 8e 00 00    	cmp    %dl,0x8e20(%eax)
+     aa6:	75 1c                	jne    ac4 <pipe1+0xa4>
+     aa8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     aab:	83 c0 01             	add    $0x1,%eax
+     aae:	39 c1                	cmp    %eax,%ecx
+     ab0:	75 ee                	jne    aa0 <pipe1+0x80>
+      cc = cc * 2;
+     ab2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ab4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ab9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     abb:	89 d6                	mov    %edx,%esi
+     abd:	39 c7                	cmp    %eax,%edi
+     abf:	0f 4f f8             	cmovg  %eax,%edi
+     ac2:	eb a3                	jmp    a67 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ac4:	83 ec 08             	sub    $0x8,%esp
+     ac7:	68 91 46 00 00       	push   $0x4691
+     acc:	6a 01                	push   $0x1
+     ace:	e8 5d 35 00 00       	call   4030 <printf>
+     ad3:	83 c4 10             	add    $0x10,%esp
+}
+     ad6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ad9:	5b                   	pop    %ebx
+     ada:	5e                   	pop    %esi
+     adb:	5f                   	pop    %edi
+     adc:	5d                   	pop    %ebp
+     add:	c3                   	ret
+    close(fds[0]);
+     ade:	83 ec 0c             	sub    $0xc,%esp
+     ae1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     ae4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     ae6:	e8 fc 33 00 00       	call   3ee7 <close>
+     aeb:	83 c4 10             	add    $0x10,%esp
+     aee:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     af0:	31 c0                	xor    %eax,%eax
+     af2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     af8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     afb:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     afe:	88 90 1f 8e 00 00    	mov    %dl,0x8e1f(%eax)
+      for(i = 0; i < 1033; i++)
+     b04:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b09:	75 ed                	jne    af8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b0b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b0e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b14:	68 09 04 00 00       	push   $0x409
+     b19:	68 20 8e 00 00       	push   $0x8e20
+     b1e:	ff 75 e4             	push   -0x1c(%ebp)
+     b21:	e8 b9 33 00 00       	call   3edf <write>
+     b26:	83 c4 10             	add    $0x10,%esp
+     b29:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b2e:	75 74                	jne    ba4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b30:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b36:	75 b8                	jne    af0 <pipe1+0xd0>
+    exit();
+     b38:	e8 82 33 00 00       	call   3ebf <exit>
+    if(total != 5 * 1033){
+     b3d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b43:	75 26                	jne    b6b <pipe1+0x14b>
+    close(fds[0]);
+     b45:	83 ec 0c             	sub    $0xc,%esp
+     b48:	ff 75 e0             	push   -0x20(%ebp)
+     b4b:	e8 97 33 00 00       	call   3ee7 <close>
+    wait();
+     b50:	e8 72 33 00 00       	call   3ec7 <wait>
+  printf(1, "pipe1 ok\n");
+     b55:	5a                   	pop    %edx
+     b56:	59                   	pop    %ecx
+     b57:	68 b6 46 00 00       	push   $0x46b6
+     b5c:	6a 01                	push   $0x1
+     b5e:	e8 cd 34 00 00       	call   4030 <printf>
+     b63:	83 c4 10             	add    $0x10,%esp
+     b66:	e9 6b ff ff ff       	jmp    ad6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b6b:	56                   	push   %esi
+     b6c:	53                   	push   %ebx
+     b6d:	68 9f 46 00 00       	push   $0x469f
+     b72:	6a 01                	push   $0x1
+     b74:	e8 b7 34 00 00       	call   4030 <printf>
+      exit();
+     b79:	e8 41 33 00 00       	call   3ebf <exit>
+    printf(1, "pipe() failed\n");
+     b7e:	50                   	push   %eax
+     b7f:	50                   	push   %eax
+     b80:	68 74 46 00 00       	push   $0x4674
+     b85:	6a 01                	push   $0x1
+     b87:	e8 a4 34 00 00       	call   4030 <printf>
+    exit();
+     b8c:	e8 2e 33 00 00       	call   3ebf <exit>
+    printf(1, "fork() failed\n");
+     b91:	50                   	push   %eax
+     b92:	50                   	push   %eax
+     b93:	68 c0 46 00 00       	push   $0x46c0
+     b98:	6a 01                	push   $0x1
+     b9a:	e8 91 34 00 00       	call   4030 <printf>
+    exit();
+     b9f:	e8 1b 33 00 00       	call   3ebf <exit>
+        printf(1, "pipe1 oops 1\n");
+     ba4:	57                   	push   %edi
+     ba5:	57                   	push   %edi
+     ba6:	68 83 46 00 00       	push   $0x4683
+     bab:	6a 01                	push   $0x1
+     bad:	e8 7e 34 00 00       	call   4030 <printf>
+        exit();
+     bb2:	e8 08 33 00 00       	call   3ebf <exit>
+     bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbe:	66 90                	xchg   %ax,%ax
+
+00000bc0 <preempt>:
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	57                   	push   %edi
+     bc4:	56                   	push   %esi
+     bc5:	53                   	push   %ebx
+     bc6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     bc9:	68 cf 46 00 00       	push   $0x46cf
+     bce:	6a 01                	push   $0x1
+     bd0:	e8 5b 34 00 00       	call   4030 <printf>
+  pid1 = fork();
+     bd5:	e8 dd 32 00 00       	call   3eb7 <fork>
+  if(pid1 == 0)
+     bda:	83 c4 10             	add    $0x10,%esp
+     bdd:	85 c0                	test   %eax,%eax
+     bdf:	75 07                	jne    be8 <preempt+0x28>
+    for(;;)
+     be1:	eb fe                	jmp    be1 <preempt+0x21>
+     be3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     be7:	90                   	nop
+     be8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     bea:	e8 c8 32 00 00       	call   3eb7 <fork>
+     bef:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     bf1:	85 c0                	test   %eax,%eax
+     bf3:	75 0b                	jne    c00 <preempt+0x40>
+    for(;;)
+     bf5:	eb fe                	jmp    bf5 <preempt+0x35>
+     bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfe:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     c00:	83 ec 0c             	sub    $0xc,%esp
+     c03:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c06:	50                   	push   %eax
+     c07:	e8 c3 32 00 00       	call   3ecf <pipe>
+  pid3 = fork();
+     c0c:	e8 a6 32 00 00       	call   3eb7 <fork>
+  if(pid3 == 0){
+     c11:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c14:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     c16:	85 c0                	test   %eax,%eax
+     c18:	75 3e                	jne    c58 <preempt+0x98>
+    close(pfds[0]);
+     c1a:	83 ec 0c             	sub    $0xc,%esp
+     c1d:	ff 75 e0             	push   -0x20(%ebp)
+     c20:	e8 c2 32 00 00       	call   3ee7 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     c25:	83 c4 0c             	add    $0xc,%esp
+     c28:	6a 01                	push   $0x1
+     c2a:	68 96 4a 00 00       	push   $0x4a96
+     c2f:	ff 75 e4             	push   -0x1c(%ebp)
+     c32:	e8 a8 32 00 00       	call   3edf <write>
+     c37:	83 c4 10             	add    $0x10,%esp
+     c3a:	83 f8 01             	cmp    $0x1,%eax
+     c3d:	0f 85 b8 00 00 00    	jne    cfb <preempt+0x13b>
+    close(pfds[1]);
+     c43:	83 ec 0c             	sub    $0xc,%esp
+     c46:	ff 75 e4             	push   -0x1c(%ebp)
+     c49:	e8 99 32 00 00       	call   3ee7 <close>
+     c4e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     c51:	eb fe                	jmp    c51 <preempt+0x91>
+     c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c57:	90                   	nop
+  close(pfds[1]);
+     c58:	83 ec 0c             	sub    $0xc,%esp
+     c5b:	ff 75 e4             	push   -0x1c(%ebp)
+     c5e:	e8 84 32 00 00       	call   3ee7 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c63:	83 c4 0c             	add    $0xc,%esp
+     c66:	68 00 20 00 00       	push   $0x2000
+     c6b:	68 20 8e 00 00       	push   $0x8e20
+     c70:	ff 75 e0             	push   -0x20(%ebp)
+     c73:	e8 5f 32 00 00       	call   3ed7 <read>
+     c78:	83 c4 10             	add    $0x10,%esp
+     c7b:	83 f8 01             	cmp    $0x1,%eax
+     c7e:	75 67                	jne    ce7 <preempt+0x127>
+  close(pfds[0]);
+     c80:	83 ec 0c             	sub    $0xc,%esp
+     c83:	ff 75 e0             	push   -0x20(%ebp)
+     c86:	e8 5c 32 00 00       	call   3ee7 <close>
+  printf(1, "kill... ");
+     c8b:	58                   	pop    %eax
+     c8c:	5a                   	pop    %edx
+     c8d:	68 00 47 00 00       	push   $0x4700
+     c92:	6a 01                	push   $0x1
+     c94:	e8 97 33 00 00       	call   4030 <printf>
+  kill(pid1);
+     c99:	89 1c 24             	mov    %ebx,(%esp)
+     c9c:	e8 4e 32 00 00       	call   3eef <kill>
+  kill(pid2);
+     ca1:	89 34 24             	mov    %esi,(%esp)
+     ca4:	e8 46 32 00 00       	call   3eef <kill>
+  kill(pid3);
+     ca9:	89 3c 24             	mov    %edi,(%esp)
+     cac:	e8 3e 32 00 00       	call   3eef <kill>
+  printf(1, "wait... ");
+     cb1:	59                   	pop    %ecx
+     cb2:	5b                   	pop    %ebx
+     cb3:	68 09 47 00 00       	push   $0x4709
+     cb8:	6a 01                	push   $0x1
+     cba:	e8 71 33 00 00       	call   4030 <printf>
+  wait();
+     cbf:	e8 03 32 00 00       	call   3ec7 <wait>
+  wait();
+     cc4:	e8 fe 31 00 00       	call   3ec7 <wait>
+  wait();
+     cc9:	e8 f9 31 00 00       	call   3ec7 <wait>
+  printf(1, "preempt ok\n");
+     cce:	5e                   	pop    %esi
+     ccf:	5f                   	pop    %edi
+     cd0:	68 12 47 00 00       	push   $0x4712
+     cd5:	6a 01                	push   $0x1
+     cd7:	e8 54 33 00 00       	call   4030 <printf>
+     cdc:	83 c4 10             	add    $0x10,%esp
+}
+     cdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ce2:	5b                   	pop    %ebx
+     ce3:	5e                   	pop    %esi
+     ce4:	5f                   	pop    %edi
+     ce5:	5d                   	pop    %ebp
+     ce6:	c3                   	ret
+    printf(1, "preempt read error");
+     ce7:	83 ec 08             	sub    $0x8,%esp
+     cea:	68 ed 46 00 00       	push   $0x46ed
+     cef:	6a 01                	push   $0x1
+     cf1:	e8 3a 33 00 00       	call   4030 <printf>
+     cf6:	83 c4 10             	add    $0x10,%esp
+     cf9:	eb e4                	jmp    cdf <preempt+0x11f>
+      printf(1, "preempt write error");
+     cfb:	83 ec 08             	sub    $0x8,%esp
+     cfe:	68 d9 46 00 00       	push   $0x46d9
+     d03:	6a 01                	push   $0x1
+     d05:	e8 26 33 00 00       	call   4030 <printf>
+     d0a:	83 c4 10             	add    $0x10,%esp
+     d0d:	e9 31 ff ff ff       	jmp    c43 <preempt+0x83>
+     d12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d20 <exitwait>:
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	56                   	push   %esi
+     d24:	be 64 00 00 00       	mov    $0x64,%esi
+     d29:	53                   	push   %ebx
+     d2a:	eb 14                	jmp    d40 <exitwait+0x20>
+     d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     d30:	74 68                	je     d9a <exitwait+0x7a>
+      if(wait() != pid){
+     d32:	e8 90 31 00 00       	call   3ec7 <wait>
+     d37:	39 d8                	cmp    %ebx,%eax
+     d39:	75 2d                	jne    d68 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     d3b:	83 ee 01             	sub    $0x1,%esi
+     d3e:	74 41                	je     d81 <exitwait+0x61>
+    pid = fork();
+     d40:	e8 72 31 00 00       	call   3eb7 <fork>
+     d45:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     d47:	85 c0                	test   %eax,%eax
+     d49:	79 e5                	jns    d30 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     d4b:	83 ec 08             	sub    $0x8,%esp
+     d4e:	68 64 54 00 00       	push   $0x5464
+     d53:	6a 01                	push   $0x1
+     d55:	e8 d6 32 00 00       	call   4030 <printf>
+      return;
+     d5a:	83 c4 10             	add    $0x10,%esp
+}
+     d5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d60:	5b                   	pop    %ebx
+     d61:	5e                   	pop    %esi
+     d62:	5d                   	pop    %ebp
+     d63:	c3                   	ret
+     d64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     d68:	83 ec 08             	sub    $0x8,%esp
+     d6b:	68 1e 47 00 00       	push   $0x471e
+     d70:	6a 01                	push   $0x1
+     d72:	e8 b9 32 00 00       	call   4030 <printf>
+        return;
+     d77:	83 c4 10             	add    $0x10,%esp
+}
+     d7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d7d:	5b                   	pop    %ebx
+     d7e:	5e                   	pop    %esi
+     d7f:	5d                   	pop    %ebp
+     d80:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     d81:	83 ec 08             	sub    $0x8,%esp
+     d84:	68 2e 47 00 00       	push   $0x472e
+     d89:	6a 01                	push   $0x1
+     d8b:	e8 a0 32 00 00       	call   4030 <printf>
+     d90:	83 c4 10             	add    $0x10,%esp
+}
+     d93:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d96:	5b                   	pop    %ebx
+     d97:	5e                   	pop    %esi
+     d98:	5d                   	pop    %ebp
+     d99:	c3                   	ret
+      exit();
+     d9a:	e8 20 31 00 00       	call   3ebf <exit>
+     d9f:	90                   	nop
+
+00000da0 <mem>:
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	56                   	push   %esi
+     da4:	31 f6                	xor    %esi,%esi
+     da6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     da7:	83 ec 08             	sub    $0x8,%esp
+     daa:	68 3b 47 00 00       	push   $0x473b
+     daf:	6a 01                	push   $0x1
+     db1:	e8 7a 32 00 00       	call   4030 <printf>
+  ppid = getpid();
+     db6:	e8 84 31 00 00       	call   3f3f <getpid>
+     dbb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     dbd:	e8 f5 30 00 00       	call   3eb7 <fork>
+     dc2:	83 c4 10             	add    $0x10,%esp
+     dc5:	85 c0                	test   %eax,%eax
+     dc7:	74 0b                	je     dd4 <mem+0x34>
+     dc9:	e9 8a 00 00 00       	jmp    e58 <mem+0xb8>
+     dce:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     dd0:	89 30                	mov    %esi,(%eax)
+     dd2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     dd4:	83 ec 0c             	sub    $0xc,%esp
+     dd7:	68 11 27 00 00       	push   $0x2711
+     ddc:	e8 8f 34 00 00       	call   4270 <malloc>
+     de1:	83 c4 10             	add    $0x10,%esp
+     de4:	85 c0                	test   %eax,%eax
+     de6:	75 e8                	jne    dd0 <mem+0x30>
+    while(m1){
+     de8:	85 f6                	test   %esi,%esi
+     dea:	74 18                	je     e04 <mem+0x64>
+     dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     df0:	89 f0                	mov    %esi,%eax
+      free(m1);
+     df2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     df5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     df7:	50                   	push   %eax
+     df8:	e8 e3 33 00 00       	call   41e0 <free>
+    while(m1){
+     dfd:	83 c4 10             	add    $0x10,%esp
+     e00:	85 f6                	test   %esi,%esi
+     e02:	75 ec                	jne    df0 <mem+0x50>
+    m1 = malloc(1024*20);
+     e04:	83 ec 0c             	sub    $0xc,%esp
+     e07:	68 00 50 00 00       	push   $0x5000
+     e0c:	e8 5f 34 00 00       	call   4270 <malloc>
+    if(m1 == 0){
+     e11:	83 c4 10             	add    $0x10,%esp
+     e14:	85 c0                	test   %eax,%eax
+     e16:	74 20                	je     e38 <mem+0x98>
+    free(m1);
+     e18:	83 ec 0c             	sub    $0xc,%esp
+     e1b:	50                   	push   %eax
+     e1c:	e8 bf 33 00 00       	call   41e0 <free>
+    printf(1, "mem ok\n");
+     e21:	58                   	pop    %eax
+     e22:	5a                   	pop    %edx
+     e23:	68 5f 47 00 00       	push   $0x475f
+     e28:	6a 01                	push   $0x1
+     e2a:	e8 01 32 00 00       	call   4030 <printf>
+    exit();
+     e2f:	e8 8b 30 00 00       	call   3ebf <exit>
+     e34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     e38:	83 ec 08             	sub    $0x8,%esp
+     e3b:	68 45 47 00 00       	push   $0x4745
+     e40:	6a 01                	push   $0x1
+     e42:	e8 e9 31 00 00       	call   4030 <printf>
+      kill(ppid);
+     e47:	89 1c 24             	mov    %ebx,(%esp)
+     e4a:	e8 a0 30 00 00       	call   3eef <kill>
+      exit();
+     e4f:	e8 6b 30 00 00       	call   3ebf <exit>
+     e54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     e58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e5b:	5b                   	pop    %ebx
+     e5c:	5e                   	pop    %esi
+     e5d:	5d                   	pop    %ebp
+    wait();
+     e5e:	e9 64 30 00 00       	jmp    3ec7 <wait>
+     e63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000e70 <sharedfd>:
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	57                   	push   %edi
+     e74:	56                   	push   %esi
+     e75:	53                   	push   %ebx
+     e76:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     e79:	68 67 47 00 00       	push   $0x4767
+     e7e:	6a 01                	push   $0x1
+     e80:	e8 ab 31 00 00       	call   4030 <printf>
+  unlink("sharedfd");
+     e85:	c7 04 24 76 47 00 00 	movl   $0x4776,(%esp)
+     e8c:	e8 7e 30 00 00       	call   3f0f <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     e91:	5b                   	pop    %ebx
+     e92:	5e                   	pop    %esi
+     e93:	68 02 02 00 00       	push   $0x202
+     e98:	68 76 47 00 00       	push   $0x4776
+     e9d:	e8 5d 30 00 00       	call   3eff <open>
+  if(fd < 0){
+     ea2:	83 c4 10             	add    $0x10,%esp
+     ea5:	85 c0                	test   %eax,%eax
+     ea7:	0f 88 2a 01 00 00    	js     fd7 <sharedfd+0x167>
+     ead:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     eaf:	8d 75 de             	lea    -0x22(%ebp),%esi
+     eb2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     eb7:	e8 fb 2f 00 00       	call   3eb7 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ebc:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     ebf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ec2:	19 c0                	sbb    %eax,%eax
+     ec4:	83 ec 04             	sub    $0x4,%esp
+     ec7:	83 e0 f3             	and    $0xfffffff3,%eax
+     eca:	6a 0a                	push   $0xa
+     ecc:	83 c0 70             	add    $0x70,%eax
+     ecf:	50                   	push   %eax
+     ed0:	56                   	push   %esi
+     ed1:	e8 1a 2e 00 00       	call   3cf0 <memset>
+     ed6:	83 c4 10             	add    $0x10,%esp
+     ed9:	eb 0a                	jmp    ee5 <sharedfd+0x75>
+     edb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     edf:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     ee0:	83 eb 01             	sub    $0x1,%ebx
+     ee3:	74 26                	je     f0b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     ee5:	83 ec 04             	sub    $0x4,%esp
+     ee8:	6a 0a                	push   $0xa
+     eea:	56                   	push   %esi
+     eeb:	57                   	push   %edi
+     eec:	e8 ee 2f 00 00       	call   3edf <write>
+     ef1:	83 c4 10             	add    $0x10,%esp
+     ef4:	83 f8 0a             	cmp    $0xa,%eax
+     ef7:	74 e7                	je     ee0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     ef9:	83 ec 08             	sub    $0x8,%esp
+     efc:	68 4c 56 00 00       	push   $0x564c
+     f01:	6a 01                	push   $0x1
+     f03:	e8 28 31 00 00       	call   4030 <printf>
+      break;
+     f08:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     f0b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     f0e:	85 c9                	test   %ecx,%ecx
+     f10:	0f 84 f5 00 00 00    	je     100b <sharedfd+0x19b>
+    wait();
+     f16:	e8 ac 2f 00 00       	call   3ec7 <wait>
+  close(fd);
+     f1b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+     f1e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     f20:	57                   	push   %edi
+     f21:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     f24:	e8 be 2f 00 00       	call   3ee7 <close>
+  fd = open("sharedfd", 0);
+     f29:	58                   	pop    %eax
+     f2a:	5a                   	pop    %edx
+     f2b:	6a 00                	push   $0x0
+     f2d:	68 76 47 00 00       	push   $0x4776
+     f32:	e8 c8 2f 00 00       	call   3eff <open>
+  if(fd < 0){
+     f37:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+     f3a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+     f3c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+     f3f:	85 c0                	test   %eax,%eax
+     f41:	0f 88 aa 00 00 00    	js     ff1 <sharedfd+0x181>
+     f47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     f50:	83 ec 04             	sub    $0x4,%esp
+     f53:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f56:	6a 0a                	push   $0xa
+     f58:	56                   	push   %esi
+     f59:	ff 75 d0             	push   -0x30(%ebp)
+     f5c:	e8 76 2f 00 00       	call   3ed7 <read>
+     f61:	83 c4 10             	add    $0x10,%esp
+     f64:	85 c0                	test   %eax,%eax
+     f66:	7e 28                	jle    f90 <sharedfd+0x120>
+     f68:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f6b:	89 f0                	mov    %esi,%eax
+     f6d:	eb 13                	jmp    f82 <sharedfd+0x112>
+     f6f:	90                   	nop
+        np++;
+     f70:	80 f9 70             	cmp    $0x70,%cl
+     f73:	0f 94 c1             	sete   %cl
+     f76:	0f b6 c9             	movzbl %cl,%ecx
+     f79:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     f7b:	83 c0 01             	add    $0x1,%eax
+     f7e:	39 f8                	cmp    %edi,%eax
+     f80:	74 ce                	je     f50 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+     f82:	0f b6 08             	movzbl (%eax),%ecx
+     f85:	80 f9 63             	cmp    $0x63,%cl
+     f88:	75 e6                	jne    f70 <sharedfd+0x100>
+        nc++;
+     f8a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+     f8d:	eb ec                	jmp    f7b <sharedfd+0x10b>
+     f8f:	90                   	nop
+  close(fd);
+     f90:	83 ec 0c             	sub    $0xc,%esp
+     f93:	ff 75 d0             	push   -0x30(%ebp)
+     f96:	e8 4c 2f 00 00       	call   3ee7 <close>
+  unlink("sharedfd");
+     f9b:	c7 04 24 76 47 00 00 	movl   $0x4776,(%esp)
+     fa2:	e8 68 2f 00 00       	call   3f0f <unlink>
+  if(nc == 10000 && np == 10000){
+     fa7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     faa:	83 c4 10             	add    $0x10,%esp
+     fad:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+     fb3:	75 5b                	jne    1010 <sharedfd+0x1a0>
+     fb5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     fbb:	75 53                	jne    1010 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+     fbd:	83 ec 08             	sub    $0x8,%esp
+     fc0:	68 7f 47 00 00       	push   $0x477f
+     fc5:	6a 01                	push   $0x1
+     fc7:	e8 64 30 00 00       	call   4030 <printf>
+     fcc:	83 c4 10             	add    $0x10,%esp
+}
+     fcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fd2:	5b                   	pop    %ebx
+     fd3:	5e                   	pop    %esi
+     fd4:	5f                   	pop    %edi
+     fd5:	5d                   	pop    %ebp
+     fd6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+     fd7:	83 ec 08             	sub    $0x8,%esp
+     fda:	68 20 56 00 00       	push   $0x5620
+     fdf:	6a 01                	push   $0x1
+     fe1:	e8 4a 30 00 00       	call   4030 <printf>
+    return;
+     fe6:	83 c4 10             	add    $0x10,%esp
+}
+     fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fec:	5b                   	pop    %ebx
+     fed:	5e                   	pop    %esi
+     fee:	5f                   	pop    %edi
+     fef:	5d                   	pop    %ebp
+     ff0:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     ff1:	83 ec 08             	sub    $0x8,%esp
+     ff4:	68 6c 56 00 00       	push   $0x566c
+     ff9:	6a 01                	push   $0x1
+     ffb:	e8 30 30 00 00       	call   4030 <printf>
+    return;
+    1000:	83 c4 10             	add    $0x10,%esp
+}
+    1003:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1006:	5b                   	pop    %ebx
+    1007:	5e                   	pop    %esi
+    1008:	5f                   	pop    %edi
+    1009:	5d                   	pop    %ebp
+    100a:	c3                   	ret
+    exit();
+    100b:	e8 af 2e 00 00       	call   3ebf <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1010:	53                   	push   %ebx
+    1011:	52                   	push   %edx
+    1012:	68 8c 47 00 00       	push   $0x478c
+    1017:	6a 01                	push   $0x1
+    1019:	e8 12 30 00 00       	call   4030 <printf>
+    exit();
+    101e:	e8 9c 2e 00 00       	call   3ebf <exit>
+    1023:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    102a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001030 <fourfiles>:
+{
+    1030:	55                   	push   %ebp
+    1031:	89 e5                	mov    %esp,%ebp
+    1033:	57                   	push   %edi
+    1034:	56                   	push   %esi
+    1035:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1036:	31 db                	xor    %ebx,%ebx
+{
+    1038:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    103b:	c7 45 d8 a1 47 00 00 	movl   $0x47a1,-0x28(%ebp)
+    1042:	c7 45 dc ea 48 00 00 	movl   $0x48ea,-0x24(%ebp)
+    1049:	c7 45 e0 ee 48 00 00 	movl   $0x48ee,-0x20(%ebp)
+    1050:	c7 45 e4 a4 47 00 00 	movl   $0x47a4,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1057:	68 a7 47 00 00       	push   $0x47a7
+    105c:	6a 01                	push   $0x1
+    105e:	e8 cd 2f 00 00       	call   4030 <printf>
+    1063:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1066:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    106a:	83 ec 0c             	sub    $0xc,%esp
+    106d:	56                   	push   %esi
+    106e:	e8 9c 2e 00 00       	call   3f0f <unlink>
+    pid = fork();
+    1073:	e8 3f 2e 00 00       	call   3eb7 <fork>
+    if(pid < 0){
+    1078:	83 c4 10             	add    $0x10,%esp
+    107b:	85 c0                	test   %eax,%eax
+    107d:	0f 88 65 01 00 00    	js     11e8 <fourfiles+0x1b8>
+    if(pid == 0){
+    1083:	0f 84 eb 00 00 00    	je     1174 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1089:	83 c3 01             	add    $0x1,%ebx
+    108c:	83 fb 04             	cmp    $0x4,%ebx
+    108f:	75 d5                	jne    1066 <fourfiles+0x36>
+    wait();
+    1091:	e8 31 2e 00 00       	call   3ec7 <wait>
+  for(i = 0; i < 2; i++){
+    1096:	31 f6                	xor    %esi,%esi
+    wait();
+    1098:	e8 2a 2e 00 00       	call   3ec7 <wait>
+    109d:	e8 25 2e 00 00       	call   3ec7 <wait>
+    10a2:	e8 20 2e 00 00       	call   3ec7 <wait>
+    fname = names[i];
+    10a7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    10ab:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    10ae:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    10b0:	6a 00                	push   $0x0
+    10b2:	53                   	push   %ebx
+    10b3:	e8 47 2e 00 00       	call   3eff <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    10b8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    10bb:	83 c4 10             	add    $0x10,%esp
+    10be:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    10c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10c8:	83 ec 04             	sub    $0x4,%esp
+    10cb:	68 00 20 00 00       	push   $0x2000
+    10d0:	68 20 8e 00 00       	push   $0x8e20
+    10d5:	ff 75 d4             	push   -0x2c(%ebp)
+    10d8:	e8 fa 2d 00 00       	call   3ed7 <read>
+    10dd:	83 c4 10             	add    $0x10,%esp
+    10e0:	89 c3                	mov    %eax,%ebx
+    10e2:	85 c0                	test   %eax,%eax
+    10e4:	7e 28                	jle    110e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    10e6:	31 c0                	xor    %eax,%eax
+    10e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ef:	90                   	nop
+        if(buf[j] != '0'+i){
+    10f0:	83 fe 01             	cmp    $0x1,%esi
+    10f3:	0f be 88 20 8e 00 00 	movsbl 0x8e20(%eax),%ecx
+    10fa:	19 d2                	sbb    %edx,%edx
+    10fc:	83 c2 31             	add    $0x31,%edx
+    10ff:	39 d1                	cmp    %edx,%ecx
+    1101:	75 5d                	jne    1160 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1103:	83 c0 01             	add    $0x1,%eax
+    1106:	39 c3                	cmp    %eax,%ebx
+    1108:	75 e6                	jne    10f0 <fourfiles+0xc0>
+      total += n;
+    110a:	01 df                	add    %ebx,%edi
+    110c:	eb ba                	jmp    10c8 <fourfiles+0x98>
+    close(fd);
+    110e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1111:	83 ec 0c             	sub    $0xc,%esp
+    1114:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1117:	51                   	push   %ecx
+    1118:	e8 ca 2d 00 00       	call   3ee7 <close>
+    if(total != 12*500){
+    111d:	83 c4 10             	add    $0x10,%esp
+    1120:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1126:	0f 85 d0 00 00 00    	jne    11fc <fourfiles+0x1cc>
+    unlink(fname);
+    112c:	83 ec 0c             	sub    $0xc,%esp
+    112f:	53                   	push   %ebx
+    1130:	e8 da 2d 00 00       	call   3f0f <unlink>
+  for(i = 0; i < 2; i++){
+    1135:	83 c4 10             	add    $0x10,%esp
+    1138:	85 f6                	test   %esi,%esi
+    113a:	75 0a                	jne    1146 <fourfiles+0x116>
+    113c:	be 01 00 00 00       	mov    $0x1,%esi
+    1141:	e9 61 ff ff ff       	jmp    10a7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1146:	83 ec 08             	sub    $0x8,%esp
+    1149:	68 e5 47 00 00       	push   $0x47e5
+    114e:	6a 01                	push   $0x1
+    1150:	e8 db 2e 00 00       	call   4030 <printf>
+}
+    1155:	83 c4 10             	add    $0x10,%esp
+    1158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    115b:	5b                   	pop    %ebx
+    115c:	5e                   	pop    %esi
+    115d:	5f                   	pop    %edi
+    115e:	5d                   	pop    %ebp
+    115f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1160:	83 ec 08             	sub    $0x8,%esp
+    1163:	68 c8 47 00 00       	push   $0x47c8
+    1168:	6a 01                	push   $0x1
+    116a:	e8 c1 2e 00 00       	call   4030 <printf>
+          exit();
+    116f:	e8 4b 2d 00 00       	call   3ebf <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1174:	83 ec 08             	sub    $0x8,%esp
+    1177:	68 02 02 00 00       	push   $0x202
+    117c:	56                   	push   %esi
+    117d:	e8 7d 2d 00 00       	call   3eff <open>
+      if(fd < 0){
+    1182:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1185:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1187:	85 c0                	test   %eax,%eax
+    1189:	78 45                	js     11d0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    118b:	83 ec 04             	sub    $0x4,%esp
+    118e:	83 c3 30             	add    $0x30,%ebx
+    1191:	68 00 02 00 00       	push   $0x200
+    1196:	53                   	push   %ebx
+    1197:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    119c:	68 20 8e 00 00       	push   $0x8e20
+    11a1:	e8 4a 2b 00 00       	call   3cf0 <memset>
+    11a6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    11a9:	83 ec 04             	sub    $0x4,%esp
+    11ac:	68 f4 01 00 00       	push   $0x1f4
+    11b1:	68 20 8e 00 00       	push   $0x8e20
+    11b6:	56                   	push   %esi
+    11b7:	e8 23 2d 00 00       	call   3edf <write>
+    11bc:	83 c4 10             	add    $0x10,%esp
+    11bf:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    11c4:	75 49                	jne    120f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    11c6:	83 eb 01             	sub    $0x1,%ebx
+    11c9:	75 de                	jne    11a9 <fourfiles+0x179>
+      exit();
+    11cb:	e8 ef 2c 00 00       	call   3ebf <exit>
+        printf(1, "create failed\n");
+    11d0:	51                   	push   %ecx
+    11d1:	51                   	push   %ecx
+    11d2:	68 42 4a 00 00       	push   $0x4a42
+    11d7:	6a 01                	push   $0x1
+    11d9:	e8 52 2e 00 00       	call   4030 <printf>
+        exit();
+    11de:	e8 dc 2c 00 00       	call   3ebf <exit>
+    11e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11e7:	90                   	nop
+      printf(1, "fork failed\n");
+    11e8:	83 ec 08             	sub    $0x8,%esp
+    11eb:	68 64 54 00 00       	push   $0x5464
+    11f0:	6a 01                	push   $0x1
+    11f2:	e8 39 2e 00 00       	call   4030 <printf>
+      exit();
+    11f7:	e8 c3 2c 00 00       	call   3ebf <exit>
+      printf(1, "wrong length %d\n", total);
+    11fc:	50                   	push   %eax
+    11fd:	57                   	push   %edi
+    11fe:	68 d4 47 00 00       	push   $0x47d4
+    1203:	6a 01                	push   $0x1
+    1205:	e8 26 2e 00 00       	call   4030 <printf>
+      exit();
+    120a:	e8 b0 2c 00 00       	call   3ebf <exit>
+          printf(1, "write failed %d\n", n);
+    120f:	52                   	push   %edx
+    1210:	50                   	push   %eax
+    1211:	68 b7 47 00 00       	push   $0x47b7
+    1216:	6a 01                	push   $0x1
+    1218:	e8 13 2e 00 00       	call   4030 <printf>
+          exit();
+    121d:	e8 9d 2c 00 00       	call   3ebf <exit>
+    1222:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001230 <createdelete>:
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	57                   	push   %edi
+    1234:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1235:	31 f6                	xor    %esi,%esi
+{
+    1237:	53                   	push   %ebx
+    1238:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    123b:	68 f3 47 00 00       	push   $0x47f3
+    1240:	6a 01                	push   $0x1
+    1242:	e8 e9 2d 00 00       	call   4030 <printf>
+    1247:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    124a:	e8 68 2c 00 00       	call   3eb7 <fork>
+    124f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1251:	85 c0                	test   %eax,%eax
+    1253:	0f 88 ac 01 00 00    	js     1405 <createdelete+0x1d5>
+    if(pid == 0){
+    1259:	0f 84 01 01 00 00    	je     1360 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    125f:	83 c6 01             	add    $0x1,%esi
+    1262:	83 fe 04             	cmp    $0x4,%esi
+    1265:	75 e3                	jne    124a <createdelete+0x1a>
+    wait();
+    1267:	e8 5b 2c 00 00       	call   3ec7 <wait>
+  for(i = 0; i < N; i++){
+    126c:	31 ff                	xor    %edi,%edi
+    126e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1271:	e8 51 2c 00 00       	call   3ec7 <wait>
+    1276:	e8 4c 2c 00 00       	call   3ec7 <wait>
+    127b:	e8 47 2c 00 00       	call   3ec7 <wait>
+  name[0] = name[1] = name[2] = 0;
+    1280:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1284:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1288:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    128a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    128d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1292:	0f 94 c2             	sete   %dl
+    1295:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1298:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    129b:	0f 9f c0             	setg   %al
+    129e:	09 c2                	or     %eax,%edx
+    12a0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    12a3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    12a7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    12aa:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    12ad:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    12b0:	6a 00                	push   $0x0
+    12b2:	56                   	push   %esi
+    12b3:	e8 47 2c 00 00       	call   3eff <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    12b8:	83 c4 10             	add    $0x10,%esp
+    12bb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    12bf:	74 7f                	je     1340 <createdelete+0x110>
+    12c1:	85 c0                	test   %eax,%eax
+    12c3:	0f 88 27 01 00 00    	js     13f0 <createdelete+0x1c0>
+        close(fd);
+    12c9:	83 ec 0c             	sub    $0xc,%esp
+    12cc:	50                   	push   %eax
+    12cd:	e8 15 2c 00 00       	call   3ee7 <close>
+    12d2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    12d5:	83 c3 01             	add    $0x1,%ebx
+    12d8:	80 fb 74             	cmp    $0x74,%bl
+    12db:	75 c6                	jne    12a3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    12dd:	83 c7 01             	add    $0x1,%edi
+    12e0:	83 ff 14             	cmp    $0x14,%edi
+    12e3:	75 a3                	jne    1288 <createdelete+0x58>
+    12e5:	bf 70 00 00 00       	mov    $0x70,%edi
+    12ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    12f0:	8d 47 c0             	lea    -0x40(%edi),%eax
+    12f3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    12f8:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    12fb:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    12fd:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1300:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1303:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1307:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    130a:	56                   	push   %esi
+    130b:	e8 ff 2b 00 00       	call   3f0f <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1310:	83 c4 10             	add    $0x10,%esp
+    1313:	83 eb 01             	sub    $0x1,%ebx
+    1316:	75 e3                	jne    12fb <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1318:	83 c7 01             	add    $0x1,%edi
+    131b:	89 f8                	mov    %edi,%eax
+    131d:	3c 84                	cmp    $0x84,%al
+    131f:	75 cf                	jne    12f0 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1321:	83 ec 08             	sub    $0x8,%esp
+    1324:	68 06 48 00 00       	push   $0x4806
+    1329:	6a 01                	push   $0x1
+    132b:	e8 00 2d 00 00       	call   4030 <printf>
+}
+    1330:	83 c4 10             	add    $0x10,%esp
+    1333:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1336:	5b                   	pop    %ebx
+    1337:	5e                   	pop    %esi
+    1338:	5f                   	pop    %edi
+    1339:	5d                   	pop    %ebp
+    133a:	c3                   	ret
+    133b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    133f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1340:	85 c0                	test   %eax,%eax
+    1342:	78 91                	js     12d5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1344:	50                   	push   %eax
+    1345:	56                   	push   %esi
+    1346:	68 bc 56 00 00       	push   $0x56bc
+    134b:	6a 01                	push   $0x1
+    134d:	e8 de 2c 00 00       	call   4030 <printf>
+        exit();
+    1352:	e8 68 2b 00 00       	call   3ebf <exit>
+    1357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    135e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1360:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1363:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1367:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    136a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    136d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1370:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1373:	8d 43 30             	lea    0x30(%ebx),%eax
+    1376:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1379:	68 02 02 00 00       	push   $0x202
+    137e:	56                   	push   %esi
+    137f:	e8 7b 2b 00 00       	call   3eff <open>
+        if(fd < 0){
+    1384:	83 c4 10             	add    $0x10,%esp
+    1387:	85 c0                	test   %eax,%eax
+    1389:	0f 88 8a 00 00 00    	js     1419 <createdelete+0x1e9>
+        close(fd);
+    138f:	83 ec 0c             	sub    $0xc,%esp
+    1392:	50                   	push   %eax
+    1393:	e8 4f 2b 00 00       	call   3ee7 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1398:	83 c4 10             	add    $0x10,%esp
+    139b:	85 db                	test   %ebx,%ebx
+    139d:	74 19                	je     13b8 <createdelete+0x188>
+    139f:	f6 c3 01             	test   $0x1,%bl
+    13a2:	74 1b                	je     13bf <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    13a4:	83 c3 01             	add    $0x1,%ebx
+    13a7:	83 fb 14             	cmp    $0x14,%ebx
+    13aa:	75 c4                	jne    1370 <createdelete+0x140>
+      exit();
+    13ac:	e8 0e 2b 00 00       	call   3ebf <exit>
+    13b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    13b8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    13bd:	eb b1                	jmp    1370 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    13bf:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    13c1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    13c4:	d1 f8                	sar    %eax
+    13c6:	83 c0 30             	add    $0x30,%eax
+    13c9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    13cc:	56                   	push   %esi
+    13cd:	e8 3d 2b 00 00       	call   3f0f <unlink>
+    13d2:	83 c4 10             	add    $0x10,%esp
+    13d5:	85 c0                	test   %eax,%eax
+    13d7:	79 cb                	jns    13a4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    13d9:	52                   	push   %edx
+    13da:	52                   	push   %edx
+    13db:	68 39 4b 00 00       	push   $0x4b39
+    13e0:	6a 01                	push   $0x1
+    13e2:	e8 49 2c 00 00       	call   4030 <printf>
+            exit();
+    13e7:	e8 d3 2a 00 00       	call   3ebf <exit>
+    13ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    13f0:	83 ec 04             	sub    $0x4,%esp
+    13f3:	56                   	push   %esi
+    13f4:	68 98 56 00 00       	push   $0x5698
+    13f9:	6a 01                	push   $0x1
+    13fb:	e8 30 2c 00 00       	call   4030 <printf>
+        exit();
+    1400:	e8 ba 2a 00 00       	call   3ebf <exit>
+      printf(1, "fork failed\n");
+    1405:	83 ec 08             	sub    $0x8,%esp
+    1408:	68 64 54 00 00       	push   $0x5464
+    140d:	6a 01                	push   $0x1
+    140f:	e8 1c 2c 00 00       	call   4030 <printf>
+      exit();
+    1414:	e8 a6 2a 00 00       	call   3ebf <exit>
+          printf(1, "create failed\n");
+    1419:	83 ec 08             	sub    $0x8,%esp
+    141c:	68 42 4a 00 00       	push   $0x4a42
+    1421:	6a 01                	push   $0x1
+    1423:	e8 08 2c 00 00       	call   4030 <printf>
+          exit();
+    1428:	e8 92 2a 00 00       	call   3ebf <exit>
+    142d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001430 <unlinkread>:
+{
+    1430:	55                   	push   %ebp
+    1431:	89 e5                	mov    %esp,%ebp
+    1433:	56                   	push   %esi
+    1434:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1435:	83 ec 08             	sub    $0x8,%esp
+    1438:	68 17 48 00 00       	push   $0x4817
+    143d:	6a 01                	push   $0x1
+    143f:	e8 ec 2b 00 00       	call   4030 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1444:	5b                   	pop    %ebx
+    1445:	5e                   	pop    %esi
+    1446:	68 02 02 00 00       	push   $0x202
+    144b:	68 28 48 00 00       	push   $0x4828
+    1450:	e8 aa 2a 00 00       	call   3eff <open>
+  if(fd < 0){
+    1455:	83 c4 10             	add    $0x10,%esp
+    1458:	85 c0                	test   %eax,%eax
+    145a:	0f 88 e6 00 00 00    	js     1546 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1460:	83 ec 04             	sub    $0x4,%esp
+    1463:	89 c3                	mov    %eax,%ebx
+    1465:	6a 05                	push   $0x5
+    1467:	68 4d 48 00 00       	push   $0x484d
+    146c:	50                   	push   %eax
+    146d:	e8 6d 2a 00 00       	call   3edf <write>
+  close(fd);
+    1472:	89 1c 24             	mov    %ebx,(%esp)
+    1475:	e8 6d 2a 00 00       	call   3ee7 <close>
+  fd = open("unlinkread", O_RDWR);
+    147a:	58                   	pop    %eax
+    147b:	5a                   	pop    %edx
+    147c:	6a 02                	push   $0x2
+    147e:	68 28 48 00 00       	push   $0x4828
+    1483:	e8 77 2a 00 00       	call   3eff <open>
+  if(fd < 0){
+    1488:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    148b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    148d:	85 c0                	test   %eax,%eax
+    148f:	0f 88 10 01 00 00    	js     15a5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1495:	83 ec 0c             	sub    $0xc,%esp
+    1498:	68 28 48 00 00       	push   $0x4828
+    149d:	e8 6d 2a 00 00       	call   3f0f <unlink>
+    14a2:	83 c4 10             	add    $0x10,%esp
+    14a5:	85 c0                	test   %eax,%eax
+    14a7:	0f 85 e5 00 00 00    	jne    1592 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14ad:	83 ec 08             	sub    $0x8,%esp
+    14b0:	68 02 02 00 00       	push   $0x202
+    14b5:	68 28 48 00 00       	push   $0x4828
+    14ba:	e8 40 2a 00 00       	call   3eff <open>
+  write(fd1, "yyy", 3);
+    14bf:	83 c4 0c             	add    $0xc,%esp
+    14c2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14c4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    14c6:	68 85 48 00 00       	push   $0x4885
+    14cb:	50                   	push   %eax
+    14cc:	e8 0e 2a 00 00       	call   3edf <write>
+  close(fd1);
+    14d1:	89 34 24             	mov    %esi,(%esp)
+    14d4:	e8 0e 2a 00 00       	call   3ee7 <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    14d9:	83 c4 0c             	add    $0xc,%esp
+    14dc:	68 00 20 00 00       	push   $0x2000
+    14e1:	68 20 8e 00 00       	push   $0x8e20
+    14e6:	53                   	push   %ebx
+    14e7:	e8 eb 29 00 00       	call   3ed7 <read>
+    14ec:	83 c4 10             	add    $0x10,%esp
+    14ef:	83 f8 05             	cmp    $0x5,%eax
+    14f2:	0f 85 87 00 00 00    	jne    157f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    14f8:	80 3d 20 8e 00 00 68 	cmpb   $0x68,0x8e20
+    14ff:	75 6b                	jne    156c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1501:	83 ec 04             	sub    $0x4,%esp
+    1504:	6a 0a                	push   $0xa
+    1506:	68 20 8e 00 00       	push   $0x8e20
+    150b:	53                   	push   %ebx
+    150c:	e8 ce 29 00 00       	call   3edf <write>
+    1511:	83 c4 10             	add    $0x10,%esp
+    1514:	83 f8 0a             	cmp    $0xa,%eax
+    1517:	75 40                	jne    1559 <unlinkread+0x129>
+  close(fd);
+    1519:	83 ec 0c             	sub    $0xc,%esp
+    151c:	53                   	push   %ebx
+    151d:	e8 c5 29 00 00       	call   3ee7 <close>
+  unlink("unlinkread");
+    1522:	c7 04 24 28 48 00 00 	movl   $0x4828,(%esp)
+    1529:	e8 e1 29 00 00       	call   3f0f <unlink>
+  printf(1, "unlinkread ok\n");
+    152e:	58                   	pop    %eax
+    152f:	5a                   	pop    %edx
+    1530:	68 d0 48 00 00       	push   $0x48d0
+    1535:	6a 01                	push   $0x1
+    1537:	e8 f4 2a 00 00       	call   4030 <printf>
+}
+    153c:	83 c4 10             	add    $0x10,%esp
+    153f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1542:	5b                   	pop    %ebx
+    1543:	5e                   	pop    %esi
+    1544:	5d                   	pop    %ebp
+    1545:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1546:	51                   	push   %ecx
+    1547:	51                   	push   %ecx
+    1548:	68 33 48 00 00       	push   $0x4833
+    154d:	6a 01                	push   $0x1
+    154f:	e8 dc 2a 00 00       	call   4030 <printf>
+    exit();
+    1554:	e8 66 29 00 00       	call   3ebf <exit>
+    printf(1, "unlinkread write failed\n");
+    1559:	51                   	push   %ecx
+    155a:	51                   	push   %ecx
+    155b:	68 b7 48 00 00       	push   $0x48b7
+    1560:	6a 01                	push   $0x1
+    1562:	e8 c9 2a 00 00       	call   4030 <printf>
+    exit();
+    1567:	e8 53 29 00 00       	call   3ebf <exit>
+    printf(1, "unlinkread wrong data\n");
+    156c:	53                   	push   %ebx
+    156d:	53                   	push   %ebx
+    156e:	68 a0 48 00 00       	push   $0x48a0
+    1573:	6a 01                	push   $0x1
+    1575:	e8 b6 2a 00 00       	call   4030 <printf>
+    exit();
+    157a:	e8 40 29 00 00       	call   3ebf <exit>
+    printf(1, "unlinkread read failed");
+    157f:	56                   	push   %esi
+    1580:	56                   	push   %esi
+    1581:	68 89 48 00 00       	push   $0x4889
+    1586:	6a 01                	push   $0x1
+    1588:	e8 a3 2a 00 00       	call   4030 <printf>
+    exit();
+    158d:	e8 2d 29 00 00       	call   3ebf <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1592:	50                   	push   %eax
+    1593:	50                   	push   %eax
+    1594:	68 6b 48 00 00       	push   $0x486b
+    1599:	6a 01                	push   $0x1
+    159b:	e8 90 2a 00 00       	call   4030 <printf>
+    exit();
+    15a0:	e8 1a 29 00 00       	call   3ebf <exit>
+    printf(1, "open unlinkread failed\n");
+    15a5:	50                   	push   %eax
+    15a6:	50                   	push   %eax
+    15a7:	68 53 48 00 00       	push   $0x4853
+    15ac:	6a 01                	push   $0x1
+    15ae:	e8 7d 2a 00 00       	call   4030 <printf>
+    exit();
+    15b3:	e8 07 29 00 00       	call   3ebf <exit>
+    15b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15bf:	90                   	nop
+
+000015c0 <linktest>:
+{
+    15c0:	55                   	push   %ebp
+    15c1:	89 e5                	mov    %esp,%ebp
+    15c3:	53                   	push   %ebx
+    15c4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    15c7:	68 df 48 00 00       	push   $0x48df
+    15cc:	6a 01                	push   $0x1
+    15ce:	e8 5d 2a 00 00       	call   4030 <printf>
+  unlink("lf1");
+    15d3:	c7 04 24 e9 48 00 00 	movl   $0x48e9,(%esp)
+    15da:	e8 30 29 00 00       	call   3f0f <unlink>
+  unlink("lf2");
+    15df:	c7 04 24 ed 48 00 00 	movl   $0x48ed,(%esp)
+    15e6:	e8 24 29 00 00       	call   3f0f <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    15eb:	58                   	pop    %eax
+    15ec:	5a                   	pop    %edx
+    15ed:	68 02 02 00 00       	push   $0x202
+    15f2:	68 e9 48 00 00       	push   $0x48e9
+    15f7:	e8 03 29 00 00       	call   3eff <open>
+  if(fd < 0){
+    15fc:	83 c4 10             	add    $0x10,%esp
+    15ff:	85 c0                	test   %eax,%eax
+    1601:	0f 88 1e 01 00 00    	js     1725 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1607:	83 ec 04             	sub    $0x4,%esp
+    160a:	89 c3                	mov    %eax,%ebx
+    160c:	6a 05                	push   $0x5
+    160e:	68 4d 48 00 00       	push   $0x484d
+    1613:	50                   	push   %eax
+    1614:	e8 c6 28 00 00       	call   3edf <write>
+    1619:	83 c4 10             	add    $0x10,%esp
+    161c:	83 f8 05             	cmp    $0x5,%eax
+    161f:	0f 85 98 01 00 00    	jne    17bd <linktest+0x1fd>
+  close(fd);
+    1625:	83 ec 0c             	sub    $0xc,%esp
+    1628:	53                   	push   %ebx
+    1629:	e8 b9 28 00 00       	call   3ee7 <close>
+  if(link("lf1", "lf2") < 0){
+    162e:	5b                   	pop    %ebx
+    162f:	58                   	pop    %eax
+    1630:	68 ed 48 00 00       	push   $0x48ed
+    1635:	68 e9 48 00 00       	push   $0x48e9
+    163a:	e8 e0 28 00 00       	call   3f1f <link>
+    163f:	83 c4 10             	add    $0x10,%esp
+    1642:	85 c0                	test   %eax,%eax
+    1644:	0f 88 60 01 00 00    	js     17aa <linktest+0x1ea>
+  unlink("lf1");
+    164a:	83 ec 0c             	sub    $0xc,%esp
+    164d:	68 e9 48 00 00       	push   $0x48e9
+    1652:	e8 b8 28 00 00       	call   3f0f <unlink>
+  if(open("lf1", 0) >= 0){
+    1657:	58                   	pop    %eax
+    1658:	5a                   	pop    %edx
+    1659:	6a 00                	push   $0x0
+    165b:	68 e9 48 00 00       	push   $0x48e9
+    1660:	e8 9a 28 00 00       	call   3eff <open>
+    1665:	83 c4 10             	add    $0x10,%esp
+    1668:	85 c0                	test   %eax,%eax
+    166a:	0f 89 27 01 00 00    	jns    1797 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1670:	83 ec 08             	sub    $0x8,%esp
+    1673:	6a 00                	push   $0x0
+    1675:	68 ed 48 00 00       	push   $0x48ed
+    167a:	e8 80 28 00 00       	call   3eff <open>
+  if(fd < 0){
+    167f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1682:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1684:	85 c0                	test   %eax,%eax
+    1686:	0f 88 f8 00 00 00    	js     1784 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    168c:	83 ec 04             	sub    $0x4,%esp
+    168f:	68 00 20 00 00       	push   $0x2000
+    1694:	68 20 8e 00 00       	push   $0x8e20
+    1699:	50                   	push   %eax
+    169a:	e8 38 28 00 00       	call   3ed7 <read>
+    169f:	83 c4 10             	add    $0x10,%esp
+    16a2:	83 f8 05             	cmp    $0x5,%eax
+    16a5:	0f 85 c6 00 00 00    	jne    1771 <linktest+0x1b1>
+  close(fd);
+    16ab:	83 ec 0c             	sub    $0xc,%esp
+    16ae:	53                   	push   %ebx
+    16af:	e8 33 28 00 00       	call   3ee7 <close>
+  if(link("lf2", "lf2") >= 0){
+    16b4:	58                   	pop    %eax
+    16b5:	5a                   	pop    %edx
+    16b6:	68 ed 48 00 00       	push   $0x48ed
+    16bb:	68 ed 48 00 00       	push   $0x48ed
+    16c0:	e8 5a 28 00 00       	call   3f1f <link>
+    16c5:	83 c4 10             	add    $0x10,%esp
+    16c8:	85 c0                	test   %eax,%eax
+    16ca:	0f 89 8e 00 00 00    	jns    175e <linktest+0x19e>
+  unlink("lf2");
+    16d0:	83 ec 0c             	sub    $0xc,%esp
+    16d3:	68 ed 48 00 00       	push   $0x48ed
+    16d8:	e8 32 28 00 00       	call   3f0f <unlink>
+  if(link("lf2", "lf1") >= 0){
+    16dd:	59                   	pop    %ecx
+    16de:	5b                   	pop    %ebx
+    16df:	68 e9 48 00 00       	push   $0x48e9
+    16e4:	68 ed 48 00 00       	push   $0x48ed
+    16e9:	e8 31 28 00 00       	call   3f1f <link>
+    16ee:	83 c4 10             	add    $0x10,%esp
+    16f1:	85 c0                	test   %eax,%eax
+    16f3:	79 56                	jns    174b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    16f5:	83 ec 08             	sub    $0x8,%esp
+    16f8:	68 e9 48 00 00       	push   $0x48e9
+    16fd:	68 9a 4c 00 00       	push   $0x4c9a
+    1702:	e8 18 28 00 00       	call   3f1f <link>
+    1707:	83 c4 10             	add    $0x10,%esp
+    170a:	85 c0                	test   %eax,%eax
+    170c:	79 2a                	jns    1738 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    170e:	83 ec 08             	sub    $0x8,%esp
+    1711:	68 87 49 00 00       	push   $0x4987
+    1716:	6a 01                	push   $0x1
+    1718:	e8 13 29 00 00       	call   4030 <printf>
+}
+    171d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1720:	83 c4 10             	add    $0x10,%esp
+    1723:	c9                   	leave
+    1724:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1725:	50                   	push   %eax
+    1726:	50                   	push   %eax
+    1727:	68 f1 48 00 00       	push   $0x48f1
+    172c:	6a 01                	push   $0x1
+    172e:	e8 fd 28 00 00       	call   4030 <printf>
+    exit();
+    1733:	e8 87 27 00 00       	call   3ebf <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1738:	50                   	push   %eax
+    1739:	50                   	push   %eax
+    173a:	68 6b 49 00 00       	push   $0x496b
+    173f:	6a 01                	push   $0x1
+    1741:	e8 ea 28 00 00       	call   4030 <printf>
+    exit();
+    1746:	e8 74 27 00 00       	call   3ebf <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    174b:	52                   	push   %edx
+    174c:	52                   	push   %edx
+    174d:	68 04 57 00 00       	push   $0x5704
+    1752:	6a 01                	push   $0x1
+    1754:	e8 d7 28 00 00       	call   4030 <printf>
+    exit();
+    1759:	e8 61 27 00 00       	call   3ebf <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    175e:	50                   	push   %eax
+    175f:	50                   	push   %eax
+    1760:	68 4d 49 00 00       	push   $0x494d
+    1765:	6a 01                	push   $0x1
+    1767:	e8 c4 28 00 00       	call   4030 <printf>
+    exit();
+    176c:	e8 4e 27 00 00       	call   3ebf <exit>
+    printf(1, "read lf2 failed\n");
+    1771:	51                   	push   %ecx
+    1772:	51                   	push   %ecx
+    1773:	68 3c 49 00 00       	push   $0x493c
+    1778:	6a 01                	push   $0x1
+    177a:	e8 b1 28 00 00       	call   4030 <printf>
+    exit();
+    177f:	e8 3b 27 00 00       	call   3ebf <exit>
+    printf(1, "open lf2 failed\n");
+    1784:	53                   	push   %ebx
+    1785:	53                   	push   %ebx
+    1786:	68 2b 49 00 00       	push   $0x492b
+    178b:	6a 01                	push   $0x1
+    178d:	e8 9e 28 00 00       	call   4030 <printf>
+    exit();
+    1792:	e8 28 27 00 00       	call   3ebf <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1797:	50                   	push   %eax
+    1798:	50                   	push   %eax
+    1799:	68 dc 56 00 00       	push   $0x56dc
+    179e:	6a 01                	push   $0x1
+    17a0:	e8 8b 28 00 00       	call   4030 <printf>
+    exit();
+    17a5:	e8 15 27 00 00       	call   3ebf <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    17aa:	51                   	push   %ecx
+    17ab:	51                   	push   %ecx
+    17ac:	68 16 49 00 00       	push   $0x4916
+    17b1:	6a 01                	push   $0x1
+    17b3:	e8 78 28 00 00       	call   4030 <printf>
+    exit();
+    17b8:	e8 02 27 00 00       	call   3ebf <exit>
+    printf(1, "write lf1 failed\n");
+    17bd:	50                   	push   %eax
+    17be:	50                   	push   %eax
+    17bf:	68 04 49 00 00       	push   $0x4904
+    17c4:	6a 01                	push   $0x1
+    17c6:	e8 65 28 00 00       	call   4030 <printf>
+    exit();
+    17cb:	e8 ef 26 00 00       	call   3ebf <exit>
+
+000017d0 <concreate>:
+{
+    17d0:	55                   	push   %ebp
+    17d1:	89 e5                	mov    %esp,%ebp
+    17d3:	57                   	push   %edi
+    17d4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    17d5:	31 f6                	xor    %esi,%esi
+{
+    17d7:	53                   	push   %ebx
+    17d8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    17db:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    17de:	68 94 49 00 00       	push   $0x4994
+    17e3:	6a 01                	push   $0x1
+    17e5:	e8 46 28 00 00       	call   4030 <printf>
+  file[0] = 'C';
+    17ea:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    17ee:	83 c4 10             	add    $0x10,%esp
+    17f1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    17f5:	eb 4c                	jmp    1843 <concreate+0x73>
+    17f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17fe:	66 90                	xchg   %ax,%ax
+    1800:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1806:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    180b:	0f 83 8f 00 00 00    	jae    18a0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1811:	83 ec 08             	sub    $0x8,%esp
+    1814:	68 02 02 00 00       	push   $0x202
+    1819:	53                   	push   %ebx
+    181a:	e8 e0 26 00 00       	call   3eff <open>
+      if(fd < 0){
+    181f:	83 c4 10             	add    $0x10,%esp
+    1822:	85 c0                	test   %eax,%eax
+    1824:	78 63                	js     1889 <concreate+0xb9>
+      close(fd);
+    1826:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1829:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    182c:	50                   	push   %eax
+    182d:	e8 b5 26 00 00       	call   3ee7 <close>
+    1832:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1835:	e8 8d 26 00 00       	call   3ec7 <wait>
+  for(i = 0; i < 40; i++){
+    183a:	83 fe 28             	cmp    $0x28,%esi
+    183d:	0f 84 7f 00 00 00    	je     18c2 <concreate+0xf2>
+    unlink(file);
+    1843:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1846:	8d 46 30             	lea    0x30(%esi),%eax
+    1849:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    184c:	53                   	push   %ebx
+    184d:	e8 bd 26 00 00       	call   3f0f <unlink>
+    pid = fork();
+    1852:	e8 60 26 00 00       	call   3eb7 <fork>
+    if(pid && (i % 3) == 1){
+    1857:	83 c4 10             	add    $0x10,%esp
+    185a:	85 c0                	test   %eax,%eax
+    185c:	75 a2                	jne    1800 <concreate+0x30>
+      link("C0", file);
+    185e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1864:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    186a:	0f 83 d0 00 00 00    	jae    1940 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1870:	83 ec 08             	sub    $0x8,%esp
+    1873:	68 02 02 00 00       	push   $0x202
+    1878:	53                   	push   %ebx
+    1879:	e8 81 26 00 00       	call   3eff <open>
+      if(fd < 0){
+    187e:	83 c4 10             	add    $0x10,%esp
+    1881:	85 c0                	test   %eax,%eax
+    1883:	0f 89 ea 01 00 00    	jns    1a73 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1889:	83 ec 04             	sub    $0x4,%esp
+    188c:	53                   	push   %ebx
+    188d:	68 a7 49 00 00       	push   $0x49a7
+    1892:	6a 01                	push   $0x1
+    1894:	e8 97 27 00 00       	call   4030 <printf>
+        exit();
+    1899:	e8 21 26 00 00       	call   3ebf <exit>
+    189e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    18a0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    18a3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    18a6:	53                   	push   %ebx
+    18a7:	68 a4 49 00 00       	push   $0x49a4
+    18ac:	e8 6e 26 00 00       	call   3f1f <link>
+    18b1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    18b4:	e8 0e 26 00 00       	call   3ec7 <wait>
+  for(i = 0; i < 40; i++){
+    18b9:	83 fe 28             	cmp    $0x28,%esi
+    18bc:	0f 85 81 ff ff ff    	jne    1843 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    18c2:	83 ec 04             	sub    $0x4,%esp
+    18c5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    18c8:	6a 28                	push   $0x28
+    18ca:	6a 00                	push   $0x0
+    18cc:	50                   	push   %eax
+    18cd:	e8 1e 24 00 00       	call   3cf0 <memset>
+  fd = open(".", 0);
+    18d2:	5e                   	pop    %esi
+    18d3:	5f                   	pop    %edi
+    18d4:	6a 00                	push   $0x0
+    18d6:	68 9a 4c 00 00       	push   $0x4c9a
+    18db:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    18de:	e8 1c 26 00 00       	call   3eff <open>
+  n = 0;
+    18e3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    18ea:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    18ed:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    18ef:	90                   	nop
+    18f0:	83 ec 04             	sub    $0x4,%esp
+    18f3:	6a 10                	push   $0x10
+    18f5:	57                   	push   %edi
+    18f6:	56                   	push   %esi
+    18f7:	e8 db 25 00 00       	call   3ed7 <read>
+    18fc:	83 c4 10             	add    $0x10,%esp
+    18ff:	85 c0                	test   %eax,%eax
+    1901:	7e 5d                	jle    1960 <concreate+0x190>
+    if(de.inum == 0)
+    1903:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1908:	74 e6                	je     18f0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    190a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    190e:	75 e0                	jne    18f0 <concreate+0x120>
+    1910:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1914:	75 da                	jne    18f0 <concreate+0x120>
+      i = de.name[1] - '0';
+    1916:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    191a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    191d:	83 f8 27             	cmp    $0x27,%eax
+    1920:	0f 87 5e 01 00 00    	ja     1a84 <concreate+0x2b4>
+      if(fa[i]){
+    1926:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    192b:	0f 85 7e 01 00 00    	jne    1aaf <concreate+0x2df>
+      n++;
+    1931:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1935:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    193a:	eb b4                	jmp    18f0 <concreate+0x120>
+    193c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1940:	83 ec 08             	sub    $0x8,%esp
+    1943:	53                   	push   %ebx
+    1944:	68 a4 49 00 00       	push   $0x49a4
+    1949:	e8 d1 25 00 00       	call   3f1f <link>
+    194e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1951:	e8 69 25 00 00       	call   3ebf <exit>
+    1956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    195d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1960:	83 ec 0c             	sub    $0xc,%esp
+    1963:	56                   	push   %esi
+    1964:	e8 7e 25 00 00       	call   3ee7 <close>
+  if(n != 40){
+    1969:	83 c4 10             	add    $0x10,%esp
+    196c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1970:	0f 85 26 01 00 00    	jne    1a9c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1976:	31 f6                	xor    %esi,%esi
+    1978:	eb 48                	jmp    19c2 <concreate+0x1f2>
+    197a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1980:	85 ff                	test   %edi,%edi
+    1982:	74 05                	je     1989 <concreate+0x1b9>
+    1984:	83 f8 01             	cmp    $0x1,%eax
+    1987:	74 68                	je     19f1 <concreate+0x221>
+      unlink(file);
+    1989:	83 ec 0c             	sub    $0xc,%esp
+    198c:	53                   	push   %ebx
+    198d:	e8 7d 25 00 00       	call   3f0f <unlink>
+      unlink(file);
+    1992:	89 1c 24             	mov    %ebx,(%esp)
+    1995:	e8 75 25 00 00       	call   3f0f <unlink>
+      unlink(file);
+    199a:	89 1c 24             	mov    %ebx,(%esp)
+    199d:	e8 6d 25 00 00       	call   3f0f <unlink>
+      unlink(file);
+    19a2:	89 1c 24             	mov    %ebx,(%esp)
+    19a5:	e8 65 25 00 00       	call   3f0f <unlink>
+    19aa:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    19ad:	85 ff                	test   %edi,%edi
+    19af:	74 a0                	je     1951 <concreate+0x181>
+      wait();
+    19b1:	e8 11 25 00 00       	call   3ec7 <wait>
+  for(i = 0; i < 40; i++){
+    19b6:	83 c6 01             	add    $0x1,%esi
+    19b9:	83 fe 28             	cmp    $0x28,%esi
+    19bc:	0f 84 86 00 00 00    	je     1a48 <concreate+0x278>
+    file[1] = '0' + i;
+    19c2:	8d 46 30             	lea    0x30(%esi),%eax
+    19c5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    19c8:	e8 ea 24 00 00       	call   3eb7 <fork>
+    19cd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    19cf:	85 c0                	test   %eax,%eax
+    19d1:	0f 88 88 00 00 00    	js     1a5f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    19d7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    19dc:	f7 e6                	mul    %esi
+    19de:	89 d0                	mov    %edx,%eax
+    19e0:	83 e2 fe             	and    $0xfffffffe,%edx
+    19e3:	d1 e8                	shr    %eax
+    19e5:	01 c2                	add    %eax,%edx
+    19e7:	89 f0                	mov    %esi,%eax
+    19e9:	29 d0                	sub    %edx,%eax
+    19eb:	89 c1                	mov    %eax,%ecx
+    19ed:	09 f9                	or     %edi,%ecx
+    19ef:	75 8f                	jne    1980 <concreate+0x1b0>
+      close(open(file, 0));
+    19f1:	83 ec 08             	sub    $0x8,%esp
+    19f4:	6a 00                	push   $0x0
+    19f6:	53                   	push   %ebx
+    19f7:	e8 03 25 00 00       	call   3eff <open>
+    19fc:	89 04 24             	mov    %eax,(%esp)
+    19ff:	e8 e3 24 00 00       	call   3ee7 <close>
+      close(open(file, 0));
+    1a04:	58                   	pop    %eax
+    1a05:	5a                   	pop    %edx
+    1a06:	6a 00                	push   $0x0
+    1a08:	53                   	push   %ebx
+    1a09:	e8 f1 24 00 00       	call   3eff <open>
+    1a0e:	89 04 24             	mov    %eax,(%esp)
+    1a11:	e8 d1 24 00 00       	call   3ee7 <close>
+      close(open(file, 0));
+    1a16:	59                   	pop    %ecx
+    1a17:	58                   	pop    %eax
+    1a18:	6a 00                	push   $0x0
+    1a1a:	53                   	push   %ebx
+    1a1b:	e8 df 24 00 00       	call   3eff <open>
+    1a20:	89 04 24             	mov    %eax,(%esp)
+    1a23:	e8 bf 24 00 00       	call   3ee7 <close>
+      close(open(file, 0));
+    1a28:	58                   	pop    %eax
+    1a29:	5a                   	pop    %edx
+    1a2a:	6a 00                	push   $0x0
+    1a2c:	53                   	push   %ebx
+    1a2d:	e8 cd 24 00 00       	call   3eff <open>
+    1a32:	89 04 24             	mov    %eax,(%esp)
+    1a35:	e8 ad 24 00 00       	call   3ee7 <close>
+    1a3a:	83 c4 10             	add    $0x10,%esp
+    1a3d:	e9 6b ff ff ff       	jmp    19ad <concreate+0x1dd>
+    1a42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1a48:	83 ec 08             	sub    $0x8,%esp
+    1a4b:	68 f9 49 00 00       	push   $0x49f9
+    1a50:	6a 01                	push   $0x1
+    1a52:	e8 d9 25 00 00       	call   4030 <printf>
+}
+    1a57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a5a:	5b                   	pop    %ebx
+    1a5b:	5e                   	pop    %esi
+    1a5c:	5f                   	pop    %edi
+    1a5d:	5d                   	pop    %ebp
+    1a5e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1a5f:	83 ec 08             	sub    $0x8,%esp
+    1a62:	68 64 54 00 00       	push   $0x5464
+    1a67:	6a 01                	push   $0x1
+    1a69:	e8 c2 25 00 00       	call   4030 <printf>
+      exit();
+    1a6e:	e8 4c 24 00 00       	call   3ebf <exit>
+      close(fd);
+    1a73:	83 ec 0c             	sub    $0xc,%esp
+    1a76:	50                   	push   %eax
+    1a77:	e8 6b 24 00 00       	call   3ee7 <close>
+    1a7c:	83 c4 10             	add    $0x10,%esp
+    1a7f:	e9 cd fe ff ff       	jmp    1951 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1a84:	83 ec 04             	sub    $0x4,%esp
+    1a87:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1a8a:	50                   	push   %eax
+    1a8b:	68 c3 49 00 00       	push   $0x49c3
+    1a90:	6a 01                	push   $0x1
+    1a92:	e8 99 25 00 00       	call   4030 <printf>
+        exit();
+    1a97:	e8 23 24 00 00       	call   3ebf <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1a9c:	51                   	push   %ecx
+    1a9d:	51                   	push   %ecx
+    1a9e:	68 28 57 00 00       	push   $0x5728
+    1aa3:	6a 01                	push   $0x1
+    1aa5:	e8 86 25 00 00       	call   4030 <printf>
+    exit();
+    1aaa:	e8 10 24 00 00       	call   3ebf <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1aaf:	83 ec 04             	sub    $0x4,%esp
+    1ab2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1ab5:	50                   	push   %eax
+    1ab6:	68 dc 49 00 00       	push   $0x49dc
+    1abb:	6a 01                	push   $0x1
+    1abd:	e8 6e 25 00 00       	call   4030 <printf>
+        exit();
+    1ac2:	e8 f8 23 00 00       	call   3ebf <exit>
+    1ac7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ace:	66 90                	xchg   %ax,%ax
+
+00001ad0 <linkunlink>:
+{
+    1ad0:	55                   	push   %ebp
+    1ad1:	89 e5                	mov    %esp,%ebp
+    1ad3:	57                   	push   %edi
+    1ad4:	56                   	push   %esi
+    1ad5:	53                   	push   %ebx
+    1ad6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1ad9:	68 07 4a 00 00       	push   $0x4a07
+    1ade:	6a 01                	push   $0x1
+    1ae0:	e8 4b 25 00 00       	call   4030 <printf>
+  unlink("x");
+    1ae5:	c7 04 24 96 4a 00 00 	movl   $0x4a96,(%esp)
+    1aec:	e8 1e 24 00 00       	call   3f0f <unlink>
+  pid = fork();
+    1af1:	e8 c1 23 00 00       	call   3eb7 <fork>
+  if(pid < 0){
+    1af6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1af9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1afc:	85 c0                	test   %eax,%eax
+    1afe:	0f 88 b6 00 00 00    	js     1bba <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1b04:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1b08:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1b0d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1b12:	19 ff                	sbb    %edi,%edi
+    1b14:	83 e7 60             	and    $0x60,%edi
+    1b17:	83 c7 01             	add    $0x1,%edi
+    1b1a:	eb 1e                	jmp    1b3a <linkunlink+0x6a>
+    1b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1b20:	83 f8 01             	cmp    $0x1,%eax
+    1b23:	74 7b                	je     1ba0 <linkunlink+0xd0>
+      unlink("x");
+    1b25:	83 ec 0c             	sub    $0xc,%esp
+    1b28:	68 96 4a 00 00       	push   $0x4a96
+    1b2d:	e8 dd 23 00 00       	call   3f0f <unlink>
+    1b32:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b35:	83 eb 01             	sub    $0x1,%ebx
+    1b38:	74 41                	je     1b7b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1b3a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1b40:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1b46:	89 f8                	mov    %edi,%eax
+    1b48:	f7 e6                	mul    %esi
+    1b4a:	89 d0                	mov    %edx,%eax
+    1b4c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1b4f:	d1 e8                	shr    %eax
+    1b51:	01 c2                	add    %eax,%edx
+    1b53:	89 f8                	mov    %edi,%eax
+    1b55:	29 d0                	sub    %edx,%eax
+    1b57:	75 c7                	jne    1b20 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1b59:	83 ec 08             	sub    $0x8,%esp
+    1b5c:	68 02 02 00 00       	push   $0x202
+    1b61:	68 96 4a 00 00       	push   $0x4a96
+    1b66:	e8 94 23 00 00       	call   3eff <open>
+    1b6b:	89 04 24             	mov    %eax,(%esp)
+    1b6e:	e8 74 23 00 00       	call   3ee7 <close>
+    1b73:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b76:	83 eb 01             	sub    $0x1,%ebx
+    1b79:	75 bf                	jne    1b3a <linkunlink+0x6a>
+  if(pid)
+    1b7b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b7e:	85 c0                	test   %eax,%eax
+    1b80:	74 4b                	je     1bcd <linkunlink+0xfd>
+    wait();
+    1b82:	e8 40 23 00 00       	call   3ec7 <wait>
+  printf(1, "linkunlink ok\n");
+    1b87:	83 ec 08             	sub    $0x8,%esp
+    1b8a:	68 1c 4a 00 00       	push   $0x4a1c
+    1b8f:	6a 01                	push   $0x1
+    1b91:	e8 9a 24 00 00       	call   4030 <printf>
+}
+    1b96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b99:	5b                   	pop    %ebx
+    1b9a:	5e                   	pop    %esi
+    1b9b:	5f                   	pop    %edi
+    1b9c:	5d                   	pop    %ebp
+    1b9d:	c3                   	ret
+    1b9e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1ba0:	83 ec 08             	sub    $0x8,%esp
+    1ba3:	68 96 4a 00 00       	push   $0x4a96
+    1ba8:	68 18 4a 00 00       	push   $0x4a18
+    1bad:	e8 6d 23 00 00       	call   3f1f <link>
+    1bb2:	83 c4 10             	add    $0x10,%esp
+    1bb5:	e9 7b ff ff ff       	jmp    1b35 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1bba:	52                   	push   %edx
+    1bbb:	52                   	push   %edx
+    1bbc:	68 64 54 00 00       	push   $0x5464
+    1bc1:	6a 01                	push   $0x1
+    1bc3:	e8 68 24 00 00       	call   4030 <printf>
+    exit();
+    1bc8:	e8 f2 22 00 00       	call   3ebf <exit>
+    exit();
+    1bcd:	e8 ed 22 00 00       	call   3ebf <exit>
+    1bd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001be0 <bigdir>:
+{
+    1be0:	55                   	push   %ebp
+    1be1:	89 e5                	mov    %esp,%ebp
+    1be3:	57                   	push   %edi
+    1be4:	56                   	push   %esi
+    1be5:	53                   	push   %ebx
+    1be6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1be9:	68 2b 4a 00 00       	push   $0x4a2b
+    1bee:	6a 01                	push   $0x1
+    1bf0:	e8 3b 24 00 00       	call   4030 <printf>
+  unlink("bd");
+    1bf5:	c7 04 24 38 4a 00 00 	movl   $0x4a38,(%esp)
+    1bfc:	e8 0e 23 00 00       	call   3f0f <unlink>
+  fd = open("bd", O_CREATE);
+    1c01:	5a                   	pop    %edx
+    1c02:	59                   	pop    %ecx
+    1c03:	68 00 02 00 00       	push   $0x200
+    1c08:	68 38 4a 00 00       	push   $0x4a38
+    1c0d:	e8 ed 22 00 00       	call   3eff <open>
+  if(fd < 0){
+    1c12:	83 c4 10             	add    $0x10,%esp
+    1c15:	85 c0                	test   %eax,%eax
+    1c17:	0f 88 de 00 00 00    	js     1cfb <bigdir+0x11b>
+  close(fd);
+    1c1d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1c20:	31 f6                	xor    %esi,%esi
+    1c22:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1c25:	50                   	push   %eax
+    1c26:	e8 bc 22 00 00       	call   3ee7 <close>
+    1c2b:	83 c4 10             	add    $0x10,%esp
+    1c2e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1c30:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1c32:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1c35:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c39:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c3c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1c40:	83 c0 30             	add    $0x30,%eax
+    1c43:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1c46:	89 f0                	mov    %esi,%eax
+    1c48:	83 e0 3f             	and    $0x3f,%eax
+    1c4b:	83 c0 30             	add    $0x30,%eax
+    1c4e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1c51:	57                   	push   %edi
+    1c52:	68 38 4a 00 00       	push   $0x4a38
+    1c57:	e8 c3 22 00 00       	call   3f1f <link>
+    1c5c:	83 c4 10             	add    $0x10,%esp
+    1c5f:	89 c3                	mov    %eax,%ebx
+    1c61:	85 c0                	test   %eax,%eax
+    1c63:	75 6e                	jne    1cd3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1c65:	83 c6 01             	add    $0x1,%esi
+    1c68:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1c6e:	75 c0                	jne    1c30 <bigdir+0x50>
+  unlink("bd");
+    1c70:	83 ec 0c             	sub    $0xc,%esp
+    1c73:	68 38 4a 00 00       	push   $0x4a38
+    1c78:	e8 92 22 00 00       	call   3f0f <unlink>
+    1c7d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1c80:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1c82:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1c85:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c89:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c8c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1c90:	83 c0 30             	add    $0x30,%eax
+    1c93:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1c96:	89 d8                	mov    %ebx,%eax
+    1c98:	83 e0 3f             	and    $0x3f,%eax
+    1c9b:	83 c0 30             	add    $0x30,%eax
+    1c9e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1ca1:	57                   	push   %edi
+    1ca2:	e8 68 22 00 00       	call   3f0f <unlink>
+    1ca7:	83 c4 10             	add    $0x10,%esp
+    1caa:	85 c0                	test   %eax,%eax
+    1cac:	75 39                	jne    1ce7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1cae:	83 c3 01             	add    $0x1,%ebx
+    1cb1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1cb7:	75 c7                	jne    1c80 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1cb9:	83 ec 08             	sub    $0x8,%esp
+    1cbc:	68 7a 4a 00 00       	push   $0x4a7a
+    1cc1:	6a 01                	push   $0x1
+    1cc3:	e8 68 23 00 00       	call   4030 <printf>
+    1cc8:	83 c4 10             	add    $0x10,%esp
+}
+    1ccb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cce:	5b                   	pop    %ebx
+    1ccf:	5e                   	pop    %esi
+    1cd0:	5f                   	pop    %edi
+    1cd1:	5d                   	pop    %ebp
+    1cd2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1cd3:	83 ec 08             	sub    $0x8,%esp
+    1cd6:	68 51 4a 00 00       	push   $0x4a51
+    1cdb:	6a 01                	push   $0x1
+    1cdd:	e8 4e 23 00 00       	call   4030 <printf>
+      exit();
+    1ce2:	e8 d8 21 00 00       	call   3ebf <exit>
+      printf(1, "bigdir unlink failed");
+    1ce7:	83 ec 08             	sub    $0x8,%esp
+    1cea:	68 65 4a 00 00       	push   $0x4a65
+    1cef:	6a 01                	push   $0x1
+    1cf1:	e8 3a 23 00 00       	call   4030 <printf>
+      exit();
+    1cf6:	e8 c4 21 00 00       	call   3ebf <exit>
+    printf(1, "bigdir create failed\n");
+    1cfb:	50                   	push   %eax
+    1cfc:	50                   	push   %eax
+    1cfd:	68 3b 4a 00 00       	push   $0x4a3b
+    1d02:	6a 01                	push   $0x1
+    1d04:	e8 27 23 00 00       	call   4030 <printf>
+    exit();
+    1d09:	e8 b1 21 00 00       	call   3ebf <exit>
+    1d0e:	66 90                	xchg   %ax,%ax
+
+00001d10 <indexdir>:
+{
+    1d10:	55                   	push   %ebp
+    1d11:	89 e5                	mov    %esp,%ebp
+    1d13:	57                   	push   %edi
+    1d14:	56                   	push   %esi
+    1d15:	53                   	push   %ebx
+    1d16:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "indexdir test\n");
+    1d19:	68 85 4a 00 00       	push   $0x4a85
+    1d1e:	6a 01                	push   $0x1
+    1d20:	e8 0b 23 00 00       	call   4030 <printf>
+  if(mkdir("idx") != 0 || chdir("idx") != 0){
+    1d25:	c7 04 24 94 4a 00 00 	movl   $0x4a94,(%esp)
+    1d2c:	e8 f6 21 00 00       	call   3f27 <mkdir>
+    1d31:	83 c4 10             	add    $0x10,%esp
+    1d34:	85 c0                	test   %eax,%eax
+    1d36:	0f 85 6b 02 00 00    	jne    1fa7 <indexdir+0x297>
+    1d3c:	83 ec 0c             	sub    $0xc,%esp
+    1d3f:	68 94 4a 00 00       	push   $0x4a94
+    1d44:	e8 e6 21 00 00       	call   3f2f <chdir>
+    1d49:	83 c4 10             	add    $0x10,%esp
+    1d4c:	89 c3                	mov    %eax,%ebx
+    1d4e:	85 c0                	test   %eax,%eax
+    1d50:	0f 85 51 02 00 00    	jne    1fa7 <indexdir+0x297>
+  fd = open("f", O_CREATE|O_RDWR);
+    1d56:	83 ec 08             	sub    $0x8,%esp
+    1d59:	68 02 02 00 00       	push   $0x202
+    1d5e:	68 f8 4b 00 00       	push   $0x4bf8
+    1d63:	e8 97 21 00 00       	call   3eff <open>
+  if(fd < 0){
+    1d68:	83 c4 10             	add    $0x10,%esp
+    1d6b:	85 c0                	test   %eax,%eax
+    1d6d:	0f 88 21 02 00 00    	js     1f94 <indexdir+0x284>
+  close(fd);
+    1d73:	83 ec 0c             	sub    $0xc,%esp
+    1d76:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+    1d79:	50                   	push   %eax
+    1d7a:	e8 68 21 00 00       	call   3ee7 <close>
+  name[0] = 'x';
+    1d7f:	c6 45 e4 78          	movb   $0x78,-0x1c(%ebp)
+  name[3] = '\0';
+    1d83:	83 c4 10             	add    $0x10,%esp
+    1d86:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 400; i++){
+    1d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + i/64;
+    1d90:	89 d8                	mov    %ebx,%eax
+    if(link("f", name) != 0){
+    1d92:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i/64;
+    1d95:	c1 f8 06             	sar    $0x6,%eax
+    1d98:	83 c0 30             	add    $0x30,%eax
+    1d9b:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[2] = '0' + i%64;
+    1d9e:	89 d8                	mov    %ebx,%eax
+    1da0:	83 e0 3f             	and    $0x3f,%eax
+    1da3:	83 c0 30             	add    $0x30,%eax
+    1da6:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    if(link("f", name) != 0){
+    1da9:	57                   	push   %edi
+    1daa:	68 f8 4b 00 00       	push   $0x4bf8
+    1daf:	e8 6b 21 00 00       	call   3f1f <link>
+    1db4:	83 c4 10             	add    $0x10,%esp
+    1db7:	85 c0                	test   %eax,%eax
+    1db9:	0f 85 99 01 00 00    	jne    1f58 <indexdir+0x248>
+  for(i = 0; i < 400; i++){
+    1dbf:	83 c3 01             	add    $0x1,%ebx
+    1dc2:	81 fb 90 01 00 00    	cmp    $0x190,%ebx
+    1dc8:	75 c6                	jne    1d90 <indexdir+0x80>
+    1dca:	89 c6                	mov    %eax,%esi
+    1dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    name[1] = '0' + i/64;
+    1dd0:	89 f0                	mov    %esi,%eax
+    if(unlink(name) != 0){
+    1dd2:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i/64;
+    1dd5:	c1 f8 06             	sar    $0x6,%eax
+    1dd8:	83 c0 30             	add    $0x30,%eax
+    1ddb:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[2] = '0' + i%64;
+    1dde:	89 f0                	mov    %esi,%eax
+    1de0:	83 e0 3f             	and    $0x3f,%eax
+    1de3:	83 c0 30             	add    $0x30,%eax
+    1de6:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    if(unlink(name) != 0){
+    1de9:	57                   	push   %edi
+    1dea:	e8 20 21 00 00       	call   3f0f <unlink>
+    1def:	83 c4 10             	add    $0x10,%esp
+    1df2:	85 c0                	test   %eax,%eax
+    1df4:	0f 85 4a 01 00 00    	jne    1f44 <indexdir+0x234>
+  for(i = 0; i < 400; i += 2){
+    1dfa:	83 c6 02             	add    $0x2,%esi
+    1dfd:	81 fe 90 01 00 00    	cmp    $0x190,%esi
+    1e03:	75 cb                	jne    1dd0 <indexdir+0xc0>
+  for(i = 0; i < 400; i++){
+    1e05:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1e08:	31 f6                	xor    %esi,%esi
+    1e0a:	eb 0f                	jmp    1e1b <indexdir+0x10b>
+    1e0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e10:	83 c6 01             	add    $0x1,%esi
+    1e13:	81 fe 90 01 00 00    	cmp    $0x190,%esi
+    1e19:	74 7d                	je     1e98 <indexdir+0x188>
+    name[1] = '0' + i/64;
+    1e1b:	89 f0                	mov    %esi,%eax
+    fd = open(name, 0);
+    1e1d:	83 ec 08             	sub    $0x8,%esp
+    1e20:	89 f3                	mov    %esi,%ebx
+    name[1] = '0' + i/64;
+    1e22:	c1 f8 06             	sar    $0x6,%eax
+    1e25:	83 e3 01             	and    $0x1,%ebx
+    1e28:	83 c0 30             	add    $0x30,%eax
+    1e2b:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[2] = '0' + i%64;
+    1e2e:	89 f0                	mov    %esi,%eax
+    1e30:	83 e0 3f             	and    $0x3f,%eax
+    1e33:	83 c0 30             	add    $0x30,%eax
+    1e36:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    fd = open(name, 0);
+    1e39:	6a 00                	push   $0x0
+    1e3b:	57                   	push   %edi
+    1e3c:	e8 be 20 00 00       	call   3eff <open>
+    if((i%2 == 0) != (fd < 0)){
+    1e41:	89 d9                	mov    %ebx,%ecx
+    1e43:	83 c4 10             	add    $0x10,%esp
+    1e46:	89 c2                	mov    %eax,%edx
+    1e48:	83 f1 01             	xor    $0x1,%ecx
+    1e4b:	c1 ea 1f             	shr    $0x1f,%edx
+    1e4e:	38 d1                	cmp    %dl,%cl
+    1e50:	0f 85 d9 00 00 00    	jne    1f2f <indexdir+0x21f>
+    if(fd >= 0)
+    1e56:	85 c0                	test   %eax,%eax
+    1e58:	78 0c                	js     1e66 <indexdir+0x156>
+      close(fd);
+    1e5a:	83 ec 0c             	sub    $0xc,%esp
+    1e5d:	50                   	push   %eax
+    1e5e:	e8 84 20 00 00       	call   3ee7 <close>
+    1e63:	83 c4 10             	add    $0x10,%esp
+    if(i%2 == 0 && link("f", name) != 0){
+    1e66:	85 db                	test   %ebx,%ebx
+    1e68:	75 a6                	jne    1e10 <indexdir+0x100>
+    1e6a:	83 ec 08             	sub    $0x8,%esp
+    1e6d:	57                   	push   %edi
+    1e6e:	68 f8 4b 00 00       	push   $0x4bf8
+    1e73:	e8 a7 20 00 00       	call   3f1f <link>
+    1e78:	83 c4 10             	add    $0x10,%esp
+    1e7b:	85 c0                	test   %eax,%eax
+    1e7d:	74 91                	je     1e10 <indexdir+0x100>
+      printf(1, "indexdir relink failed\n");
+    1e7f:	83 ec 08             	sub    $0x8,%esp
+    1e82:	68 12 4b 00 00       	push   $0x4b12
+    1e87:	6a 01                	push   $0x1
+    1e89:	e8 a2 21 00 00       	call   4030 <printf>
+      exit();
+    1e8e:	e8 2c 20 00 00       	call   3ebf <exit>
+    1e93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e97:	90                   	nop
+    1e98:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+    1e9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e9f:	90                   	nop
+    name[1] = '0' + i/64;
+    1ea0:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1ea2:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i/64;
+    1ea5:	c1 f8 06             	sar    $0x6,%eax
+    1ea8:	83 c0 30             	add    $0x30,%eax
+    1eab:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[2] = '0' + i%64;
+    1eae:	89 d8                	mov    %ebx,%eax
+    1eb0:	83 e0 3f             	and    $0x3f,%eax
+    1eb3:	83 c0 30             	add    $0x30,%eax
+    1eb6:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    if(unlink(name) != 0){
+    1eb9:	57                   	push   %edi
+    1eba:	e8 50 20 00 00       	call   3f0f <unlink>
+    1ebf:	83 c4 10             	add    $0x10,%esp
+    1ec2:	85 c0                	test   %eax,%eax
+    1ec4:	0f 85 a2 00 00 00    	jne    1f6c <indexdir+0x25c>
+  for(i = 0; i < 400; i++){
+    1eca:	83 c3 01             	add    $0x1,%ebx
+    1ecd:	81 fb 90 01 00 00    	cmp    $0x190,%ebx
+    1ed3:	75 cb                	jne    1ea0 <indexdir+0x190>
+  if(unlink("f") != 0 || chdir("..") != 0 || unlink("idx") != 0){
+    1ed5:	83 ec 0c             	sub    $0xc,%esp
+    1ed8:	68 f8 4b 00 00       	push   $0x4bf8
+    1edd:	e8 2d 20 00 00       	call   3f0f <unlink>
+    1ee2:	83 c4 10             	add    $0x10,%esp
+    1ee5:	85 c0                	test   %eax,%eax
+    1ee7:	0f 85 93 00 00 00    	jne    1f80 <indexdir+0x270>
+    1eed:	83 ec 0c             	sub    $0xc,%esp
+    1ef0:	68 99 4c 00 00       	push   $0x4c99
+    1ef5:	e8 35 20 00 00       	call   3f2f <chdir>
+    1efa:	83 c4 10             	add    $0x10,%esp
+    1efd:	85 c0                	test   %eax,%eax
+    1eff:	75 7f                	jne    1f80 <indexdir+0x270>
+    1f01:	83 ec 0c             	sub    $0xc,%esp
+    1f04:	68 94 4a 00 00       	push   $0x4a94
+    1f09:	e8 01 20 00 00       	call   3f0f <unlink>
+    1f0e:	83 c4 10             	add    $0x10,%esp
+    1f11:	85 c0                	test   %eax,%eax
+    1f13:	75 6b                	jne    1f80 <indexdir+0x270>
+  printf(1, "indexdir ok\n");
+    1f15:	83 ec 08             	sub    $0x8,%esp
+    1f18:	68 61 4b 00 00       	push   $0x4b61
+    1f1d:	6a 01                	push   $0x1
+    1f1f:	e8 0c 21 00 00       	call   4030 <printf>
+}
+    1f24:	83 c4 10             	add    $0x10,%esp
+    1f27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f2a:	5b                   	pop    %ebx
+    1f2b:	5e                   	pop    %esi
+    1f2c:	5f                   	pop    %edi
+    1f2d:	5d                   	pop    %ebp
+    1f2e:	c3                   	ret
+      printf(1, "indexdir lookup of %s wrong\n", name);
+    1f2f:	83 ec 04             	sub    $0x4,%esp
+    1f32:	57                   	push   %edi
+    1f33:	68 f5 4a 00 00       	push   $0x4af5
+    1f38:	6a 01                	push   $0x1
+    1f3a:	e8 f1 20 00 00       	call   4030 <printf>
+      exit();
+    1f3f:	e8 7b 1f 00 00       	call   3ebf <exit>
+      printf(1, "indexdir unlink failed\n");
+    1f44:	83 ec 08             	sub    $0x8,%esp
+    1f47:	68 dd 4a 00 00       	push   $0x4add
+    1f4c:	6a 01                	push   $0x1
+    1f4e:	e8 dd 20 00 00       	call   4030 <printf>
+      exit();
+    1f53:	e8 67 1f 00 00       	call   3ebf <exit>
+      printf(1, "indexdir link failed\n");
+    1f58:	83 ec 08             	sub    $0x8,%esp
+    1f5b:	68 c7 4a 00 00       	push   $0x4ac7
+    1f60:	6a 01                	push   $0x1
+    1f62:	e8 c9 20 00 00       	call   4030 <printf>
+      exit();
+    1f67:	e8 53 1f 00 00       	call   3ebf <exit>
+      printf(1, "indexdir final unlink failed\n");
+    1f6c:	83 ec 08             	sub    $0x8,%esp
+    1f6f:	68 2a 4b 00 00       	push   $0x4b2a
+    1f74:	6a 01                	push   $0x1
+    1f76:	e8 b5 20 00 00       	call   4030 <printf>
+      exit();
+    1f7b:	e8 3f 1f 00 00       	call   3ebf <exit>
+    printf(1, "indexdir cleanup failed\n");
+    1f80:	83 ec 08             	sub    $0x8,%esp
+    1f83:	68 48 4b 00 00       	push   $0x4b48
+    1f88:	6a 01                	push   $0x1
+    1f8a:	e8 a1 20 00 00       	call   4030 <printf>
+    exit();
+    1f8f:	e8 2b 1f 00 00       	call   3ebf <exit>
+    printf(1, "indexdir create failed\n");
+    1f94:	50                   	push   %eax
+    1f95:	50                   	push   %eax
+    1f96:	68 af 4a 00 00       	push   $0x4aaf
+    1f9b:	6a 01                	push   $0x1
+    1f9d:	e8 8e 20 00 00       	call   4030 <printf>
+    exit();
+    1fa2:	e8 18 1f 00 00       	call   3ebf <exit>
+    printf(1, "indexdir mkdir failed\n");
+    1fa7:	52                   	push   %edx
+    1fa8:	52                   	push   %edx
+    1fa9:	68 98 4a 00 00       	push   $0x4a98
+    1fae:	6a 01                	push   $0x1
+    1fb0:	e8 7b 20 00 00       	call   4030 <printf>
+    exit();
+    1fb5:	e8 05 1f 00 00       	call   3ebf <exit>
+    1fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001fc0 <subdir>:
+{
+    1fc0:	55                   	push   %ebp
+    1fc1:	89 e5                	mov    %esp,%ebp
+    1fc3:	53                   	push   %ebx
+    1fc4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1fc7:	68 6e 4b 00 00       	push   $0x4b6e
+    1fcc:	6a 01                	push   $0x1
+    1fce:	e8 5d 20 00 00       	call   4030 <printf>
+  unlink("ff");
+    1fd3:	c7 04 24 f7 4b 00 00 	movl   $0x4bf7,(%esp)
+    1fda:	e8 30 1f 00 00       	call   3f0f <unlink>
+  if(mkdir("dd") != 0){
+    1fdf:	c7 04 24 94 4c 00 00 	movl   $0x4c94,(%esp)
+    1fe6:	e8 3c 1f 00 00       	call   3f27 <mkdir>
+    1feb:	83 c4 10             	add    $0x10,%esp
+    1fee:	85 c0                	test   %eax,%eax
+    1ff0:	0f 85 b3 05 00 00    	jne    25a9 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1ff6:	83 ec 08             	sub    $0x8,%esp
+    1ff9:	68 02 02 00 00       	push   $0x202
+    1ffe:	68 cd 4b 00 00       	push   $0x4bcd
+    2003:	e8 f7 1e 00 00       	call   3eff <open>
+  if(fd < 0){
+    2008:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    200b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    200d:	85 c0                	test   %eax,%eax
+    200f:	0f 88 81 05 00 00    	js     2596 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    2015:	83 ec 04             	sub    $0x4,%esp
+    2018:	6a 02                	push   $0x2
+    201a:	68 f7 4b 00 00       	push   $0x4bf7
+    201f:	50                   	push   %eax
+    2020:	e8 ba 1e 00 00       	call   3edf <write>
+  close(fd);
+    2025:	89 1c 24             	mov    %ebx,(%esp)
+    2028:	e8 ba 1e 00 00       	call   3ee7 <close>
+  if(unlink("dd") >= 0){
+    202d:	c7 04 24 94 4c 00 00 	movl   $0x4c94,(%esp)
+    2034:	e8 d6 1e 00 00       	call   3f0f <unlink>
+    2039:	83 c4 10             	add    $0x10,%esp
+    203c:	85 c0                	test   %eax,%eax
+    203e:	0f 89 3f 05 00 00    	jns    2583 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2044:	83 ec 0c             	sub    $0xc,%esp
+    2047:	68 a8 4b 00 00       	push   $0x4ba8
+    204c:	e8 d6 1e 00 00       	call   3f27 <mkdir>
+    2051:	83 c4 10             	add    $0x10,%esp
+    2054:	85 c0                	test   %eax,%eax
+    2056:	0f 85 14 05 00 00    	jne    2570 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    205c:	83 ec 08             	sub    $0x8,%esp
+    205f:	68 02 02 00 00       	push   $0x202
+    2064:	68 ca 4b 00 00       	push   $0x4bca
+    2069:	e8 91 1e 00 00       	call   3eff <open>
+  if(fd < 0){
+    206e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2071:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2073:	85 c0                	test   %eax,%eax
+    2075:	0f 88 24 04 00 00    	js     249f <subdir+0x4df>
+  write(fd, "FF", 2);
+    207b:	83 ec 04             	sub    $0x4,%esp
+    207e:	6a 02                	push   $0x2
+    2080:	68 eb 4b 00 00       	push   $0x4beb
+    2085:	50                   	push   %eax
+    2086:	e8 54 1e 00 00       	call   3edf <write>
+  close(fd);
+    208b:	89 1c 24             	mov    %ebx,(%esp)
+    208e:	e8 54 1e 00 00       	call   3ee7 <close>
+  fd = open("dd/dd/../ff", 0);
+    2093:	58                   	pop    %eax
+    2094:	5a                   	pop    %edx
+    2095:	6a 00                	push   $0x0
+    2097:	68 ee 4b 00 00       	push   $0x4bee
+    209c:	e8 5e 1e 00 00       	call   3eff <open>
+  if(fd < 0){
+    20a1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    20a4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    20a6:	85 c0                	test   %eax,%eax
+    20a8:	0f 88 de 03 00 00    	js     248c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    20ae:	83 ec 04             	sub    $0x4,%esp
+    20b1:	68 00 20 00 00       	push   $0x2000
+    20b6:	68 20 8e 00 00       	push   $0x8e20
+    20bb:	50                   	push   %eax
+    20bc:	e8 16 1e 00 00       	call   3ed7 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    20c1:	83 c4 10             	add    $0x10,%esp
+    20c4:	83 f8 02             	cmp    $0x2,%eax
+    20c7:	0f 85 3a 03 00 00    	jne    2407 <subdir+0x447>
+    20cd:	80 3d 20 8e 00 00 66 	cmpb   $0x66,0x8e20
+    20d4:	0f 85 2d 03 00 00    	jne    2407 <subdir+0x447>
+  close(fd);
+    20da:	83 ec 0c             	sub    $0xc,%esp
+    20dd:	53                   	push   %ebx
+    20de:	e8 04 1e 00 00       	call   3ee7 <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    20e3:	59                   	pop    %ecx
+    20e4:	5b                   	pop    %ebx
+    20e5:	68 2e 4c 00 00       	push   $0x4c2e
+    20ea:	68 ca 4b 00 00       	push   $0x4bca
+    20ef:	e8 2b 1e 00 00       	call   3f1f <link>
+    20f4:	83 c4 10             	add    $0x10,%esp
+    20f7:	85 c0                	test   %eax,%eax
+    20f9:	0f 85 c6 03 00 00    	jne    24c5 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    20ff:	83 ec 0c             	sub    $0xc,%esp
+    2102:	68 ca 4b 00 00       	push   $0x4bca
+    2107:	e8 03 1e 00 00       	call   3f0f <unlink>
+    210c:	83 c4 10             	add    $0x10,%esp
+    210f:	85 c0                	test   %eax,%eax
+    2111:	0f 85 16 03 00 00    	jne    242d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2117:	83 ec 08             	sub    $0x8,%esp
+    211a:	6a 00                	push   $0x0
+    211c:	68 ca 4b 00 00       	push   $0x4bca
+    2121:	e8 d9 1d 00 00       	call   3eff <open>
+    2126:	83 c4 10             	add    $0x10,%esp
+    2129:	85 c0                	test   %eax,%eax
+    212b:	0f 89 2c 04 00 00    	jns    255d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2131:	83 ec 0c             	sub    $0xc,%esp
+    2134:	68 94 4c 00 00       	push   $0x4c94
+    2139:	e8 f1 1d 00 00       	call   3f2f <chdir>
+    213e:	83 c4 10             	add    $0x10,%esp
+    2141:	85 c0                	test   %eax,%eax
+    2143:	0f 85 01 04 00 00    	jne    254a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2149:	83 ec 0c             	sub    $0xc,%esp
+    214c:	68 62 4c 00 00       	push   $0x4c62
+    2151:	e8 d9 1d 00 00       	call   3f2f <chdir>
+    2156:	83 c4 10             	add    $0x10,%esp
+    2159:	85 c0                	test   %eax,%eax
+    215b:	0f 85 b9 02 00 00    	jne    241a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    2161:	83 ec 0c             	sub    $0xc,%esp
+    2164:	68 88 4c 00 00       	push   $0x4c88
+    2169:	e8 c1 1d 00 00       	call   3f2f <chdir>
+    216e:	83 c4 10             	add    $0x10,%esp
+    2171:	85 c0                	test   %eax,%eax
+    2173:	0f 85 a1 02 00 00    	jne    241a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    2179:	83 ec 0c             	sub    $0xc,%esp
+    217c:	68 97 4c 00 00       	push   $0x4c97
+    2181:	e8 a9 1d 00 00       	call   3f2f <chdir>
+    2186:	83 c4 10             	add    $0x10,%esp
+    2189:	85 c0                	test   %eax,%eax
+    218b:	0f 85 21 03 00 00    	jne    24b2 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    2191:	83 ec 08             	sub    $0x8,%esp
+    2194:	6a 00                	push   $0x0
+    2196:	68 2e 4c 00 00       	push   $0x4c2e
+    219b:	e8 5f 1d 00 00       	call   3eff <open>
+  if(fd < 0){
+    21a0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    21a3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    21a5:	85 c0                	test   %eax,%eax
+    21a7:	0f 88 e0 04 00 00    	js     268d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    21ad:	83 ec 04             	sub    $0x4,%esp
+    21b0:	68 00 20 00 00       	push   $0x2000
+    21b5:	68 20 8e 00 00       	push   $0x8e20
+    21ba:	50                   	push   %eax
+    21bb:	e8 17 1d 00 00       	call   3ed7 <read>
+    21c0:	83 c4 10             	add    $0x10,%esp
+    21c3:	83 f8 02             	cmp    $0x2,%eax
+    21c6:	0f 85 ae 04 00 00    	jne    267a <subdir+0x6ba>
+  close(fd);
+    21cc:	83 ec 0c             	sub    $0xc,%esp
+    21cf:	53                   	push   %ebx
+    21d0:	e8 12 1d 00 00       	call   3ee7 <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    21d5:	58                   	pop    %eax
+    21d6:	5a                   	pop    %edx
+    21d7:	6a 00                	push   $0x0
+    21d9:	68 ca 4b 00 00       	push   $0x4bca
+    21de:	e8 1c 1d 00 00       	call   3eff <open>
+    21e3:	83 c4 10             	add    $0x10,%esp
+    21e6:	85 c0                	test   %eax,%eax
+    21e8:	0f 89 65 02 00 00    	jns    2453 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    21ee:	83 ec 08             	sub    $0x8,%esp
+    21f1:	68 02 02 00 00       	push   $0x202
+    21f6:	68 e2 4c 00 00       	push   $0x4ce2
+    21fb:	e8 ff 1c 00 00       	call   3eff <open>
+    2200:	83 c4 10             	add    $0x10,%esp
+    2203:	85 c0                	test   %eax,%eax
+    2205:	0f 89 35 02 00 00    	jns    2440 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    220b:	83 ec 08             	sub    $0x8,%esp
+    220e:	68 02 02 00 00       	push   $0x202
+    2213:	68 07 4d 00 00       	push   $0x4d07
+    2218:	e8 e2 1c 00 00       	call   3eff <open>
+    221d:	83 c4 10             	add    $0x10,%esp
+    2220:	85 c0                	test   %eax,%eax
+    2222:	0f 89 0f 03 00 00    	jns    2537 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2228:	83 ec 08             	sub    $0x8,%esp
+    222b:	68 00 02 00 00       	push   $0x200
+    2230:	68 94 4c 00 00       	push   $0x4c94
+    2235:	e8 c5 1c 00 00       	call   3eff <open>
+    223a:	83 c4 10             	add    $0x10,%esp
+    223d:	85 c0                	test   %eax,%eax
+    223f:	0f 89 df 02 00 00    	jns    2524 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2245:	83 ec 08             	sub    $0x8,%esp
+    2248:	6a 02                	push   $0x2
+    224a:	68 94 4c 00 00       	push   $0x4c94
+    224f:	e8 ab 1c 00 00       	call   3eff <open>
+    2254:	83 c4 10             	add    $0x10,%esp
+    2257:	85 c0                	test   %eax,%eax
+    2259:	0f 89 b2 02 00 00    	jns    2511 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    225f:	83 ec 08             	sub    $0x8,%esp
+    2262:	6a 01                	push   $0x1
+    2264:	68 94 4c 00 00       	push   $0x4c94
+    2269:	e8 91 1c 00 00       	call   3eff <open>
+    226e:	83 c4 10             	add    $0x10,%esp
+    2271:	85 c0                	test   %eax,%eax
+    2273:	0f 89 85 02 00 00    	jns    24fe <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2279:	83 ec 08             	sub    $0x8,%esp
+    227c:	68 76 4d 00 00       	push   $0x4d76
+    2281:	68 e2 4c 00 00       	push   $0x4ce2
+    2286:	e8 94 1c 00 00       	call   3f1f <link>
+    228b:	83 c4 10             	add    $0x10,%esp
+    228e:	85 c0                	test   %eax,%eax
+    2290:	0f 84 55 02 00 00    	je     24eb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2296:	83 ec 08             	sub    $0x8,%esp
+    2299:	68 76 4d 00 00       	push   $0x4d76
+    229e:	68 07 4d 00 00       	push   $0x4d07
+    22a3:	e8 77 1c 00 00       	call   3f1f <link>
+    22a8:	83 c4 10             	add    $0x10,%esp
+    22ab:	85 c0                	test   %eax,%eax
+    22ad:	0f 84 25 02 00 00    	je     24d8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    22b3:	83 ec 08             	sub    $0x8,%esp
+    22b6:	68 2e 4c 00 00       	push   $0x4c2e
+    22bb:	68 cd 4b 00 00       	push   $0x4bcd
+    22c0:	e8 5a 1c 00 00       	call   3f1f <link>
+    22c5:	83 c4 10             	add    $0x10,%esp
+    22c8:	85 c0                	test   %eax,%eax
+    22ca:	0f 84 a9 01 00 00    	je     2479 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    22d0:	83 ec 0c             	sub    $0xc,%esp
+    22d3:	68 e2 4c 00 00       	push   $0x4ce2
+    22d8:	e8 4a 1c 00 00       	call   3f27 <mkdir>
+    22dd:	83 c4 10             	add    $0x10,%esp
+    22e0:	85 c0                	test   %eax,%eax
+    22e2:	0f 84 7e 01 00 00    	je     2466 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    22e8:	83 ec 0c             	sub    $0xc,%esp
+    22eb:	68 07 4d 00 00       	push   $0x4d07
+    22f0:	e8 32 1c 00 00       	call   3f27 <mkdir>
+    22f5:	83 c4 10             	add    $0x10,%esp
+    22f8:	85 c0                	test   %eax,%eax
+    22fa:	0f 84 67 03 00 00    	je     2667 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2300:	83 ec 0c             	sub    $0xc,%esp
+    2303:	68 2e 4c 00 00       	push   $0x4c2e
+    2308:	e8 1a 1c 00 00       	call   3f27 <mkdir>
+    230d:	83 c4 10             	add    $0x10,%esp
+    2310:	85 c0                	test   %eax,%eax
+    2312:	0f 84 3c 03 00 00    	je     2654 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2318:	83 ec 0c             	sub    $0xc,%esp
+    231b:	68 07 4d 00 00       	push   $0x4d07
+    2320:	e8 ea 1b 00 00       	call   3f0f <unlink>
+    2325:	83 c4 10             	add    $0x10,%esp
+    2328:	85 c0                	test   %eax,%eax
+    232a:	0f 84 11 03 00 00    	je     2641 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2330:	83 ec 0c             	sub    $0xc,%esp
+    2333:	68 e2 4c 00 00       	push   $0x4ce2
+    2338:	e8 d2 1b 00 00       	call   3f0f <unlink>
+    233d:	83 c4 10             	add    $0x10,%esp
+    2340:	85 c0                	test   %eax,%eax
+    2342:	0f 84 e6 02 00 00    	je     262e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2348:	83 ec 0c             	sub    $0xc,%esp
+    234b:	68 cd 4b 00 00       	push   $0x4bcd
+    2350:	e8 da 1b 00 00       	call   3f2f <chdir>
+    2355:	83 c4 10             	add    $0x10,%esp
+    2358:	85 c0                	test   %eax,%eax
+    235a:	0f 84 bb 02 00 00    	je     261b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2360:	83 ec 0c             	sub    $0xc,%esp
+    2363:	68 79 4d 00 00       	push   $0x4d79
+    2368:	e8 c2 1b 00 00       	call   3f2f <chdir>
+    236d:	83 c4 10             	add    $0x10,%esp
+    2370:	85 c0                	test   %eax,%eax
+    2372:	0f 84 90 02 00 00    	je     2608 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2378:	83 ec 0c             	sub    $0xc,%esp
+    237b:	68 2e 4c 00 00       	push   $0x4c2e
+    2380:	e8 8a 1b 00 00       	call   3f0f <unlink>
+    2385:	83 c4 10             	add    $0x10,%esp
+    2388:	85 c0                	test   %eax,%eax
+    238a:	0f 85 9d 00 00 00    	jne    242d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2390:	83 ec 0c             	sub    $0xc,%esp
+    2393:	68 cd 4b 00 00       	push   $0x4bcd
+    2398:	e8 72 1b 00 00       	call   3f0f <unlink>
+    239d:	83 c4 10             	add    $0x10,%esp
+    23a0:	85 c0                	test   %eax,%eax
+    23a2:	0f 85 4d 02 00 00    	jne    25f5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    23a8:	83 ec 0c             	sub    $0xc,%esp
+    23ab:	68 94 4c 00 00       	push   $0x4c94
+    23b0:	e8 5a 1b 00 00       	call   3f0f <unlink>
+    23b5:	83 c4 10             	add    $0x10,%esp
+    23b8:	85 c0                	test   %eax,%eax
+    23ba:	0f 84 22 02 00 00    	je     25e2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    23c0:	83 ec 0c             	sub    $0xc,%esp
+    23c3:	68 a9 4b 00 00       	push   $0x4ba9
+    23c8:	e8 42 1b 00 00       	call   3f0f <unlink>
+    23cd:	83 c4 10             	add    $0x10,%esp
+    23d0:	85 c0                	test   %eax,%eax
+    23d2:	0f 88 f7 01 00 00    	js     25cf <subdir+0x60f>
+  if(unlink("dd") < 0){
+    23d8:	83 ec 0c             	sub    $0xc,%esp
+    23db:	68 94 4c 00 00       	push   $0x4c94
+    23e0:	e8 2a 1b 00 00       	call   3f0f <unlink>
+    23e5:	83 c4 10             	add    $0x10,%esp
+    23e8:	85 c0                	test   %eax,%eax
+    23ea:	0f 88 cc 01 00 00    	js     25bc <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    23f0:	83 ec 08             	sub    $0x8,%esp
+    23f3:	68 76 4e 00 00       	push   $0x4e76
+    23f8:	6a 01                	push   $0x1
+    23fa:	e8 31 1c 00 00       	call   4030 <printf>
+}
+    23ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2402:	83 c4 10             	add    $0x10,%esp
+    2405:	c9                   	leave
+    2406:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2407:	50                   	push   %eax
+    2408:	50                   	push   %eax
+    2409:	68 13 4c 00 00       	push   $0x4c13
+    240e:	6a 01                	push   $0x1
+    2410:	e8 1b 1c 00 00       	call   4030 <printf>
+    exit();
+    2415:	e8 a5 1a 00 00       	call   3ebf <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    241a:	50                   	push   %eax
+    241b:	50                   	push   %eax
+    241c:	68 6e 4c 00 00       	push   $0x4c6e
+    2421:	6a 01                	push   $0x1
+    2423:	e8 08 1c 00 00       	call   4030 <printf>
+    exit();
+    2428:	e8 92 1a 00 00       	call   3ebf <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    242d:	50                   	push   %eax
+    242e:	50                   	push   %eax
+    242f:	68 39 4c 00 00       	push   $0x4c39
+    2434:	6a 01                	push   $0x1
+    2436:	e8 f5 1b 00 00       	call   4030 <printf>
+    exit();
+    243b:	e8 7f 1a 00 00       	call   3ebf <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2440:	51                   	push   %ecx
+    2441:	51                   	push   %ecx
+    2442:	68 eb 4c 00 00       	push   $0x4ceb
+    2447:	6a 01                	push   $0x1
+    2449:	e8 e2 1b 00 00       	call   4030 <printf>
+    exit();
+    244e:	e8 6c 1a 00 00       	call   3ebf <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2453:	53                   	push   %ebx
+    2454:	53                   	push   %ebx
+    2455:	68 cc 57 00 00       	push   $0x57cc
+    245a:	6a 01                	push   $0x1
+    245c:	e8 cf 1b 00 00       	call   4030 <printf>
+    exit();
+    2461:	e8 59 1a 00 00       	call   3ebf <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2466:	51                   	push   %ecx
+    2467:	51                   	push   %ecx
+    2468:	68 7f 4d 00 00       	push   $0x4d7f
+    246d:	6a 01                	push   $0x1
+    246f:	e8 bc 1b 00 00       	call   4030 <printf>
+    exit();
+    2474:	e8 46 1a 00 00       	call   3ebf <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2479:	53                   	push   %ebx
+    247a:	53                   	push   %ebx
+    247b:	68 3c 58 00 00       	push   $0x583c
+    2480:	6a 01                	push   $0x1
+    2482:	e8 a9 1b 00 00       	call   4030 <printf>
+    exit();
+    2487:	e8 33 1a 00 00       	call   3ebf <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    248c:	50                   	push   %eax
+    248d:	50                   	push   %eax
+    248e:	68 fa 4b 00 00       	push   $0x4bfa
+    2493:	6a 01                	push   $0x1
+    2495:	e8 96 1b 00 00       	call   4030 <printf>
+    exit();
+    249a:	e8 20 1a 00 00       	call   3ebf <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    249f:	51                   	push   %ecx
+    24a0:	51                   	push   %ecx
+    24a1:	68 d3 4b 00 00       	push   $0x4bd3
+    24a6:	6a 01                	push   $0x1
+    24a8:	e8 83 1b 00 00       	call   4030 <printf>
+    exit();
+    24ad:	e8 0d 1a 00 00       	call   3ebf <exit>
+    printf(1, "chdir ./.. failed\n");
+    24b2:	50                   	push   %eax
+    24b3:	50                   	push   %eax
+    24b4:	68 9c 4c 00 00       	push   $0x4c9c
+    24b9:	6a 01                	push   $0x1
+    24bb:	e8 70 1b 00 00       	call   4030 <printf>
+    exit();
+    24c0:	e8 fa 19 00 00       	call   3ebf <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    24c5:	52                   	push   %edx
+    24c6:	52                   	push   %edx
+    24c7:	68 84 57 00 00       	push   $0x5784
+    24cc:	6a 01                	push   $0x1
+    24ce:	e8 5d 1b 00 00       	call   4030 <printf>
+    exit();
+    24d3:	e8 e7 19 00 00       	call   3ebf <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    24d8:	50                   	push   %eax
+    24d9:	50                   	push   %eax
+    24da:	68 18 58 00 00       	push   $0x5818
+    24df:	6a 01                	push   $0x1
+    24e1:	e8 4a 1b 00 00       	call   4030 <printf>
+    exit();
+    24e6:	e8 d4 19 00 00       	call   3ebf <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    24eb:	50                   	push   %eax
+    24ec:	50                   	push   %eax
+    24ed:	68 f4 57 00 00       	push   $0x57f4
+    24f2:	6a 01                	push   $0x1
+    24f4:	e8 37 1b 00 00       	call   4030 <printf>
+    exit();
+    24f9:	e8 c1 19 00 00       	call   3ebf <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    24fe:	50                   	push   %eax
+    24ff:	50                   	push   %eax
+    2500:	68 5b 4d 00 00       	push   $0x4d5b
+    2505:	6a 01                	push   $0x1
+    2507:	e8 24 1b 00 00       	call   4030 <printf>
+    exit();
+    250c:	e8 ae 19 00 00       	call   3ebf <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2511:	50                   	push   %eax
+    2512:	50                   	push   %eax
+    2513:	68 42 4d 00 00       	push   $0x4d42
+    2518:	6a 01                	push   $0x1
+    251a:	e8 11 1b 00 00       	call   4030 <printf>
+    exit();
+    251f:	e8 9b 19 00 00       	call   3ebf <exit>
+    printf(1, "create dd succeeded!\n");
+    2524:	50                   	push   %eax
+    2525:	50                   	push   %eax
+    2526:	68 2c 4d 00 00       	push   $0x4d2c
+    252b:	6a 01                	push   $0x1
+    252d:	e8 fe 1a 00 00       	call   4030 <printf>
+    exit();
+    2532:	e8 88 19 00 00       	call   3ebf <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2537:	52                   	push   %edx
+    2538:	52                   	push   %edx
+    2539:	68 10 4d 00 00       	push   $0x4d10
+    253e:	6a 01                	push   $0x1
+    2540:	e8 eb 1a 00 00       	call   4030 <printf>
+    exit();
+    2545:	e8 75 19 00 00       	call   3ebf <exit>
+    printf(1, "chdir dd failed\n");
+    254a:	50                   	push   %eax
+    254b:	50                   	push   %eax
+    254c:	68 51 4c 00 00       	push   $0x4c51
+    2551:	6a 01                	push   $0x1
+    2553:	e8 d8 1a 00 00       	call   4030 <printf>
+    exit();
+    2558:	e8 62 19 00 00       	call   3ebf <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    255d:	50                   	push   %eax
+    255e:	50                   	push   %eax
+    255f:	68 a8 57 00 00       	push   $0x57a8
+    2564:	6a 01                	push   $0x1
+    2566:	e8 c5 1a 00 00       	call   4030 <printf>
+    exit();
+    256b:	e8 4f 19 00 00       	call   3ebf <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2570:	53                   	push   %ebx
+    2571:	53                   	push   %ebx
+    2572:	68 af 4b 00 00       	push   $0x4baf
+    2577:	6a 01                	push   $0x1
+    2579:	e8 b2 1a 00 00       	call   4030 <printf>
+    exit();
+    257e:	e8 3c 19 00 00       	call   3ebf <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2583:	50                   	push   %eax
+    2584:	50                   	push   %eax
+    2585:	68 5c 57 00 00       	push   $0x575c
+    258a:	6a 01                	push   $0x1
+    258c:	e8 9f 1a 00 00       	call   4030 <printf>
+    exit();
+    2591:	e8 29 19 00 00       	call   3ebf <exit>
+    printf(1, "create dd/ff failed\n");
+    2596:	50                   	push   %eax
+    2597:	50                   	push   %eax
+    2598:	68 93 4b 00 00       	push   $0x4b93
+    259d:	6a 01                	push   $0x1
+    259f:	e8 8c 1a 00 00       	call   4030 <printf>
+    exit();
+    25a4:	e8 16 19 00 00       	call   3ebf <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    25a9:	50                   	push   %eax
+    25aa:	50                   	push   %eax
+    25ab:	68 7b 4b 00 00       	push   $0x4b7b
+    25b0:	6a 01                	push   $0x1
+    25b2:	e8 79 1a 00 00       	call   4030 <printf>
+    exit();
+    25b7:	e8 03 19 00 00       	call   3ebf <exit>
+    printf(1, "unlink dd failed\n");
+    25bc:	50                   	push   %eax
+    25bd:	50                   	push   %eax
+    25be:	68 64 4e 00 00       	push   $0x4e64
+    25c3:	6a 01                	push   $0x1
+    25c5:	e8 66 1a 00 00       	call   4030 <printf>
+    exit();
+    25ca:	e8 f0 18 00 00       	call   3ebf <exit>
+    printf(1, "unlink dd/dd failed\n");
+    25cf:	52                   	push   %edx
+    25d0:	52                   	push   %edx
+    25d1:	68 4f 4e 00 00       	push   $0x4e4f
+    25d6:	6a 01                	push   $0x1
+    25d8:	e8 53 1a 00 00       	call   4030 <printf>
+    exit();
+    25dd:	e8 dd 18 00 00       	call   3ebf <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    25e2:	51                   	push   %ecx
+    25e3:	51                   	push   %ecx
+    25e4:	68 60 58 00 00       	push   $0x5860
+    25e9:	6a 01                	push   $0x1
+    25eb:	e8 40 1a 00 00       	call   4030 <printf>
+    exit();
+    25f0:	e8 ca 18 00 00       	call   3ebf <exit>
+    printf(1, "unlink dd/ff failed\n");
+    25f5:	53                   	push   %ebx
+    25f6:	53                   	push   %ebx
+    25f7:	68 3a 4e 00 00       	push   $0x4e3a
+    25fc:	6a 01                	push   $0x1
+    25fe:	e8 2d 1a 00 00       	call   4030 <printf>
+    exit();
+    2603:	e8 b7 18 00 00       	call   3ebf <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2608:	50                   	push   %eax
+    2609:	50                   	push   %eax
+    260a:	68 22 4e 00 00       	push   $0x4e22
+    260f:	6a 01                	push   $0x1
+    2611:	e8 1a 1a 00 00       	call   4030 <printf>
+    exit();
+    2616:	e8 a4 18 00 00       	call   3ebf <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    261b:	50                   	push   %eax
+    261c:	50                   	push   %eax
+    261d:	68 0a 4e 00 00       	push   $0x4e0a
+    2622:	6a 01                	push   $0x1
+    2624:	e8 07 1a 00 00       	call   4030 <printf>
+    exit();
+    2629:	e8 91 18 00 00       	call   3ebf <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    262e:	50                   	push   %eax
+    262f:	50                   	push   %eax
+    2630:	68 ee 4d 00 00       	push   $0x4dee
+    2635:	6a 01                	push   $0x1
+    2637:	e8 f4 19 00 00       	call   4030 <printf>
+    exit();
+    263c:	e8 7e 18 00 00       	call   3ebf <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2641:	50                   	push   %eax
+    2642:	50                   	push   %eax
+    2643:	68 d2 4d 00 00       	push   $0x4dd2
+    2648:	6a 01                	push   $0x1
+    264a:	e8 e1 19 00 00       	call   4030 <printf>
+    exit();
+    264f:	e8 6b 18 00 00       	call   3ebf <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2654:	50                   	push   %eax
+    2655:	50                   	push   %eax
+    2656:	68 b5 4d 00 00       	push   $0x4db5
+    265b:	6a 01                	push   $0x1
+    265d:	e8 ce 19 00 00       	call   4030 <printf>
+    exit();
+    2662:	e8 58 18 00 00       	call   3ebf <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2667:	52                   	push   %edx
+    2668:	52                   	push   %edx
+    2669:	68 9a 4d 00 00       	push   $0x4d9a
+    266e:	6a 01                	push   $0x1
+    2670:	e8 bb 19 00 00       	call   4030 <printf>
+    exit();
+    2675:	e8 45 18 00 00       	call   3ebf <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    267a:	51                   	push   %ecx
+    267b:	51                   	push   %ecx
+    267c:	68 c7 4c 00 00       	push   $0x4cc7
+    2681:	6a 01                	push   $0x1
+    2683:	e8 a8 19 00 00       	call   4030 <printf>
+    exit();
+    2688:	e8 32 18 00 00       	call   3ebf <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    268d:	53                   	push   %ebx
+    268e:	53                   	push   %ebx
+    268f:	68 af 4c 00 00       	push   $0x4caf
+    2694:	6a 01                	push   $0x1
+    2696:	e8 95 19 00 00       	call   4030 <printf>
+    exit();
+    269b:	e8 1f 18 00 00       	call   3ebf <exit>
+
+000026a0 <bigwrite>:
+{
+    26a0:	55                   	push   %ebp
+    26a1:	89 e5                	mov    %esp,%ebp
+    26a3:	56                   	push   %esi
+    26a4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    26a5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    26aa:	83 ec 08             	sub    $0x8,%esp
+    26ad:	68 81 4e 00 00       	push   $0x4e81
+    26b2:	6a 01                	push   $0x1
+    26b4:	e8 77 19 00 00       	call   4030 <printf>
+  unlink("bigwrite");
+    26b9:	c7 04 24 90 4e 00 00 	movl   $0x4e90,(%esp)
+    26c0:	e8 4a 18 00 00       	call   3f0f <unlink>
+    26c5:	83 c4 10             	add    $0x10,%esp
+    26c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26cf:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    26d0:	83 ec 08             	sub    $0x8,%esp
+    26d3:	68 02 02 00 00       	push   $0x202
+    26d8:	68 90 4e 00 00       	push   $0x4e90
+    26dd:	e8 1d 18 00 00       	call   3eff <open>
+    if(fd < 0){
+    26e2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    26e5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    26e7:	85 c0                	test   %eax,%eax
+    26e9:	78 7e                	js     2769 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    26eb:	83 ec 04             	sub    $0x4,%esp
+    26ee:	53                   	push   %ebx
+    26ef:	68 20 8e 00 00       	push   $0x8e20
+    26f4:	50                   	push   %eax
+    26f5:	e8 e5 17 00 00       	call   3edf <write>
+      if(cc != sz){
+    26fa:	83 c4 10             	add    $0x10,%esp
+    26fd:	39 d8                	cmp    %ebx,%eax
+    26ff:	75 55                	jne    2756 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2701:	83 ec 04             	sub    $0x4,%esp
+    2704:	53                   	push   %ebx
+    2705:	68 20 8e 00 00       	push   $0x8e20
+    270a:	56                   	push   %esi
+    270b:	e8 cf 17 00 00       	call   3edf <write>
+      if(cc != sz){
+    2710:	83 c4 10             	add    $0x10,%esp
+    2713:	39 c3                	cmp    %eax,%ebx
+    2715:	75 3f                	jne    2756 <bigwrite+0xb6>
+    close(fd);
+    2717:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    271a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2720:	56                   	push   %esi
+    2721:	e8 c1 17 00 00       	call   3ee7 <close>
+    unlink("bigwrite");
+    2726:	c7 04 24 90 4e 00 00 	movl   $0x4e90,(%esp)
+    272d:	e8 dd 17 00 00       	call   3f0f <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2732:	83 c4 10             	add    $0x10,%esp
+    2735:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    273b:	75 93                	jne    26d0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    273d:	83 ec 08             	sub    $0x8,%esp
+    2740:	68 c3 4e 00 00       	push   $0x4ec3
+    2745:	6a 01                	push   $0x1
+    2747:	e8 e4 18 00 00       	call   4030 <printf>
+}
+    274c:	83 c4 10             	add    $0x10,%esp
+    274f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2752:	5b                   	pop    %ebx
+    2753:	5e                   	pop    %esi
+    2754:	5d                   	pop    %ebp
+    2755:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2756:	50                   	push   %eax
+    2757:	53                   	push   %ebx
+    2758:	68 b1 4e 00 00       	push   $0x4eb1
+    275d:	6a 01                	push   $0x1
+    275f:	e8 cc 18 00 00       	call   4030 <printf>
+        exit();
+    2764:	e8 56 17 00 00       	call   3ebf <exit>
+      printf(1, "cannot create bigwrite\n");
+    2769:	83 ec 08             	sub    $0x8,%esp
+    276c:	68 99 4e 00 00       	push   $0x4e99
+    2771:	6a 01                	push   $0x1
+    2773:	e8 b8 18 00 00       	call   4030 <printf>
+      exit();
+    2778:	e8 42 17 00 00       	call   3ebf <exit>
+    277d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002780 <bigfile>:
+{
+    2780:	55                   	push   %ebp
+    2781:	89 e5                	mov    %esp,%ebp
+    2783:	57                   	push   %edi
+    2784:	56                   	push   %esi
+    2785:	53                   	push   %ebx
+    2786:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    2789:	68 d0 4e 00 00       	push   $0x4ed0
+    278e:	6a 01                	push   $0x1
+    2790:	e8 9b 18 00 00       	call   4030 <printf>
+  unlink("bigfile");
+    2795:	c7 04 24 ec 4e 00 00 	movl   $0x4eec,(%esp)
+    279c:	e8 6e 17 00 00       	call   3f0f <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    27a1:	58                   	pop    %eax
+    27a2:	5a                   	pop    %edx
+    27a3:	68 02 02 00 00       	push   $0x202
+    27a8:	68 ec 4e 00 00       	push   $0x4eec
+    27ad:	e8 4d 17 00 00       	call   3eff <open>
+  if(fd < 0){
+    27b2:	83 c4 10             	add    $0x10,%esp
+    27b5:	85 c0                	test   %eax,%eax
+    27b7:	0f 88 5e 01 00 00    	js     291b <bigfile+0x19b>
+    27bd:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    27bf:	31 db                	xor    %ebx,%ebx
+    27c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    27c8:	83 ec 04             	sub    $0x4,%esp
+    27cb:	68 58 02 00 00       	push   $0x258
+    27d0:	53                   	push   %ebx
+    27d1:	68 20 8e 00 00       	push   $0x8e20
+    27d6:	e8 15 15 00 00       	call   3cf0 <memset>
+    if(write(fd, buf, 600) != 600){
+    27db:	83 c4 0c             	add    $0xc,%esp
+    27de:	68 58 02 00 00       	push   $0x258
+    27e3:	68 20 8e 00 00       	push   $0x8e20
+    27e8:	56                   	push   %esi
+    27e9:	e8 f1 16 00 00       	call   3edf <write>
+    27ee:	83 c4 10             	add    $0x10,%esp
+    27f1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    27f6:	0f 85 f8 00 00 00    	jne    28f4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    27fc:	83 c3 01             	add    $0x1,%ebx
+    27ff:	83 fb 14             	cmp    $0x14,%ebx
+    2802:	75 c4                	jne    27c8 <bigfile+0x48>
+  close(fd);
+    2804:	83 ec 0c             	sub    $0xc,%esp
+    2807:	56                   	push   %esi
+    2808:	e8 da 16 00 00       	call   3ee7 <close>
+  fd = open("bigfile", 0);
+    280d:	5e                   	pop    %esi
+    280e:	5f                   	pop    %edi
+    280f:	6a 00                	push   $0x0
+    2811:	68 ec 4e 00 00       	push   $0x4eec
+    2816:	e8 e4 16 00 00       	call   3eff <open>
+  if(fd < 0){
+    281b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    281e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2820:	85 c0                	test   %eax,%eax
+    2822:	0f 88 e0 00 00 00    	js     2908 <bigfile+0x188>
+  total = 0;
+    2828:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    282a:	31 ff                	xor    %edi,%edi
+    282c:	eb 30                	jmp    285e <bigfile+0xde>
+    282e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2830:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2835:	0f 85 91 00 00 00    	jne    28cc <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    283b:	89 fa                	mov    %edi,%edx
+    283d:	0f be 05 20 8e 00 00 	movsbl 0x8e20,%eax
+    2844:	d1 fa                	sar    %edx
+    2846:	39 d0                	cmp    %edx,%eax
+    2848:	75 6e                	jne    28b8 <bigfile+0x138>
+    284a:	0f be 15 4b 8f 00 00 	movsbl 0x8f4b,%edx
+    2851:	39 d0                	cmp    %edx,%eax
+    2853:	75 63                	jne    28b8 <bigfile+0x138>
+    total += cc;
+    2855:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    285b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    285e:	83 ec 04             	sub    $0x4,%esp
+    2861:	68 2c 01 00 00       	push   $0x12c
+    2866:	68 20 8e 00 00       	push   $0x8e20
+    286b:	56                   	push   %esi
+    286c:	e8 66 16 00 00       	call   3ed7 <read>
+    if(cc < 0){
+    2871:	83 c4 10             	add    $0x10,%esp
+    2874:	85 c0                	test   %eax,%eax
+    2876:	78 68                	js     28e0 <bigfile+0x160>
+    if(cc == 0)
+    2878:	75 b6                	jne    2830 <bigfile+0xb0>
+  close(fd);
+    287a:	83 ec 0c             	sub    $0xc,%esp
+    287d:	56                   	push   %esi
+    287e:	e8 64 16 00 00       	call   3ee7 <close>
+  if(total != 20*600){
+    2883:	83 c4 10             	add    $0x10,%esp
+    2886:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    288c:	0f 85 9c 00 00 00    	jne    292e <bigfile+0x1ae>
+  unlink("bigfile");
+    2892:	83 ec 0c             	sub    $0xc,%esp
+    2895:	68 ec 4e 00 00       	push   $0x4eec
+    289a:	e8 70 16 00 00       	call   3f0f <unlink>
+  printf(1, "bigfile test ok\n");
+    289f:	58                   	pop    %eax
+    28a0:	5a                   	pop    %edx
+    28a1:	68 7b 4f 00 00       	push   $0x4f7b
+    28a6:	6a 01                	push   $0x1
+    28a8:	e8 83 17 00 00       	call   4030 <printf>
+}
+    28ad:	83 c4 10             	add    $0x10,%esp
+    28b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    28b3:	5b                   	pop    %ebx
+    28b4:	5e                   	pop    %esi
+    28b5:	5f                   	pop    %edi
+    28b6:	5d                   	pop    %ebp
+    28b7:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    28b8:	83 ec 08             	sub    $0x8,%esp
+    28bb:	68 48 4f 00 00       	push   $0x4f48
+    28c0:	6a 01                	push   $0x1
+    28c2:	e8 69 17 00 00       	call   4030 <printf>
+      exit();
+    28c7:	e8 f3 15 00 00       	call   3ebf <exit>
+      printf(1, "short read bigfile\n");
+    28cc:	83 ec 08             	sub    $0x8,%esp
+    28cf:	68 34 4f 00 00       	push   $0x4f34
+    28d4:	6a 01                	push   $0x1
+    28d6:	e8 55 17 00 00       	call   4030 <printf>
+      exit();
+    28db:	e8 df 15 00 00       	call   3ebf <exit>
+      printf(1, "read bigfile failed\n");
+    28e0:	83 ec 08             	sub    $0x8,%esp
+    28e3:	68 1f 4f 00 00       	push   $0x4f1f
+    28e8:	6a 01                	push   $0x1
+    28ea:	e8 41 17 00 00       	call   4030 <printf>
+      exit();
+    28ef:	e8 cb 15 00 00       	call   3ebf <exit>
+      printf(1, "write bigfile failed\n");
+    28f4:	83 ec 08             	sub    $0x8,%esp
+    28f7:	68 f4 4e 00 00       	push   $0x4ef4
+    28fc:	6a 01                	push   $0x1
+    28fe:	e8 2d 17 00 00       	call   4030 <printf>
+      exit();
+    2903:	e8 b7 15 00 00       	call   3ebf <exit>
+    printf(1, "cannot open bigfile\n");
+    2908:	53                   	push   %ebx
+    2909:	53                   	push   %ebx
+    290a:	68 0a 4f 00 00       	push   $0x4f0a
+    290f:	6a 01                	push   $0x1
+    2911:	e8 1a 17 00 00       	call   4030 <printf>
+    exit();
+    2916:	e8 a4 15 00 00       	call   3ebf <exit>
+    printf(1, "cannot create bigfile");
+    291b:	50                   	push   %eax
+    291c:	50                   	push   %eax
+    291d:	68 de 4e 00 00       	push   $0x4ede
+    2922:	6a 01                	push   $0x1
+    2924:	e8 07 17 00 00       	call   4030 <printf>
+    exit();
+    2929:	e8 91 15 00 00       	call   3ebf <exit>
+    printf(1, "read bigfile wrong total\n");
+    292e:	51                   	push   %ecx
+    292f:	51                   	push   %ecx
+    2930:	68 61 4f 00 00       	push   $0x4f61
+    2935:	6a 01                	push   $0x1
+    2937:	e8 f4 16 00 00       	call   4030 <printf>
+    exit();
+    293c:	e8 7e 15 00 00       	call   3ebf <exit>
+    2941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    294f:	90                   	nop
+
+00002950 <fourteen>:
+{
+    2950:	55                   	push   %ebp
+    2951:	89 e5                	mov    %esp,%ebp
+    2953:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2956:	68 8c 4f 00 00       	push   $0x4f8c
+    295b:	6a 01                	push   $0x1
+    295d:	e8 ce 16 00 00       	call   4030 <printf>
+  if(mkdir("12345678901234") != 0){
+    2962:	c7 04 24 c7 4f 00 00 	movl   $0x4fc7,(%esp)
+    2969:	e8 b9 15 00 00       	call   3f27 <mkdir>
+    296e:	83 c4 10             	add    $0x10,%esp
+    2971:	85 c0                	test   %eax,%eax
+    2973:	0f 85 97 00 00 00    	jne    2a10 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2979:	83 ec 0c             	sub    $0xc,%esp
+    297c:	68 80 58 00 00       	push   $0x5880
+    2981:	e8 a1 15 00 00       	call   3f27 <mkdir>
+    2986:	83 c4 10             	add    $0x10,%esp
+    2989:	85 c0                	test   %eax,%eax
+    298b:	0f 85 de 00 00 00    	jne    2a6f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2991:	83 ec 08             	sub    $0x8,%esp
+    2994:	68 00 02 00 00       	push   $0x200
+    2999:	68 d0 58 00 00       	push   $0x58d0
+    299e:	e8 5c 15 00 00       	call   3eff <open>
+  if(fd < 0){
+    29a3:	83 c4 10             	add    $0x10,%esp
+    29a6:	85 c0                	test   %eax,%eax
+    29a8:	0f 88 ae 00 00 00    	js     2a5c <fourteen+0x10c>
+  close(fd);
+    29ae:	83 ec 0c             	sub    $0xc,%esp
+    29b1:	50                   	push   %eax
+    29b2:	e8 30 15 00 00       	call   3ee7 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    29b7:	58                   	pop    %eax
+    29b8:	5a                   	pop    %edx
+    29b9:	6a 00                	push   $0x0
+    29bb:	68 40 59 00 00       	push   $0x5940
+    29c0:	e8 3a 15 00 00       	call   3eff <open>
+  if(fd < 0){
+    29c5:	83 c4 10             	add    $0x10,%esp
+    29c8:	85 c0                	test   %eax,%eax
+    29ca:	78 7d                	js     2a49 <fourteen+0xf9>
+  close(fd);
+    29cc:	83 ec 0c             	sub    $0xc,%esp
+    29cf:	50                   	push   %eax
+    29d0:	e8 12 15 00 00       	call   3ee7 <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    29d5:	c7 04 24 b8 4f 00 00 	movl   $0x4fb8,(%esp)
+    29dc:	e8 46 15 00 00       	call   3f27 <mkdir>
+    29e1:	83 c4 10             	add    $0x10,%esp
+    29e4:	85 c0                	test   %eax,%eax
+    29e6:	74 4e                	je     2a36 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    29e8:	83 ec 0c             	sub    $0xc,%esp
+    29eb:	68 dc 59 00 00       	push   $0x59dc
+    29f0:	e8 32 15 00 00       	call   3f27 <mkdir>
+    29f5:	83 c4 10             	add    $0x10,%esp
+    29f8:	85 c0                	test   %eax,%eax
+    29fa:	74 27                	je     2a23 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    29fc:	83 ec 08             	sub    $0x8,%esp
+    29ff:	68 d6 4f 00 00       	push   $0x4fd6
+    2a04:	6a 01                	push   $0x1
+    2a06:	e8 25 16 00 00       	call   4030 <printf>
+}
+    2a0b:	83 c4 10             	add    $0x10,%esp
+    2a0e:	c9                   	leave
+    2a0f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2a10:	50                   	push   %eax
+    2a11:	50                   	push   %eax
+    2a12:	68 9b 4f 00 00       	push   $0x4f9b
+    2a17:	6a 01                	push   $0x1
+    2a19:	e8 12 16 00 00       	call   4030 <printf>
+    exit();
+    2a1e:	e8 9c 14 00 00       	call   3ebf <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2a23:	50                   	push   %eax
+    2a24:	50                   	push   %eax
+    2a25:	68 fc 59 00 00       	push   $0x59fc
+    2a2a:	6a 01                	push   $0x1
+    2a2c:	e8 ff 15 00 00       	call   4030 <printf>
+    exit();
+    2a31:	e8 89 14 00 00       	call   3ebf <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2a36:	52                   	push   %edx
+    2a37:	52                   	push   %edx
+    2a38:	68 ac 59 00 00       	push   $0x59ac
+    2a3d:	6a 01                	push   $0x1
+    2a3f:	e8 ec 15 00 00       	call   4030 <printf>
+    exit();
+    2a44:	e8 76 14 00 00       	call   3ebf <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2a49:	51                   	push   %ecx
+    2a4a:	51                   	push   %ecx
+    2a4b:	68 70 59 00 00       	push   $0x5970
+    2a50:	6a 01                	push   $0x1
+    2a52:	e8 d9 15 00 00       	call   4030 <printf>
+    exit();
+    2a57:	e8 63 14 00 00       	call   3ebf <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    2a5c:	51                   	push   %ecx
+    2a5d:	51                   	push   %ecx
+    2a5e:	68 00 59 00 00       	push   $0x5900
+    2a63:	6a 01                	push   $0x1
+    2a65:	e8 c6 15 00 00       	call   4030 <printf>
+    exit();
+    2a6a:	e8 50 14 00 00       	call   3ebf <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2a6f:	50                   	push   %eax
+    2a70:	50                   	push   %eax
+    2a71:	68 a0 58 00 00       	push   $0x58a0
+    2a76:	6a 01                	push   $0x1
+    2a78:	e8 b3 15 00 00       	call   4030 <printf>
+    exit();
+    2a7d:	e8 3d 14 00 00       	call   3ebf <exit>
+    2a82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002a90 <rmdot>:
+{
+    2a90:	55                   	push   %ebp
+    2a91:	89 e5                	mov    %esp,%ebp
+    2a93:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2a96:	68 e3 4f 00 00       	push   $0x4fe3
+    2a9b:	6a 01                	push   $0x1
+    2a9d:	e8 8e 15 00 00       	call   4030 <printf>
+  if(mkdir("dots") != 0){
+    2aa2:	c7 04 24 ef 4f 00 00 	movl   $0x4fef,(%esp)
+    2aa9:	e8 79 14 00 00       	call   3f27 <mkdir>
+    2aae:	83 c4 10             	add    $0x10,%esp
+    2ab1:	85 c0                	test   %eax,%eax
+    2ab3:	0f 85 b0 00 00 00    	jne    2b69 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2ab9:	83 ec 0c             	sub    $0xc,%esp
+    2abc:	68 ef 4f 00 00       	push   $0x4fef
+    2ac1:	e8 69 14 00 00       	call   3f2f <chdir>
+    2ac6:	83 c4 10             	add    $0x10,%esp
+    2ac9:	85 c0                	test   %eax,%eax
+    2acb:	0f 85 1d 01 00 00    	jne    2bee <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2ad1:	83 ec 0c             	sub    $0xc,%esp
+    2ad4:	68 9a 4c 00 00       	push   $0x4c9a
+    2ad9:	e8 31 14 00 00       	call   3f0f <unlink>
+    2ade:	83 c4 10             	add    $0x10,%esp
+    2ae1:	85 c0                	test   %eax,%eax
+    2ae3:	0f 84 f2 00 00 00    	je     2bdb <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2ae9:	83 ec 0c             	sub    $0xc,%esp
+    2aec:	68 99 4c 00 00       	push   $0x4c99
+    2af1:	e8 19 14 00 00       	call   3f0f <unlink>
+    2af6:	83 c4 10             	add    $0x10,%esp
+    2af9:	85 c0                	test   %eax,%eax
+    2afb:	0f 84 c7 00 00 00    	je     2bc8 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2b01:	83 ec 0c             	sub    $0xc,%esp
+    2b04:	68 93 43 00 00       	push   $0x4393
+    2b09:	e8 21 14 00 00       	call   3f2f <chdir>
+    2b0e:	83 c4 10             	add    $0x10,%esp
+    2b11:	85 c0                	test   %eax,%eax
+    2b13:	0f 85 9c 00 00 00    	jne    2bb5 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2b19:	83 ec 0c             	sub    $0xc,%esp
+    2b1c:	68 37 50 00 00       	push   $0x5037
+    2b21:	e8 e9 13 00 00       	call   3f0f <unlink>
+    2b26:	83 c4 10             	add    $0x10,%esp
+    2b29:	85 c0                	test   %eax,%eax
+    2b2b:	74 75                	je     2ba2 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    2b2d:	83 ec 0c             	sub    $0xc,%esp
+    2b30:	68 55 50 00 00       	push   $0x5055
+    2b35:	e8 d5 13 00 00       	call   3f0f <unlink>
+    2b3a:	83 c4 10             	add    $0x10,%esp
+    2b3d:	85 c0                	test   %eax,%eax
+    2b3f:	74 4e                	je     2b8f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    2b41:	83 ec 0c             	sub    $0xc,%esp
+    2b44:	68 ef 4f 00 00       	push   $0x4fef
+    2b49:	e8 c1 13 00 00       	call   3f0f <unlink>
+    2b4e:	83 c4 10             	add    $0x10,%esp
+    2b51:	85 c0                	test   %eax,%eax
+    2b53:	75 27                	jne    2b7c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    2b55:	83 ec 08             	sub    $0x8,%esp
+    2b58:	68 8a 50 00 00       	push   $0x508a
+    2b5d:	6a 01                	push   $0x1
+    2b5f:	e8 cc 14 00 00       	call   4030 <printf>
+}
+    2b64:	83 c4 10             	add    $0x10,%esp
+    2b67:	c9                   	leave
+    2b68:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2b69:	50                   	push   %eax
+    2b6a:	50                   	push   %eax
+    2b6b:	68 f4 4f 00 00       	push   $0x4ff4
+    2b70:	6a 01                	push   $0x1
+    2b72:	e8 b9 14 00 00       	call   4030 <printf>
+    exit();
+    2b77:	e8 43 13 00 00       	call   3ebf <exit>
+    printf(1, "unlink dots failed!\n");
+    2b7c:	50                   	push   %eax
+    2b7d:	50                   	push   %eax
+    2b7e:	68 75 50 00 00       	push   $0x5075
+    2b83:	6a 01                	push   $0x1
+    2b85:	e8 a6 14 00 00       	call   4030 <printf>
+    exit();
+    2b8a:	e8 30 13 00 00       	call   3ebf <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2b8f:	52                   	push   %edx
+    2b90:	52                   	push   %edx
+    2b91:	68 5d 50 00 00       	push   $0x505d
+    2b96:	6a 01                	push   $0x1
+    2b98:	e8 93 14 00 00       	call   4030 <printf>
+    exit();
+    2b9d:	e8 1d 13 00 00       	call   3ebf <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2ba2:	51                   	push   %ecx
+    2ba3:	51                   	push   %ecx
+    2ba4:	68 3e 50 00 00       	push   $0x503e
+    2ba9:	6a 01                	push   $0x1
+    2bab:	e8 80 14 00 00       	call   4030 <printf>
+    exit();
+    2bb0:	e8 0a 13 00 00       	call   3ebf <exit>
+    printf(1, "chdir / failed\n");
+    2bb5:	50                   	push   %eax
+    2bb6:	50                   	push   %eax
+    2bb7:	68 95 43 00 00       	push   $0x4395
+    2bbc:	6a 01                	push   $0x1
+    2bbe:	e8 6d 14 00 00       	call   4030 <printf>
+    exit();
+    2bc3:	e8 f7 12 00 00       	call   3ebf <exit>
+    printf(1, "rm .. worked!\n");
+    2bc8:	50                   	push   %eax
+    2bc9:	50                   	push   %eax
+    2bca:	68 28 50 00 00       	push   $0x5028
+    2bcf:	6a 01                	push   $0x1
+    2bd1:	e8 5a 14 00 00       	call   4030 <printf>
+    exit();
+    2bd6:	e8 e4 12 00 00       	call   3ebf <exit>
+    printf(1, "rm . worked!\n");
+    2bdb:	50                   	push   %eax
+    2bdc:	50                   	push   %eax
+    2bdd:	68 1a 50 00 00       	push   $0x501a
+    2be2:	6a 01                	push   $0x1
+    2be4:	e8 47 14 00 00       	call   4030 <printf>
+    exit();
+    2be9:	e8 d1 12 00 00       	call   3ebf <exit>
+    printf(1, "chdir dots failed\n");
+    2bee:	50                   	push   %eax
+    2bef:	50                   	push   %eax
+    2bf0:	68 07 50 00 00       	push   $0x5007
+    2bf5:	6a 01                	push   $0x1
+    2bf7:	e8 34 14 00 00       	call   4030 <printf>
+    exit();
+    2bfc:	e8 be 12 00 00       	call   3ebf <exit>
+    2c01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c0f:	90                   	nop
+
+00002c10 <dirfile>:
+{
+    2c10:	55                   	push   %ebp
+    2c11:	89 e5                	mov    %esp,%ebp
+    2c13:	53                   	push   %ebx
+    2c14:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2c17:	68 94 50 00 00       	push   $0x5094
+    2c1c:	6a 01                	push   $0x1
+    2c1e:	e8 0d 14 00 00       	call   4030 <printf>
+  fd = open("dirfile", O_CREATE);
+    2c23:	5b                   	pop    %ebx
+    2c24:	58                   	pop    %eax
+    2c25:	68 00 02 00 00       	push   $0x200
+    2c2a:	68 a1 50 00 00       	push   $0x50a1
+    2c2f:	e8 cb 12 00 00       	call   3eff <open>
+  if(fd < 0){
+    2c34:	83 c4 10             	add    $0x10,%esp
+    2c37:	85 c0                	test   %eax,%eax
+    2c39:	0f 88 43 01 00 00    	js     2d82 <dirfile+0x172>
+  close(fd);
+    2c3f:	83 ec 0c             	sub    $0xc,%esp
+    2c42:	50                   	push   %eax
+    2c43:	e8 9f 12 00 00       	call   3ee7 <close>
+  if(chdir("dirfile") == 0){
+    2c48:	c7 04 24 a1 50 00 00 	movl   $0x50a1,(%esp)
+    2c4f:	e8 db 12 00 00       	call   3f2f <chdir>
+    2c54:	83 c4 10             	add    $0x10,%esp
+    2c57:	85 c0                	test   %eax,%eax
+    2c59:	0f 84 10 01 00 00    	je     2d6f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    2c5f:	83 ec 08             	sub    $0x8,%esp
+    2c62:	6a 00                	push   $0x0
+    2c64:	68 da 50 00 00       	push   $0x50da
+    2c69:	e8 91 12 00 00       	call   3eff <open>
+  if(fd >= 0){
+    2c6e:	83 c4 10             	add    $0x10,%esp
+    2c71:	85 c0                	test   %eax,%eax
+    2c73:	0f 89 e3 00 00 00    	jns    2d5c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2c79:	83 ec 08             	sub    $0x8,%esp
+    2c7c:	68 00 02 00 00       	push   $0x200
+    2c81:	68 da 50 00 00       	push   $0x50da
+    2c86:	e8 74 12 00 00       	call   3eff <open>
+  if(fd >= 0){
+    2c8b:	83 c4 10             	add    $0x10,%esp
+    2c8e:	85 c0                	test   %eax,%eax
+    2c90:	0f 89 c6 00 00 00    	jns    2d5c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2c96:	83 ec 0c             	sub    $0xc,%esp
+    2c99:	68 da 50 00 00       	push   $0x50da
+    2c9e:	e8 84 12 00 00       	call   3f27 <mkdir>
+    2ca3:	83 c4 10             	add    $0x10,%esp
+    2ca6:	85 c0                	test   %eax,%eax
+    2ca8:	0f 84 46 01 00 00    	je     2df4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2cae:	83 ec 0c             	sub    $0xc,%esp
+    2cb1:	68 da 50 00 00       	push   $0x50da
+    2cb6:	e8 54 12 00 00       	call   3f0f <unlink>
+    2cbb:	83 c4 10             	add    $0x10,%esp
+    2cbe:	85 c0                	test   %eax,%eax
+    2cc0:	0f 84 1b 01 00 00    	je     2de1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2cc6:	83 ec 08             	sub    $0x8,%esp
+    2cc9:	68 da 50 00 00       	push   $0x50da
+    2cce:	68 3e 51 00 00       	push   $0x513e
+    2cd3:	e8 47 12 00 00       	call   3f1f <link>
+    2cd8:	83 c4 10             	add    $0x10,%esp
+    2cdb:	85 c0                	test   %eax,%eax
+    2cdd:	0f 84 eb 00 00 00    	je     2dce <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2ce3:	83 ec 0c             	sub    $0xc,%esp
+    2ce6:	68 a1 50 00 00       	push   $0x50a1
+    2ceb:	e8 1f 12 00 00       	call   3f0f <unlink>
+    2cf0:	83 c4 10             	add    $0x10,%esp
+    2cf3:	85 c0                	test   %eax,%eax
+    2cf5:	0f 85 c0 00 00 00    	jne    2dbb <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2cfb:	83 ec 08             	sub    $0x8,%esp
+    2cfe:	6a 02                	push   $0x2
+    2d00:	68 9a 4c 00 00       	push   $0x4c9a
+    2d05:	e8 f5 11 00 00       	call   3eff <open>
+  if(fd >= 0){
+    2d0a:	83 c4 10             	add    $0x10,%esp
+    2d0d:	85 c0                	test   %eax,%eax
+    2d0f:	0f 89 93 00 00 00    	jns    2da8 <dirfile+0x198>
+  fd = open(".", 0);
+    2d15:	83 ec 08             	sub    $0x8,%esp
+    2d18:	6a 00                	push   $0x0
+    2d1a:	68 9a 4c 00 00       	push   $0x4c9a
+    2d1f:	e8 db 11 00 00       	call   3eff <open>
+  if(write(fd, "x", 1) > 0){
+    2d24:	83 c4 0c             	add    $0xc,%esp
+    2d27:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2d29:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2d2b:	68 96 4a 00 00       	push   $0x4a96
+    2d30:	50                   	push   %eax
+    2d31:	e8 a9 11 00 00       	call   3edf <write>
+    2d36:	83 c4 10             	add    $0x10,%esp
+    2d39:	85 c0                	test   %eax,%eax
+    2d3b:	7f 58                	jg     2d95 <dirfile+0x185>
+  close(fd);
+    2d3d:	83 ec 0c             	sub    $0xc,%esp
+    2d40:	53                   	push   %ebx
+    2d41:	e8 a1 11 00 00       	call   3ee7 <close>
+  printf(1, "dir vs file OK\n");
+    2d46:	58                   	pop    %eax
+    2d47:	5a                   	pop    %edx
+    2d48:	68 71 51 00 00       	push   $0x5171
+    2d4d:	6a 01                	push   $0x1
+    2d4f:	e8 dc 12 00 00       	call   4030 <printf>
+}
+    2d54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d57:	83 c4 10             	add    $0x10,%esp
+    2d5a:	c9                   	leave
+    2d5b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2d5c:	50                   	push   %eax
+    2d5d:	50                   	push   %eax
+    2d5e:	68 e5 50 00 00       	push   $0x50e5
+    2d63:	6a 01                	push   $0x1
+    2d65:	e8 c6 12 00 00       	call   4030 <printf>
+    exit();
+    2d6a:	e8 50 11 00 00       	call   3ebf <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2d6f:	52                   	push   %edx
+    2d70:	52                   	push   %edx
+    2d71:	68 c0 50 00 00       	push   $0x50c0
+    2d76:	6a 01                	push   $0x1
+    2d78:	e8 b3 12 00 00       	call   4030 <printf>
+    exit();
+    2d7d:	e8 3d 11 00 00       	call   3ebf <exit>
+    printf(1, "create dirfile failed\n");
+    2d82:	51                   	push   %ecx
+    2d83:	51                   	push   %ecx
+    2d84:	68 a9 50 00 00       	push   $0x50a9
+    2d89:	6a 01                	push   $0x1
+    2d8b:	e8 a0 12 00 00       	call   4030 <printf>
+    exit();
+    2d90:	e8 2a 11 00 00       	call   3ebf <exit>
+    printf(1, "write . succeeded!\n");
+    2d95:	51                   	push   %ecx
+    2d96:	51                   	push   %ecx
+    2d97:	68 5d 51 00 00       	push   $0x515d
+    2d9c:	6a 01                	push   $0x1
+    2d9e:	e8 8d 12 00 00       	call   4030 <printf>
+    exit();
+    2da3:	e8 17 11 00 00       	call   3ebf <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2da8:	53                   	push   %ebx
+    2da9:	53                   	push   %ebx
+    2daa:	68 50 5a 00 00       	push   $0x5a50
+    2daf:	6a 01                	push   $0x1
+    2db1:	e8 7a 12 00 00       	call   4030 <printf>
+    exit();
+    2db6:	e8 04 11 00 00       	call   3ebf <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2dbb:	50                   	push   %eax
+    2dbc:	50                   	push   %eax
+    2dbd:	68 45 51 00 00       	push   $0x5145
+    2dc2:	6a 01                	push   $0x1
+    2dc4:	e8 67 12 00 00       	call   4030 <printf>
+    exit();
+    2dc9:	e8 f1 10 00 00       	call   3ebf <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2dce:	50                   	push   %eax
+    2dcf:	50                   	push   %eax
+    2dd0:	68 30 5a 00 00       	push   $0x5a30
+    2dd5:	6a 01                	push   $0x1
+    2dd7:	e8 54 12 00 00       	call   4030 <printf>
+    exit();
+    2ddc:	e8 de 10 00 00       	call   3ebf <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2de1:	50                   	push   %eax
+    2de2:	50                   	push   %eax
+    2de3:	68 20 51 00 00       	push   $0x5120
+    2de8:	6a 01                	push   $0x1
+    2dea:	e8 41 12 00 00       	call   4030 <printf>
+    exit();
+    2def:	e8 cb 10 00 00       	call   3ebf <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2df4:	50                   	push   %eax
+    2df5:	50                   	push   %eax
+    2df6:	68 03 51 00 00       	push   $0x5103
+    2dfb:	6a 01                	push   $0x1
+    2dfd:	e8 2e 12 00 00       	call   4030 <printf>
+    exit();
+    2e02:	e8 b8 10 00 00       	call   3ebf <exit>
+    2e07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2e0e:	66 90                	xchg   %ax,%ax
+
+00002e10 <iref>:
+{
+    2e10:	55                   	push   %ebp
+    2e11:	89 e5                	mov    %esp,%ebp
+    2e13:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2e14:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2e19:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2e1c:	68 81 51 00 00       	push   $0x5181
+    2e21:	6a 01                	push   $0x1
+    2e23:	e8 08 12 00 00       	call   4030 <printf>
+    2e28:	83 c4 10             	add    $0x10,%esp
+    2e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2e2f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2e30:	83 ec 0c             	sub    $0xc,%esp
+    2e33:	68 92 51 00 00       	push   $0x5192
+    2e38:	e8 ea 10 00 00       	call   3f27 <mkdir>
+    2e3d:	83 c4 10             	add    $0x10,%esp
+    2e40:	85 c0                	test   %eax,%eax
+    2e42:	0f 85 bb 00 00 00    	jne    2f03 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2e48:	83 ec 0c             	sub    $0xc,%esp
+    2e4b:	68 92 51 00 00       	push   $0x5192
+    2e50:	e8 da 10 00 00       	call   3f2f <chdir>
+    2e55:	83 c4 10             	add    $0x10,%esp
+    2e58:	85 c0                	test   %eax,%eax
+    2e5a:	0f 85 b7 00 00 00    	jne    2f17 <iref+0x107>
+    mkdir("");
+    2e60:	83 ec 0c             	sub    $0xc,%esp
+    2e63:	68 5e 47 00 00       	push   $0x475e
+    2e68:	e8 ba 10 00 00       	call   3f27 <mkdir>
+    link("README", "");
+    2e6d:	59                   	pop    %ecx
+    2e6e:	58                   	pop    %eax
+    2e6f:	68 5e 47 00 00       	push   $0x475e
+    2e74:	68 3e 51 00 00       	push   $0x513e
+    2e79:	e8 a1 10 00 00       	call   3f1f <link>
+    fd = open("", O_CREATE);
+    2e7e:	58                   	pop    %eax
+    2e7f:	5a                   	pop    %edx
+    2e80:	68 00 02 00 00       	push   $0x200
+    2e85:	68 5e 47 00 00       	push   $0x475e
+    2e8a:	e8 70 10 00 00       	call   3eff <open>
+    if(fd >= 0)
+    2e8f:	83 c4 10             	add    $0x10,%esp
+    2e92:	85 c0                	test   %eax,%eax
+    2e94:	78 0c                	js     2ea2 <iref+0x92>
+      close(fd);
+    2e96:	83 ec 0c             	sub    $0xc,%esp
+    2e99:	50                   	push   %eax
+    2e9a:	e8 48 10 00 00       	call   3ee7 <close>
+    2e9f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2ea2:	83 ec 08             	sub    $0x8,%esp
+    2ea5:	68 00 02 00 00       	push   $0x200
+    2eaa:	68 7c 4d 00 00       	push   $0x4d7c
+    2eaf:	e8 4b 10 00 00       	call   3eff <open>
+    if(fd >= 0)
+    2eb4:	83 c4 10             	add    $0x10,%esp
+    2eb7:	85 c0                	test   %eax,%eax
+    2eb9:	78 0c                	js     2ec7 <iref+0xb7>
+      close(fd);
+    2ebb:	83 ec 0c             	sub    $0xc,%esp
+    2ebe:	50                   	push   %eax
+    2ebf:	e8 23 10 00 00       	call   3ee7 <close>
+    2ec4:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2ec7:	83 ec 0c             	sub    $0xc,%esp
+    2eca:	68 7c 4d 00 00       	push   $0x4d7c
+    2ecf:	e8 3b 10 00 00       	call   3f0f <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2ed4:	83 c4 10             	add    $0x10,%esp
+    2ed7:	83 eb 01             	sub    $0x1,%ebx
+    2eda:	0f 85 50 ff ff ff    	jne    2e30 <iref+0x20>
+  chdir("/");
+    2ee0:	83 ec 0c             	sub    $0xc,%esp
+    2ee3:	68 93 43 00 00       	push   $0x4393
+    2ee8:	e8 42 10 00 00       	call   3f2f <chdir>
+  printf(1, "empty file name OK\n");
+    2eed:	58                   	pop    %eax
+    2eee:	5a                   	pop    %edx
+    2eef:	68 c0 51 00 00       	push   $0x51c0
+    2ef4:	6a 01                	push   $0x1
+    2ef6:	e8 35 11 00 00       	call   4030 <printf>
+}
+    2efb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2efe:	83 c4 10             	add    $0x10,%esp
+    2f01:	c9                   	leave
+    2f02:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2f03:	83 ec 08             	sub    $0x8,%esp
+    2f06:	68 98 51 00 00       	push   $0x5198
+    2f0b:	6a 01                	push   $0x1
+    2f0d:	e8 1e 11 00 00       	call   4030 <printf>
+      exit();
+    2f12:	e8 a8 0f 00 00       	call   3ebf <exit>
+      printf(1, "chdir irefd failed\n");
+    2f17:	83 ec 08             	sub    $0x8,%esp
+    2f1a:	68 ac 51 00 00       	push   $0x51ac
+    2f1f:	6a 01                	push   $0x1
+    2f21:	e8 0a 11 00 00       	call   4030 <printf>
+      exit();
+    2f26:	e8 94 0f 00 00       	call   3ebf <exit>
+    2f2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2f2f:	90                   	nop
+
+00002f30 <forktest>:
+{
+    2f30:	55                   	push   %ebp
+    2f31:	89 e5                	mov    %esp,%ebp
+    2f33:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    2f34:	31 db                	xor    %ebx,%ebx
+{
+    2f36:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2f39:	68 d4 51 00 00       	push   $0x51d4
+    2f3e:	6a 01                	push   $0x1
+    2f40:	e8 eb 10 00 00       	call   4030 <printf>
+    2f45:	83 c4 10             	add    $0x10,%esp
+    2f48:	eb 13                	jmp    2f5d <forktest+0x2d>
+    2f4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2f50:	74 4d                	je     2f9f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    2f52:	83 c3 01             	add    $0x1,%ebx
+    2f55:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2f5b:	74 6e                	je     2fcb <forktest+0x9b>
+    pid = fork();
+    2f5d:	e8 55 0f 00 00       	call   3eb7 <fork>
+    if(pid < 0)
+    2f62:	85 c0                	test   %eax,%eax
+    2f64:	79 ea                	jns    2f50 <forktest+0x20>
+  for(; n > 0; n--){
+    2f66:	85 db                	test   %ebx,%ebx
+    2f68:	74 14                	je     2f7e <forktest+0x4e>
+    2f6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2f70:	e8 52 0f 00 00       	call   3ec7 <wait>
+    2f75:	85 c0                	test   %eax,%eax
+    2f77:	78 2b                	js     2fa4 <forktest+0x74>
+  for(; n > 0; n--){
+    2f79:	83 eb 01             	sub    $0x1,%ebx
+    2f7c:	75 f2                	jne    2f70 <forktest+0x40>
+  if(wait() != -1){
+    2f7e:	e8 44 0f 00 00       	call   3ec7 <wait>
+    2f83:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f86:	75 30                	jne    2fb8 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2f88:	83 ec 08             	sub    $0x8,%esp
+    2f8b:	68 06 52 00 00       	push   $0x5206
+    2f90:	6a 01                	push   $0x1
+    2f92:	e8 99 10 00 00       	call   4030 <printf>
+}
+    2f97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2f9a:	83 c4 10             	add    $0x10,%esp
+    2f9d:	c9                   	leave
+    2f9e:	c3                   	ret
+      exit();
+    2f9f:	e8 1b 0f 00 00       	call   3ebf <exit>
+      printf(1, "wait stopped early\n");
+    2fa4:	83 ec 08             	sub    $0x8,%esp
+    2fa7:	68 df 51 00 00       	push   $0x51df
+    2fac:	6a 01                	push   $0x1
+    2fae:	e8 7d 10 00 00       	call   4030 <printf>
+      exit();
+    2fb3:	e8 07 0f 00 00       	call   3ebf <exit>
+    printf(1, "wait got too many\n");
+    2fb8:	50                   	push   %eax
+    2fb9:	50                   	push   %eax
+    2fba:	68 f3 51 00 00       	push   $0x51f3
+    2fbf:	6a 01                	push   $0x1
+    2fc1:	e8 6a 10 00 00       	call   4030 <printf>
+    exit();
+    2fc6:	e8 f4 0e 00 00       	call   3ebf <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2fcb:	52                   	push   %edx
+    2fcc:	52                   	push   %edx
+    2fcd:	68 70 5a 00 00       	push   $0x5a70
+    2fd2:	6a 01                	push   $0x1
+    2fd4:	e8 57 10 00 00       	call   4030 <printf>
+    exit();
+    2fd9:	e8 e1 0e 00 00       	call   3ebf <exit>
+    2fde:	66 90                	xchg   %ax,%ax
+
+00002fe0 <cowtest>:
+{
+    2fe0:	55                   	push   %ebp
+    2fe1:	89 e5                	mov    %esp,%ebp
+    2fe3:	57                   	push   %edi
+    2fe4:	56                   	push   %esi
+    2fe5:	53                   	push   %ebx
+    2fe6:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "cow test\n");
+    2fe9:	68 14 52 00 00       	push   $0x5214
+    2fee:	ff 35 dc 66 00 00    	push   0x66dc
+    2ff4:	e8 37 10 00 00       	call   4030 <printf>
+  p = sbrk(sz);
+    2ff9:	c7 04 24 00 00 04 00 	movl   $0x40000,(%esp)
+    3000:	e8 42 0f 00 00       	call   3f47 <sbrk>
+  if(p == (char*)-1){
+    3005:	83 c4 10             	add    $0x10,%esp
+    3008:	83 f8 ff             	cmp    $0xffffffff,%eax
+    300b:	0f 84 8a 01 00 00    	je     319b <cowtest+0x1bb>
+    3011:	89 c7                	mov    %eax,%edi
+    3013:	89 c3                	mov    %eax,%ebx
+    3015:	8d b0 00 00 04 00    	lea    0x40000(%eax),%esi
+    301b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    301f:	90                   	nop
+    p[i] = 'a';
+    3020:	c6 00 61             	movb   $0x61,(%eax)
+  for(i = 0; i < sz; i += 4096)
+    3023:	05 00 10 00 00       	add    $0x1000,%eax
+    3028:	39 f0                	cmp    %esi,%eax
+    302a:	75 f4                	jne    3020 <cowtest+0x40>
+  if(pipe(fds) != 0){
+    302c:	83 ec 0c             	sub    $0xc,%esp
+    302f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    3032:	50                   	push   %eax
+    3033:	e8 97 0e 00 00       	call   3ecf <pipe>
+    3038:	83 c4 10             	add    $0x10,%esp
+    303b:	85 c0                	test   %eax,%eax
+    303d:	0f 85 41 01 00 00    	jne    3184 <cowtest+0x1a4>
+  pid = fork();
+    3043:	e8 6f 0e 00 00       	call   3eb7 <fork>
+  if(pid < 0){
+    3048:	85 c0                	test   %eax,%eax
+    304a:	0f 88 1d 01 00 00    	js     316d <cowtest+0x18d>
+  if(pid == 0){
+    3050:	75 49                	jne    309b <cowtest+0xbb>
+    if(read(fds[0], p+1, 1) != 1 || p[1] != 'x'){
+    3052:	83 ec 04             	sub    $0x4,%esp
+    3055:	8d 47 01             	lea    0x1(%edi),%eax
+    3058:	6a 01                	push   $0x1
+    305a:	50                   	push   %eax
+    305b:	ff 75 e0             	push   -0x20(%ebp)
+    305e:	e8 74 0e 00 00       	call   3ed7 <read>
+    3063:	83 c4 10             	add    $0x10,%esp
+    3066:	83 f8 01             	cmp    $0x1,%eax
+    3069:	0f 85 d0 00 00 00    	jne    313f <cowtest+0x15f>
+    306f:	80 7f 01 78          	cmpb   $0x78,0x1(%edi)
+    3073:	0f 85 c6 00 00 00    	jne    313f <cowtest+0x15f>
+    3079:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(p[i] != 'a'){
+    3080:	80 3b 61             	cmpb   $0x61,(%ebx)
+    3083:	0f 85 9e 00 00 00    	jne    3127 <cowtest+0x147>
+      p[i] = 'b';
+    3089:	c6 03 62             	movb   $0x62,(%ebx)
+    for(i = 0; i < sz; i += 4096){
+    308c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    3092:	39 f3                	cmp    %esi,%ebx
+    3094:	75 ea                	jne    3080 <cowtest+0xa0>
+    exit();
+    3096:	e8 24 0e 00 00       	call   3ebf <exit>
+  write(fds[1], "x", 1);
+    309b:	83 ec 04             	sub    $0x4,%esp
+  p[1] = 'y';
+    309e:	c6 47 01 79          	movb   $0x79,0x1(%edi)
+  write(fds[1], "x", 1);
+    30a2:	6a 01                	push   $0x1
+    30a4:	68 96 4a 00 00       	push   $0x4a96
+    30a9:	ff 75 e4             	push   -0x1c(%ebp)
+    30ac:	e8 2e 0e 00 00       	call   3edf <write>
+  wait();
+    30b1:	e8 11 0e 00 00       	call   3ec7 <wait>
+  close(fds[0]);
+    30b6:	58                   	pop    %eax
+    30b7:	ff 75 e0             	push   -0x20(%ebp)
+    30ba:	e8 28 0e 00 00       	call   3ee7 <close>
+  close(fds[1]);
+    30bf:	58                   	pop    %eax
+    30c0:	ff 75 e4             	push   -0x1c(%ebp)
+    30c3:	e8 1f 0e 00 00       	call   3ee7 <close>
+    30c8:	83 c4 10             	add    $0x10,%esp
+    30cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    30cf:	90                   	nop
+    if(p[i] != 'a'){
+    30d0:	80 3b 61             	cmpb   $0x61,(%ebx)
+    30d3:	75 3a                	jne    310f <cowtest+0x12f>
+  for(i = 0; i < sz; i += 4096){
+    30d5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    30db:	39 f3                	cmp    %esi,%ebx
+    30dd:	75 f1                	jne    30d0 <cowtest+0xf0>
+  if(p[1] != 'y'){
+    30df:	80 7f 01 79          	cmpb   $0x79,0x1(%edi)
+    30e3:	75 71                	jne    3156 <cowtest+0x176>
+  sbrk(-sz);
+    30e5:	83 ec 0c             	sub    $0xc,%esp
+    30e8:	68 00 00 fc ff       	push   $0xfffc0000
+    30ed:	e8 55 0e 00 00       	call   3f47 <sbrk>
+  printf(stdout, "cow ok\n");
+    30f2:	58                   	pop    %eax
+    30f3:	5a                   	pop    %edx
+    30f4:	68 bd 52 00 00       	push   $0x52bd
+    30f9:	ff 35 dc 66 00 00    	push   0x66dc
+    30ff:	e8 2c 0f 00 00       	call   4030 <printf>
+}
+    3104:	83 c4 10             	add    $0x10,%esp
+    3107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    310a:	5b                   	pop    %ebx
+    310b:	5e                   	pop    %esi
+    310c:	5f                   	pop    %edi
+    310d:	5d                   	pop    %ebp
+    310e:	c3                   	ret
+      printf(stdout, "cow parent saw child's write\n");
+    310f:	83 ec 08             	sub    $0x8,%esp
+    3112:	68 82 52 00 00       	push   $0x5282
+    3117:	ff 35 dc 66 00 00    	push   0x66dc
+    311d:	e8 0e 0f 00 00       	call   4030 <printf>
+      exit();
+    3122:	e8 98 0d 00 00       	call   3ebf <exit>
+        printf(stdout, "cow child saw wrong data\n");
+    3127:	83 ec 08             	sub    $0x8,%esp
+    312a:	68 68 52 00 00       	push   $0x5268
+    312f:	ff 35 dc 66 00 00    	push   0x66dc
+    3135:	e8 f6 0e 00 00       	call   4030 <printf>
+        exit();
+    313a:	e8 80 0d 00 00       	call   3ebf <exit>
+      printf(stdout, "cow child read failed\n");
+    313f:	50                   	push   %eax
+    3140:	50                   	push   %eax
+    3141:	68 51 52 00 00       	push   $0x5251
+    3146:	ff 35 dc 66 00 00    	push   0x66dc
+    314c:	e8 df 0e 00 00       	call   4030 <printf>
+      exit();
+    3151:	e8 69 0d 00 00       	call   3ebf <exit>
+    printf(stdout, "cow parent saw child's read\n");
+    3156:	51                   	push   %ecx
+    3157:	51                   	push   %ecx
+    3158:	68 a0 52 00 00       	push   $0x52a0
+    315d:	ff 35 dc 66 00 00    	push   0x66dc
+    3163:	e8 c8 0e 00 00       	call   4030 <printf>
+    exit();
+    3168:	e8 52 0d 00 00       	call   3ebf <exit>
+    printf(stdout, "cow fork failed\n");
+    316d:	50                   	push   %eax
+    316e:	50                   	push   %eax
+    316f:	68 40 52 00 00       	push   $0x5240
+    3174:	ff 35 dc 66 00 00    	push   0x66dc
+    317a:	e8 b1 0e 00 00       	call   4030 <printf>
+    exit();
+    317f:	e8 3b 0d 00 00       	call   3ebf <exit>
+    printf(stdout, "cow pipe failed\n");
+    3184:	50                   	push   %eax
+    3185:	50                   	push   %eax
+    3186:	68 2f 52 00 00       	push   $0x522f
+    318b:	ff 35 dc 66 00 00    	push   0x66dc
+    3191:	e8 9a 0e 00 00       	call   4030 <printf>
+    exit();
+    3196:	e8 24 0d 00 00       	call   3ebf <exit>
+    printf(stdout, "cow sbrk failed\n");
+    319b:	52                   	push   %edx
+    319c:	52                   	push   %edx
+    319d:	68 1e 52 00 00       	push   $0x521e
+    31a2:	ff 35 dc 66 00 00    	push   0x66dc
+    31a8:	e8 83 0e 00 00       	call   4030 <printf>
+    exit();
+    31ad:	e8 0d 0d 00 00       	call   3ebf <exit>
+    31b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    31b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000031c0 <lazytest>:
+{
+    31c0:	55                   	push   %ebp
+    31c1:	89 e5                	mov    %esp,%ebp
+    31c3:	53                   	push   %ebx
+    31c4:	83 ec 1c             	sub    $0x1c,%esp
+  printf(stdout, "lazy test\n");
+    31c7:	68 c5 52 00 00       	push   $0x52c5
+    31cc:	ff 35 dc 66 00 00    	push   0x66dc
+    31d2:	e8 59 0e 00 00       	call   4030 <printf>
+  p = sbrk(sz);
+    31d7:	c7 04 24 00 00 40 00 	movl   $0x400000,(%esp)
+    31de:	e8 64 0d 00 00       	call   3f47 <sbrk>
+  if(p == (char*)-1){
+    31e3:	83 c4 10             	add    $0x10,%esp
+    31e6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    31e9:	0f 84 d2 00 00 00    	je     32c1 <lazytest+0x101>
+  if(p[sz/2] != 0 || p[sz-1] != 0){
+    31ef:	80 b8 00 00 20 00 00 	cmpb   $0x0,0x200000(%eax)
+    31f6:	89 c3                	mov    %eax,%ebx
+    31f8:	0f 85 95 00 00 00    	jne    3293 <lazytest+0xd3>
+    31fe:	80 b8 ff ff 3f 00 00 	cmpb   $0x0,0x3fffff(%eax)
+    3205:	0f 85 88 00 00 00    	jne    3293 <lazytest+0xd3>
+  if(pipe(fds) != 0){
+    320b:	83 ec 0c             	sub    $0xc,%esp
+    320e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    3211:	50                   	push   %eax
+    3212:	e8 b8 0c 00 00       	call   3ecf <pipe>
+    3217:	83 c4 10             	add    $0x10,%esp
+    321a:	85 c0                	test   %eax,%eax
+    321c:	0f 85 b6 00 00 00    	jne    32d8 <lazytest+0x118>
+  write(fds[1], "z", 1);
+    3222:	83 ec 04             	sub    $0x4,%esp
+    3225:	6a 01                	push   $0x1
+    3227:	68 08 53 00 00       	push   $0x5308
+    322c:	ff 75 f4             	push   -0xc(%ebp)
+    322f:	e8 ab 0c 00 00       	call   3edf <write>
+  if(read(fds[0], p+sz/4, 1) != 1 || p[sz/4] != 'z'){
+    3234:	83 c4 0c             	add    $0xc,%esp
+    3237:	8d 83 00 00 10 00    	lea    0x100000(%ebx),%eax
+    323d:	6a 01                	push   $0x1
+    323f:	50                   	push   %eax
+    3240:	ff 75 f0             	push   -0x10(%ebp)
+    3243:	e8 8f 0c 00 00       	call   3ed7 <read>
+    3248:	83 c4 10             	add    $0x10,%esp
+    324b:	83 f8 01             	cmp    $0x1,%eax
+    324e:	75 5a                	jne    32aa <lazytest+0xea>
+    3250:	80 bb 00 00 10 00 7a 	cmpb   $0x7a,0x100000(%ebx)
+    3257:	75 51                	jne    32aa <lazytest+0xea>
+  close(fds[0]);
+    3259:	83 ec 0c             	sub    $0xc,%esp
+    325c:	ff 75 f0             	push   -0x10(%ebp)
+    325f:	e8 83 0c 00 00       	call   3ee7 <close>
+  close(fds[1]);
+    3264:	58                   	pop    %eax
+    3265:	ff 75 f4             	push   -0xc(%ebp)
+    3268:	e8 7a 0c 00 00       	call   3ee7 <close>
+  sbrk(-sz);
+    326d:	c7 04 24 00 00 c0 ff 	movl   $0xffc00000,(%esp)
+    3274:	e8 ce 0c 00 00       	call   3f47 <sbrk>
+  printf(stdout, "lazy ok\n");
+    3279:	5a                   	pop    %edx
+    327a:	59                   	pop    %ecx
+    327b:	68 0a 53 00 00       	push   $0x530a
+    3280:	ff 35 dc 66 00 00    	push   0x66dc
+    3286:	e8 a5 0d 00 00       	call   4030 <printf>
+}
+    328b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    328e:	83 c4 10             	add    $0x10,%esp
+    3291:	c9                   	leave
+    3292:	c3                   	ret
+    printf(stdout, "lazy page not zero\n");
+    3293:	50                   	push   %eax
+    3294:	50                   	push   %eax
+    3295:	68 e2 52 00 00       	push   $0x52e2
+    329a:	ff 35 dc 66 00 00    	push   0x66dc
+    32a0:	e8 8b 0d 00 00       	call   4030 <printf>
+    exit();
+    32a5:	e8 15 0c 00 00       	call   3ebf <exit>
+    printf(stdout, "lazy read into untouched page failed\n");
+    32aa:	53                   	push   %ebx
+    32ab:	53                   	push   %ebx
+    32ac:	68 94 5a 00 00       	push   $0x5a94
+    32b1:	ff 35 dc 66 00 00    	push   0x66dc
+    32b7:	e8 74 0d 00 00       	call   4030 <printf>
+    exit();
+    32bc:	e8 fe 0b 00 00       	call   3ebf <exit>
+    printf(stdout, "lazy sbrk failed\n");
+    32c1:	50                   	push   %eax
+    32c2:	50                   	push   %eax
+    32c3:	68 d0 52 00 00       	push   $0x52d0
+    32c8:	ff 35 dc 66 00 00    	push   0x66dc
+    32ce:	e8 5d 0d 00 00       	call   4030 <printf>
+    exit();
+    32d3:	e8 e7 0b 00 00       	call   3ebf <exit>
+    printf(stdout, "lazy pipe failed\n");
+    32d8:	50                   	push   %eax
+    32d9:	50                   	push   %eax
+    32da:	68 f6 52 00 00       	push   $0x52f6
+    32df:	ff 35 dc 66 00 00    	push   0x66dc
+    32e5:	e8 46 0d 00 00       	call   4030 <printf>
+    exit();
+    32ea:	e8 d0 0b 00 00       	call   3ebf <exit>
+    32ef:	90                   	nop
+
+000032f0 <sbrktest>:
+{
+    32f0:	55                   	push   %ebp
+    32f1:	89 e5                	mov    %esp,%ebp
+    32f3:	57                   	push   %edi
+    32f4:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    32f5:	31 f6                	xor    %esi,%esi
+{
+    32f7:	53                   	push   %ebx
+    32f8:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    32fb:	68 13 53 00 00       	push   $0x5313
+    3300:	ff 35 dc 66 00 00    	push   0x66dc
+    3306:	e8 25 0d 00 00       	call   4030 <printf>
+  oldbrk = sbrk(0);
+    330b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3312:	e8 30 0c 00 00       	call   3f47 <sbrk>
+    3317:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    331a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3321:	e8 21 0c 00 00       	call   3f47 <sbrk>
+    3326:	83 c4 10             	add    $0x10,%esp
+    3329:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    332b:	eb 05                	jmp    3332 <sbrktest+0x42>
+    332d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3330:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3332:	83 ec 0c             	sub    $0xc,%esp
+    3335:	6a 01                	push   $0x1
+    3337:	e8 0b 0c 00 00       	call   3f47 <sbrk>
+    if(b != a){
+    333c:	83 c4 10             	add    $0x10,%esp
+    333f:	39 d8                	cmp    %ebx,%eax
+    3341:	0f 85 9c 02 00 00    	jne    35e3 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    3347:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    334a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    334d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3350:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3356:	75 d8                	jne    3330 <sbrktest+0x40>
+  pid = fork();
+    3358:	e8 5a 0b 00 00       	call   3eb7 <fork>
+    335d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    335f:	85 c0                	test   %eax,%eax
+    3361:	0f 88 02 03 00 00    	js     3669 <sbrktest+0x379>
+  c = sbrk(1);
+    3367:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    336a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    336d:	6a 01                	push   $0x1
+    336f:	e8 d3 0b 00 00       	call   3f47 <sbrk>
+  c = sbrk(1);
+    3374:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    337b:	e8 c7 0b 00 00       	call   3f47 <sbrk>
+  if(c != a + 1){
+    3380:	83 c4 10             	add    $0x10,%esp
+    3383:	39 c3                	cmp    %eax,%ebx
+    3385:	0f 85 3b 03 00 00    	jne    36c6 <sbrktest+0x3d6>
+  if(pid == 0)
+    338b:	85 f6                	test   %esi,%esi
+    338d:	0f 84 2e 03 00 00    	je     36c1 <sbrktest+0x3d1>
+  wait();
+    3393:	e8 2f 0b 00 00       	call   3ec7 <wait>
+  a = sbrk(0);
+    3398:	83 ec 0c             	sub    $0xc,%esp
+    339b:	6a 00                	push   $0x0
+    339d:	e8 a5 0b 00 00       	call   3f47 <sbrk>
+    33a2:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    33a4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    33a9:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    33ab:	89 04 24             	mov    %eax,(%esp)
+    33ae:	e8 94 0b 00 00       	call   3f47 <sbrk>
+  if (p != a) {
+    33b3:	83 c4 10             	add    $0x10,%esp
+    33b6:	39 c3                	cmp    %eax,%ebx
+    33b8:	0f 85 94 02 00 00    	jne    3652 <sbrktest+0x362>
+  a = sbrk(0);
+    33be:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    33c1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    33c8:	6a 00                	push   $0x0
+    33ca:	e8 78 0b 00 00       	call   3f47 <sbrk>
+  c = sbrk(-4096);
+    33cf:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    33d6:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    33d8:	e8 6a 0b 00 00       	call   3f47 <sbrk>
+  if(c == (char*)0xffffffff){
+    33dd:	83 c4 10             	add    $0x10,%esp
+    33e0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    33e3:	0f 84 22 03 00 00    	je     370b <sbrktest+0x41b>
+  c = sbrk(0);
+    33e9:	83 ec 0c             	sub    $0xc,%esp
+    33ec:	6a 00                	push   $0x0
+    33ee:	e8 54 0b 00 00       	call   3f47 <sbrk>
+  if(c != a - 4096){
+    33f3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    33f9:	83 c4 10             	add    $0x10,%esp
+    33fc:	39 d0                	cmp    %edx,%eax
+    33fe:	0f 85 f0 02 00 00    	jne    36f4 <sbrktest+0x404>
+  a = sbrk(0);
+    3404:	83 ec 0c             	sub    $0xc,%esp
+    3407:	6a 00                	push   $0x0
+    3409:	e8 39 0b 00 00       	call   3f47 <sbrk>
+  c = sbrk(4096);
+    340e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3415:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3417:	e8 2b 0b 00 00       	call   3f47 <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    341c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    341f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3421:	39 c3                	cmp    %eax,%ebx
+    3423:	0f 85 b4 02 00 00    	jne    36dd <sbrktest+0x3ed>
+    3429:	83 ec 0c             	sub    $0xc,%esp
+    342c:	6a 00                	push   $0x0
+    342e:	e8 14 0b 00 00       	call   3f47 <sbrk>
+    3433:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3439:	83 c4 10             	add    $0x10,%esp
+    343c:	39 c2                	cmp    %eax,%edx
+    343e:	0f 85 99 02 00 00    	jne    36dd <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3444:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    344b:	0f 84 2f 02 00 00    	je     3680 <sbrktest+0x390>
+  a = sbrk(0);
+    3451:	83 ec 0c             	sub    $0xc,%esp
+    3454:	6a 00                	push   $0x0
+    3456:	e8 ec 0a 00 00       	call   3f47 <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    345b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3462:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3464:	e8 de 0a 00 00       	call   3f47 <sbrk>
+    3469:	89 c2                	mov    %eax,%edx
+    346b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    346e:	29 d0                	sub    %edx,%eax
+    3470:	89 04 24             	mov    %eax,(%esp)
+    3473:	e8 cf 0a 00 00       	call   3f47 <sbrk>
+  if(c != a){
+    3478:	83 c4 10             	add    $0x10,%esp
+    347b:	39 c3                	cmp    %eax,%ebx
+    347d:	0f 85 b8 01 00 00    	jne    363b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3483:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3488:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    348f:	90                   	nop
+    ppid = getpid();
+    3490:	e8 aa 0a 00 00       	call   3f3f <getpid>
+    3495:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3497:	e8 1b 0a 00 00       	call   3eb7 <fork>
+    if(pid < 0){
+    349c:	85 c0                	test   %eax,%eax
+    349e:	0f 88 5d 01 00 00    	js     3601 <sbrktest+0x311>
+    if(pid == 0){
+    34a4:	0f 84 6f 01 00 00    	je     3619 <sbrktest+0x329>
+    wait();
+    34aa:	e8 18 0a 00 00       	call   3ec7 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    34af:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    34b5:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    34bb:	75 d3                	jne    3490 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    34bd:	83 ec 0c             	sub    $0xc,%esp
+    34c0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    34c3:	50                   	push   %eax
+    34c4:	e8 06 0a 00 00       	call   3ecf <pipe>
+    34c9:	83 c4 10             	add    $0x10,%esp
+    34cc:	85 c0                	test   %eax,%eax
+    34ce:	0f 85 da 01 00 00    	jne    36ae <sbrktest+0x3be>
+    34d4:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    34d7:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    34da:	89 df                	mov    %ebx,%edi
+    34dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    34e0:	e8 d2 09 00 00       	call   3eb7 <fork>
+    34e5:	89 07                	mov    %eax,(%edi)
+    34e7:	85 c0                	test   %eax,%eax
+    34e9:	0f 84 91 00 00 00    	je     3580 <sbrktest+0x290>
+    if(pids[i] != -1)
+    34ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+    34f2:	74 14                	je     3508 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    34f4:	83 ec 04             	sub    $0x4,%esp
+    34f7:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    34fa:	6a 01                	push   $0x1
+    34fc:	50                   	push   %eax
+    34fd:	ff 75 b8             	push   -0x48(%ebp)
+    3500:	e8 d2 09 00 00       	call   3ed7 <read>
+    3505:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3508:	83 c7 04             	add    $0x4,%edi
+    350b:	39 f7                	cmp    %esi,%edi
+    350d:	75 d1                	jne    34e0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    350f:	83 ec 0c             	sub    $0xc,%esp
+    3512:	68 00 10 00 00       	push   $0x1000
+    3517:	e8 2b 0a 00 00       	call   3f47 <sbrk>
+    351c:	83 c4 10             	add    $0x10,%esp
+    351f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3528:	8b 03                	mov    (%ebx),%eax
+    352a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    352d:	74 11                	je     3540 <sbrktest+0x250>
+    kill(pids[i]);
+    352f:	83 ec 0c             	sub    $0xc,%esp
+    3532:	50                   	push   %eax
+    3533:	e8 b7 09 00 00       	call   3eef <kill>
+    wait();
+    3538:	e8 8a 09 00 00       	call   3ec7 <wait>
+    353d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3540:	83 c3 04             	add    $0x4,%ebx
+    3543:	39 f3                	cmp    %esi,%ebx
+    3545:	75 e1                	jne    3528 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3547:	83 ff ff             	cmp    $0xffffffff,%edi
+    354a:	0f 84 47 01 00 00    	je     3697 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3550:	83 ec 0c             	sub    $0xc,%esp
+    3553:	6a 00                	push   $0x0
+    3555:	e8 ed 09 00 00       	call   3f47 <sbrk>
+    355a:	83 c4 10             	add    $0x10,%esp
+    355d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3560:	72 60                	jb     35c2 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3562:	83 ec 08             	sub    $0x8,%esp
+    3565:	68 bb 53 00 00       	push   $0x53bb
+    356a:	ff 35 dc 66 00 00    	push   0x66dc
+    3570:	e8 bb 0a 00 00       	call   4030 <printf>
+}
+    3575:	83 c4 10             	add    $0x10,%esp
+    3578:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    357b:	5b                   	pop    %ebx
+    357c:	5e                   	pop    %esi
+    357d:	5f                   	pop    %edi
+    357e:	5d                   	pop    %ebp
+    357f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3580:	83 ec 0c             	sub    $0xc,%esp
+    3583:	6a 00                	push   $0x0
+    3585:	e8 bd 09 00 00       	call   3f47 <sbrk>
+    358a:	89 c2                	mov    %eax,%edx
+    358c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3591:	29 d0                	sub    %edx,%eax
+    3593:	89 04 24             	mov    %eax,(%esp)
+    3596:	e8 ac 09 00 00       	call   3f47 <sbrk>
+      write(fds[1], "x", 1);
+    359b:	83 c4 0c             	add    $0xc,%esp
+    359e:	6a 01                	push   $0x1
+    35a0:	68 96 4a 00 00       	push   $0x4a96
+    35a5:	ff 75 bc             	push   -0x44(%ebp)
+    35a8:	e8 32 09 00 00       	call   3edf <write>
+    35ad:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    35b0:	83 ec 0c             	sub    $0xc,%esp
+    35b3:	68 e8 03 00 00       	push   $0x3e8
+    35b8:	e8 92 09 00 00       	call   3f4f <sleep>
+    35bd:	83 c4 10             	add    $0x10,%esp
+    35c0:	eb ee                	jmp    35b0 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    35c2:	83 ec 0c             	sub    $0xc,%esp
+    35c5:	6a 00                	push   $0x0
+    35c7:	e8 7b 09 00 00       	call   3f47 <sbrk>
+    35cc:	89 c2                	mov    %eax,%edx
+    35ce:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    35d1:	29 d0                	sub    %edx,%eax
+    35d3:	89 04 24             	mov    %eax,(%esp)
+    35d6:	e8 6c 09 00 00       	call   3f47 <sbrk>
+    35db:	83 c4 10             	add    $0x10,%esp
+    35de:	e9 7f ff ff ff       	jmp    3562 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    35e3:	83 ec 0c             	sub    $0xc,%esp
+    35e6:	50                   	push   %eax
+    35e7:	53                   	push   %ebx
+    35e8:	56                   	push   %esi
+    35e9:	68 1e 53 00 00       	push   $0x531e
+    35ee:	ff 35 dc 66 00 00    	push   0x66dc
+    35f4:	e8 37 0a 00 00       	call   4030 <printf>
+      exit();
+    35f9:	83 c4 20             	add    $0x20,%esp
+    35fc:	e8 be 08 00 00       	call   3ebf <exit>
+      printf(stdout, "fork failed\n");
+    3601:	83 ec 08             	sub    $0x8,%esp
+    3604:	68 64 54 00 00       	push   $0x5464
+    3609:	ff 35 dc 66 00 00    	push   0x66dc
+    360f:	e8 1c 0a 00 00       	call   4030 <printf>
+      exit();
+    3614:	e8 a6 08 00 00       	call   3ebf <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3619:	0f be 03             	movsbl (%ebx),%eax
+    361c:	50                   	push   %eax
+    361d:	53                   	push   %ebx
+    361e:	68 87 53 00 00       	push   $0x5387
+    3623:	ff 35 dc 66 00 00    	push   0x66dc
+    3629:	e8 02 0a 00 00       	call   4030 <printf>
+      kill(ppid);
+    362e:	89 34 24             	mov    %esi,(%esp)
+    3631:	e8 b9 08 00 00       	call   3eef <kill>
+      exit();
+    3636:	e8 84 08 00 00       	call   3ebf <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    363b:	50                   	push   %eax
+    363c:	53                   	push   %ebx
+    363d:	68 8c 5b 00 00       	push   $0x5b8c
+    3642:	ff 35 dc 66 00 00    	push   0x66dc
+    3648:	e8 e3 09 00 00       	call   4030 <printf>
+    exit();
+    364d:	e8 6d 08 00 00       	call   3ebf <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3652:	56                   	push   %esi
+    3653:	56                   	push   %esi
+    3654:	68 bc 5a 00 00       	push   $0x5abc
+    3659:	ff 35 dc 66 00 00    	push   0x66dc
+    365f:	e8 cc 09 00 00       	call   4030 <printf>
+    exit();
+    3664:	e8 56 08 00 00       	call   3ebf <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3669:	50                   	push   %eax
+    366a:	50                   	push   %eax
+    366b:	68 39 53 00 00       	push   $0x5339
+    3670:	ff 35 dc 66 00 00    	push   0x66dc
+    3676:	e8 b5 09 00 00       	call   4030 <printf>
+    exit();
+    367b:	e8 3f 08 00 00       	call   3ebf <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3680:	51                   	push   %ecx
+    3681:	51                   	push   %ecx
+    3682:	68 5c 5b 00 00       	push   $0x5b5c
+    3687:	ff 35 dc 66 00 00    	push   0x66dc
+    368d:	e8 9e 09 00 00       	call   4030 <printf>
+    exit();
+    3692:	e8 28 08 00 00       	call   3ebf <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3697:	50                   	push   %eax
+    3698:	50                   	push   %eax
+    3699:	68 a0 53 00 00       	push   $0x53a0
+    369e:	ff 35 dc 66 00 00    	push   0x66dc
+    36a4:	e8 87 09 00 00       	call   4030 <printf>
+    exit();
+    36a9:	e8 11 08 00 00       	call   3ebf <exit>
+    printf(1, "pipe() failed\n");
+    36ae:	52                   	push   %edx
+    36af:	52                   	push   %edx
+    36b0:	68 74 46 00 00       	push   $0x4674
+    36b5:	6a 01                	push   $0x1
+    36b7:	e8 74 09 00 00       	call   4030 <printf>
+    exit();
+    36bc:	e8 fe 07 00 00       	call   3ebf <exit>
+    exit();
+    36c1:	e8 f9 07 00 00       	call   3ebf <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    36c6:	57                   	push   %edi
+    36c7:	57                   	push   %edi
+    36c8:	68 50 53 00 00       	push   $0x5350
+    36cd:	ff 35 dc 66 00 00    	push   0x66dc
+    36d3:	e8 58 09 00 00       	call   4030 <printf>
+    exit();
+    36d8:	e8 e2 07 00 00       	call   3ebf <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    36dd:	56                   	push   %esi
+    36de:	53                   	push   %ebx
+    36df:	68 34 5b 00 00       	push   $0x5b34
+    36e4:	ff 35 dc 66 00 00    	push   0x66dc
+    36ea:	e8 41 09 00 00       	call   4030 <printf>
+    exit();
+    36ef:	e8 cb 07 00 00       	call   3ebf <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    36f4:	50                   	push   %eax
+    36f5:	53                   	push   %ebx
+    36f6:	68 fc 5a 00 00       	push   $0x5afc
+    36fb:	ff 35 dc 66 00 00    	push   0x66dc
+    3701:	e8 2a 09 00 00       	call   4030 <printf>
+    exit();
+    3706:	e8 b4 07 00 00       	call   3ebf <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    370b:	53                   	push   %ebx
+    370c:	53                   	push   %ebx
+    370d:	68 6c 53 00 00       	push   $0x536c
+    3712:	ff 35 dc 66 00 00    	push   0x66dc
+    3718:	e8 13 09 00 00       	call   4030 <printf>
+    exit();
+    371d:	e8 9d 07 00 00       	call   3ebf <exit>
+    3722:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3729:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003730 <validateint>:
+}
+    3730:	c3                   	ret
+    3731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    373f:	90                   	nop
+
+00003740 <validatetest>:
+{
+    3740:	55                   	push   %ebp
+    3741:	89 e5                	mov    %esp,%ebp
+    3743:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3744:	31 f6                	xor    %esi,%esi
+{
+    3746:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3747:	83 ec 08             	sub    $0x8,%esp
+    374a:	68 c9 53 00 00       	push   $0x53c9
+    374f:	ff 35 dc 66 00 00    	push   0x66dc
+    3755:	e8 d6 08 00 00       	call   4030 <printf>
+    375a:	83 c4 10             	add    $0x10,%esp
+    375d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3760:	e8 52 07 00 00       	call   3eb7 <fork>
+    3765:	89 c3                	mov    %eax,%ebx
+    3767:	85 c0                	test   %eax,%eax
+    3769:	74 63                	je     37ce <validatetest+0x8e>
+    sleep(0);
+    376b:	83 ec 0c             	sub    $0xc,%esp
+    376e:	6a 00                	push   $0x0
+    3770:	e8 da 07 00 00       	call   3f4f <sleep>
+    sleep(0);
+    3775:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    377c:	e8 ce 07 00 00       	call   3f4f <sleep>
+    kill(pid);
+    3781:	89 1c 24             	mov    %ebx,(%esp)
+    3784:	e8 66 07 00 00       	call   3eef <kill>
+    wait();
+    3789:	e8 39 07 00 00       	call   3ec7 <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    378e:	58                   	pop    %eax
+    378f:	5a                   	pop    %edx
+    3790:	56                   	push   %esi
+    3791:	68 d8 53 00 00       	push   $0x53d8
+    3796:	e8 84 07 00 00       	call   3f1f <link>
+    379b:	83 c4 10             	add    $0x10,%esp
+    379e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    37a1:	75 30                	jne    37d3 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    37a3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    37a9:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    37af:	75 af                	jne    3760 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    37b1:	83 ec 08             	sub    $0x8,%esp
+    37b4:	68 fc 53 00 00       	push   $0x53fc
+    37b9:	ff 35 dc 66 00 00    	push   0x66dc
+    37bf:	e8 6c 08 00 00       	call   4030 <printf>
+}
+    37c4:	83 c4 10             	add    $0x10,%esp
+    37c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    37ca:	5b                   	pop    %ebx
+    37cb:	5e                   	pop    %esi
+    37cc:	5d                   	pop    %ebp
+    37cd:	c3                   	ret
+      exit();
+    37ce:	e8 ec 06 00 00       	call   3ebf <exit>
+      printf(stdout, "link should not succeed\n");
+    37d3:	83 ec 08             	sub    $0x8,%esp
+    37d6:	68 e3 53 00 00       	push   $0x53e3
+    37db:	ff 35 dc 66 00 00    	push   0x66dc
+    37e1:	e8 4a 08 00 00       	call   4030 <printf>
+      exit();
+    37e6:	e8 d4 06 00 00       	call   3ebf <exit>
+    37eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    37ef:	90                   	nop
+
+000037f0 <bsstest>:
+{
+    37f0:	55                   	push   %ebp
+    37f1:	89 e5                	mov    %esp,%ebp
+    37f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    37f6:	68 09 54 00 00       	push   $0x5409
+    37fb:	ff 35 dc 66 00 00    	push   0x66dc
+    3801:	e8 2a 08 00 00       	call   4030 <printf>
+    3806:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3809:	31 c0                	xor    %eax,%eax
+    380b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    380f:	90                   	nop
+    if(uninit[i] != '\0'){
+    3810:	80 b8 00 67 00 00 00 	cmpb   $0x0,0x6700(%eax)
+    3817:	75 22                	jne    383b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3819:	83 c0 01             	add    $0x1,%eax
+    381c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3821:	75 ed                	jne    3810 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3823:	83 ec 08             	sub    $0x8,%esp
+    3826:	68 24 54 00 00       	push   $0x5424
+    382b:	ff 35 dc 66 00 00    	push   0x66dc
+    3831:	e8 fa 07 00 00       	call   4030 <printf>
+}
+    3836:	83 c4 10             	add    $0x10,%esp
+    3839:	c9                   	leave
+    383a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    383b:	83 ec 08             	sub    $0x8,%esp
+    383e:	68 13 54 00 00       	push   $0x5413
+    3843:	ff 35 dc 66 00 00    	push   0x66dc
+    3849:	e8 e2 07 00 00       	call   4030 <printf>
+      exit();
+    384e:	e8 6c 06 00 00       	call   3ebf <exit>
+    3853:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    385a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003860 <bigargtest>:
+{
+    3860:	55                   	push   %ebp
+    3861:	89 e5                	mov    %esp,%ebp
+    3863:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3866:	68 31 54 00 00       	push   $0x5431
+    386b:	e8 9f 06 00 00       	call   3f0f <unlink>
+  pid = fork();
+    3870:	e8 42 06 00 00       	call   3eb7 <fork>
+  if(pid == 0){
+    3875:	83 c4 10             	add    $0x10,%esp
+    3878:	85 c0                	test   %eax,%eax
+    387a:	74 44                	je     38c0 <bigargtest+0x60>
+  } else if(pid < 0){
+    387c:	0f 88 c3 00 00 00    	js     3945 <bigargtest+0xe5>
+  wait();
+    3882:	e8 40 06 00 00       	call   3ec7 <wait>
+  fd = open("bigarg-ok", 0);
+    3887:	83 ec 08             	sub    $0x8,%esp
+    388a:	6a 00                	push   $0x0
+    388c:	68 31 54 00 00       	push   $0x5431
+    3891:	e8 69 06 00 00       	call   3eff <open>
+  if(fd < 0){
+    3896:	83 c4 10             	add    $0x10,%esp
+    3899:	85 c0                	test   %eax,%eax
+    389b:	0f 88 8d 00 00 00    	js     392e <bigargtest+0xce>
+  close(fd);
+    38a1:	83 ec 0c             	sub    $0xc,%esp
+    38a4:	50                   	push   %eax
+    38a5:	e8 3d 06 00 00       	call   3ee7 <close>
+  unlink("bigarg-ok");
+    38aa:	c7 04 24 31 54 00 00 	movl   $0x5431,(%esp)
+    38b1:	e8 59 06 00 00       	call   3f0f <unlink>
+}
+    38b6:	83 c4 10             	add    $0x10,%esp
+    38b9:	c9                   	leave
+    38ba:	c3                   	ret
+    38bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    38bf:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    38c0:	c7 04 85 20 ae 00 00 	movl   $0x5bb0,0xae20(,%eax,4)
+    38c7:	b0 5b 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    38cb:	83 c0 01             	add    $0x1,%eax
+    38ce:	83 f8 1f             	cmp    $0x1f,%eax
+    38d1:	75 ed                	jne    38c0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    38d3:	31 c9                	xor    %ecx,%ecx
+    38d5:	89 0d 9c ae 00 00    	mov    %ecx,0xae9c
+    printf(stdout, "bigarg test\n");
+    38db:	50                   	push   %eax
+    38dc:	50                   	push   %eax
+    38dd:	68 3b 54 00 00       	push   $0x543b
+    38e2:	ff 35 dc 66 00 00    	push   0x66dc
+    38e8:	e8 43 07 00 00       	call   4030 <printf>
+    exec("echo", args);
+    38ed:	58                   	pop    %eax
+    38ee:	5a                   	pop    %edx
+    38ef:	68 20 ae 00 00       	push   $0xae20
+    38f4:	68 20 44 00 00       	push   $0x4420
+    38f9:	e8 f9 05 00 00       	call   3ef7 <exec>
+    printf(stdout, "bigarg test ok\n");
+    38fe:	59                   	pop    %ecx
+    38ff:	58                   	pop    %eax
+    3900:	68 48 54 00 00       	push   $0x5448
+    3905:	ff 35 dc 66 00 00    	push   0x66dc
+    390b:	e8 20 07 00 00       	call   4030 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3910:	58                   	pop    %eax
+    3911:	5a                   	pop    %edx
+    3912:	68 00 02 00 00       	push   $0x200
+    3917:	68 31 54 00 00       	push   $0x5431
+    391c:	e8 de 05 00 00       	call   3eff <open>
+    close(fd);
+    3921:	89 04 24             	mov    %eax,(%esp)
+    3924:	e8 be 05 00 00       	call   3ee7 <close>
+    exit();
+    3929:	e8 91 05 00 00       	call   3ebf <exit>
+    printf(stdout, "bigarg test failed!\n");
+    392e:	50                   	push   %eax
+    392f:	50                   	push   %eax
+    3930:	68 71 54 00 00       	push   $0x5471
+    3935:	ff 35 dc 66 00 00    	push   0x66dc
+    393b:	e8 f0 06 00 00       	call   4030 <printf>
+    exit();
+    3940:	e8 7a 05 00 00       	call   3ebf <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3945:	52                   	push   %edx
+    3946:	52                   	push   %edx
+    3947:	68 58 54 00 00       	push   $0x5458
+    394c:	ff 35 dc 66 00 00    	push   0x66dc
+    3952:	e8 d9 06 00 00       	call   4030 <printf>
+    exit();
+    3957:	e8 63 05 00 00       	call   3ebf <exit>
+    395c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003960 <fsfull>:
+{
+    3960:	55                   	push   %ebp
+    3961:	89 e5                	mov    %esp,%ebp
+    3963:	57                   	push   %edi
+    3964:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3965:	31 f6                	xor    %esi,%esi
+{
+    3967:	53                   	push   %ebx
+    3968:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    396b:	68 86 54 00 00       	push   $0x5486
+    3970:	6a 01                	push   $0x1
+    3972:	e8 b9 06 00 00       	call   4030 <printf>
+    3977:	83 c4 10             	add    $0x10,%esp
+    397a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3980:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3985:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    398a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    398d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3991:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    3993:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3997:	c1 ea 06             	shr    $0x6,%edx
+    399a:	8d 42 30             	lea    0x30(%edx),%eax
+    399d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    39a0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    39a6:	89 f2                	mov    %esi,%edx
+    39a8:	29 c2                	sub    %eax,%edx
+    39aa:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    39af:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    39b1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    39b6:	c1 ea 05             	shr    $0x5,%edx
+    39b9:	83 c2 30             	add    $0x30,%edx
+    39bc:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    39bf:	f7 e6                	mul    %esi
+    39c1:	c1 ea 05             	shr    $0x5,%edx
+    39c4:	6b c2 64             	imul   $0x64,%edx,%eax
+    39c7:	89 f2                	mov    %esi,%edx
+    39c9:	29 c2                	sub    %eax,%edx
+    39cb:	89 d0                	mov    %edx,%eax
+    39cd:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    39cf:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    39d1:	c1 ea 03             	shr    $0x3,%edx
+    39d4:	83 c2 30             	add    $0x30,%edx
+    39d7:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    39da:	f7 e1                	mul    %ecx
+    39dc:	89 f0                	mov    %esi,%eax
+    39de:	c1 ea 03             	shr    $0x3,%edx
+    39e1:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    39e4:	01 d2                	add    %edx,%edx
+    39e6:	29 d0                	sub    %edx,%eax
+    39e8:	83 c0 30             	add    $0x30,%eax
+    39eb:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    39ee:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    39f1:	50                   	push   %eax
+    39f2:	68 93 54 00 00       	push   $0x5493
+    39f7:	6a 01                	push   $0x1
+    39f9:	e8 32 06 00 00       	call   4030 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    39fe:	58                   	pop    %eax
+    39ff:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3a02:	5a                   	pop    %edx
+    3a03:	68 02 02 00 00       	push   $0x202
+    3a08:	50                   	push   %eax
+    3a09:	e8 f1 04 00 00       	call   3eff <open>
+    if(fd < 0){
+    3a0e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3a11:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3a13:	85 c0                	test   %eax,%eax
+    3a15:	78 4f                	js     3a66 <fsfull+0x106>
+    int total = 0;
+    3a17:	31 db                	xor    %ebx,%ebx
+    3a19:	eb 07                	jmp    3a22 <fsfull+0xc2>
+    3a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a1f:	90                   	nop
+      total += cc;
+    3a20:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3a22:	83 ec 04             	sub    $0x4,%esp
+    3a25:	68 00 02 00 00       	push   $0x200
+    3a2a:	68 20 8e 00 00       	push   $0x8e20
+    3a2f:	57                   	push   %edi
+    3a30:	e8 aa 04 00 00       	call   3edf <write>
+      if(cc < 512)
+    3a35:	83 c4 10             	add    $0x10,%esp
+    3a38:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    3a3d:	7f e1                	jg     3a20 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    3a3f:	83 ec 04             	sub    $0x4,%esp
+    3a42:	53                   	push   %ebx
+    3a43:	68 af 54 00 00       	push   $0x54af
+    3a48:	6a 01                	push   $0x1
+    3a4a:	e8 e1 05 00 00       	call   4030 <printf>
+    close(fd);
+    3a4f:	89 3c 24             	mov    %edi,(%esp)
+    3a52:	e8 90 04 00 00       	call   3ee7 <close>
+    if(total == 0)
+    3a57:	83 c4 10             	add    $0x10,%esp
+    3a5a:	85 db                	test   %ebx,%ebx
+    3a5c:	74 1e                	je     3a7c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    3a5e:	83 c6 01             	add    $0x1,%esi
+    3a61:	e9 1a ff ff ff       	jmp    3980 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    3a66:	83 ec 04             	sub    $0x4,%esp
+    3a69:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3a6c:	50                   	push   %eax
+    3a6d:	68 9f 54 00 00       	push   $0x549f
+    3a72:	6a 01                	push   $0x1
+    3a74:	e8 b7 05 00 00       	call   4030 <printf>
+      break;
+    3a79:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    3a7c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3a81:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    3a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3a90:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    3a92:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    3a95:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3a99:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    3a9b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3a9f:	c1 ea 06             	shr    $0x6,%edx
+    3aa2:	8d 42 30             	lea    0x30(%edx),%eax
+    3aa5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3aa8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3aae:	89 f2                	mov    %esi,%edx
+    3ab0:	29 c2                	sub    %eax,%edx
+    3ab2:	89 d0                	mov    %edx,%eax
+    3ab4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3ab6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3ab8:	c1 ea 05             	shr    $0x5,%edx
+    3abb:	83 c2 30             	add    $0x30,%edx
+    3abe:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3ac1:	f7 e3                	mul    %ebx
+    3ac3:	c1 ea 05             	shr    $0x5,%edx
+    3ac6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    3ac9:	89 f2                	mov    %esi,%edx
+    3acb:	29 ca                	sub    %ecx,%edx
+    3acd:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    3ad2:	89 d0                	mov    %edx,%eax
+    3ad4:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3ad6:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3ad8:	c1 ea 03             	shr    $0x3,%edx
+    3adb:	83 c2 30             	add    $0x30,%edx
+    3ade:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3ae1:	f7 e1                	mul    %ecx
+    3ae3:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3ae5:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3ae8:	c1 ea 03             	shr    $0x3,%edx
+    3aeb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3aee:	01 d2                	add    %edx,%edx
+    3af0:	29 d0                	sub    %edx,%eax
+    3af2:	83 c0 30             	add    $0x30,%eax
+    3af5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3af8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3afb:	50                   	push   %eax
+    3afc:	e8 0e 04 00 00       	call   3f0f <unlink>
+  while(nfiles >= 0){
+    3b01:	83 c4 10             	add    $0x10,%esp
+    3b04:	83 fe ff             	cmp    $0xffffffff,%esi
+    3b07:	75 87                	jne    3a90 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3b09:	83 ec 08             	sub    $0x8,%esp
+    3b0c:	68 bf 54 00 00       	push   $0x54bf
+    3b11:	6a 01                	push   $0x1
+    3b13:	e8 18 05 00 00       	call   4030 <printf>
+}
+    3b18:	83 c4 10             	add    $0x10,%esp
+    3b1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3b1e:	5b                   	pop    %ebx
+    3b1f:	5e                   	pop    %esi
+    3b20:	5f                   	pop    %edi
+    3b21:	5d                   	pop    %ebp
+    3b22:	c3                   	ret
+    3b23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003b30 <uio>:
+{
+    3b30:	55                   	push   %ebp
+    3b31:	89 e5                	mov    %esp,%ebp
+    3b33:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3b36:	68 d5 54 00 00       	push   $0x54d5
+    3b3b:	6a 01                	push   $0x1
+    3b3d:	e8 ee 04 00 00       	call   4030 <printf>
+  pid = fork();
+    3b42:	e8 70 03 00 00       	call   3eb7 <fork>
+  if(pid == 0){
+    3b47:	83 c4 10             	add    $0x10,%esp
+    3b4a:	85 c0                	test   %eax,%eax
+    3b4c:	74 1b                	je     3b69 <uio+0x39>
+  } else if(pid < 0){
+    3b4e:	78 3d                	js     3b8d <uio+0x5d>
+  wait();
+    3b50:	e8 72 03 00 00       	call   3ec7 <wait>
+  printf(1, "uio test done\n");
+    3b55:	83 ec 08             	sub    $0x8,%esp
+    3b58:	68 df 54 00 00       	push   $0x54df
+    3b5d:	6a 01                	push   $0x1
+    3b5f:	e8 cc 04 00 00       	call   4030 <printf>
+}
+    3b64:	83 c4 10             	add    $0x10,%esp
+    3b67:	c9                   	leave
+    3b68:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    3b69:	b8 09 00 00 00       	mov    $0x9,%eax
+    3b6e:	ba 70 00 00 00       	mov    $0x70,%edx
+    3b73:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    3b74:	ba 71 00 00 00       	mov    $0x71,%edx
+    3b79:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    3b7a:	52                   	push   %edx
+    3b7b:	52                   	push   %edx
+    3b7c:	68 90 5c 00 00       	push   $0x5c90
+    3b81:	6a 01                	push   $0x1
+    3b83:	e8 a8 04 00 00       	call   4030 <printf>
+    exit();
+    3b88:	e8 32 03 00 00       	call   3ebf <exit>
+    printf (1, "fork failed\n");
+    3b8d:	50                   	push   %eax
+    3b8e:	50                   	push   %eax
+    3b8f:	68 64 54 00 00       	push   $0x5464
+    3b94:	6a 01                	push   $0x1
+    3b96:	e8 95 04 00 00       	call   4030 <printf>
+    exit();
+    3b9b:	e8 1f 03 00 00       	call   3ebf <exit>
+
+00003ba0 <argptest>:
+{
+    3ba0:	55                   	push   %ebp
+    3ba1:	89 e5                	mov    %esp,%ebp
+    3ba3:	53                   	push   %ebx
+    3ba4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    3ba7:	6a 00                	push   $0x0
+    3ba9:	68 ee 54 00 00       	push   $0x54ee
+    3bae:	e8 4c 03 00 00       	call   3eff <open>
+  if (fd < 0) {
+    3bb3:	83 c4 10             	add    $0x10,%esp
+    3bb6:	85 c0                	test   %eax,%eax
+    3bb8:	78 39                	js     3bf3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    3bba:	83 ec 0c             	sub    $0xc,%esp
+    3bbd:	89 c3                	mov    %eax,%ebx
+    3bbf:	6a 00                	push   $0x0
+    3bc1:	e8 81 03 00 00       	call   3f47 <sbrk>
+    3bc6:	83 c4 0c             	add    $0xc,%esp
+    3bc9:	83 e8 01             	sub    $0x1,%eax
+    3bcc:	6a ff                	push   $0xffffffff
+    3bce:	50                   	push   %eax
+    3bcf:	53                   	push   %ebx
+    3bd0:	e8 02 03 00 00       	call   3ed7 <read>
+  close(fd);
+    3bd5:	89 1c 24             	mov    %ebx,(%esp)
+    3bd8:	e8 0a 03 00 00       	call   3ee7 <close>
+  printf(1, "arg test passed\n");
+    3bdd:	58                   	pop    %eax
+    3bde:	5a                   	pop    %edx
+    3bdf:	68 00 55 00 00       	push   $0x5500
+    3be4:	6a 01                	push   $0x1
+    3be6:	e8 45 04 00 00       	call   4030 <printf>
+}
+    3beb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3bee:	83 c4 10             	add    $0x10,%esp
+    3bf1:	c9                   	leave
+    3bf2:	c3                   	ret
+    printf(2, "open failed\n");
+    3bf3:	51                   	push   %ecx
+    3bf4:	51                   	push   %ecx
+    3bf5:	68 f3 54 00 00       	push   $0x54f3
+    3bfa:	6a 02                	push   $0x2
+    3bfc:	e8 2f 04 00 00       	call   4030 <printf>
+    exit();
+    3c01:	e8 b9 02 00 00       	call   3ebf <exit>
+    3c06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003c10 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    3c10:	69 05 d8 66 00 00 0d 	imul   $0x19660d,0x66d8,%eax
+    3c17:	66 19 00 
+    3c1a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    3c1f:	a3 d8 66 00 00       	mov    %eax,0x66d8
+}
+    3c24:	c3                   	ret
+    3c25:	66 90                	xchg   %ax,%ax
+    3c27:	66 90                	xchg   %ax,%ax
+    3c29:	66 90                	xchg   %ax,%ax
+    3c2b:	66 90                	xchg   %ax,%ax
+    3c2d:	66 90                	xchg   %ax,%ax
+    3c2f:	90                   	nop
+
+00003c30 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    3c30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    3c31:	31 c0                	xor    %eax,%eax
+{
+    3c33:	89 e5                	mov    %esp,%ebp
+    3c35:	53                   	push   %ebx
+    3c36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3c39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    3c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    3c40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    3c44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    3c47:	83 c0 01             	add    $0x1,%eax
+    3c4a:	84 d2                	test   %dl,%dl
+    3c4c:	75 f2                	jne    3c40 <strcpy+0x10>
+    ;
+  return os;
+}
+    3c4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3c51:	89 c8                	mov    %ecx,%eax
+    3c53:	c9                   	leave
+    3c54:	c3                   	ret
+    3c55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003c60 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    3c60:	55                   	push   %ebp
+    3c61:	89 e5                	mov    %esp,%ebp
+    3c63:	53                   	push   %ebx
+    3c64:	8b 55 08             	mov    0x8(%ebp),%edx
+    3c67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    3c6a:	0f b6 02             	movzbl (%edx),%eax
+    3c6d:	84 c0                	test   %al,%al
+    3c6f:	75 17                	jne    3c88 <strcmp+0x28>
+    3c71:	eb 3a                	jmp    3cad <strcmp+0x4d>
+    3c73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3c77:	90                   	nop
+    3c78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    3c7c:	83 c2 01             	add    $0x1,%edx
+    3c7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    3c82:	84 c0                	test   %al,%al
+    3c84:	74 1a                	je     3ca0 <strcmp+0x40>
+    p++, q++;
+    3c86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    3c88:	0f b6 19             	movzbl (%ecx),%ebx
+    3c8b:	38 c3                	cmp    %al,%bl
+    3c8d:	74 e9                	je     3c78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    3c8f:	29 d8                	sub    %ebx,%eax
+}
+    3c91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3c94:	c9                   	leave
+    3c95:	c3                   	ret
+    3c96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    3ca0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    3ca4:	31 c0                	xor    %eax,%eax
+    3ca6:	29 d8                	sub    %ebx,%eax
+}
+    3ca8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3cab:	c9                   	leave
+    3cac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    3cad:	0f b6 19             	movzbl (%ecx),%ebx
+    3cb0:	31 c0                	xor    %eax,%eax
+    3cb2:	eb db                	jmp    3c8f <strcmp+0x2f>
+    3cb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3cbf:	90                   	nop
+
+00003cc0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    3cc0:	55                   	push   %ebp
+    3cc1:	89 e5                	mov    %esp,%ebp
+    3cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    3cc6:	80 3a 00             	cmpb   $0x0,(%edx)
+    3cc9:	74 15                	je     3ce0 <strlen+0x20>
+    3ccb:	31 c0                	xor    %eax,%eax
+    3ccd:	8d 76 00             	lea    0x0(%esi),%esi
+    3cd0:	83 c0 01             	add    $0x1,%eax
+    3cd3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    3cd7:	89 c1                	mov    %eax,%ecx
+    3cd9:	75 f5                	jne    3cd0 <strlen+0x10>
+    ;
+  return n;
+}
+    3cdb:	89 c8                	mov    %ecx,%eax
+    3cdd:	5d                   	pop    %ebp
+    3cde:	c3                   	ret
+    3cdf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    3ce0:	31 c9                	xor    %ecx,%ecx
+}
+    3ce2:	5d                   	pop    %ebp
+    3ce3:	89 c8                	mov    %ecx,%eax
+    3ce5:	c3                   	ret
+    3ce6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ced:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003cf0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    3cf0:	55                   	push   %ebp
+    3cf1:	89 e5                	mov    %esp,%ebp
+    3cf3:	57                   	push   %edi
+    3cf4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3cf7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    3cfa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    3cfd:	89 d7                	mov    %edx,%edi
+    3cff:	fc                   	cld
+    3d00:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    3d02:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    3d05:	89 d0                	mov    %edx,%eax
+    3d07:	c9                   	leave
+    3d08:	c3                   	ret
+    3d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003d10 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    3d10:	55                   	push   %ebp
+    3d11:	89 e5                	mov    %esp,%ebp
+    3d13:	8b 45 08             	mov    0x8(%ebp),%eax
+    3d16:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    3d1a:	0f b6 10             	movzbl (%eax),%edx
+    3d1d:	84 d2                	test   %dl,%dl
+    3d1f:	75 12                	jne    3d33 <strchr+0x23>
+    3d21:	eb 1d                	jmp    3d40 <strchr+0x30>
+    3d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d27:	90                   	nop
+    3d28:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    3d2c:	83 c0 01             	add    $0x1,%eax
+    3d2f:	84 d2                	test   %dl,%dl
+    3d31:	74 0d                	je     3d40 <strchr+0x30>
+    if(*s == c)
+    3d33:	38 d1                	cmp    %dl,%cl
+    3d35:	75 f1                	jne    3d28 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    3d37:	5d                   	pop    %ebp
+    3d38:	c3                   	ret
+    3d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    3d40:	31 c0                	xor    %eax,%eax
+}
+    3d42:	5d                   	pop    %ebp
+    3d43:	c3                   	ret
+    3d44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d4f:	90                   	nop
+
+00003d50 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    3d50:	55                   	push   %ebp
+    3d51:	89 e5                	mov    %esp,%ebp
+    3d53:	57                   	push   %edi
+    3d54:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    3d55:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    3d58:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    3d59:	31 db                	xor    %ebx,%ebx
+{
+    3d5b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    3d5e:	eb 2b                	jmp    3d8b <gets+0x3b>
+    cc = read(0, &c, 1);
+    3d60:	83 ec 04             	sub    $0x4,%esp
+    3d63:	6a 01                	push   $0x1
+    3d65:	56                   	push   %esi
+    3d66:	6a 00                	push   $0x0
+    3d68:	e8 6a 01 00 00       	call   3ed7 <read>
+    if(cc < 1)
+    3d6d:	83 c4 10             	add    $0x10,%esp
+    3d70:	85 c0                	test   %eax,%eax
+    3d72:	7e 21                	jle    3d95 <gets+0x45>
+      break;
+    buf[i++] = c;
+    3d74:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3d78:	8b 55 08             	mov    0x8(%ebp),%edx
+    if(c == '\n' || c == '\r' || c == '\t')
+    3d7b:	8d 48 f7             	lea    -0x9(%eax),%ecx
+    buf[i++] = c;
+    3d7e:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r' || c == '\t')
+    3d82:	80 f9 01             	cmp    $0x1,%cl
+    3d85:	76 10                	jbe    3d97 <gets+0x47>
+    3d87:	3c 0d                	cmp    $0xd,%al
+    3d89:	74 0c                	je     3d97 <gets+0x47>
+  for(i=0; i+1 < max; ){
+    3d8b:	89 df                	mov    %ebx,%edi
+    3d8d:	83 c3 01             	add    $0x1,%ebx
+    3d90:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    3d93:	7c cb                	jl     3d60 <gets+0x10>
+    3d95:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    3d97:	8b 45 08             	mov    0x8(%ebp),%eax
+    3d9a:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    3d9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3da1:	5b                   	pop    %ebx
+    3da2:	5e                   	pop    %esi
+    3da3:	5f                   	pop    %edi
+    3da4:	5d                   	pop    %ebp
+    3da5:	c3                   	ret
+    3da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003db0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    3db0:	55                   	push   %ebp
+    3db1:	89 e5                	mov    %esp,%ebp
+    3db3:	56                   	push   %esi
+    3db4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3db5:	83 ec 08             	sub    $0x8,%esp
+    3db8:	6a 00                	push   $0x0
+    3dba:	ff 75 08             	push   0x8(%ebp)
+    3dbd:	e8 3d 01 00 00       	call   3eff <open>
+  if(fd < 0)
+    3dc2:	83 c4 10             	add    $0x10,%esp
+    3dc5:	85 c0                	test   %eax,%eax
+    3dc7:	78 27                	js     3df0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    3dc9:	83 ec 08             	sub    $0x8,%esp
+    3dcc:	ff 75 0c             	push   0xc(%ebp)
+    3dcf:	89 c3                	mov    %eax,%ebx
+    3dd1:	50                   	push   %eax
+    3dd2:	e8 40 01 00 00       	call   3f17 <fstat>
+  close(fd);
+    3dd7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    3dda:	89 c6                	mov    %eax,%esi
+  close(fd);
+    3ddc:	e8 06 01 00 00       	call   3ee7 <close>
+  return r;
+    3de1:	83 c4 10             	add    $0x10,%esp
+}
+    3de4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3de7:	89 f0                	mov    %esi,%eax
+    3de9:	5b                   	pop    %ebx
+    3dea:	5e                   	pop    %esi
+    3deb:	5d                   	pop    %ebp
+    3dec:	c3                   	ret
+    3ded:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    3df0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3df5:	eb ed                	jmp    3de4 <stat+0x34>
+    3df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dfe:	66 90                	xchg   %ax,%ax
+
+00003e00 <atoi>:
+
+int
+atoi(const char *s)
+{
+    3e00:	55                   	push   %ebp
+    3e01:	89 e5                	mov    %esp,%ebp
+    3e03:	53                   	push   %ebx
+    3e04:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    3e07:	0f be 02             	movsbl (%edx),%eax
+    3e0a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    3e0d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    3e10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    3e15:	77 1e                	ja     3e35 <atoi+0x35>
+    3e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e1e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    3e20:	83 c2 01             	add    $0x1,%edx
+    3e23:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    3e26:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    3e2a:	0f be 02             	movsbl (%edx),%eax
+    3e2d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    3e30:	80 fb 09             	cmp    $0x9,%bl
+    3e33:	76 eb                	jbe    3e20 <atoi+0x20>
+  return n;
+}
+    3e35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3e38:	89 c8                	mov    %ecx,%eax
+    3e3a:	c9                   	leave
+    3e3b:	c3                   	ret
+    3e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003e40 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    3e40:	55                   	push   %ebp
+    3e41:	89 e5                	mov    %esp,%ebp
+    3e43:	57                   	push   %edi
+    3e44:	56                   	push   %esi
+    3e45:	8b 45 10             	mov    0x10(%ebp),%eax
+    3e48:	8b 55 08             	mov    0x8(%ebp),%edx
+    3e4b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    3e4e:	85 c0                	test   %eax,%eax
+    3e50:	7e 13                	jle    3e65 <memmove+0x25>
+    3e52:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    3e54:	89 d7                	mov    %edx,%edi
+    3e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e5d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    3e60:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    3e61:	39 f8                	cmp    %edi,%eax
+    3e63:	75 fb                	jne    3e60 <memmove+0x20>
+  return vdst;
+}
+    3e65:	5e                   	pop    %esi
+    3e66:	89 d0                	mov    %edx,%eax
+    3e68:	5f                   	pop    %edi
+    3e69:	5d                   	pop    %ebp
+    3e6a:	c3                   	ret
+    3e6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3e6f:	90                   	nop
+
+00003e70 <strncmp>:
+
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+    3e70:	55                   	push   %ebp
+    3e71:	89 e5                	mov    %esp,%ebp
+    3e73:	53                   	push   %ebx
+    3e74:	8b 55 10             	mov    0x10(%ebp),%edx
+    3e77:	8b 45 08             	mov    0x8(%ebp),%eax
+    3e7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+    3e7d:	85 d2                	test   %edx,%edx
+    3e7f:	75 16                	jne    3e97 <strncmp+0x27>
+    3e81:	eb 2d                	jmp    3eb0 <strncmp+0x40>
+    3e83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3e87:	90                   	nop
+    3e88:	3a 19                	cmp    (%ecx),%bl
+    3e8a:	75 12                	jne    3e9e <strncmp+0x2e>
+    n--, p++, q++;
+    3e8c:	83 c0 01             	add    $0x1,%eax
+    3e8f:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+    3e92:	83 ea 01             	sub    $0x1,%edx
+    3e95:	74 19                	je     3eb0 <strncmp+0x40>
+    3e97:	0f b6 18             	movzbl (%eax),%ebx
+    3e9a:	84 db                	test   %bl,%bl
+    3e9c:	75 ea                	jne    3e88 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+    3e9e:	0f b6 00             	movzbl (%eax),%eax
+    3ea1:	0f b6 11             	movzbl (%ecx),%edx
+    3ea4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3ea7:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+    3ea8:	29 d0                	sub    %edx,%eax
+    3eaa:	c3                   	ret
+    3eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3eaf:	90                   	nop
+    3eb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+    3eb3:	31 c0                	xor    %eax,%eax
+    3eb5:	c9                   	leave
+    3eb6:	c3                   	ret
+
+00003eb7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3eb7:	b8 01 00 00 00       	mov    $0x1,%eax
+    3ebc:	cd 40                	int    $0x40
+    3ebe:	c3                   	ret
+
+00003ebf <exit>:
+SYSCALL(exit)
+    3ebf:	b8 02 00 00 00       	mov    $0x2,%eax
+    3ec4:	cd 40                	int    $0x40
+    3ec6:	c3                   	ret
+
+00003ec7 <wait>:
+SYSCALL(wait)
+    3ec7:	b8 03 00 00 00       	mov    $0x3,%eax
+    3ecc:	cd 40                	int    $0x40
+    3ece:	c3                   	ret
+
+00003ecf <pipe>:
+SYSCALL(pipe)
+    3ecf:	b8 04 00 00 00       	mov    $0x4,%eax
+    3ed4:	cd 40                	int    $0x40
+    3ed6:	c3                   	ret
+
+00003ed7 <read>:
+SYSCALL(read)
+    3ed7:	b8 05 00 00 00       	mov    $0x5,%eax
+    3edc:	cd 40                	int    $0x40
+    3ede:	c3                   	ret
+
+00003edf <write>:
+SYSCALL(write)
+    3edf:	b8 10 00 00 00       	mov    $0x10,%eax
+    3ee4:	cd 40                	int    $0x40
+    3ee6:	c3                   	ret
+
+00003ee7 <close>:
+SYSCALL(close)
+    3ee7:	b8 15 00 00 00       	mov    $0x15,%eax
+    3eec:	cd 40                	int    $0x40
+    3eee:	c3                   	ret
+
+00003eef <kill>:
+SYSCALL(kill)
+    3eef:	b8 06 00 00 00       	mov    $0x6,%eax
+    3ef4:	cd 40                	int    $0x40
+    3ef6:	c3                   	ret
+
+00003ef7 <exec>:
+SYSCALL(exec)
+    3ef7:	b8 07 00 00 00       	mov    $0x7,%eax
+    3efc:	cd 40                	int    $0x40
+    3efe:	c3                   	ret
+
+00003eff <open>:
+SYSCALL(open)
+    3eff:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3f04:	cd 40                	int    $0x40
+    3f06:	c3                   	ret
+
+00003f07 <mknod>:
+SYSCALL(mknod)
+    3f07:	b8 11 00 00 00       	mov    $0x11,%eax
+    3f0c:	cd 40                	int    $0x40
+    3f0e:	c3                   	ret
+
+00003f0f <unlink>:
+SYSCALL(unlink)
+    3f0f:	b8 12 00 00 00       	mov    $0x12,%eax
+    3f14:	cd 40                	int    $0x40
+    3f16:	c3                   	ret
+
+00003f17 <fstat>:
+SYSCALL(fstat)
+    3f17:	b8 08 00 00 00       	mov    $0x8,%eax
+    3f1c:	cd 40                	int    $0x40
+    3f1e:	c3                   	ret
+
+00003f1f <link>:
+SYSCALL(link)
+    3f1f:	b8 13 00 00 00       	mov    $0x13,%eax
+    3f24:	cd 40                	int    $0x40
+    3f26:	c3                   	ret
+
+00003f27 <mkdir>:
+SYSCALL(mkdir)
+    3f27:	b8 14 00 00 00       	mov    $0x14,%eax
+    3f2c:	cd 40                	int    $0x40
+    3f2e:	c3                   	ret
+
+00003f2f <chdir>:
+SYSCALL(chdir)
+    3f2f:	b8 09 00 00 00       	mov    $0x9,%eax
+    3f34:	cd 40                	int    $0x40
+    3f36:	c3                   	ret
+
+00003f37 <dup>:
+SYSCALL(dup)
+    3f37:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3f3c:	cd 40                	int    $0x40
+    3f3e:	c3                   	ret
+
+00003f3f <getpid>:
+SYSCALL(getpid)
+    3f3f:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3f44:	cd 40                	int    $0x40
+    3f46:	c3                   	ret
+
+00003f47 <sbrk>:
+SYSCALL(sbrk)
+    3f47:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3f4c:	cd 40                	int    $0x40
+    3f4e:	c3                   	ret
+
+00003f4f <sleep>:
+SYSCALL(sleep)
+    3f4f:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3f54:	cd 40                	int    $0x40
+    3f56:	c3                   	ret
+
+00003f57 <uptime>:
+SYSCALL(uptime)
+    3f57:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3f5c:	cd 40                	int    $0x40
+    3f5e:	c3                   	ret
+
+00003f5f <setsched>:
+SYSCALL(setsched)
+    3f5f:	b8 16 00 00 00       	mov    $0x16,%eax
+    3f64:	cd 40                	int    $0x40
+    3f66:	c3                   	ret
+
+00003f67 <memstat>:
+SYSCALL(memstat)
+    3f67:	b8 17 00 00 00       	mov    $0x17,%eax
+    3f6c:	cd 40                	int    $0x40
+    3f6e:	c3                   	ret
+
+00003f6f <lseek>:
+SYSCALL(lseek)
+    3f6f:	b8 18 00 00 00       	mov    $0x18,%eax
+    3f74:	cd 40                	int    $0x40
+    3f76:	c3                   	ret
+
+00003f77 <setiosched>:
+SYSCALL(setiosched)
+    3f77:	b8 19 00 00 00       	mov    $0x19,%eax
+    3f7c:	cd 40                	int    $0x40
+    3f7e:	c3                   	ret
+
+00003f7f <iostat>:
+SYSCALL(iostat)
+    3f7f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3f84:	cd 40                	int    $0x40
+    3f86:	c3                   	ret
+    3f87:	66 90                	xchg   %ax,%ax
+    3f89:	66 90                	xchg   %ax,%ax
+    3f8b:	66 90                	xchg   %ax,%ax
+    3f8d:	66 90                	xchg   %ax,%ax
+    3f8f:	90                   	nop
+
+00003f90 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3f90:	55                   	push   %ebp
+    3f91:	89 e5                	mov    %esp,%ebp
+    3f93:	57                   	push   %edi
+    3f94:	56                   	push   %esi
+    3f95:	53                   	push   %ebx
+    3f96:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    3f98:	89 d1                	mov    %edx,%ecx
+{
+    3f9a:	83 ec 3c             	sub    $0x3c,%esp
+    3f9d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    3fa0:	85 d2                	test   %edx,%edx
+    3fa2:	0f 89 80 00 00 00    	jns    4028 <printint+0x98>
+    3fa8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    3fac:	74 7a                	je     4028 <printint+0x98>
+    x = -xx;
+    3fae:	f7 d9                	neg    %ecx
+    neg = 1;
+    3fb0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    3fb5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    3fb8:	31 f6                	xor    %esi,%esi
+    3fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    3fc0:	89 c8                	mov    %ecx,%eax
+    3fc2:	31 d2                	xor    %edx,%edx
+    3fc4:	89 f7                	mov    %esi,%edi
+    3fc6:	f7 f3                	div    %ebx
+    3fc8:	8d 76 01             	lea    0x1(%esi),%esi
+    3fcb:	0f b6 92 40 5d 00 00 	movzbl 0x5d40(%edx),%edx
+    3fd2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    3fd6:	89 ca                	mov    %ecx,%edx
+    3fd8:	89 c1                	mov    %eax,%ecx
+    3fda:	39 da                	cmp    %ebx,%edx
+    3fdc:	73 e2                	jae    3fc0 <printint+0x30>
+  if(neg)
+    3fde:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    3fe1:	85 c0                	test   %eax,%eax
+    3fe3:	74 07                	je     3fec <printint+0x5c>
+    buf[i++] = '-';
+    3fe5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    3fea:	89 f7                	mov    %esi,%edi
+    3fec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    3fef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    3ff2:	01 df                	add    %ebx,%edi
+    3ff4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    3ff8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    3ffb:	83 ec 04             	sub    $0x4,%esp
+    3ffe:	88 45 d7             	mov    %al,-0x29(%ebp)
+    4001:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    4004:	6a 01                	push   $0x1
+    4006:	50                   	push   %eax
+    4007:	56                   	push   %esi
+    4008:	e8 d2 fe ff ff       	call   3edf <write>
+  while(--i >= 0)
+    400d:	89 f8                	mov    %edi,%eax
+    400f:	83 c4 10             	add    $0x10,%esp
+    4012:	83 ef 01             	sub    $0x1,%edi
+    4015:	39 d8                	cmp    %ebx,%eax
+    4017:	75 df                	jne    3ff8 <printint+0x68>
+}
+    4019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    401c:	5b                   	pop    %ebx
+    401d:	5e                   	pop    %esi
+    401e:	5f                   	pop    %edi
+    401f:	5d                   	pop    %ebp
+    4020:	c3                   	ret
+    4021:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    4028:	31 c0                	xor    %eax,%eax
+    402a:	eb 89                	jmp    3fb5 <printint+0x25>
+    402c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004030 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    4030:	55                   	push   %ebp
+    4031:	89 e5                	mov    %esp,%ebp
+    4033:	57                   	push   %edi
+    4034:	56                   	push   %esi
+    4035:	53                   	push   %ebx
+    4036:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    4039:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    403c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    403f:	0f b6 1e             	movzbl (%esi),%ebx
+    4042:	83 c6 01             	add    $0x1,%esi
+    4045:	84 db                	test   %bl,%bl
+    4047:	74 67                	je     40b0 <printf+0x80>
+    4049:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    404c:	31 d2                	xor    %edx,%edx
+    404e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    4051:	eb 34                	jmp    4087 <printf+0x57>
+    4053:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4057:	90                   	nop
+    4058:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    405b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    4060:	83 f8 25             	cmp    $0x25,%eax
+    4063:	74 18                	je     407d <printf+0x4d>
+  write(fd, &c, 1);
+    4065:	83 ec 04             	sub    $0x4,%esp
+    4068:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    406b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    406e:	6a 01                	push   $0x1
+    4070:	50                   	push   %eax
+    4071:	57                   	push   %edi
+    4072:	e8 68 fe ff ff       	call   3edf <write>
+    4077:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    407a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    407d:	0f b6 1e             	movzbl (%esi),%ebx
+    4080:	83 c6 01             	add    $0x1,%esi
+    4083:	84 db                	test   %bl,%bl
+    4085:	74 29                	je     40b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4087:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    408a:	85 d2                	test   %edx,%edx
+    408c:	74 ca                	je     4058 <printf+0x28>
+      }
+    } else if(state == '%'){
+    408e:	83 fa 25             	cmp    $0x25,%edx
+    4091:	75 ea                	jne    407d <printf+0x4d>
+      if(c == 'd'){
+    4093:	83 f8 25             	cmp    $0x25,%eax
+    4096:	0f 84 24 01 00 00    	je     41c0 <printf+0x190>
+    409c:	83 e8 63             	sub    $0x63,%eax
+    409f:	83 f8 15             	cmp    $0x15,%eax
+    40a2:	77 1c                	ja     40c0 <printf+0x90>
+    40a4:	ff 24 85 e8 5c 00 00 	jmp    *0x5ce8(,%eax,4)
+    40ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    40af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    40b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    40b3:	5b                   	pop    %ebx
+    40b4:	5e                   	pop    %esi
+    40b5:	5f                   	pop    %edi
+    40b6:	5d                   	pop    %ebp
+    40b7:	c3                   	ret
+    40b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    40bf:	90                   	nop
+  write(fd, &c, 1);
+    40c0:	83 ec 04             	sub    $0x4,%esp
+    40c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    40c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    40ca:	6a 01                	push   $0x1
+    40cc:	52                   	push   %edx
+    40cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    40d0:	57                   	push   %edi
+    40d1:	e8 09 fe ff ff       	call   3edf <write>
+    40d6:	83 c4 0c             	add    $0xc,%esp
+    40d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    40dc:	6a 01                	push   $0x1
+    40de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    40e1:	52                   	push   %edx
+    40e2:	57                   	push   %edi
+    40e3:	e8 f7 fd ff ff       	call   3edf <write>
+        putc(fd, c);
+    40e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    40eb:	31 d2                	xor    %edx,%edx
+    40ed:	eb 8e                	jmp    407d <printf+0x4d>
+    40ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    40f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    40f3:	83 ec 0c             	sub    $0xc,%esp
+    40f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    40fb:	8b 13                	mov    (%ebx),%edx
+    40fd:	6a 00                	push   $0x0
+    40ff:	89 f8                	mov    %edi,%eax
+        ap++;
+    4101:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    4104:	e8 87 fe ff ff       	call   3f90 <printint>
+        ap++;
+    4109:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    410c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    410f:	31 d2                	xor    %edx,%edx
+    4111:	e9 67 ff ff ff       	jmp    407d <printf+0x4d>
+    4116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    411d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    4120:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4123:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    4125:	83 c0 04             	add    $0x4,%eax
+    4128:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    412b:	85 db                	test   %ebx,%ebx
+    412d:	0f 84 9d 00 00 00    	je     41d0 <printf+0x1a0>
+        while(*s != 0){
+    4133:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    4136:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    4138:	84 c0                	test   %al,%al
+    413a:	0f 84 3d ff ff ff    	je     407d <printf+0x4d>
+    4140:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4143:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    4146:	89 de                	mov    %ebx,%esi
+    4148:	89 d3                	mov    %edx,%ebx
+    414a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    4150:	83 ec 04             	sub    $0x4,%esp
+    4153:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    4156:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    4159:	6a 01                	push   $0x1
+    415b:	53                   	push   %ebx
+    415c:	57                   	push   %edi
+    415d:	e8 7d fd ff ff       	call   3edf <write>
+        while(*s != 0){
+    4162:	0f b6 06             	movzbl (%esi),%eax
+    4165:	83 c4 10             	add    $0x10,%esp
+    4168:	84 c0                	test   %al,%al
+    416a:	75 e4                	jne    4150 <printf+0x120>
+      state = 0;
+    416c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    416f:	31 d2                	xor    %edx,%edx
+    4171:	e9 07 ff ff ff       	jmp    407d <printf+0x4d>
+    4176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    417d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4180:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4183:	83 ec 0c             	sub    $0xc,%esp
+    4186:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    418b:	8b 13                	mov    (%ebx),%edx
+    418d:	6a 01                	push   $0x1
+    418f:	e9 6b ff ff ff       	jmp    40ff <printf+0xcf>
+    4194:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4198:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    419b:	83 ec 04             	sub    $0x4,%esp
+    419e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    41a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    41a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    41a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    41a9:	6a 01                	push   $0x1
+    41ab:	52                   	push   %edx
+    41ac:	57                   	push   %edi
+    41ad:	e8 2d fd ff ff       	call   3edf <write>
+        ap++;
+    41b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    41b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    41b8:	31 d2                	xor    %edx,%edx
+    41ba:	e9 be fe ff ff       	jmp    407d <printf+0x4d>
+    41bf:	90                   	nop
+  write(fd, &c, 1);
+    41c0:	83 ec 04             	sub    $0x4,%esp
+    41c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    41c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    41c9:	6a 01                	push   $0x1
+    41cb:	e9 11 ff ff ff       	jmp    40e1 <printf+0xb1>
+    41d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    41d5:	bb de 5c 00 00       	mov    $0x5cde,%ebx
+    41da:	e9 61 ff ff ff       	jmp    4140 <printf+0x110>
+    41df:	90                   	nop
+
+000041e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    41e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    41e1:	a1 a0 ae 00 00       	mov    0xaea0,%eax
+{
+    41e6:	89 e5                	mov    %esp,%ebp
+    41e8:	57                   	push   %edi
+    41e9:	56                   	push   %esi
+    41ea:	53                   	push   %ebx
+    41eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    41ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    41f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    41fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    41fc:	39 ca                	cmp    %ecx,%edx
+    41fe:	73 30                	jae    4230 <free+0x50>
+    4200:	39 c1                	cmp    %eax,%ecx
+    4202:	72 04                	jb     4208 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4204:	39 c2                	cmp    %eax,%edx
+    4206:	72 f0                	jb     41f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4208:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    420b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    420e:	39 f8                	cmp    %edi,%eax
+    4210:	74 2e                	je     4240 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4212:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4215:	8b 42 04             	mov    0x4(%edx),%eax
+    4218:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    421b:	39 f1                	cmp    %esi,%ecx
+    421d:	74 38                	je     4257 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    421f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4221:	5b                   	pop    %ebx
+  freep = p;
+    4222:	89 15 a0 ae 00 00    	mov    %edx,0xaea0
+}
+    4228:	5e                   	pop    %esi
+    4229:	5f                   	pop    %edi
+    422a:	5d                   	pop    %ebp
+    422b:	c3                   	ret
+    422c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4230:	39 c1                	cmp    %eax,%ecx
+    4232:	72 d0                	jb     4204 <free+0x24>
+    4234:	eb c2                	jmp    41f8 <free+0x18>
+    4236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    423d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    4240:	03 70 04             	add    0x4(%eax),%esi
+    4243:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4246:	8b 02                	mov    (%edx),%eax
+    4248:	8b 00                	mov    (%eax),%eax
+    424a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    424d:	8b 42 04             	mov    0x4(%edx),%eax
+    4250:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4253:	39 f1                	cmp    %esi,%ecx
+    4255:	75 c8                	jne    421f <free+0x3f>
+    p->s.size += bp->s.size;
+    4257:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    425a:	89 15 a0 ae 00 00    	mov    %edx,0xaea0
+    p->s.size += bp->s.size;
+    4260:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4263:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4266:	89 0a                	mov    %ecx,(%edx)
+}
+    4268:	5b                   	pop    %ebx
+    4269:	5e                   	pop    %esi
+    426a:	5f                   	pop    %edi
+    426b:	5d                   	pop    %ebp
+    426c:	c3                   	ret
+    426d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004270 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4270:	55                   	push   %ebp
+    4271:	89 e5                	mov    %esp,%ebp
+    4273:	57                   	push   %edi
+    4274:	56                   	push   %esi
+    4275:	53                   	push   %ebx
+    4276:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4279:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    427c:	8b 15 a0 ae 00 00    	mov    0xaea0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4282:	8d 78 07             	lea    0x7(%eax),%edi
+    4285:	c1 ef 03             	shr    $0x3,%edi
+    4288:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    428b:	85 d2                	test   %edx,%edx
+    428d:	0f 84 8d 00 00 00    	je     4320 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4293:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4295:	8b 48 04             	mov    0x4(%eax),%ecx
+    4298:	39 f9                	cmp    %edi,%ecx
+    429a:	73 64                	jae    4300 <malloc+0x90>
+  if(nu < 4096)
+    429c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    42a1:	39 df                	cmp    %ebx,%edi
+    42a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    42a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    42ad:	eb 0a                	jmp    42b9 <malloc+0x49>
+    42af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    42b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    42b2:	8b 48 04             	mov    0x4(%eax),%ecx
+    42b5:	39 f9                	cmp    %edi,%ecx
+    42b7:	73 47                	jae    4300 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    42b9:	89 c2                	mov    %eax,%edx
+    42bb:	39 05 a0 ae 00 00    	cmp    %eax,0xaea0
+    42c1:	75 ed                	jne    42b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    42c3:	83 ec 0c             	sub    $0xc,%esp
+    42c6:	56                   	push   %esi
+    42c7:	e8 7b fc ff ff       	call   3f47 <sbrk>
+  if(p == (char*)-1)
+    42cc:	83 c4 10             	add    $0x10,%esp
+    42cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    42d2:	74 1c                	je     42f0 <malloc+0x80>
+  hp->s.size = nu;
+    42d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    42d7:	83 ec 0c             	sub    $0xc,%esp
+    42da:	83 c0 08             	add    $0x8,%eax
+    42dd:	50                   	push   %eax
+    42de:	e8 fd fe ff ff       	call   41e0 <free>
+  return freep;
+    42e3:	8b 15 a0 ae 00 00    	mov    0xaea0,%edx
+      if((p = morecore(nunits)) == 0)
+    42e9:	83 c4 10             	add    $0x10,%esp
+    42ec:	85 d2                	test   %edx,%edx
+    42ee:	75 c0                	jne    42b0 <malloc+0x40>
+        return 0;
+  }
+}
+    42f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    42f3:	31 c0                	xor    %eax,%eax
+}
+    42f5:	5b                   	pop    %ebx
+    42f6:	5e                   	pop    %esi
+    42f7:	5f                   	pop    %edi
+    42f8:	5d                   	pop    %ebp
+    42f9:	c3                   	ret
+    42fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4300:	39 cf                	cmp    %ecx,%edi
+    4302:	74 4c                	je     4350 <malloc+0xe0>
+        p->s.size -= nunits;
+    4304:	29 f9                	sub    %edi,%ecx
+    4306:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4309:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    430c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    430f:	89 15 a0 ae 00 00    	mov    %edx,0xaea0
+}
+    4315:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4318:	83 c0 08             	add    $0x8,%eax
+}
+    431b:	5b                   	pop    %ebx
+    431c:	5e                   	pop    %esi
+    431d:	5f                   	pop    %edi
+    431e:	5d                   	pop    %ebp
+    431f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4320:	c7 05 a0 ae 00 00 a4 	movl   $0xaea4,0xaea0
+    4327:	ae 00 00 
+    base.s.size = 0;
+    432a:	b8 a4 ae 00 00       	mov    $0xaea4,%eax
+    base.s.ptr = freep = prevp = &base;
+    432f:	c7 05 a4 ae 00 00 a4 	movl   $0xaea4,0xaea4
+    4336:	ae 00 00 
+    base.s.size = 0;
+    4339:	c7 05 a8 ae 00 00 00 	movl   $0x0,0xaea8
+    4340:	00 00 00 
+    if(p->s.size >= nunits){
+    4343:	e9 54 ff ff ff       	jmp    429c <malloc+0x2c>
+    4348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    434f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4350:	8b 08                	mov    (%eax),%ecx
+    4352:	89 0a                	mov    %ecx,(%edx)
+    4354:	eb b9                	jmp    430f <malloc+0x9f>
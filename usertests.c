@@ -184,6 +184,9 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// Reaches into the doubly indirect blocks.
+#define BIGBLOCKS (NDIRECT + NINDIRECT + 2*NINDIRECT)
+
 void
 writetest1(void)
 {
@@ -197,7 +200,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGBLOCKS; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +220,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != BIGBLOCKS){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -931,6 +934,74 @@ bigdir(void)
   printf(1, "bigdir ok\n");
 }
 
+// A directory big enough to get a hash index: look every
+// entry up, free half and reuse their slots, then remove it.
+void
+indexdir(void)
+{
+  int i, fd;
+  char name[4];
+
+  printf(1, "indexdir test\n");
+  if(mkdir("idx") != 0 || chdir("idx") != 0){
+    printf(1, "indexdir mkdir failed\n");
+    exit();
+  }
+  fd = open("f", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "indexdir create failed\n");
+    exit();
+  }
+  close(fd);
+
+  name[0] = 'x';
+  name[3] = '\0';
+  for(i = 0; i < 400; i++){
+    name[1] = '0' + i/64;
+    name[2] = '0' + i%64;
+    if(link("f", name) != 0){
+      printf(1, "indexdir link failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 400; i += 2){
+    name[1] = '0' + i/64;
+    name[2] = '0' + i%64;
+    if(unlink(name) != 0){
+      printf(1, "indexdir unlink failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 400; i++){
+    name[1] = '0' + i/64;
+    name[2] = '0' + i%64;
+    fd = open(name, 0);
+    if((i%2 == 0) != (fd < 0)){
+      printf(1, "indexdir lookup of %s wrong\n", name);
+      exit();
+    }
+    if(fd >= 0)
+      close(fd);
+    if(i%2 == 0 && link("f", name) != 0){
+      printf(1, "indexdir relink failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 400; i++){
+    name[1] = '0' + i/64;
+    name[2] = '0' + i%64;
+    if(unlink(name) != 0){
+      printf(1, "indexdir final unlink failed\n");
+      exit();
+    }
+  }
+  if(unlink("f") != 0 || chdir("..") != 0 || unlink("idx") != 0){
+    printf(1, "indexdir cleanup failed\n");
+    exit();
+  }
+  printf(1, "indexdir ok\n");
+}
+
 void
 subdir(void)
 {
@@ -1347,7 +1418,7 @@ iref(void)
 
   printf(1, "empty file name\n");
 
-  // the 50 is NINODE
+  // the 50 was the old fixed NINODE
   for(i = 0; i < 50 + 1; i++){
     if(mkdir("irefd") != 0){
       printf(1, "mkdir irefd failed\n");
@@ -1411,6 +1482,101 @@ forktest(void)
   printf(1, "fork test OK\n");
 }
 
+// fork shares memory copy-on-write; writes by the child,
+// from user code or by the kernel on its behalf, must not
+// show up in the parent.
+void
+cowtest(void)
+{
+  int fds[2], i, pid, sz;
+  char *p;
+
+  printf(stdout, "cow test\n");
+  sz = 64*4096;
+  p = sbrk(sz);
+  if(p == (char*)-1){
+    printf(stdout, "cow sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < sz; i += 4096)
+    p[i] = 'a';
+  if(pipe(fds) != 0){
+    printf(stdout, "cow pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "cow fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // the kernel writes into a still-shared page
+    if(read(fds[0], p+1, 1) != 1 || p[1] != 'x'){
+      printf(stdout, "cow child read failed\n");
+      exit();
+    }
+    for(i = 0; i < sz; i += 4096){
+      if(p[i] != 'a'){
+        printf(stdout, "cow child saw wrong data\n");
+        exit();
+      }
+      p[i] = 'b';
+    }
+    exit();
+  }
+  p[1] = 'y';
+  write(fds[1], "x", 1);
+  wait();
+  close(fds[0]);
+  close(fds[1]);
+  for(i = 0; i < sz; i += 4096){
+    if(p[i] != 'a'){
+      printf(stdout, "cow parent saw child's write\n");
+      exit();
+    }
+  }
+  if(p[1] != 'y'){
+    printf(stdout, "cow parent saw child's read\n");
+    exit();
+  }
+  sbrk(-sz);
+  printf(stdout, "cow ok\n");
+}
+
+// sbrk only reserves address space; pages appear on first
+// touch, including when the kernel is the one touching them.
+void
+lazytest(void)
+{
+  int fds[2], sz;
+  char *p;
+
+  printf(stdout, "lazy test\n");
+  sz = 1024*4096;
+  p = sbrk(sz);
+  if(p == (char*)-1){
+    printf(stdout, "lazy sbrk failed\n");
+    exit();
+  }
+  if(p[sz/2] != 0 || p[sz-1] != 0){
+    printf(stdout, "lazy page not zero\n");
+    exit();
+  }
+  if(pipe(fds) != 0){
+    printf(stdout, "lazy pipe failed\n");
+    exit();
+  }
+  write(fds[1], "z", 1);
+  if(read(fds[0], p+sz/4, 1) != 1 || p[sz/4] != 'z'){
+    printf(stdout, "lazy read into untouched page failed\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  sbrk(-sz);
+  printf(stdout, "lazy ok\n");
+}
+
 void
 sbrktest(void)
 {
@@ -1768,6 +1934,8 @@ main(int argc, char *argv[])
   bigargtest();
   bsstest();
   sbrktest();
+  lazytest();
+  cowtest();
   validatetest();
 
   opentest();
@@ -1794,6 +1962,7 @@ main(int argc, char *argv[])
   iref();
   forktest();
   bigdir(); // slow
+  indexdir();
 
   uio();
 
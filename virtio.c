@@ -0,0 +1,238 @@
+// Driver for a virtio-blk disk on the PCI bus.
+//
+// If QEMU gives the file system disk to a virtio-blk device
+// (make qemu VIRTIO=1), it takes the place of IDE disk 1:
+// iderw() and iderwv() hand ROOTDEV's bufs to virtiorw().
+//
+// Unlike the IDE disk, the device takes many requests at once.
+// Each buf becomes a chain of three descriptors, header, data
+// and status, in the one virtqueue; virtiorw() makes a whole
+// batch of them available before notifying the device once, and
+// virtiointr() completes every request the device has finished
+// since the last interrupt.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "sleeplock.h"
+#include "x86.h"
+#include "fs.h"
+#include "buf.h"
+#include "pci.h"
+#include "virtio.h"
+
+#define NVDESC 256  // largest queue we will drive
+
+static struct {
+  struct spinlock lock;
+  ushort base;              // I/O registers
+  int ndesc;                // queue size, set by the device
+  struct vring_desc *desc;
+  struct vring_avail *avail;
+  struct vring_used *used;
+  ushort usedidx;           // next used entry to look at
+  uchar free[NVDESC];       // is desc[i] free?
+  int nfree;
+
+  // For each request, by the index of its first descriptor.
+  struct {
+    struct virtio_blk_req hdr;
+    uchar status;
+    struct buf *b;
+  } req[NVDESC];
+} vdisk;
+
+int virtioirq;  // the disk's IRQ, or 0 if there is no virtio disk
+
+// Look for a virtio-blk device and set it up.
+void
+virtioinit(void)
+{
+  struct pcidev pd;
+  uint sz;
+  int order;
+  char *p;
+
+  if(pcifind(VIRTIO_VENDOR, VIRTIO_DEV_BLK, 0, 0, &pd) < 0 ||
+     (pd.bar[0] & PCI_BAR_IO) == 0)
+    return;
+  initlock(&vdisk.lock, "virtio");
+  pciwrite(&pd, PCI_COMMAND,
+           pciread(&pd, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+  vdisk.base = pd.bar[0] & PCI_BAR_IOMASK;
+
+  outb(vdisk.base + VIRTIO_STATUS, 0);  // reset
+  outb(vdisk.base + VIRTIO_STATUS, VIRTIO_STAT_ACK);
+  outb(vdisk.base + VIRTIO_STATUS, VIRTIO_STAT_ACK | VIRTIO_STAT_DRIVER);
+  inl(vdisk.base + VIRTIO_HOST_FEATURES);
+  outl(vdisk.base + VIRTIO_GUEST_FEATURES, 0);
+
+  // Queue 0, in physically contiguous memory laid out as the
+  // device expects: descriptors and available ring, then the
+  // used ring on a page boundary.
+  outw(vdisk.base + VIRTIO_QUEUE_SEL, 0);
+  vdisk.ndesc = inw(vdisk.base + VIRTIO_QUEUE_SIZE);
+  if(vdisk.ndesc == 0 || vdisk.ndesc > NVDESC)
+    goto fail;
+  sz = PGROUNDUP(sizeof(struct vring_desc)*vdisk.ndesc +
+                 sizeof(struct vring_avail) + sizeof(ushort)*(vdisk.ndesc+1));
+  sz += PGROUNDUP(sizeof(struct vring_used) +
+                  sizeof(struct vring_used_elem)*vdisk.ndesc + sizeof(ushort));
+  for(order = 0; (PGSIZE << order) < sz; order++)
+    ;
+  if((p = buddyalloc(order)) == 0)
+    goto fail;
+  memset(p, 0, PGSIZE << order);
+  vdisk.desc = (struct vring_desc*)p;
+  vdisk.avail = (struct vring_avail*)(p + sizeof(struct vring_desc)*vdisk.ndesc);
+  vdisk.used = (struct vring_used*)(p + PGROUNDUP(sizeof(struct vring_desc)*vdisk.ndesc +
+                 sizeof(struct vring_avail) + sizeof(ushort)*(vdisk.ndesc+1)));
+  outl(vdisk.base + VIRTIO_QUEUE_PFN, V2P(p) >> 12);
+  memset(vdisk.free, 1, vdisk.ndesc);
+  vdisk.nfree = vdisk.ndesc;
+
+  outb(vdisk.base + VIRTIO_STATUS,
+       VIRTIO_STAT_ACK | VIRTIO_STAT_DRIVER | VIRTIO_STAT_DRIVER_OK);
+  virtioirq = pd.irq;
+  ioapicenable(virtioirq, ncpu - 1);
+  cprintf("virtio: disk with %d sectors, queue of %d\n",
+          inl(vdisk.base + VIRTIO_BLK_CAPACITY), vdisk.ndesc);
+  return;
+
+fail:
+  outb(vdisk.base + VIRTIO_STATUS, VIRTIO_STAT_FAILED);
+}
+
+// Take a free descriptor.  Caller must hold vdisk.lock
+// and have checked vdisk.nfree.
+static int
+allocdesc(void)
+{
+  int i;
+
+  for(i = 0; i < vdisk.ndesc; i++){
+    if(vdisk.free[i]){
+      vdisk.free[i] = 0;
+      vdisk.nfree--;
+      return i;
+    }
+  }
+  panic("virtio: no descriptor");
+}
+
+// Free the chain of descriptors starting at i.
+static void
+freechain(int i)
+{
+  int flags;
+
+  for(;;){
+    flags = vdisk.desc[i].flags;
+    vdisk.free[i] = 1;
+    vdisk.nfree++;
+    if((flags & VRING_DESC_F_NEXT) == 0)
+      break;
+    i = vdisk.desc[i].next;
+  }
+}
+
+static void
+setdesc(int i, void *a, uint len, int flags, int next)
+{
+  vdisk.desc[i].addr = V2P(a);
+  vdisk.desc[i].addrhi = 0;
+  vdisk.desc[i].len = len;
+  vdisk.desc[i].flags = flags;
+  vdisk.desc[i].next = next;
+}
+
+// Sync n bufs with the disk, as iderwv() does, with all of
+// them in flight at once.  Bufs with B_ASYNC set are handed
+// to bdone() when they complete instead of being waited for.
+void
+virtiorw(struct buf **v, int n)
+{
+  struct buf *b;
+  int i, d0, d1, d2;
+
+  acquire(&vdisk.lock);
+  for(i = 0; i < n; i++){
+    b = v[i];
+    if(!holdingsleep(&b->lock))
+      panic("virtiorw: buf not locked");
+    if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("virtiorw: nothing to do");
+    if(b->blockno >= FSSIZE)
+      panic("virtiorw: blockno");
+
+    while(vdisk.nfree < 3){
+      // Let the device drain what we have given it so far.
+      outw(vdisk.base + VIRTIO_QUEUE_NOTIFY, 0);
+      sleep(&vdisk.free, &vdisk.lock);
+    }
+    iostart(b);
+    iocmd(b->dev);
+    d0 = allocdesc();
+    d1 = allocdesc();
+    d2 = allocdesc();
+    vdisk.req[d0].hdr.type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+    vdisk.req[d0].hdr.reserved = 0;
+    vdisk.req[d0].hdr.sector = b->blockno * (BSIZE / 512);
+    vdisk.req[d0].hdr.sectorhi = 0;
+    vdisk.req[d0].status = 0xff;
+    vdisk.req[d0].b = b;
+    setdesc(d0, &vdisk.req[d0].hdr, sizeof(vdisk.req[d0].hdr), VRING_DESC_F_NEXT, d1);
+    setdesc(d1, b->data, BSIZE,
+            VRING_DESC_F_NEXT | ((b->flags & B_DIRTY) ? 0 : VRING_DESC_F_WRITE), d2);
+    setdesc(d2, &vdisk.req[d0].status, 1, VRING_DESC_F_WRITE, 0);
+
+    vdisk.avail->ring[vdisk.avail->idx % vdisk.ndesc] = d0;
+    __sync_synchronize();
+    vdisk.avail->idx++;
+  }
+  __sync_synchronize();
+  outw(vdisk.base + VIRTIO_QUEUE_NOTIFY, 0);
+
+  for(i = 0; i < n; i++){
+    if(v[i]->flags & B_ASYNC)
+      continue;
+    while((v[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(v[i], &vdisk.lock);
+  }
+  release(&vdisk.lock);
+}
+
+// Interrupt handler: complete every finished request.
+void
+virtiointr(void)
+{
+  struct buf *b;
+  int d0;
+
+  acquire(&vdisk.lock);
+  inb(vdisk.base + VIRTIO_ISR);
+  while(vdisk.usedidx != vdisk.used->idx){
+    __sync_synchronize();
+    d0 = vdisk.used->ring[vdisk.usedidx % vdisk.ndesc].id;
+    b = vdisk.req[d0].b;
+    if(vdisk.req[d0].status != 0)
+      cprintf("virtio: error at block %d\n", b->blockno);
+    vdisk.req[d0].b = 0;
+    freechain(d0);
+    vdisk.usedidx++;
+
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    iodone(b);
+    if(b->flags & B_ASYNC)
+      bdone(b);
+    else
+      wakeup(b);
+  }
+  wakeup(&vdisk.free);
+  release(&vdisk.lock);
+}
@@ -0,0 +1,64 @@
+// Legacy virtio over PCI, as QEMU's virtio-blk-pci provides
+// with disable-modern=on.  See the virtio 0.9.5 specification.
+
+#define VIRTIO_VENDOR         0x1af4
+#define VIRTIO_DEV_BLK        0x1001
+
+// Registers, at an offset from the device's I/O BAR.
+#define VIRTIO_HOST_FEATURES  0x00
+#define VIRTIO_GUEST_FEATURES 0x04
+#define VIRTIO_QUEUE_PFN      0x08  // physical page of the queue
+#define VIRTIO_QUEUE_SIZE     0x0c
+#define VIRTIO_QUEUE_SEL      0x0e
+#define VIRTIO_QUEUE_NOTIFY   0x10
+#define VIRTIO_STATUS         0x12
+#define VIRTIO_ISR            0x13  // reading acknowledges
+#define VIRTIO_BLK_CAPACITY   0x14  // 64 bits, in sectors
+
+// Device status bits.
+#define VIRTIO_STAT_ACK       0x01
+#define VIRTIO_STAT_DRIVER    0x02
+#define VIRTIO_STAT_DRIVER_OK 0x04
+#define VIRTIO_STAT_FAILED    0x80
+
+// A virtqueue is a descriptor table, the ring of descriptor
+// chains the driver has made available, and, on the next page
+// boundary, the ring of chains the device has used.
+struct vring_desc {
+  uint addr;            // physical address, low 32 bits
+  uint addrhi;
+  uint len;
+  ushort flags;
+  ushort next;          // next descriptor if VRING_DESC_F_NEXT
+};
+
+#define VRING_DESC_F_NEXT  1
+#define VRING_DESC_F_WRITE 2  // device writes, rather than reads
+
+struct vring_avail {
+  ushort flags;
+  ushort idx;           // where the driver puts the next entry
+  ushort ring[];
+};
+
+struct vring_used_elem {
+  uint id;              // head of a completed chain
+  uint len;
+};
+
+struct vring_used {
+  ushort flags;
+  ushort idx;           // where the device puts the next entry
+  struct vring_used_elem ring[];
+};
+
+// A block request: this header, the data, then a status byte.
+struct virtio_blk_req {
+  uint type;
+  uint reserved;
+  uint sector;
+  uint sectorhi;
+};
+
+#define VIRTIO_BLK_T_IN   0  // read
+#define VIRTIO_BLK_T_OUT  1  // write
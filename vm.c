@@ -4,6 +4,7 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
 
@@ -311,39 +312,161 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child.  The pages themselves are shared
+// copy-on-write: writable pages become read-only and
+// PTE_COW in both page tables, and the first write from
+// either side takes a private copy (see pagefault).
+// pgdir must be the current page table.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
   pte_t *pte;
   uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+    // Skip heap pages that were never touched.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;
+    if(*pte & PTE_W)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
-    }
+    kref(P2V(pa));
   }
+  lcr3(V2P(pgdir));  // flush stale writable TLB entries
   return d;
 
 bad:
+  lcr3(V2P(pgdir));
   freevm(d);
   return 0;
 }
 
+// Give pgdir a private, writable copy of the copy-on-write
+// page containing va.  If no other page table still shares
+// the page, just make it writable again.
+// Return 0 on success, -1 if va is not a copy-on-write page
+// or memory is exhausted.
+static int
+cowcopy(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa;
+  char *mem;
+
+  if(va >= KERNBASE)
+    return -1;
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+    return -1;
+  if((*pte & PTE_P) == 0 || (*pte & PTE_COW) == 0)
+    return -1;
+  pa = PTE_ADDR(*pte);
+  if(krefcount(P2V(pa)) == 1){
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+  } else {
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+    kfree(P2V(pa));
+  }
+  // Drop the stale read-only TLB entry if pgdir is loaded.
+  if(myproc() && myproc()->pgdir == pgdir)
+    lcr3(V2P(pgdir));
+  return 0;
+}
+
+// Copy the page at va in pgdir now if it is copy-on-write,
+// so that the kernel can write to it without faulting.
+// Return 0 on success, -1 if memory is exhausted.
+static int
+cowbreak(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0 ||
+     (*pte & (PTE_P|PTE_COW)) != (PTE_P|PTE_COW))
+    return 0;
+  return cowcopy(pgdir, va);
+}
+
+// Map a zeroed page at va if it lies below sz but was
+// never allocated (see growproc).
+// Return 0 if va is mapped on return, -1 otherwise.
+static int
+lazyalloc(pde_t *pgdir, uint sz, uint va)
+{
+  pte_t *pte;
+  char *mem;
+
+  if(va >= sz || va >= KERNBASE)
+    return -1;
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P))
+    return 0;
+  if((mem = kalloc()) == 0){
+    cprintf("lazyalloc out of memory\n");
+    return -1;
+  }
+  memset(mem, 0, PGSIZE);
+  if(mappages(pgdir, (char*)va, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Handle a page fault by process p at address va with
+// the hardware error code err.  The fault may come from
+// user code or from the kernel accessing user memory.
+// Return 0 if the faulting access can be retried.
+int
+pagefault(struct proc *p, uint va, uint err)
+{
+  va = PGROUNDDOWN(va);
+  if((err & FEC_PR) == 0)
+    return lazyalloc(p->pgdir, p->sz, va);
+  if(err & FEC_WR)
+    return cowcopy(p->pgdir, va);
+  return -1;
+}
+
+// Map the not yet allocated pages of p covering [va, va+len),
+// which must lie below p->sz, before the kernel touches them,
+// and if write is set give p private copies of any of them
+// that are copy-on-write.  A page fault in the kernel cannot
+// fail gracefully, so the system call argument checks call
+// this instead: running out of memory fails the system call.
+// Return 0 on success, -1 if memory is exhausted.
+int
+uvmprefault(struct proc *p, uint va, uint len, int write)
+{
+  uint a, last;
+
+  if(len == 0)
+    return 0;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + len - 1);
+  for(;;){
+    if(lazyalloc(p->pgdir, p->sz, a) < 0)
+      return -1;
+    if(write && cowbreak(p->pgdir, a) < 0)
+      return -1;
+    if(a == last)
+      break;
+    a += PGSIZE;
+  }
+  return 0;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -352,7 +475,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -371,6 +494,12 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    // The writes below bypass the user PTE.
+    if(myproc() && myproc()->pgdir == pgdir &&
+       lazyalloc(pgdir, myproc()->sz, va0) < 0)
+      return -1;
+    if(cowbreak(pgdir, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;